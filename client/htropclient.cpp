@@ -38,6 +38,8 @@
 #include <iostream>
 #include <string>
 #include <list>
+#include <set>
+#include <algorithm>
 
 #include "polly/ScopDetection.h"
 #include "polly/LinkAllPasses.h"
@@ -72,6 +74,7 @@
 #include "../common/messageHelper.h"
 #include "../common/messageTypes.h"
 #include "../common/llvmHelper.h"
+#include "../common/stringHelper.h"
 
 #include <cxxabi.h>
 #include <fstream>
@@ -125,6 +128,7 @@ HTROPClient::~HTROPClient() {
     //Close the sockets
     shutdown(orch_sockfd, 2);
     shutdown(htrop_server_sockfd, 2);
+    delete codeGenEngine;
 
     //Delete all global objects allocated by libprotobuf.
     google::protobuf::ShutdownProtobufLibrary();
@@ -160,14 +164,45 @@ int HTROPClient::connectToHTROPServer() {
     return 0;
 }
 
+void HTROPClient::useInProcessCodeGen(std::string cacheDir, CodeGenOptions codeGenOptions) {
+    codeGenEngine = new CodeGenEngine(!cacheDir.empty(), false, 0, cacheDir, "", codeGenOptions);
+}
+
 //END ESTABLISH CONNECTIONS
 
 //BEGIN
 
 //Handle HTROP communication
 void HTROPClient::handleRequests() {
-    std::thread clientHTROPServerHandler(&HTROPClient::handleHTROPServerCommunicationWrapper, this);
-    clientHTROPServerHandler.detach();
+    if (codeGenEngine != NULL) {
+        std::thread inProcessCodeGen(&HTROPClient::handleInProcessCodeGen, this);
+        inProcessCodeGen.detach();
+        return;
+    }
+
+    if (scopAnalysisState != SCOP_ANALYSIS_NONE) {
+        //The module is already on the HTROP Server, use its kernels if the analysis succeeded
+        std::unique_lock < std::mutex > lock(scopAnalysisMutex);
+        scopAnalysisCV.wait(lock,[this] {
+                            return scopAnalysisState != SCOP_ANALYSIS_PENDING;});
+
+        if (scopAnalysisState == SCOP_ANALYSIS_RECEIVED) {
+            HTROP_PB::Message_RSRC codeGenMsgFromServer = scopAnalysisResult.codegen();
+            handleOclBinary(programMod, scopAnalysisBinary, &codeGenMsgFromServer);
+            free(scopAnalysisBinary);
+            scopAnalysisBinary = NULL;
+            processed = true;
+            return;
+        }
+        if (processed)
+            return;             //Disconnected
+    }
+
+    if (!communicationStarted) {
+        std::thread clientHTROPServerHandler(&HTROPClient::handleHTROPServerCommunicationWrapper, this);
+        clientHTROPServerHandler.detach();
+        communicationStarted = true;
+    }
     //Send the request to the server
     sendCodeGenReq();
 }
@@ -214,6 +249,16 @@ void HTROPClient::handleHTROPServerCommunication() {
             active = handleLLVMIRReq(handleReqMessage->getMessageBuffer(), handleReqMessage->getSize());
             break;
 
+        case RSP_SCOP_ANALYSIS:
+            active = handleScopAnalysis(handleReqMessage->getMessageBuffer(), handleReqMessage->getSize());
+            break;
+
+        case RSP_CODE_GEN_FAILED:
+            std::cout << "\nHTROP Server could not generate code, keeping original functions ...";
+            processed = true;
+            active = 0;
+            break;
+
         case -1:               // Disconnection / error
 
             if (handleReqMessage->getSize() == 0) {
@@ -222,7 +267,10 @@ void HTROPClient::handleHTROPServerCommunication() {
             else if (handleReqMessage->getSize() == -1) {
                 std::cout << "recv failed ...";
             }
+            // Do not wait for code that will never arrive.
+            processed = true;
             active = 0;
+            setScopAnalysisState(SCOP_ANALYSIS_FAILED);
             break;
 
         default:
@@ -316,180 +364,14 @@ void HTROPClient::exportToFile(std::string fileName) {
 }
 
 void HTROPClient::prepareIRForPolly() {
-    /*
-     *  -polly-canonicalize -polly-run-inliner \
-     *      -polly-detect -polly-scops \
-     *       -polly-dce -polly-opt-isl \
-     *      -polly-codegen -polly-parallel \
-     *      seidel-2d-no-dependency/out/seidel-2d.O0.ll \
-     *      | opt -O3 > seidel-2d-no-dependency/out/seidel-2d.openmp.dance.ll
-     */
-
-    // Build up all of the passes that we want to run on the module.
-    llvm::legacy::PassManager pm;
-    pm.add(polly::createPollyCanonicalizePass());
-    pm.run(*programMod);
+    htrop::prepareModuleForPolly(programMod, optimizeScopSchedule);
 }
 
-
-
-int HTROPClient::runScopDetection(Function *function){
-    llvm::legacy::FunctionPassManager ScopDetectPM(programMod);
-    htrop::ScopDetect * ScopDetectPass = static_cast < htrop::ScopDetect * >(htrop::createScopDetectPass(maxScopLoopDepth));
-    ScopDetectPM.add(ScopDetectPass);
-    
-    // NOTE:
-    // if we iterate over several functions then we would overwrite the results.
-    // The idea should be to loop over the given functions (analysisCandidates) 
-    // and try to match whatever we would like to detect.
-    
-    ScopDetectPass->clear();
-    ScopDetectPM.run(*function);
-    
-    //Assumption only one scop per function
-    if (ScopDetectPass->containsScop()) {
-        ScopDS *scopDS = new ScopDS();
-        
-        scopDS->scopFunction = ScopDetectPass->getScopFunction();
-        scopDS->scopFunctionParent = ScopDetectPass->getScopFunctionParent();
-        scopDS->scopFunctonArgs = ScopDetectPass->getScopFuncitonArgs();
-        scopDS->scopLoopInfo = ScopDetectPass->getScopLoopInfo();
-        
-        // Get accelerator affinity. 
-        // Run the scoring pass.
-        llvm::legacy::FunctionPassManager ScopScorePM(programMod);
-        htrop::AccScore * ScopScorePass = static_cast < htrop::AccScore * >(htrop::createScoringPass());
-        ScopScorePM.add(ScopScorePass);
-        ScopScorePM.run(*function);
-        
-        // Set accelerator affinity.
-        ResourceInfo LEG_Resource, MCPU_Resource, GPU_Resource, MIC_Resource;
-        
-        LEG_Resource.affinity = MCPU_Resource.affinity = GPU_Resource.affinity = MIC_Resource.affinity = 0;
-        LEG_Resource.codeGenTime = MCPU_Resource.codeGenTime = GPU_Resource.codeGenTime = MIC_Resource.codeGenTime = 0;
-        LEG_Resource.function = MCPU_Resource.function = GPU_Resource.function = MIC_Resource.function = NULL;
-        LEG_Resource.registrationFunction = MCPU_Resource.registrationFunction = GPU_Resource.registrationFunction = MIC_Resource.registrationFunction = NULL;
-        
-        scopDS->resources.insert(std::pair < DeviceType, ResourceInfo > (LEG, LEG_Resource));
-        scopDS->resources.insert(std::pair < DeviceType, ResourceInfo > (MCPU, MCPU_Resource));
-        scopDS->resources.insert(std::pair < DeviceType, ResourceInfo > (GPU, GPU_Resource));
-        scopDS->resources.insert(std::pair < DeviceType, ResourceInfo > (MIC, MIC_Resource));
-        
-        scopList.insert(std::pair < std::string, ScopDS * >(ScopDetectPass->getScopFunction()->getName(), scopDS));
-        scopFunctionParent = ScopDetectPass->getScopFunctionParent(); 
-        
-        scopDS->maxParalleizationDepth = ScopDetectPass->getMaxCodegenLoopDepth();
-        
-        #ifdef HTROP_DEBUG
-        std::cout << "\nHTROP INFO: Max codegen depth : " << scopDS->maxParalleizationDepth << "\n";
-        std::cout.flush();
-        #endif
-        
-        return 0;
-    }
-    return 1;
-}
-
-
-
 // Run pass to detect and analysescops in functions.
 //   This is the static part. 
 int HTROPClient::analyseScop() {
 
-    // Functions to analyse. 
-    std::list < llvm::Function * >analysisCandidates;
-    for (llvm::Module::iterator I = programMod->begin(); I != programMod->end(); I++) {
-        if (I->getName().str().find(CHECK_RESULTS_CPU) != std::string::npos) {
-            std::cout << "INFO: " << "Skipped SCoP analysis for: \"" << (*I).getName().str() << "\"\n";
-        }
-        else {
-            analysisCandidates.push_back(&(*I));
-        }
-    }
-
-    // Run the detection/analysis pass.
-    llvm::legacy::FunctionPassManager ScopDetectPM(programMod);
-
-    htrop::ScopDetect * ScopDetectPass = static_cast < htrop::ScopDetect * >(htrop::createScopDetectPass(maxScopLoopDepth));
-    ScopDetectPM.add(ScopDetectPass);
-
-    //Go through all the functions and detect scops
-    for (const auto & function:analysisCandidates) {
-        // NOTE:
-        // if we iterate over several functions then we would overwrite the results.
-        // The idea should be to loop over the given functions (analysisCandidates) 
-        // and try to match whatever we would like to detect.
-
-        int status = runScopDetection(function);
-    }
-    
-    //Search for multiple calls to the same scop
-    std::vector<std::string> seenScop;
-    struct RepeatedCalls{
-        Function *calledF;
-        CallInst *callInst;
-    };
-    std::vector<RepeatedCalls*> repeatedCalls;
-    
-    // Iterate over instructions of the scop parent
-    for (inst_iterator I = inst_begin(scopFunctionParent), E = inst_end(scopFunctionParent); I != E; ++I) {
-        // Look for calls.
-        if (isa < llvm::CallInst > (&*I)) {
-            llvm::CallInst * callInst = dyn_cast < llvm::CallInst > (&*I);
-            Function *calledF = callInst->getCalledFunction();
-            // Look for calls to functions.
-            if (calledF) {
-                // Does it point to a Scop?
-                std::map < std::string, ScopDS * >::iterator scopListIt;
-                scopListIt = scopList.find(calledF->getName());
-                
-                if (scopListIt != scopList.end()) {
-                    //Check if the scop has been called more than once
-                    if(std::find(seenScop.begin(), seenScop.end(), calledF->getName()) != seenScop.end()){
-                        auto repeatedCall =  new RepeatedCalls();
-                        repeatedCall->calledF = calledF;
-                        repeatedCall->callInst = callInst;
-                        repeatedCalls.push_back(repeatedCall);
-                    }
-                    else{
-                        seenScop.push_back(calledF->getName());
-                    }
-                }
-            }
-        }
-    }
-    
-    //clone the scop functions and replace the corresponding calls
-    int seq=1;
-    for(auto repeatedCall: repeatedCalls) {
-        
-        //Clone the scop function
-        llvm::ValueToValueMapTy VMap;
-        llvm::Function *newFn = llvm::CloneFunction(repeatedCall->calledF, VMap,
-                                                    /*ModuleLevelChanges=*/false);
-        newFn->setName(repeatedCall->calledF->getName().str() + std::to_string(seq++));
-        repeatedCall->calledF->getParent()->getFunctionList().push_back(newFn);
-        
-        //replace the call to the call to the new function
-        std::vector < Value * >newFn_params;
-        for (Use & U: repeatedCall->callInst->operands()) {
-            // Skip the Function declaration.
-            if (!isa < llvm::Function > (U)) {
-                newFn_params.push_back(U.get());
-            }
-        }
-        auto newCallInst = CallInst::Create(newFn, newFn_params, "", repeatedCall->callInst);
-        repeatedCall->callInst->eraseFromParent();
-       
-        //run scop analysis for the new function
-        int status = runScopDetection(newFn);
-    }
-    
-    #ifdef HTROP_SCOP_DEBUG
-    std::cout << "\nINFO : Updated the application.";
-    std::cout.flush();
-    #endif
-
+    scopFunctionParent = htrop::detectScops(programMod, maxScopLoopDepth, scopList);
 
 #ifdef HTROP_DEBUG
     std::cout << "\nHTROP INFO: No. of Scops detected : " << scopList.size();
@@ -501,6 +383,18 @@ int HTROPClient::analyseScop() {
     
 }
 
+void HTROPClient::useScopFusion(bool fuseScops) {
+    this->fuseScops = fuseScops;
+}
+
+void HTROPClient::useKernelTuningFile(std::string kernelTuningFile) {
+    this->kernelTuningFile = kernelTuningFile;
+}
+
+void HTROPClient::useScopScheduleOptimization(bool optimizeScopSchedule) {
+    this->optimizeScopSchedule = optimizeScopSchedule;
+}
+
 // Run pass to detect order and dependencies between calls to scops.
 //   This is the dynamic part. 
 int HTROPClient::analyseScopDependency() {
@@ -550,6 +444,10 @@ int HTROPClient::analyseScopDependency() {
     }
     
     flag_chain_interrupt = ScopDependencyPass->getFlagChainInterrupt();
+
+    if (fuseScops) {
+        scopFusionList = htrop::findScopFusions(programMod, scopList, scopCallList);
+    }
 }
 
 int HTROPClient::startAppExecutionSequential() {
@@ -602,34 +500,7 @@ int HTROPClient::sendCodeGenReq() {
 #endif
 
     HTROP_PB::Message_RCRS codeGenMsgToServer;
-
-    codeGenMsgToServer.set_scopfunctionparentname(scopFunctionParent->getName().str());
-
-    // Debug flag to enable hand tuning, if automated detection is not sufficient.
-    //   Call stub for automated code tuner.
-    int debug_hand_tune_pos = 0;
-
-    for (auto scop:scopList) {
-        //NOTE do we check against a static threshold  here?
-
-        HTROP_PB::Message_RCRS::ScopInfo * scopInfo = codeGenMsgToServer.add_scoplist();
-        scopInfo->set_scopfunctionname(scop.second->scopFunction->getName().str());
-        // Use automatic detection of independent loops to parallelize.
-        if(maxCogeGenLoopDepth.size() == 0) {
-            scopInfo->set_max_codegen_loop_depth(scop.second->maxParalleizationDepth);
-        } 
-        // Use user provided flag to hand tune.
-        else if(maxCogeGenLoopDepth.size() == 1) {
-            scopInfo->set_max_codegen_loop_depth(maxCogeGenLoopDepth[0]);
-        } else {
-            // Reuse last to prevent overflow.
-            if((maxCogeGenLoopDepth.size()-1) == debug_hand_tune_pos) {
-                scopInfo->set_max_codegen_loop_depth(maxCogeGenLoopDepth[debug_hand_tune_pos]);
-            } else {
-                scopInfo->set_max_codegen_loop_depth(maxCogeGenLoopDepth[debug_hand_tune_pos++]);
-            }
-        }
-    }
+    buildCodeGenReq(&codeGenMsgToServer);
 
     std::string msgBuffer = codeGenMsgToServer.SerializeAsString();
 
@@ -650,6 +521,13 @@ int HTROPClient::sendCodeGenReq() {
     return 1;
 }
 
+//Describe the scops and the requested parallelization depth
+void HTROPClient::buildCodeGenReq(HTROP_PB::Message_RCRS * codeGenMsgToServer) {
+
+    htrop::addScopsToCodeGenReq(codeGenMsgToServer, scopList, scopFunctionParent, maxCogeGenLoopDepth);
+    codeGenMsgToServer->set_module_hash(hashString(exportScopFunctions()));
+}
+
 //Recieve the compiled binary from the HTROP Server
 int HTROPClient::handleCompiledBinary(const char *recvMessageBuffer, int messageSize) {
 
@@ -718,6 +596,12 @@ bool HTROPClient::finished() {
 
 llvm::Value * HTROPClient::resolveScopValue(ScopFnArg * scopArg, std::vector < ScopFnArg * >*scopFunctonArgs, llvm::BasicBlock ** start_block, llvm::BasicBlock * label_lpad, llvm::Function * function,
                                             llvm::Module * &programMod) {
+    return resolveScopExpression(scopArg->dimension_maxStr[0], scopFunctonArgs, start_block, label_lpad, function, programMod);
+}
+
+//Evaluates a formula of the scop analysis (i.e. "-1 + n") with the integer arguments of the function at runtime
+llvm::Value * HTROPClient::resolveScopExpression(std::string formula, std::vector < ScopFnArg * >*scopFunctonArgs, llvm::BasicBlock ** start_block, llvm::BasicBlock * label_lpad,
+                                                 llvm::Function * function, llvm::Module * &programMod) {
 
     Function *func_replaceWithValue = programMod->getFunction("replaceWithValue");
     Function *func_evaluateExpression = programMod->getFunction("evaluateExpression");
@@ -725,7 +609,7 @@ llvm::Value * HTROPClient::resolveScopValue(ScopFnArg * scopArg, std::vector < S
     assert(func_replaceWithValue != nullptr && func_evaluateExpression != nullptr);
 
     //Get the scop string to evaluate
-    AllocaInst *scop_formulaStr = createLlvmString(scopArg->dimension_maxStr[0], start_block, label_lpad, function, programMod);
+    AllocaInst *scop_formulaStr = createLlvmString(formula, start_block, label_lpad, function, programMod);
 
     //At this point we have the string
 
@@ -870,23 +754,31 @@ Function *HTROPClient::resolveKernelArgFunction(ScopFnArg * scopArg) {
 }
 
 void HTROPClient::createLocalAndGlobalWorkGroups(const HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopServerInfo, BasicBlock * insertCallIntoBlock, int blockSizeDim0, int blockSizeDim1,
-                                                 Value ** ptr_arraydecay, Value ** ptr_arraydecay_local) {
+                                                 Value * deviceType, Value * kernelName, std::vector < Value * >&loopTripCounts, Value ** ptr_arraydecay, Value ** ptr_arraydecay_local) {
 
     ConstantInt *const_int64_0 = ConstantInt::get(*context, APInt(DATA_WIDTH, StringRef("0"), 10));
     ConstantInt *const_int64_1 = ConstantInt::get(*context, APInt(DATA_WIDTH, StringRef("1"), 10));
     ConstantInt *const_int64_block_size_0 = ConstantInt::get(*context, APInt(DATA_WIDTH, blockSizeDim0, 10));
     ConstantInt *const_int64_block_size_1 = ConstantInt::get(*context, APInt(DATA_WIDTH, blockSizeDim1, 10));
-    PointerType *PointerTy_64_0 = PointerType::get(IntegerType::get(*context, DATA_WIDTH), 0);
 
     assert(scopServerInfo->workgroup_arg_index_size() > 0);
     ArrayType *workgroupSize = ArrayType::get(IntegerType::get(*context, DATA_WIDTH), scopServerInfo->workgroup_arg_index_size());
     AllocaInst *ptr_global_work_size = new AllocaInst(workgroupSize, "global_work_size", insertCallIntoBlock);
 
-    //Local Group size
+    //Local Group size, a work-group size required by the kernel overrides the user's block size.
+    //Without both the runtime picks the size for the device (0).
     AllocaInst *ptr_local_work_size;
-
-    if (blockSizeDim0)
-        ptr_local_work_size = new AllocaInst(workgroupSize, "local_work_size", insertCallIntoBlock);
+    bool isLocalSizeRequired = scopServerInfo->local_work_size_size() > 0;
+
+    //Per dimension, the dimensions after the first use the block size of dimension 1
+    std::vector < ConstantInt * >const_int64_block_sizes;
+    for (int dim = 0; dim < scopServerInfo->workgroup_arg_index_size(); dim++) {
+        if (isLocalSizeRequired)
+            const_int64_block_sizes.push_back(ConstantInt::get(*context, APInt(DATA_WIDTH, scopServerInfo->local_work_size(std::min(dim, scopServerInfo->local_work_size_size() - 1)), 10)));
+        else
+            const_int64_block_sizes.push_back(dim == 0 ? const_int64_block_size_0 : const_int64_block_size_1);
+    }
+    ptr_local_work_size = new AllocaInst(workgroupSize, "local_work_size", insertCallIntoBlock);
 
     Instruction *arrayPtr;
     Instruction *arrayPtrLocal;
@@ -903,32 +795,48 @@ void HTROPClient::createLocalAndGlobalWorkGroups(const HTROP_PB::Message_RSRC::S
             arrayPtr = ptr_arrayinit_begin;
 
             //local
-            Instruction *ptr_arrayinit_begin_local;
-
-            if (blockSizeDim0) {
-                ptr_arrayinit_begin_local =
-                    GetElementPtrInst::Create(cast < PointerType > (ptr_local_work_size->getType()->getScalarType())->getElementType(), ptr_local_work_size, ptr_arrayinit_begin_indices,
-                                              "arrayinit.begin.local", insertCallIntoBlock);
-                arrayPtrLocal = ptr_arrayinit_begin_local;
-                StoreInst *storetmp = new StoreInst(const_int64_block_size_0, arrayPtrLocal, false, insertCallIntoBlock);
-            }
+            Instruction *ptr_arrayinit_begin_local =
+                GetElementPtrInst::Create(cast < PointerType > (ptr_local_work_size->getType()->getScalarType())->getElementType(), ptr_local_work_size, ptr_arrayinit_begin_indices,
+                                          "arrayinit.begin.local", insertCallIntoBlock);
+            arrayPtrLocal = ptr_arrayinit_begin_local;
+            StoreInst *storetmp = new StoreInst(const_int64_block_sizes[parmsProcessed], arrayPtrLocal, false, insertCallIntoBlock);
         }
         else {
             arrayPtr = GetElementPtrInst::Create(cast < PointerType > (arrayPtr->getType()->getScalarType())->getElementType(), arrayPtr, const_int64_1, "arrayinit.element", insertCallIntoBlock);
-            if (blockSizeDim0) {
-                arrayPtrLocal =
-                    GetElementPtrInst::Create(cast < PointerType > (arrayPtrLocal->getType()->getScalarType())->getElementType(), arrayPtrLocal, const_int64_1, "arrayinit.element.local",
-                                              insertCallIntoBlock);
-                StoreInst *storetmp = new StoreInst(const_int64_block_size_1, arrayPtrLocal, false, insertCallIntoBlock);
-            }
+            arrayPtrLocal =
+                GetElementPtrInst::Create(cast < PointerType > (arrayPtrLocal->getType()->getScalarType())->getElementType(), arrayPtrLocal, const_int64_1, "arrayinit.element.local",
+                                          insertCallIntoBlock);
+            StoreInst *storetmp = new StoreInst(const_int64_block_sizes[parmsProcessed], arrayPtrLocal, false, insertCallIntoBlock);
         }
 
         Value *sizeParam;
 
         if (parmsProcessed < scopServerInfo->workgroup_arg_index_size()) {
-            Value *int64_conv = getArg(insertCallIntoBlock->getParent(), scopServerInfo->workgroup_arg_index(parmsProcessed));
+            //The trip count of the loop if it is not bounded by an argument
+            if (scopServerInfo->workgroup_arg_index(parmsProcessed) < 0) {
+                sizeParam = loopTripCounts[parmsProcessed];
+            }
+            else {
+                Value *int64_conv = getArg(insertCallIntoBlock->getParent(), scopServerInfo->workgroup_arg_index(parmsProcessed));
+
+                sizeParam = castTo64(int64_conv, insertCallIntoBlock);
+            }
 
-            sizeParam = castTo64(int64_conv, insertCallIntoBlock);
+            //Register blocked and vectorized dimensions need fewer work-items, the factor depends on the device that runs the kernel
+            std::vector < HTROP_PB::Message_RSRC::WorkItemFactor > workItemFactors(scopServerInfo->register_block().begin(), scopServerInfo->register_block().end());
+            workItemFactors.insert(workItemFactors.end(), scopServerInfo->vector_width().begin(), scopServerInfo->vector_width().end());
+            workItemFactors.insert(workItemFactors.end(), scopServerInfo->coarsening().begin(), scopServerInfo->coarsening().end());
+            for (auto workItemFactor:workItemFactors) {
+                if ((int)workItemFactor.dimension() != parmsProcessed)
+                    continue;
+                std::vector < Value * >func_scaleWorkSize_params;
+                func_scaleWorkSize_params.push_back(deviceType);
+                func_scaleWorkSize_params.push_back(sizeParam);
+                func_scaleWorkSize_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), workItemFactor.factor_mcpu()));
+                func_scaleWorkSize_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), workItemFactor.factor_gpu()));
+                func_scaleWorkSize_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), workItemFactor.factor_mic()));
+                sizeParam = CallInst::Create(programMod->getFunction("scaleWorkSize"), func_scaleWorkSize_params, "global_work_size_scaled", insertCallIntoBlock);
+            }
         }
         else {
             sizeParam = const_int64_1;
@@ -943,13 +851,210 @@ void HTROPClient::createLocalAndGlobalWorkGroups(const HTROP_PB::Message_RSRC::S
         GetElementPtrInst::Create(cast < PointerType > (ptr_global_work_size->getType()->getScalarType())->getElementType(), ptr_global_work_size, ptr_arraydecay_indices, "arraydecay",
                                   insertCallIntoBlock);
 
-    if (blockSizeDim0)
-        *ptr_arraydecay_local =
-            GetElementPtrInst::Create(cast < PointerType > (ptr_local_work_size->getType()->getScalarType())->getElementType(), ptr_local_work_size, ptr_arraydecay_indices, "arraydecaylocal",
-                                      insertCallIntoBlock);
-    else
-        *ptr_arraydecay_local = ConstantPointerNull::get(PointerTy_64_0);
+    *ptr_arraydecay_local =
+        GetElementPtrInst::Create(cast < PointerType > (ptr_local_work_size->getType()->getScalarType())->getElementType(), ptr_local_work_size, ptr_arraydecay_indices, "arraydecaylocal",
+                                  insertCallIntoBlock);
+
+    //Pick the missing local sizes for the device and kernel, round the global sizes up to whole work-groups.
+    //The kernels skip the additional work-items.
+    std::vector < Value * >func_fitWorkGroupSize_params;
+    func_fitWorkGroupSize_params.push_back(deviceType);
+    func_fitWorkGroupSize_params.push_back(kernelName);
+    func_fitWorkGroupSize_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), scopServerInfo->workgroup_arg_index_size()));
+    func_fitWorkGroupSize_params.push_back(*ptr_arraydecay);
+    func_fitWorkGroupSize_params.push_back(*ptr_arraydecay_local);
+    CallInst::Create(programMod->getFunction("fitWorkGroupSize"), func_fitWorkGroupSize_params, "", insertCallIntoBlock);
+}
+
+//Set the arguments of a kernel of the scop and run it, the calls are appended to launchBlock
+void HTROPClient::createKernelLaunch(const HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * kernelInfo, ScopDS * scop, std::vector < Value * >&kernelArgs, BasicBlock * launchBlock,
+                                     Value * deviceType, BasicBlock ** start_block, BasicBlock * label_lpad) {
+    Function *function = launchBlock->getParent();
+
+    //create the kernelname string
+    AllocaInst *scop_KernelNameStr = createLlvmString(kernelInfo->scopoclkernelname(), start_block, label_lpad, function, programMod);
+
+    //The interior kernel of an index-set split takes the same arguments
+    std::vector < AllocaInst * >argKernelNameStrs = { scop_KernelNameStr };
+    if (kernelInfo->has_interior_kernel()) {
+        argKernelNameStrs.push_back(createLlvmString(kernelInfo->interior_kernel().scopoclkernelname(), start_block, label_lpad, function, programMod));
+    }
+
+    for (AllocaInst * argKernelNameStr:argKernelNameStrs) {
+        int scopFnParamId = 0;
+        for (ScopFnArg * scopArg:scop->scopFunctonArgs) {
+            Function *func_setKernelArg = resolveKernelArgFunction(scopArg);
+
+            std::vector < Value * >func_setKernelArg_params;
+            func_setKernelArg_params.push_back(deviceType);
+            func_setKernelArg_params.push_back(argKernelNameStr);
+            ConstantInt *const_int_kernel_pos = ConstantInt::get(*context, APInt(32, StringRef(std::to_string(scopFnParamId)), 10));
+
+            func_setKernelArg_params.push_back(const_int_kernel_pos);
+            func_setKernelArg_params.push_back(kernelArgs[scopFnParamId]);
+
+            CallInst::Create(func_setKernelArg, func_setKernelArg_params, "", launchBlock);
+
+            scopFnParamId++;
+        }
+    }
+
+    //Trip counts of the loops that are not bounded by an argument, the loop counters of the scop analysis start at 0
+    std::vector < Value * >loopTripCounts(kernelInfo->workgroup_arg_index_size(), NULL);
+    for (int dim = 0; dim < kernelInfo->workgroup_arg_index_size(); dim++) {
+        if (kernelInfo->workgroup_arg_index(dim) >= 0)
+            continue;
+        assert(dim < kernelInfo->workgroup_loop_index_size() && kernelInfo->workgroup_loop_index(dim) < (int)scop->scopLoopInfo.size());
+        std::string tripCountStr = "(" + scop->scopLoopInfo[kernelInfo->workgroup_loop_index(dim)]->maxValueStr + ") + 1";
+        loopTripCounts[dim] = resolveScopExpression(tripCountStr, &scop->scopFunctonArgs, start_block, label_lpad, function, programMod);
+    }
+
+    //A wavefront kernel takes the iteration space of its two loops, the runtime launches and sizes the waves
+    if (kernelInfo->wavefront_skew() > 0) {
+        std::vector < Value * >func_executeOCLWavefronts_params;
+        func_executeOCLWavefronts_params.push_back(deviceType);
+        func_executeOCLWavefronts_params.push_back(scop_KernelNameStr);
+        func_executeOCLWavefronts_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), kernelInfo->wavefront_skew()));
+        for (int dim = 0; dim < 2; dim++) {
+            if (kernelInfo->workgroup_arg_index(dim) < 0)
+                func_executeOCLWavefronts_params.push_back(loopTripCounts[dim]);
+            else
+                func_executeOCLWavefronts_params.push_back(castTo64(getArg(function, kernelInfo->workgroup_arg_index(dim)), launchBlock));
+        }
+
+#if MEASURE
+        CallInst::Create(programMod->getFunction("startTimeStamp"), "", launchBlock);
+#endif
+        CallInst::Create(programMod->getFunction("executeOCLWavefronts"), func_executeOCLWavefronts_params, "", launchBlock);
+#if MEASURE
+        CallInst::Create(programMod->getFunction("kernelExecutionTimeStamp"), "", launchBlock);
+#endif
+        return;
+    }
+
+    //An index-set split passes the exact sizes and the border widths, the runtime launches the interior and border kernel
+    if (kernelInfo->has_interior_kernel()) {
+        const HTROP_PB::Message_RSRC::ScopFunctionOCLInfo & interiorInfo = kernelInfo->interior_kernel();
+        int dimension = kernelInfo->workgroup_arg_index_size();
+        ArrayType *sizesType = ArrayType::get(IntegerType::get(*context, DATA_WIDTH), dimension);
+        ArrayType *bordersType = ArrayType::get(IntegerType::get(*context, 32), dimension);
+        AllocaInst *ptr_split_size = new AllocaInst(sizesType, "split_size", launchBlock);
+        AllocaInst *ptr_border_low = new AllocaInst(bordersType, "border_low", launchBlock);
+        AllocaInst *ptr_border_high = new AllocaInst(bordersType, "border_high", launchBlock);
+
+        std::vector < Value * >func_executeOCLSplitKernel_params;
+        func_executeOCLSplitKernel_params.push_back(deviceType);
+        func_executeOCLSplitKernel_params.push_back(scop_KernelNameStr);
+        func_executeOCLSplitKernel_params.push_back(argKernelNameStrs[1]);
+        func_executeOCLSplitKernel_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), dimension));
+        for (int dim = 0; dim < dimension; dim++) {
+            std::vector < Value * >indices;
+            indices.push_back(ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), 0));
+            indices.push_back(ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), dim));
+
+            Value *sizeParam = loopTripCounts[dim];
+            if (kernelInfo->workgroup_arg_index(dim) >= 0)
+                sizeParam = castTo64(getArg(function, kernelInfo->workgroup_arg_index(dim)), launchBlock);
+            new StoreInst(sizeParam, GetElementPtrInst::Create(sizesType, ptr_split_size, indices, "split_size.element", launchBlock), false, launchBlock);
+            new StoreInst(ConstantInt::get(IntegerType::get(*context, 32), interiorInfo.border_low(dim)),
+                          GetElementPtrInst::Create(bordersType, ptr_border_low, indices, "border_low.element", launchBlock), false, launchBlock);
+            new StoreInst(ConstantInt::get(IntegerType::get(*context, 32), interiorInfo.border_high(dim)),
+                          GetElementPtrInst::Create(bordersType, ptr_border_high, indices, "border_high.element", launchBlock), false, launchBlock);
+        }
+
+        //The runtime takes pointers to the first elements
+        std::vector < Value * >decay_indices(2, ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), 0));
+        func_executeOCLSplitKernel_params.push_back(GetElementPtrInst::Create(sizesType, ptr_split_size, decay_indices, "split_size.decay", launchBlock));
+        func_executeOCLSplitKernel_params.push_back(GetElementPtrInst::Create(bordersType, ptr_border_low, decay_indices, "border_low.decay", launchBlock));
+        func_executeOCLSplitKernel_params.push_back(GetElementPtrInst::Create(bordersType, ptr_border_high, decay_indices, "border_high.decay", launchBlock));
+
+#if MEASURE
+        CallInst::Create(programMod->getFunction("startTimeStamp"), "", launchBlock);
+#endif
+        CallInst::Create(programMod->getFunction("executeOCLSplitKernel"), func_executeOCLSplitKernel_params, "", launchBlock);
+#if MEASURE
+        CallInst::Create(programMod->getFunction("kernelExecutionTimeStamp"), "", launchBlock);
+#endif
+        return;
+    }
+
+    //Create the array
+    BasicBlock *insertCallIntoBlock = launchBlock;
+    Value *ptr_arraydecay_global;
+    Value *ptr_arraydecay_local;
+
+    createLocalAndGlobalWorkGroups(kernelInfo, insertCallIntoBlock, blockSizeDim0, blockSizeDim1, deviceType, scop_KernelNameStr, loopTripCounts, &ptr_arraydecay_global,
+                                   &ptr_arraydecay_local);
+
+    //The work-groups of a reduction write partial results, they are combined into the accumulator after the kernel
+    if (kernelInfo->has_reduction()) {
+        std::vector < Value * >func_prepareReduction_params;
+        func_prepareReduction_params.push_back(deviceType);
+        func_prepareReduction_params.push_back(scop_KernelNameStr);
+        func_prepareReduction_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), kernelInfo->reduction().partial_arg_position()));
+        func_prepareReduction_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), kernelInfo->reduction().data_type_size()));
+        func_prepareReduction_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), kernelInfo->workgroup_arg_index_size()));
+        func_prepareReduction_params.push_back(ptr_arraydecay_global);
+        func_prepareReduction_params.push_back(ptr_arraydecay_local);
+        CallInst::Create(programMod->getFunction("prepareReduction"), func_prepareReduction_params, "", insertCallIntoBlock);
+    }
+
+#if MEASURE
+    CallInst::Create(programMod->getFunction("startTimeStamp"), "", insertCallIntoBlock);
+#endif
+
+    std::vector < Value * >func_executeOCLKernel_params;
+    func_executeOCLKernel_params.push_back(deviceType);
+    func_executeOCLKernel_params.push_back(scop_KernelNameStr);
+    func_executeOCLKernel_params.push_back(ConstantInt::get(*context, APInt(32, StringRef(std::to_string(kernelInfo->workgroup_arg_index_size())), 10)));
+    func_executeOCLKernel_params.push_back(ptr_arraydecay_global);
+    func_executeOCLKernel_params.push_back(ptr_arraydecay_local);
+    CallInst::Create(programMod->getFunction("executeOCLKernel"), func_executeOCLKernel_params, "", insertCallIntoBlock);
+
+    if (kernelInfo->has_reduction()) {
+        CastInst *castAccumulator = new BitCastInst(getArg(function, kernelInfo->reduction().arg_position()), PointerType::get(IntegerType::get(*context, 8), 0), "", insertCallIntoBlock);
+
+        std::vector < Value * >func_finishReduction_params;
+        func_finishReduction_params.push_back(deviceType);
+        func_finishReduction_params.push_back(scop_KernelNameStr);
+        func_finishReduction_params.push_back(castAccumulator);
+        func_finishReduction_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), kernelInfo->reduction().reduction_operator()));
+        func_finishReduction_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), kernelInfo->reduction().is_float()));
+        func_finishReduction_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), kernelInfo->reduction().data_type_size()));
+        CallInst::Create(programMod->getFunction("finishReduction"), func_finishReduction_params, "", insertCallIntoBlock);
+    }
+
+#if MEASURE
+    CallInst::Create(programMod->getFunction("kernelExecutionTimeStamp"), "", insertCallIntoBlock);
+#endif
+
+    //The kernels of the other loop chains of a distributed nest follow in order
+    for (const auto & distributedKernel:kernelInfo->distributed_kernels()) {
+        createKernelLaunch(&distributedKernel, scop, kernelArgs, launchBlock, deviceType, start_block, label_lpad);
+    }
+}
+
+//Product of the global sizes of the kernel before the work-item factors, the same bounds select the NDRange.
+//globalSizes gets the size of each dimension.
+Value *HTROPClient::createWorkItemCount(const HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * kernelInfo, ScopDS * scop, BasicBlock * insertBlock, BasicBlock ** start_block,
+                                        BasicBlock * label_lpad, std::vector < Value * >&globalSizes) {
+    Function *function = insertBlock->getParent();
+    Value *workItems = ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), 1);
+
+    for (int dim = 0; dim < kernelInfo->workgroup_arg_index_size(); dim++) {
+        Value *size;
+        if (kernelInfo->workgroup_arg_index(dim) >= 0) {
+            size = castTo64(getArg(function, kernelInfo->workgroup_arg_index(dim)), insertBlock);
+        }
+        else {
+            std::string tripCountStr = "(" + scop->scopLoopInfo[kernelInfo->workgroup_loop_index(dim)]->maxValueStr + ") + 1";
+            size = resolveScopExpression(tripCountStr, &scop->scopFunctonArgs, start_block, label_lpad, function, programMod);
+        }
+        globalSizes.push_back(size);
+        workItems = BinaryOperator::CreateMul(workItems, size, "work_items", insertBlock);
+    }
 
+    return workItems;
 }
 
 void HTROPClient::setupCatchForInvoke(BasicBlock * label_lpad, BasicBlock * retBlock) {
@@ -1041,6 +1146,8 @@ void HTROPClient::handleOclBinary(Module * &programMod, char *function_binary_bu
 
     //      Function* func_ifGlobalSwitch = programMod->getFunction("ifGlobalSwitch");
     Function *func_transferToDevice = programMod->getFunction("transferToDevice");
+    Function *func_transferImageToDevice = programMod->getFunction("transferImageToDevice");
+    Function *func_transferPitchedToDevice = programMod->getFunction("transferPitchedToDevice");
     Function *func_oclFinish = programMod->getFunction("oclFinish");
     Function *func_executeOCLKernel = programMod->getFunction("executeOCLKernel");
     Function *func_isLegacy = programMod->getFunction("isLegacy");
@@ -1048,6 +1155,10 @@ void HTROPClient::handleOclBinary(Module * &programMod, char *function_binary_bu
     Function *func_cleanupBuffers = programMod->getFunction("cleanupBuffers");
     Function *func_cleanUpBuffers_Device = programMod->getFunction("cleanUpBuffers_Device");
     Function *func_staticDecision = programMod->getFunction("staticDecision");
+    Function *func_prepareReduction = programMod->getFunction("prepareReduction");
+    Function *func_finishReduction = programMod->getFunction("finishReduction");
+    Function *func_selectKernelVariant = programMod->getFunction("selectKernelVariant");
+    Function *func_timeKernelVariant = programMod->getFunction("timeKernelVariant");
 
     StructType *struct_cl_mem = programMod->getTypeByName("struct._cl_mem");
     PointerType *voidPtrType = PointerType::get(IntegerType::get(*context, 8), 0);
@@ -1058,6 +1169,8 @@ void HTROPClient::handleOclBinary(Module * &programMod, char *function_binary_bu
     assert(func_calculateBonusAndDecide != nullptr);
     //      assert(func_ifGlobalSwitch!=nullptr);
     assert(func_transferToDevice != nullptr);
+    assert(func_transferImageToDevice != nullptr);
+    assert(func_transferPitchedToDevice != nullptr);
     assert(func_oclFinish != nullptr);
     assert(func_executeOCLKernel != nullptr);
     assert(func_isLegacy != nullptr);
@@ -1065,6 +1178,10 @@ void HTROPClient::handleOclBinary(Module * &programMod, char *function_binary_bu
     assert(func_cleanupBuffers != nullptr);
     assert(func_cleanUpBuffers_Device != nullptr);
     assert(func_staticDecision != nullptr);
+    assert(func_prepareReduction != nullptr);
+    assert(func_finishReduction != nullptr);
+    assert(func_selectKernelVariant != nullptr);
+    assert(func_timeKernelVariant != nullptr);
 
     assert(struct_cl_mem != nullptr);
     PointerType *PointerTy_struct_cl_mem = PointerType::get(struct_cl_mem, 0);
@@ -1087,12 +1204,38 @@ void HTROPClient::handleOclBinary(Module * &programMod, char *function_binary_bu
     assert(func_runtimeDecisionTimeStamp != nullptr);
 #endif
 
+    //Fused scops replace their producer and consumer if the server generated the fused kernel
+    for (auto scopFusion:scopFusionList) {
+        if (getServerInfo(codeGenMsgFromServer, scopFusion->scopID) != NULL) {
+            htrop::applyScopFusion(scopFusion, scopList, scopCallList);
+        }
+        else {
+            htrop::discardScopFusion(scopFusion, scopList);
+        }
+    }
+    scopFusionList.clear();
+
     //Step I : Create the initialization function
     addOCLInitializationFunction(programMod, codeGenMsgFromServer, oclKernelFilePath);
     int scop_id = 0;
 
     for (auto scop:scopList) {
 
+        //The server has no kernel for the scop, its calls keep the host code. The arrays of the chain are copied back from the device before.
+        std::string scopName = scop.second->scopFunction->getName().str();
+        if (getServerInfo(codeGenMsgFromServer, scopName) == NULL) {
+            std::cout << "\nHTROP INFO: No kernel for " << scopName << ", keeping the original function";
+            for (ScopCallDS * scopCall:scopCallList) {
+                if (scopCall->scopID == scopName) {
+                    std::vector < Value * >cleanupBuffers_params;
+                    cleanupBuffers_params.push_back(CallInst::Create(func_getCurrentAccelerator, "call", scopCall->callInst));
+                    CallInst::Create(func_cleanUpBuffers_Device, cleanupBuffers_params, "", scopCall->callInst);
+                }
+            }
+            scop_id++;
+            continue;
+        }
+
         Function *runtimeDecisionFn;
         BasicBlock *start_block;
         BasicBlock *label_lpad;
@@ -1183,14 +1326,15 @@ void HTROPClient::handleOclBinary(Module * &programMod, char *function_binary_bu
         //Get the scopInfo from the server message
         auto scopServerInfo = getServerInfo(codeGenMsgFromServer, scop.second->scopFunction->getName().str());
 
-        //create the kernelname string
-        AllocaInst *scop_KernelNameStr = createLlvmString(scopServerInfo->scopoclkernelname(), &start_block, label_lpad, transferAndInvokeFn, programMod);
-
         //Get the size of each argument to transfer
         int scopFnParamId = 0;
+        std::vector < Value * >kernelArgs;
+        std::vector < Value * >indexExtents;    //Array sizes in elements and long arguments, the guard of a version with 32-bit indices
 
         for (ScopFnArg * scopArg:*scopFunctonArgs) {
             Value *dataPtr = getArg(transferAndInvokeFn, scopFnParamId);
+            if (dataPtr->getType()->isIntegerTy(64))
+                indexExtents.push_back(dataPtr);
 
             if (scopArg->isPointer) {
                 AllocaInst *ptr_clBuffer = new AllocaInst(PointerTy_struct_cl_mem, "clBuffer", start_block);
@@ -1204,49 +1348,140 @@ void HTROPClient::handleOclBinary(Module * &programMod, char *function_binary_bu
                 func_transferToDevice_params.push_back(resolveBufferType(scopInstance->scopCallFunctonArgs.at(scopFnParamId)->typeOptimized));  //resolve from scopCallList
                 func_transferToDevice_params.push_back(resolveSizeOf(scopArg->value));  //resolve from scop
                 func_transferToDevice_params.push_back(scopValue);
-                auto transferCall = CallInst::Create(func_transferToDevice, func_transferToDevice_params, "", dataTransferBB);
+
+                //Rows of a multi-dimensional array count all their elements
+                uint64_t rowElements = 1;
+                for (Type * elementType = scopArg->value->getType()->getPointerElementType(); elementType->isArrayTy(); elementType = elementType->getArrayElementType())
+                    rowElements *= elementType->getArrayNumElements();
+                indexExtents.push_back(BinaryOperator::CreateMul(castTo64(scopValue, start_block), ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), rowElements), "elements",
+                                                                 start_block));
+
+                //The kernel has an image variant for this array, the runtime decides by the image support of the device
+                const HTROP_PB::Message_RSRC::ImageArg * imageArg = NULL;
+                for (const auto & serverImageArg:scopServerInfo->image_args()) {
+                    if ((int)serverImageArg.arg_position() == scopFnParamId)
+                        imageArg = &serverImageArg;
+                }
+
+                //The rows of the array are padded to the alignment of the device
+                const HTROP_PB::Message_RSRC::PitchedArg * pitchedArg = NULL;
+                for (const auto & serverPitchedArg:scopServerInfo->pitched_args()) {
+                    if ((int)serverPitchedArg.arg_position() == scopFnParamId)
+                        pitchedArg = &serverPitchedArg;
+                }
+
+                CallInst *transferCall;
+                if (imageArg != NULL) {
+                    Value *imageWidth = ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), 0);
+                    if (imageArg->row_width_arg() >= 0)
+                        imageWidth = castTo64(getArg(transferAndInvokeFn, imageArg->row_width_arg()), start_block);
+                    func_transferToDevice_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), imageArg->is_float()));
+                    func_transferToDevice_params.push_back(imageWidth);
+                    transferCall = CallInst::Create(func_transferImageToDevice, func_transferToDevice_params, "", dataTransferBB);
+                }
+                else if (pitchedArg != NULL) {
+                    //Element size of the server, resolveSizeOf only sees the row type
+                    func_transferToDevice_params[3] = ConstantInt::get(IntegerType::get(*context, 32), pitchedArg->data_type_size());
+                    func_transferToDevice_params.push_back(ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), pitchedArg->row_width()));
+                    transferCall = CallInst::Create(func_transferPitchedToDevice, func_transferToDevice_params, "", dataTransferBB);
+                }
+                else {
+                    transferCall = CallInst::Create(func_transferToDevice, func_transferToDevice_params, "", dataTransferBB);
+                }
                 StoreInst *storeTransfer = new StoreInst(transferCall, ptr_clBuffer, false, dataTransferBB);
 
                 dataPtr = ptr_clBuffer;
             }
 
-            Function *func_setKernelArg = resolveKernelArgFunction(scopArg);
+            kernelArgs.push_back(dataPtr);
+            scopFnParamId++;
+        }
 
-            std::vector < Value * >func_setKernelArg_params;
-            func_setKernelArg_params.push_back(deviceType);
-            func_setKernelArg_params.push_back(scop_KernelNameStr);
-            ConstantInt *const_int_kernel_pos = ConstantInt::get(*context, APInt(32, StringRef(std::to_string(scopFnParamId)), 10));
+        //Calls with a number of work-items in the range of a size version run it instead of the kernel of the scop
+        BasicBlock *launchedBlock = BasicBlock::Create(getGlobalContext(), "launched", transferAndInvokeFn);
+        BasicBlock *kernelBlock = setKernelArgsBlock;
+        if (scopServerInfo->size_versions_size() > 0) {
+            std::vector < Value * >globalSizes;
+            Value *workItems = createWorkItemCount(scopServerInfo, scop.second, setKernelArgsBlock, &start_block, label_lpad, globalSizes);
+
+            for (const auto & sizeVersion:scopServerInfo->size_versions()) {
+                BasicBlock *versionBlock = BasicBlock::Create(getGlobalContext(), "size_version", transferAndInvokeFn);
+                BasicBlock *nextBlock = BasicBlock::Create(getGlobalContext(), "next_size_version", transferAndInvokeFn);
+
+                Value *inRange = new ICmpInst(*kernelBlock, ICmpInst::ICMP_UGE, workItems, ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), sizeVersion.min_work_items()));
+                if (sizeVersion.max_work_items() > 0) {
+                    Value *belowMax = new ICmpInst(*kernelBlock, ICmpInst::ICMP_ULT, workItems, ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), sizeVersion.max_work_items()));
+                    inRange = BinaryOperator::CreateAnd(inRange, belowMax, "in_range", kernelBlock);
+                }
 
-            func_setKernelArg_params.push_back(const_int_kernel_pos);
-            func_setKernelArg_params.push_back(dataPtr);
+                //The global size of each dimension of the scop kernel
+                for (int dim = 0; dim < sizeVersion.max_global_size_size() && dim < (int)globalSizes.size(); dim++) {
+                    if (sizeVersion.min_global_size(dim) > 0) {
+                        Value *aboveMin = new ICmpInst(*kernelBlock, ICmpInst::ICMP_UGE, globalSizes[dim],
+                                                       ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), sizeVersion.min_global_size(dim)));
+                        inRange = BinaryOperator::CreateAnd(inRange, aboveMin, "in_range", kernelBlock);
+                    }
+                    if (sizeVersion.max_global_size(dim) > 0) {
+                        Value *belowMax = new ICmpInst(*kernelBlock, ICmpInst::ICMP_ULT, globalSizes[dim],
+                                                       ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), sizeVersion.max_global_size(dim)));
+                        inRange = BinaryOperator::CreateAnd(inRange, belowMax, "in_range", kernelBlock);
+                    }
+                }
 
-            CallInst::Create(func_setKernelArg, func_setKernelArg_params, "", setKernelArgsBlock);
+                //32-bit indices: every extent in (-max_index, max_index)
+                if (sizeVersion.max_index() > 0) {
+                    Constant *maxIndex = ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), sizeVersion.max_index());
+                    Constant *minIndex = ConstantInt::get(IntegerType::get(*context, DATA_WIDTH), -(int64_t) sizeVersion.max_index());
+                    inRange = BinaryOperator::CreateAnd(inRange, new ICmpInst(*kernelBlock, ICmpInst::ICMP_ULT, workItems, maxIndex), "in_range", kernelBlock);
+                    for (Value * extent:indexExtents) {
+                        inRange = BinaryOperator::CreateAnd(inRange, new ICmpInst(*kernelBlock, ICmpInst::ICMP_SLT, extent, maxIndex), "in_range", kernelBlock);
+                        inRange = BinaryOperator::CreateAnd(inRange, new ICmpInst(*kernelBlock, ICmpInst::ICMP_SGT, extent, minIndex), "in_range", kernelBlock);
+                    }
+                }
+                BranchInst::Create(versionBlock, nextBlock, inRange, kernelBlock);
 
-            scopFnParamId++;
+                createKernelLaunch(&sizeVersion, scop.second, kernelArgs, versionBlock, deviceType, &start_block, label_lpad);
+                BranchInst::Create(launchedBlock, versionBlock);
+                kernelBlock = nextBlock;
+            }
         }
 
-        //Create the array
-        BasicBlock *insertCallIntoBlock = setKernelArgsBlock;
-        Value *ptr_arraydecay_global;
-        Value *ptr_arraydecay_local;
-
-        createLocalAndGlobalWorkGroups(scopServerInfo, insertCallIntoBlock, blockSizeDim0, blockSizeDim1, &ptr_arraydecay_global, &ptr_arraydecay_local);
-
-#if MEASURE
-        CallInst::Create(func_startTimeStamp, "", insertCallIntoBlock);
-#endif
+        //The runtime selects one of the kernel variants of the server, times it and keeps the fastest per device
+        if (scopServerInfo->variants_size() == 0) {
+            createKernelLaunch(scopServerInfo, scop.second, kernelArgs, kernelBlock, deviceType, &start_block, label_lpad);
+            BranchInst::Create(launchedBlock, kernelBlock);
+        }
+        else {
+            AllocaInst *scop_NameStr = createLlvmString(scopServerInfo->scopfunctionname(), &start_block, label_lpad, transferAndInvokeFn, programMod);
 
-        std::vector < Value * >func_executeOCLKernel_params;
-        func_executeOCLKernel_params.push_back(deviceType);
-        func_executeOCLKernel_params.push_back(scop_KernelNameStr);
-        func_executeOCLKernel_params.push_back(ConstantInt::get(*context, APInt(32, StringRef(std::to_string(scopServerInfo->workgroup_arg_index_size())), 10)));
-        func_executeOCLKernel_params.push_back(ptr_arraydecay_global);
-        func_executeOCLKernel_params.push_back(ptr_arraydecay_local);
-        CallInst::Create(func_executeOCLKernel, func_executeOCLKernel_params, "", insertCallIntoBlock);
+            std::vector < Value * >func_selectKernelVariant_params;
+            func_selectKernelVariant_params.push_back(deviceType);
+            func_selectKernelVariant_params.push_back(scop_NameStr);
+            func_selectKernelVariant_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), scopServerInfo->variants_size() + 1));
+            CallInst *call_selectKernelVariant = CallInst::Create(func_selectKernelVariant, func_selectKernelVariant_params, "variant", kernelBlock);
 
-#if MEASURE
-        CallInst::Create(func_kernelExecutionTimeStamp, "", insertCallIntoBlock);
-#endif
+            std::vector < BasicBlock * >variantBlocks;
+            for (int variant = 0; variant <= scopServerInfo->variants_size(); variant++) {
+                variantBlocks.push_back(BasicBlock::Create(getGlobalContext(), "variant", transferAndInvokeFn));
+            }
+            SwitchInst *variantSwitch = SwitchInst::Create(call_selectKernelVariant, variantBlocks[0], scopServerInfo->variants_size(), kernelBlock);
+
+            //Variant 0 is the kernel of the scop
+            for (int variant = 0; variant <= scopServerInfo->variants_size(); variant++) {
+                if (variant > 0)
+                    variantSwitch->addCase(ConstantInt::get(IntegerType::get(*context, 32), variant), variantBlocks[variant]);
+
+                createKernelLaunch(variant == 0 ? scopServerInfo : &scopServerInfo->variants(variant - 1), scop.second, kernelArgs, variantBlocks[variant], deviceType, &start_block,
+                                   label_lpad);
+
+                std::vector < Value * >func_timeKernelVariant_params;
+                func_timeKernelVariant_params.push_back(deviceType);
+                func_timeKernelVariant_params.push_back(scop_NameStr);
+                func_timeKernelVariant_params.push_back(ConstantInt::get(IntegerType::get(*context, 32), variant));
+                CallInst::Create(func_timeKernelVariant, func_timeKernelVariant_params, "", variantBlocks[variant]);
+                BranchInst::Create(launchedBlock, variantBlocks[variant]);
+            }
+        }
 
         //Add the branch and return instructions
         retBlock = BasicBlock::Create(getGlobalContext(), "ret", transferAndInvokeFn);
@@ -1254,7 +1489,7 @@ void HTROPClient::handleOclBinary(Module * &programMod, char *function_binary_bu
         builder.CreateBr(dataTransferBB);
         builder.SetInsertPoint(dataTransferBB);
         builder.CreateBr(setKernelArgsBlock);
-        builder.SetInsertPoint(setKernelArgsBlock);
+        builder.SetInsertPoint(launchedBlock);
         builder.CreateBr(retBlock);
         setupCatchForInvoke(label_lpad, retBlock);
         builder.SetInsertPoint(retBlock);
@@ -1369,11 +1604,10 @@ void HTROPClient::handleOclBinary(Module * &programMod, char *function_binary_bu
 
     //BEGIN Call to final Device cleanup
     
+    //Add cleanup in the scop Parent before the first free, there is no wrapper if all scops kept their original function
+    Instruction *lastWrapperCall = NULL;
     if(!flag_chain_interrupt){
 
-        //Add cleanup in the scop Parent before the first free
-        Instruction *lastWrapperCall = NULL;
-
         for (inst_iterator instInScop = inst_begin(scopFunctionParent), e = inst_end(scopFunctionParent); instInScop != e; ++instInScop) {
             if (isa < CallInst > (&*instInScop)) {
                 CallInst *callScopInst = dyn_cast < CallInst > (&*instInScop);
@@ -1384,8 +1618,8 @@ void HTROPClient::handleOclBinary(Module * &programMod, char *function_binary_bu
             }
         }
 
-        assert(lastWrapperCall != NULL);
-
+    }
+    if (lastWrapperCall != NULL) {
         Instruction *insertBefore = lastWrapperCall->getNextNode();
 
         std::vector < Value * >cleanupBuffers_params;
@@ -1440,10 +1674,47 @@ void HTROPClient::addOCLInitializationFunction(Module * &programMod, HTROP_PB::M
     llvm::Function * fnAddClKernel = programMod->getFunction("addClKernel");
     assert(fnAddClKernel != nullptr);
 
+    bool hasVariants = false;
     for (int i = 0; i < codeGenMsgFromServer->scopfunctions_size(); i++) {
         std::vector < Value * >paramsAddClKernel;
         paramsAddClKernel.push_back(builder.CreateGlobalStringPtr(codeGenMsgFromServer->scopfunctions(i).scopoclkernelname()));
         builder.CreateCall(fnAddClKernel, paramsAddClKernel);
+
+        for (const auto & variant:codeGenMsgFromServer->scopfunctions(i).variants()) {
+            std::vector < Value * >paramsAddVariant;
+            paramsAddVariant.push_back(builder.CreateGlobalStringPtr(variant.scopoclkernelname()));
+            builder.CreateCall(fnAddClKernel, paramsAddVariant);
+            hasVariants = true;
+        }
+        //Size versions for several ranges share their kernel
+        std::set < std::string > sizeVersionNames;
+        for (const auto & sizeVersion:codeGenMsgFromServer->scopfunctions(i).size_versions()) {
+            if (!sizeVersionNames.insert(sizeVersion.scopoclkernelname()).second)
+                continue;
+            std::vector < Value * >paramsAddSizeVersion;
+            paramsAddSizeVersion.push_back(builder.CreateGlobalStringPtr(sizeVersion.scopoclkernelname()));
+            builder.CreateCall(fnAddClKernel, paramsAddSizeVersion);
+        }
+        for (const auto & distributedKernel:codeGenMsgFromServer->scopfunctions(i).distributed_kernels()) {
+            std::vector < Value * >paramsAddDistributedKernel;
+            paramsAddDistributedKernel.push_back(builder.CreateGlobalStringPtr(distributedKernel.scopoclkernelname()));
+            builder.CreateCall(fnAddClKernel, paramsAddDistributedKernel);
+        }
+        if (codeGenMsgFromServer->scopfunctions(i).has_interior_kernel()) {
+            std::vector < Value * >paramsAddInteriorKernel;
+            paramsAddInteriorKernel.push_back(builder.CreateGlobalStringPtr(codeGenMsgFromServer->scopfunctions(i).interior_kernel().scopoclkernelname()));
+            builder.CreateCall(fnAddClKernel, paramsAddInteriorKernel);
+        }
+    }
+
+    //Step III : Load the fastest kernel variants of earlier runs
+    if (hasVariants) {
+        llvm::Function * fnInitKernelTuning = programMod->getFunction("initKernelTuning");
+        assert(fnInitKernelTuning != nullptr);
+
+        std::vector < Value * >paramsInitKernelTuning;
+        paramsInitKernelTuning.push_back(builder.CreateGlobalStringPtr(kernelTuningFile));
+        builder.CreateCall(fnInitKernelTuning, paramsInitKernelTuning);
     }
 
     llvm::BranchInst::Create(retBlock, initBlock);
@@ -1481,13 +1752,7 @@ int HTROPClient::handleLLVMIRReq(const char *recvMessageBuffer, int messageSize)
     std::cout.flush();
 #endif
 
-    std::vector < llvm::Function * >functionsToExport;
-    for (auto scop:scopList) {
-        functionsToExport.push_back(scop.second->scopFunction);
-    }
-
-    std::vector < llvm::GlobalVariable * >globalsToExport;
-    std::string llvmIR = exportFunctionIntoBitcode(programMod, functionsToExport, globalsToExport);
+    std::string llvmIR = exportScopFunctions();
 
     //Send LLVM IR
     Message *llvmIRResponseMessage = new Message();
@@ -1509,3 +1774,204 @@ int HTROPClient::handleLLVMIRReq(const char *recvMessageBuffer, int messageSize)
 
     return 1;
 }
+
+//Send the unmodified module to the HTROP Server, it runs the scop analysis and the code generation.
+//Called before prepareIRForPolly, the server applies the same preparation.
+int HTROPClient::uploadModuleForAnalysis() {
+
+#if MEASURE
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+#endif
+
+    std::string moduleIR;
+    llvm::raw_string_ostream moduleStream(moduleIR);
+    WriteBitcodeToFile(programMod, moduleStream);
+    moduleStream.flush();
+
+    HTROP_PB::Message_RCRS_Analysis analysisMsgToServer;
+    for (auto depth:maxScopLoopDepth) {
+        analysisMsgToServer.add_max_scop_loop_depth(depth);
+    }
+    for (auto depth:maxCogeGenLoopDepth) {
+        analysisMsgToServer.add_max_codegen_loop_depth(depth);
+    }
+    analysisMsgToServer.set_modulesize(moduleIR.size());
+    analysisMsgToServer.set_optimize_schedule(optimizeScopSchedule);
+    std::string msgBuffer = analysisMsgToServer.SerializeAsString();
+
+    scopAnalysisState = SCOP_ANALYSIS_PENDING;
+    std::thread clientHTROPServerHandler(&HTROPClient::handleHTROPServerCommunicationWrapper, this);
+    clientHTROPServerHandler.detach();
+    communicationStarted = true;
+
+    Message *analysisMessage = new Message();
+    if (analysisMessage->send(htrop_server_sockfd, REQ_SCOP_ANALYSIS, msgBuffer.c_str(), msgBuffer.size(), 0) < 0
+        || analysisMessage->send(htrop_server_sockfd, BINARY_STREAM, moduleIR.c_str(), moduleIR.size(), 0) < 0) {
+        std::cerr << "ERROR sending module for analysis (HTROP Server)";
+        delete analysisMessage;
+        setScopAnalysisState(SCOP_ANALYSIS_FAILED);
+        return -1;
+    }
+    delete analysisMessage;
+
+#if MEASURE
+    std::cout << "\nMEASURE-TIME: Module upload : " << (std::chrono::duration_cast < std::chrono::microseconds > (std::chrono::steady_clock::now() - time_start).count());
+#endif
+
+    return 0;
+}
+
+//Take the scops from the analysis of the HTROP Server. Falls back to the local analysis if it failed.
+int HTROPClient::awaitScopAnalysis() {
+    {
+        std::unique_lock < std::mutex > lock(scopAnalysisMutex);
+        scopAnalysisCV.wait(lock,[this] {
+                            return scopAnalysisState != SCOP_ANALYSIS_PENDING;});
+    }
+
+    //Without kernels the analysis is still valid, the code is requested again later
+    if (scopAnalysisResult.scops_size() == 0) {
+        std::cout << "\nINFO: No scop analysis from the HTROP Server, analysing locally";
+        std::cout.flush();
+        return analyseScop();
+    }
+
+    //The clones of repeated scop calls do not exist yet, restore the original scops first
+    for (const auto & scopAnalysisInfo:scopAnalysisResult.scops()) {
+        ScopDS *scopDS = htrop::scopDSFromProto(programMod, scopAnalysisInfo);
+        if (scopDS != NULL) {
+            scopList.insert(std::pair < std::string, ScopDS * >(scopAnalysisInfo.scopfunctionname(), scopDS));
+            scopFunctionParent = scopDS->scopFunctionParent;
+        }
+    }
+
+    //Repeat the cloning of the server, it names the clones in the same order
+    htrop::cloneRepeatedScopCalls(scopFunctionParent, scopList);
+    for (const auto & scopAnalysisInfo:scopAnalysisResult.scops()) {
+        if (scopList.count(scopAnalysisInfo.scopfunctionname()))
+            continue;
+        ScopDS *scopDS = htrop::scopDSFromProto(programMod, scopAnalysisInfo);
+        if (scopDS == NULL) {
+            std::cerr << "\nERROR: Scop " << scopAnalysisInfo.scopfunctionname() << " of the HTROP Server not found";
+            continue;
+        }
+        scopList.insert(std::pair < std::string, ScopDS * >(scopAnalysisInfo.scopfunctionname(), scopDS));
+    }
+
+#ifdef HTROP_DEBUG
+    std::cout << "\nHTROP INFO: No. of Scops from HTROP Server : " << scopList.size();
+    std::cout.flush();
+#endif
+
+    return 0;
+}
+
+//Recieve the analysis and the kernels of the uploaded module
+int HTROPClient::handleScopAnalysis(const char *recvMessageBuffer, int messageSize) {
+
+    HTROP_PB::Message_RSRC_Analysis analysisMsgFromServer;
+    if (!analysisMsgFromServer.ParseFromArray(recvMessageBuffer, messageSize)) {
+        std::cerr << ": Failed to parse message" << std::endl;
+        setScopAnalysisState(SCOP_ANALYSIS_FAILED);
+        return 1;
+    }
+
+    char *result_buffer = (char *)calloc(analysisMsgFromServer.resultsize(), sizeof(char));
+    Message *resultMessage = new Message(result_buffer);
+    resultMessage->recv(htrop_server_sockfd, 0);
+    bool resultValid = resultMessage->getType() == BINARY_STREAM && scopAnalysisResult.ParseFromArray(result_buffer, resultMessage->getSize());
+    delete resultMessage;
+    free(result_buffer);
+
+    if (!resultValid) {
+        std::cerr << ": Failed to recieve scop analysis" << std::endl;
+        scopAnalysisResult.Clear();
+        setScopAnalysisState(SCOP_ANALYSIS_FAILED);
+        return 0;
+    }
+
+    if (!scopAnalysisResult.has_codegen()) {
+#ifdef HTROP_DEBUG
+        std::cout << "\n -- recieved scop analysis without code";
+        std::cout.flush();
+#endif
+        setScopAnalysisState(SCOP_ANALYSIS_FAILED);
+        return 1;
+    }
+
+    scopAnalysisBinary = (char *)calloc(scopAnalysisResult.codegen().binarysize(), sizeof(char));
+    Message *binaryMessage = new Message(scopAnalysisBinary);
+    binaryMessage->recv(htrop_server_sockfd, 0);
+    assert(binaryMessage->getType() == BINARY_STREAM);
+    delete binaryMessage;
+
+#ifdef HTROP_DEBUG
+    std::cout << "\n -- recieved scop analysis and binary...";
+    std::cout.flush();
+#endif
+
+    setScopAnalysisState(SCOP_ANALYSIS_RECEIVED);
+    return 1;
+}
+
+void HTROPClient::setScopAnalysisState(ScopAnalysisState state) {
+    std::lock_guard < std::mutex > lock(scopAnalysisMutex);
+    if (scopAnalysisState == SCOP_ANALYSIS_PENDING)
+        scopAnalysisState = state;
+    scopAnalysisCV.notify_all();
+}
+
+//Extract the scop functions, this is the module the code generation works on
+std::string HTROPClient::exportScopFunctions() {
+    std::vector < llvm::Function * >functionsToExport;
+    for (auto scop:scopList) {
+        functionsToExport.push_back(scop.second->scopFunction);
+    }
+
+    std::vector < llvm::GlobalVariable * >globalsToExport;
+    return exportFunctionIntoBitcode(programMod, functionsToExport, globalsToExport);
+}
+
+//Run the code generation pipeline of the HTROP Server in this process
+void HTROPClient::handleInProcessCodeGen() {
+
+#if MEASURE
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+#endif
+
+    HTROP_PB::Message_RCRS codeGenMsgToServer;
+    buildCodeGenReq(&codeGenMsgToServer);
+
+    std::string key = codeGenEngine->getCacheKey(&codeGenMsgToServer);
+    HTROP_PB::Message_RSRC * codeGenMsgFromServer = codeGenEngine->isCodeCached(key);
+
+    if (codeGenMsgFromServer == NULL) {
+        std::string llvmIR = exportScopFunctions();
+        codeGenMsgFromServer = codeGenEngine->generateCode(&codeGenMsgToServer, key, llvmIR.c_str(), llvmIR.size());
+    }
+
+    if (codeGenMsgFromServer == NULL) {
+        std::cout << "\nIn-process code generation failed, keeping original functions ...";
+        processed = true;
+        return;
+    }
+
+    char *function_binary_buffer;
+    codeGenMsgFromServer->set_binarysize(fileToBuffer(codeGenMsgFromServer->oclkernelfilename(), function_binary_buffer));
+
+#if MEASURE
+    std::cout << "\nMEASURE-TIME: In-process Code Generation : " << (std::chrono::duration_cast < std::chrono::microseconds > (std::chrono::steady_clock::now() - time_start).count());
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+#endif
+
+    handleOclBinary(programMod, function_binary_buffer, codeGenMsgFromServer);
+    free(function_binary_buffer);
+    codeGenEngine->releaseCode(codeGenMsgFromServer);
+
+#if MEASURE
+    std::cout << "\nMEASURE-TIME: -> Function wrapper creation : " << (std::chrono::duration_cast < std::chrono::microseconds > (std::chrono::steady_clock::now() - startTime).count()) << "\n";
+    std::cout.flush();
+#endif
+
+    processed = true;
+}
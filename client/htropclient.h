@@ -32,6 +32,8 @@
 #include "pass/scopdetect.h"
 #include "pass/scopdependency.h"
 #include "pass/accscore.h"
+#include "pass/scopanalysis.h"
+#include "pass/scopfusion.h"
 
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/Module.h"
@@ -41,10 +43,12 @@
 #include<netdb.h>
 #include<mutex>
 #include<thread>
+#include<condition_variable>
 #include<stdint.h>
 
 #include "../common/hds.pb.h"
 #include "../common/sharedStructCompileRuntime.h"
+#include "../server/codegenengine.h"
 
 class HTROPClient {
 
@@ -74,6 +78,23 @@ class HTROPClient {
     int handleLLVMIRReq(const char *recvMessageBuffer, int messageSize);        //htropServer
     int handleCompiledBinary(const char *recvMessageBuffer, int messageSize);   //htropServer
     int sendCodeGenReq();
+    void buildCodeGenReq(HTROP_PB::Message_RCRS * codeGenMsgToServer);
+    std::string exportScopFunctions();
+
+    //In-process code generation, replaces the HTROP Server connection
+     CodeGenEngine * codeGenEngine = NULL;
+    void handleInProcessCodeGen();
+
+    //Server-side scop analysis, the HTROP Server analyses the uploaded module while the client runs its own analysis
+    enum ScopAnalysisState { SCOP_ANALYSIS_NONE, SCOP_ANALYSIS_PENDING, SCOP_ANALYSIS_RECEIVED, SCOP_ANALYSIS_FAILED };
+    ScopAnalysisState scopAnalysisState = SCOP_ANALYSIS_NONE;
+     std::mutex scopAnalysisMutex;
+     std::condition_variable scopAnalysisCV;
+     HTROP_PB::ScopAnalysisResult scopAnalysisResult;
+    char *scopAnalysisBinary = NULL;
+    int handleScopAnalysis(const char *recvMessageBuffer, int messageSize);     //htropServer
+    void setScopAnalysisState(ScopAnalysisState state);
+    bool communicationStarted = false;
 
     //Handle requests and responses
     void handleHTROPServerCommunication();
@@ -94,11 +115,22 @@ class HTROPClient {
      std::vector < ScopCallDS * >scopCallList;
      llvm::Function * scopFunctionParent;
 
+    //Fused scops offered to the code generation, applied if it returns a fused kernel
+    bool fuseScops = false;
+     std::vector < htrop::ScopFusionDS * >scopFusionList;
+
+    //Polly's schedule optimization of the scops before the detection, the server-side analysis applies it as well
+    bool optimizeScopSchedule = false;
+
+    //File of the runtime with the fastest kernel variant per device and scop, empty to tune in every run
+     std::string kernelTuningFile = "htrop_tuning.txt";
+
     void addOCLInitializationFunction(Module * &programMod, HTROP_PB::Message_RSRC * codeGenMsgFromServer, std::string oclKernelFilePath);
     void handleOclBinary(Module * &programMod, char *function_binary_buffer, HTROP_PB::Message_RSRC * codeGenMsgFromServer);
      llvm::Value * resolveScopValue(ScopFnArg * scopArg, std::vector < ScopFnArg * >*scopFunctonArgs, llvm::BasicBlock ** start_block, llvm::BasicBlock * label_lpad, llvm::Function * function,
                                     llvm::Module * &programMod);
-    int runScopDetection(Function *function);
+     llvm::Value * resolveScopExpression(std::string formula, std::vector < ScopFnArg * >*scopFunctonArgs, llvm::BasicBlock ** start_block, llvm::BasicBlock * label_lpad,
+                                         llvm::Function * function, llvm::Module * &programMod);
     ScopCallDS *getFirstScopWithId(std::string scopId);
     ConstantInt *resolveBufferType(DataTransferType dtType);
     ConstantInt *resolveDeviceType(std::string deviceType);
@@ -106,7 +138,11 @@ class HTROPClient {
     const HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * getServerInfo(HTROP_PB::Message_RSRC * codeGenMsgFromServer, std::string scopName);
     Function *resolveKernelArgFunction(ScopFnArg * scopArg);
     void createLocalAndGlobalWorkGroups(const HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopServerInfo, BasicBlock * insertCallIntoBlock, int blockSizeDim0, int blockSizeDim1,
-                                        Value ** ptr_arraydecay, Value ** ptr_arraydecay_local);
+                                        Value * deviceType, Value * kernelName, std::vector < Value * >&loopTripCounts, Value ** ptr_arraydecay, Value ** ptr_arraydecay_local);
+    void createKernelLaunch(const HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * kernelInfo, ScopDS * scop, std::vector < Value * >&kernelArgs, BasicBlock * launchBlock,
+                            Value * deviceType, BasicBlock ** start_block, BasicBlock * label_lpad);
+     Value * createWorkItemCount(const HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * kernelInfo, ScopDS * scop, BasicBlock * insertBlock, BasicBlock ** start_block,
+                                 BasicBlock * label_lpad, std::vector < Value * >&globalSizes);
     void setupCatchForInvoke(BasicBlock * label_lpad, BasicBlock * retBlock);
     bool processed = false;
     bool flag_chain_interrupt = false;
@@ -115,9 +151,15 @@ class HTROPClient {
      HTROPClient(std::string orchServerName, std::string htropServerName, int portNumber, std::string IRFilename, std::vector < int > maxCogeGenLoopDepth, std::vector < int > maxScopLoopDepth, int blockSizeDim0, int blockSizeDim1,
                  std::string target, std::vector < std::string > *InputArgv);
     int connectToHTROPServer(); //Establishes hte connections to the RTSC_Server and orchestrator
+    void useInProcessCodeGen(std::string cacheDir, CodeGenOptions codeGenOptions);     //Generate code on a background thread instead of the HTROP Server
+    void useScopFusion(bool fuseScops); //Offer fused kernels for consecutive scops, call before analyseScopDependency
+    void useKernelTuningFile(std::string kernelTuningFile);    //Persist the autotuning of kernel variants in this file
+    void useScopScheduleOptimization(bool optimizeScopSchedule);        //Reschedule the scops with Polly, call before uploadModuleForAnalysis
     void handleRequests();      //Start waiting for requests from the orchestrator and RTSC_Server
     int analyseScopDependency();        // Detect Orchestrator components.
     int analyseScop();          // Detect Scops in functions.
+    int uploadModuleForAnalysis();      // Let the HTROP Server analyse the module and generate code.
+    int awaitScopAnalysis();    // Use the analysis of the HTROP Server instead of analyseScop.
     int startAppExecutionSequential();  //Start executing the application on same thread
     void initializeExecutionEngine();   //intitalze the execution engine
     void initializeLLVMModule();        //intitalze the LLVM module  
@@ -91,7 +91,56 @@ llvm::cl::opt < int >ProgramRuns("runs",
                                  llvm::cl::desc("How often the acceleration on program and program itself should run, defaults to one. Reruns the whole process on program exit if greater one"),
                                  llvm::cl::init(1));
 
-llvm::cl::opt < std::string > HTROPHostname("htrop-host", llvm::cl::desc("HTROP Server hostname or IP, defaults to 'localhost'"), llvm::cl::init("localhost"));
+llvm::cl::opt < std::string > HTROPHostname("htrop-host", llvm::cl::desc("HTROP Server hostname or IP, 'inprocess' generates code in the client, defaults to 'localhost'"), llvm::cl::init("localhost"));
+llvm::cl::opt < std::string > InProcessCacheDir("inprocess-cache-dir", llvm::cl::desc("Persistent code cache used by in-process code generation, e.g. the -cache-dir of the HTROP Server"), llvm::cl::init(""));
+llvm::cl::opt < bool > ServerAnalysis("server-analysis", llvm::cl::desc("Upload the module at startup, the HTROP Server analyses the scops and generates code while the client analyses"), llvm::cl::init(false));
+llvm::cl::opt < bool > OptimizeScopSchedule("optimize-scop-schedule",
+                                            llvm::cl::desc("Reschedule each scop with Polly's isl scheduler (tiling, interchange, fusion) before the kernels are extracted, tuned by -polly-tiling, -polly-tile-sizes and -polly-opt-fusion"),
+                                            llvm::cl::init(false));
+llvm::cl::opt < bool > FuseScops("fuse-scops", llvm::cl::desc("Offer one kernel for consecutive scops that pass an array elementwise, the intermediate stays in registers"), llvm::cl::init(false));
+llvm::cl::opt < bool > SkipLocalAnalysis("skip-local-analysis", llvm::cl::desc("With -server-analysis, use the scop analysis of the HTROP Server instead of analysing locally"), llvm::cl::init(false));
+llvm::cl::opt < std::string > InProcessOCLEmitter("inprocess-ocl-emitter", llvm::cl::desc("OpenCL C generation of the in-process code generation: 'axtor', 'direct' or 'compare', defaults to 'axtor'"), llvm::cl::init("axtor"));
+llvm::cl::list < unsigned int >InProcessRegisterBlock("inprocess-register-block", llvm::cl::CommaSeparated,
+                                                     llvm::cl::desc("Register blocking factors (MCPU,GPU,MIC) of the in-process code generation, see -register-block of the HTROP Server"));
+llvm::cl::list < unsigned int >InProcessVectorWidth("inprocess-vector-width", llvm::cl::CommaSeparated,
+                                                   llvm::cl::desc("Vector widths (MCPU,GPU,MIC) of the in-process code generation, see -vector-width of the HTROP Server"));
+llvm::cl::list < unsigned int >InProcessCoarsening("inprocess-coarsening", llvm::cl::CommaSeparated,
+                                                  llvm::cl::desc("Thread coarsening factors (MCPU,GPU,MIC) of the in-process code generation, see -coarsening of the HTROP Server"));
+llvm::cl::opt < unsigned int >InProcessReductionGroupSize("inprocess-reduction-group-size",
+                                                         llvm::cl::desc("Work-group size of parallel reductions of the in-process code generation, see -reduction-group-size of the HTROP Server"),
+                                                         llvm::cl::init(0));
+llvm::cl::opt < bool > InProcessReadOnlyMemory("inprocess-read-only-memory", llvm::cl::desc("Constant and image memory for IN arrays of the in-process code generation, see -read-only-memory of the HTROP Server"),
+                                               llvm::cl::init(false));
+llvm::cl::opt < bool > InProcessKernelVariants("inprocess-kernel-variants", llvm::cl::desc("Kernel variants for runtime autotuning of the in-process code generation, see -kernel-variants of the HTROP Server"),
+                                               llvm::cl::init(false));
+llvm::cl::list < unsigned int >InProcessVariantCoarsening("inprocess-variant-coarsening", llvm::cl::CommaSeparated,
+                                                         llvm::cl::desc("Coarsening factors (MCPU,GPU,MIC) of the kernel variants of the in-process code generation, see -variant-coarsening of the HTROP Server"));
+llvm::cl::opt < unsigned int >InProcessVariantTileSize("inprocess-variant-tile-size",
+                                                      llvm::cl::desc("Tile edge of the kernel variants of the in-process code generation, see -variant-tile-size of the HTROP Server"),
+                                                      llvm::cl::init(16));
+llvm::cl::opt < unsigned int >InProcessSmallSizeThreshold("inprocess-small-size-threshold",
+                                                         llvm::cl::desc("Small size kernel versions of the in-process code generation, see -small-size-threshold of the HTROP Server"),
+                                                         llvm::cl::init(0));
+llvm::cl::opt < bool > InProcessSpecializeArgs("inprocess-specialize-args", llvm::cl::desc("Value specialization of the in-process code generation, see -specialize-args of the HTROP Server"),
+                                               llvm::cl::init(false));
+llvm::cl::opt < bool > InProcessIndex32Versions("inprocess-index32-versions", llvm::cl::desc("32-bit index versions of the in-process code generation, see -index32-versions of the HTROP Server"),
+                                                llvm::cl::init(false));
+llvm::cl::opt < bool > InProcessWavefront("inprocess-wavefront", llvm::cl::desc("Wavefront kernels of the in-process code generation, see -wavefront of the HTROP Server"),
+                                          llvm::cl::init(false));
+llvm::cl::opt < bool > InProcessLoopDistribution("inprocess-loop-distribution",
+                                                 llvm::cl::desc("Loop distribution of the in-process code generation, see -loop-distribution of the HTROP Server"),
+                                                 llvm::cl::init(false));
+llvm::cl::opt < bool > InProcessIndexSetSplitting("inprocess-index-set-splitting",
+                                                  llvm::cl::desc("Interior and border kernels of the in-process code generation, see -index-set-splitting of the HTROP Server"),
+                                                  llvm::cl::init(false));
+llvm::cl::opt < unsigned int >InProcessScatterLocalBins("inprocess-scatter-local-bins",
+                                                        llvm::cl::desc("Local-memory scatter copies of the in-process code generation, see -scatter-local-bins of the HTROP Server"),
+                                                        llvm::cl::init(0));
+llvm::cl::opt < bool > InProcessPitchedBuffers("inprocess-pitched-buffers", llvm::cl::desc("Pitched 2D buffers of the in-process code generation, see -pitched-buffers of the HTROP Server"),
+                                               llvm::cl::init(false));
+llvm::cl::opt < std::string > KernelTuningFile("tuning-file", llvm::cl::desc("Fastest kernel variant per device and scop, read at startup and written after tuning, defaults to 'htrop_tuning.txt'"),
+                                               llvm::cl::init("htrop_tuning.txt"));
+llvm::cl::opt < unsigned int >InProcessLocalTileSize("inprocess-local-tile-size", llvm::cl::desc("Local-memory stencil tiles of the in-process code generation, see -local-tile-size of the HTROP Server"), llvm::cl::init(0));
 llvm::cl::opt < int >HTROPHostPort("htrop-port", llvm::cl::desc("HTROP Server port, defaults to '55066'"), llvm::cl::init(55066));
 
 llvm::cl::opt < std::string > OrchestratorHostname("orch-host", llvm::cl::desc("Orchestrator hostname or IP, defaults to 'localhost'"), llvm::cl::init("localhost"));
@@ -192,6 +241,46 @@ int main(int argc, char *argv[]) {
         startTime = std::chrono::steady_clock::now();
 #endif
 
+        CodeGenOptions inProcessCodeGenOptions;
+        inProcessCodeGenOptions.oclEmitter = InProcessOCLEmitter;
+        inProcessCodeGenOptions.localTileSize = InProcessLocalTileSize;
+        inProcessCodeGenOptions.readOnlyMemory = InProcessReadOnlyMemory;
+        inProcessCodeGenOptions.kernelVariants = InProcessKernelVariants;
+        inProcessCodeGenOptions.variantTileSize = InProcessVariantTileSize;
+        inProcessCodeGenOptions.smallSizeThreshold = InProcessSmallSizeThreshold;
+        inProcessCodeGenOptions.specializeArgs = InProcessSpecializeArgs;
+        inProcessCodeGenOptions.pitchedBuffers = InProcessPitchedBuffers;
+        inProcessCodeGenOptions.index32Versions = InProcessIndex32Versions;
+        inProcessCodeGenOptions.wavefront = InProcessWavefront;
+        inProcessCodeGenOptions.loopDistribution = InProcessLoopDistribution;
+        inProcessCodeGenOptions.indexSetSplitting = InProcessIndexSetSplitting;
+        inProcessCodeGenOptions.scatterLocalBins = InProcessScatterLocalBins;
+        if ((InProcessReductionGroupSize & (InProcessReductionGroupSize - 1)) == 0) {
+            inProcessCodeGenOptions.reductionGroupSize = InProcessReductionGroupSize;
+        }
+        if (InProcessRegisterBlock.size() == 3 && std::find(InProcessRegisterBlock.begin(), InProcessRegisterBlock.end(), 0) == InProcessRegisterBlock.end()) {
+            inProcessCodeGenOptions.registerBlock.assign(InProcessRegisterBlock.begin(), InProcessRegisterBlock.end());
+        }
+        if (InProcessVectorWidth.size() == 3 && std::find(InProcessVectorWidth.begin(), InProcessVectorWidth.end(), 0) == InProcessVectorWidth.end()) {
+            inProcessCodeGenOptions.vectorWidth.assign(InProcessVectorWidth.begin(), InProcessVectorWidth.end());
+        }
+        if (InProcessCoarsening.size() == 3 && std::find(InProcessCoarsening.begin(), InProcessCoarsening.end(), 0) == InProcessCoarsening.end()) {
+            inProcessCodeGenOptions.coarsening.assign(InProcessCoarsening.begin(), InProcessCoarsening.end());
+        }
+        if (InProcessVariantCoarsening.size() == 3 && std::find(InProcessVariantCoarsening.begin(), InProcessVariantCoarsening.end(), 0) == InProcessVariantCoarsening.end()) {
+            inProcessCodeGenOptions.variantCoarsening.assign(InProcessVariantCoarsening.begin(), InProcessVariantCoarsening.end());
+        }
+
+        htropclient->useScopScheduleOptimization(OptimizeScopSchedule);
+
+        // Overlap the analysis and code generation on the HTROP Server with the local analysis.
+        bool serverConnected = false;
+        bool serverAnalysis = false;
+        if (ServerAnalysis && HTROPHostname != "inprocess" && htropclient->connectToHTROPServer() == 0) {
+            serverConnected = true;
+            serverAnalysis = htropclient->uploadModuleForAnalysis() == 0;
+        }
+
 #ifdef HTROP_DEBUG
         std::cout << "INFO: " << "Preparing LLVM IR for Polly/ScopDetection: " << std::endl;
         std::cout.flush();
@@ -213,7 +302,12 @@ int main(int argc, char *argv[]) {
         std::cout.flush();
 #endif
         // Run passes to detect and analyse scops.
-        htropclient->analyseScop();
+        if (serverAnalysis && SkipLocalAnalysis) {
+            htropclient->awaitScopAnalysis();
+        }
+        else {
+            htropclient->analyseScop();
+        }
 
         //Analysis should be correct till here.
 
@@ -227,6 +321,9 @@ int main(int argc, char *argv[]) {
         std::cout.flush();
 #endif
 
+        // The scops of the server-side analysis already have their kernels.
+        htropclient->useScopFusion(FuseScops && !serverAnalysis);
+        htropclient->useKernelTuningFile(KernelTuningFile);
         htropclient->analyseScopDependency();
 
 #ifdef HTROP_DEBUG
@@ -253,7 +350,17 @@ int main(int argc, char *argv[]) {
         std::cout << "\nINFO: Establish Connections: \n";
         std::cout.flush();
 #endif
-        htropclient->connectToHTROPServer();
+        if (serverConnected) {
+            // Connected for the server-side analysis.
+        }
+        else if (HTROPHostname == "inprocess") {
+            htropclient->useInProcessCodeGen(InProcessCacheDir, inProcessCodeGenOptions);
+        }
+        else if (htropclient->connectToHTROPServer() < 0) {
+            std::cout << "\nINFO: No HTROP Server answering, falling back to in-process code generation";
+            std::cout.flush();
+            htropclient->useInProcessCodeGen(InProcessCacheDir, inProcessCodeGenOptions);
+        }
 #ifdef HTROP_DEBUG
         std::cout << "\nINFO: ... connection established.\n";
         std::cout.flush();
@@ -35,6 +35,8 @@
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/Analysis/Passes.h"
 #include "llvm/Analysis/RegionInfo.h"
+#include "llvm/Analysis/ScalarEvolutionExpressions.h"
+#include "llvm/Analysis/ValueTracking.h"
 #include "llvm/Support/CommandLine.h"
 #if LLVM_VERSION == 3 && LLVM_MINOR_VERSION < 5
 #include "llvm/Support/InstIterator.h"
@@ -45,6 +47,8 @@
 
 #include <iostream>
 #include <list>
+#include <map>
+#include <set>
 
 char htrop::DepDetect::ID = 0;
 
@@ -176,16 +180,391 @@ bool htrop::DepDetect::runOnFunction(Function &F) {
             break;
     }
     max_codegen_loop_depth = minDepthLoop->getLoopDepth();   
+    
+    detectReduction(F);
+    detectWavefront(F);
+    detectScatter(F);
     return false;
 }
 
+bool htrop::DepDetect::getReductionOperator(BinaryOperator *binOp, ReductionOperator &reductionOperator){
+    switch (binOp->getOpcode()) {
+    case Instruction::Add:
+    case Instruction::FAdd:
+        reductionOperator = RED_ADD;
+        return true;
+    case Instruction::Mul:
+    case Instruction::FMul:
+        reductionOperator = RED_MUL;
+        return true;
+    case Instruction::And:
+        reductionOperator = RED_AND;
+        return true;
+    case Instruction::Or:
+        reductionOperator = RED_OR;
+        return true;
+    case Instruction::Xor:
+        reductionOperator = RED_XOR;
+        return true;
+    default:
+        return false;
+    }
+}
+
+//Find a single reduction acc[x] = acc[x] op value. The outermost loop in which x does not change
+//is the reduction loop, the parallelized loops below it have to change x.
+void htrop::DepDetect::detectReduction(Function &F){
+    
+    reduction = ScopReductionInfo();
+    
+    LoopInfo &LI = (getAnalysis<llvm::LoopInfoWrapperPass>()).getLoopInfo();
+    ScalarEvolution &SE = (getAnalysis<llvm::ScalarEvolutionWrapperPass>()).getSE();
+    const DataLayout &DL = F.getParent()->getDataLayout();
+    
+    StoreInst *reductionStore = NULL;
+    ScopReductionInfo candidate;
+    
+    for (auto &I : instructions(F)) {
+        StoreInst *storeInst = dyn_cast<StoreInst>(&I);
+        if(storeInst == NULL)
+            continue;
+        
+        BinaryOperator *binOp = dyn_cast<BinaryOperator>(storeInst->getValueOperand());
+        ReductionOperator reductionOperator;
+        if(binOp == NULL || !binOp->hasOneUse() || !getReductionOperator(binOp, reductionOperator))
+            continue;
+        
+        //The accumulator is read by the same address and only feeds the combination
+        bool readsAccumulator = false;
+        for(unsigned int i = 0; i < 2; i++){
+            LoadInst *loadInst = dyn_cast<LoadInst>(binOp->getOperand(i));
+            if(loadInst && loadInst->hasOneUse() && SE.getSCEV(loadInst->getPointerOperand()) == SE.getSCEV(storeInst->getPointerOperand()))
+                readsAccumulator = true;
+        }
+        
+        Argument *accumulator = dyn_cast<Argument>(GetUnderlyingObject(storeInst->getPointerOperand(), DL));
+        if(!readsAccumulator || accumulator == NULL)
+            continue;
+        
+        //Only one reduction per scop
+        if(reductionStore != NULL)
+            return;
+        
+        reductionStore = storeInst;
+        candidate.argPosition = accumulator->getArgNo();
+        candidate.reductionOperator = reductionOperator;
+    }
+    
+    if(reductionStore == NULL)
+        return;
+    
+    //The accumulator is not accessed anywhere else
+    for (auto &I : instructions(F)) {
+        Value *pointer = NULL;
+        if (LoadInst *loadInst = dyn_cast<LoadInst>(&I))
+            pointer = loadInst->getPointerOperand();
+        else if (StoreInst *storeInst = dyn_cast<StoreInst>(&I))
+            pointer = storeInst->getPointerOperand();
+        else
+            continue;
+        
+        Argument *array = dyn_cast<Argument>(GetUnderlyingObject(pointer, DL));
+        if(array == NULL || (int)array->getArgNo() != candidate.argPosition || &I == reductionStore)
+            continue;
+        if(!isa<LoadInst>(&I) || !I.hasOneUse() || *I.user_begin() != reductionStore->getValueOperand())
+            return;
+    }
+    
+    //Loops around the reduction, outermost first
+    std::vector<llvm::Loop *> loops;
+    for(llvm::Loop *loop = LI.getLoopFor(reductionStore->getParent()); loop != NULL; loop = loop->getParentLoop())
+        loops.insert(loops.begin(), loop);
+    
+    const SCEV *address = SE.getSCEV(reductionStore->getPointerOperand());
+    for(unsigned int depth = 1; depth <= loops.size() && depth <= (unsigned int) max_codegen_loop_depth; depth++){
+        if(!SE.isLoopInvariant(address, loops[depth - 1]))
+            continue;
+        
+        if(candidate.loopDepth == 0){
+            candidate.loopDepth = depth;
+        }
+        else{
+            //A second loop without a new address stays sequential inside the work-item
+            max_codegen_loop_depth = depth - 1;
+            break;
+        }
+    }
+    
+    if(candidate.loopDepth > 0)
+        reduction = candidate;
+}
+
+//Distance (di, dj) of two accesses whose addresses differ by delta = di * strideOuter + dj * strideInner, the smallest |dj|
+//if the strides allow several (the accesses stay in their row). False if no small constant distance exists.
+static bool getAccessDistance(ScalarEvolution &SE, const SCEV *delta, const SCEV *strideOuter, const SCEV *strideInner, int64_t &di, int64_t &dj){
+    const int64_t maxDistance = 8;
+    
+    const SCEVConstant *constStrideInner = dyn_cast<SCEVConstant>(strideInner);
+    if(constStrideInner == NULL || constStrideInner->getValue()->isZero())
+        return false;
+    int64_t stride = constStrideInner->getValue()->getSExtValue();
+    
+    bool found = false;
+    for(int64_t outer = -maxDistance; outer <= maxDistance; outer++){
+        const SCEV *remainder = SE.getMinusSCEV(delta, SE.getMulExpr(SE.getConstant(strideOuter->getType(), outer, true), strideOuter));
+        const SCEVConstant *constRemainder = dyn_cast<SCEVConstant>(remainder);
+        if(constRemainder == NULL || constRemainder->getValue()->getSExtValue() % stride != 0)
+            continue;
+        
+        int64_t inner = constRemainder->getValue()->getSExtValue() / stride;
+        if(inner < -maxDistance || inner > maxDistance || (found && std::abs(inner) >= std::abs(dj)))
+            continue;
+        di = outer;
+        dj = inner;
+        found = true;
+    }
+    return found;
+}
+
+//In-place stencils (Gauss-Seidel) in a perfect 2D nest: the stores depend on earlier iterations of both loops.
+//Every access of a stored array has to be {{start,+,strideOuter}<i>,+,strideInner}<j> with the same strides, then each pair
+//of accesses has a constant distance (di, dj). The waves t = skew * i + j carry all distances (skew * di + dj >= 1),
+//the iterations of one wave are independent.
+void htrop::DepDetect::detectWavefront(Function &F){
+    
+    wavefrontSkew = 0;
+    const int64_t maxSkew = 8;
+    
+    LoopInfo &LI = (getAnalysis<llvm::LoopInfoWrapperPass>()).getLoopInfo();
+    ScalarEvolution &SE = (getAnalysis<llvm::ScalarEvolutionWrapperPass>()).getSE();
+    
+    if(LI.begin() == LI.end() || std::next(LI.begin()) != LI.end())
+        return;
+    llvm::Loop *outerLoop = *LI.begin();
+    if(outerLoop->getSubLoops().size() != 1 || !outerLoop->getSubLoops()[0]->getSubLoops().empty())
+        return;
+    llvm::Loop *innerLoop = outerLoop->getSubLoops()[0];
+    
+    //Only the induction variables may be carried from one iteration to the next
+    for(llvm::Loop *loop = innerLoop; loop != NULL; loop = loop->getParentLoop()){
+        PHINode *phi = dyn_cast<PHINode>(loop->getHeader()->begin());
+        if(phi == NULL || isa<PHINode>(phi->getNextNode()))
+            return;
+    }
+    
+    struct Access {
+        Instruction *inst;
+        const SCEV *start = NULL; //Address of the first iteration, NULL if the address is not affine in both loops
+        const SCEV *strideOuter = NULL;
+        const SCEV *strideInner = NULL;
+    };
+    std::map<const SCEV *, std::vector<Access> > arrayAccesses;
+    std::set<const SCEV *> storedArrays;
+    
+    for (auto &I : instructions(F)) {
+        Value *pointer = NULL;
+        if (LoadInst *loadInst = dyn_cast<LoadInst>(&I))
+            pointer = loadInst->getPointerOperand();
+        else if (StoreInst *storeInst = dyn_cast<StoreInst>(&I))
+            pointer = storeInst->getPointerOperand();
+        else if (I.mayReadFromMemory() || I.mayWriteToMemory())
+            return;
+        else
+            continue;
+        
+        if(LI.getLoopFor(I.getParent()) != innerLoop)
+            return;
+        
+        const SCEV *address = SE.getSCEV(pointer);
+        const SCEV *base = SE.getPointerBase(address);
+        Access access;
+        access.inst = &I;
+        
+        const SCEVAddRecExpr *innerRec = dyn_cast<SCEVAddRecExpr>(SE.getMinusSCEV(address, base));
+        if(innerRec != NULL && innerRec->getLoop() == innerLoop && innerRec->isAffine()){
+            const SCEVAddRecExpr *outerRec = dyn_cast<SCEVAddRecExpr>(innerRec->getStart());
+            if(outerRec != NULL && outerRec->getLoop() == outerLoop && outerRec->isAffine()){
+                access.start = outerRec->getStart();
+                access.strideOuter = outerRec->getStepRecurrence(SE);
+                access.strideInner = innerRec->getStepRecurrence(SE);
+            }
+        }
+        
+        arrayAccesses[base].push_back(access);
+        if(isa<StoreInst>(&I))
+            storedArrays.insert(base);
+    }
+    
+    bool outerCarried = false;
+    bool innerCarried = false;
+    int64_t skew = 1;
+    
+    for(const SCEV *array : storedArrays){
+        std::vector<Access> &accesses = arrayAccesses[array];
+        for(Access &store : accesses){
+            if(!isa<StoreInst>(store.inst))
+                continue;
+            for(Access &access : accesses){
+                if(store.start == NULL || access.start == NULL || access.strideOuter != store.strideOuter || access.strideInner != store.strideInner)
+                    return;
+                
+                int64_t di, dj;
+                if(!getAccessDistance(SE, SE.getMinusSCEV(store.start, access.start), store.strideOuter, store.strideInner, di, dj))
+                    return;
+                
+                //Direction from the earlier to the later iteration of the pair
+                if(di < 0 || (di == 0 && dj < 0)){
+                    di = -di;
+                    dj = -dj;
+                }
+                
+                if(di == 0 && dj == 0)
+                    continue;
+                if(di == 0){
+                    innerCarried = true;
+                }
+                else{
+                    outerCarried = true;
+                    if(dj < 1)
+                        skew = std::max(skew, (di - dj) / di);
+                }
+            }
+        }
+    }
+    
+    //A loop without dependences is parallelized directly
+    if(outerCarried && innerCarried && skew <= maxSkew)
+        wavefrontSkew = skew;
+}
+
+//Data loaded in the function flows into the value
+static bool dependsOnLoad(Value *value, std::set<Value *> &visited){
+    Instruction *inst = dyn_cast<Instruction>(value);
+    if(inst == NULL || !visited.insert(inst).second)
+        return false;
+    if(isa<LoadInst>(inst))
+        return true;
+    for(unsigned int i = 0; i < inst->getNumOperands(); i++){
+        if(dependsOnLoad(inst->getOperand(i), visited))
+            return true;
+    }
+    return false;
+}
+
+//old + value, or old min/max value as compare and select. The old value only feeds the update.
+static bool getScatterUpdate(Value *update, LoadInst *&oldValue, ReductionOperator &scatterOperator){
+    oldValue = NULL;
+    if(BinaryOperator *binOp = dyn_cast<BinaryOperator>(update)){
+        if(binOp->getOpcode() != Instruction::Add || !binOp->hasOneUse())
+            return false;
+        for(unsigned int i = 0; i < 2; i++){
+            LoadInst *loadInst = dyn_cast<LoadInst>(binOp->getOperand(i));
+            if(loadInst && loadInst->hasOneUse())
+                oldValue = loadInst;
+        }
+        scatterOperator = RED_ADD;
+        return oldValue != NULL;
+    }
+    
+    SelectInst *selectInst = dyn_cast<SelectInst>(update);
+    ICmpInst *cmpInst = selectInst ? dyn_cast<ICmpInst>(selectInst->getCondition()) : NULL;
+    if(cmpInst == NULL || !selectInst->hasOneUse() || !cmpInst->hasOneUse() || !cmpInst->isSigned())
+        return false;
+    
+    //select(a < b, a, b) is the minimum, select(a < b, b, a) the maximum
+    Value *a = cmpInst->getOperand(0), *b = cmpInst->getOperand(1);
+    bool picksFirst = selectInst->getTrueValue() == a && selectInst->getFalseValue() == b;
+    if(!picksFirst && !(selectInst->getTrueValue() == b && selectInst->getFalseValue() == a))
+        return false;
+    bool isLess = cmpInst->getPredicate() == ICmpInst::ICMP_SLT || cmpInst->getPredicate() == ICmpInst::ICMP_SLE;
+    scatterOperator = isLess == picksFirst ? RED_MIN : RED_MAX;
+    
+    for(Value *operand : {a, b}){
+        LoadInst *loadInst = dyn_cast<LoadInst>(operand);
+        if(loadInst && loadInst->getNumUses() == 2)
+            oldValue = loadInst;
+    }
+    return oldValue != NULL;
+}
+
+//Find a single scatter update acc[x] = acc[x] op value of 32-bit integers whose address depends on loaded data,
+//e.g. hist[img[i]]++. Polly only keeps such loops as scops with -polly-allow-nonaffine.
+void htrop::DepDetect::detectScatter(Function &F){
+    
+    scatter = ScopScatterInfo();
+    
+    const DataLayout &DL = F.getParent()->getDataLayout();
+    
+    StoreInst *scatterStore = NULL;
+    LoadInst *scatterLoad = NULL;
+    ScopScatterInfo candidate;
+    
+    for (auto &I : instructions(F)) {
+        StoreInst *storeInst = dyn_cast<StoreInst>(&I);
+        if(storeInst == NULL || !storeInst->getValueOperand()->getType()->isIntegerTy(32))
+            continue;
+        
+        LoadInst *oldValue;
+        ReductionOperator scatterOperator;
+        if(!getScatterUpdate(storeInst->getValueOperand(), oldValue, scatterOperator) || oldValue->getPointerOperand() != storeInst->getPointerOperand())
+            continue;
+        
+        std::set<Value *> visited;
+        Argument *array = dyn_cast<Argument>(GetUnderlyingObject(storeInst->getPointerOperand(), DL));
+        if(array == NULL || !dependsOnLoad(storeInst->getPointerOperand(), visited))
+            continue;
+        
+        //Only one scatter update per scop
+        if(scatterStore != NULL)
+            return;
+        
+        scatterStore = storeInst;
+        scatterLoad = oldValue;
+        candidate.argPosition = array->getArgNo();
+        candidate.scatterOperator = scatterOperator;
+    }
+    
+    if(scatterStore == NULL)
+        return;
+    
+    //The array is not accessed anywhere else
+    for (auto &I : instructions(F)) {
+        Value *pointer = NULL;
+        if (LoadInst *loadInst = dyn_cast<LoadInst>(&I))
+            pointer = loadInst->getPointerOperand();
+        else if (StoreInst *storeInst = dyn_cast<StoreInst>(&I))
+            pointer = storeInst->getPointerOperand();
+        else
+            continue;
+        
+        Argument *array = dyn_cast<Argument>(GetUnderlyingObject(pointer, DL));
+        if(array != NULL && (int)array->getArgNo() == candidate.argPosition && &I != scatterStore && &I != scatterLoad)
+            return;
+    }
+    
+    scatter = candidate;
+}
+
 
 int htrop::DepDetect::getMaxCodegenLoopDepth(){
     return max_codegen_loop_depth;
 }
 
+ScopReductionInfo htrop::DepDetect::getReduction(){
+    return reduction;
+}
+
+unsigned int htrop::DepDetect::getWavefrontSkew(){
+    return wavefrontSkew;
+}
+
+ScopScatterInfo htrop::DepDetect::getScatter(){
+    return scatter;
+}
+
 
 void htrop::DepDetect::getAnalysisUsage(AnalysisUsage &AU) const {
     AU.setPreservesAll();
     AU.addRequired<LoopInfoWrapperPass>();
+    AU.addRequired<ScalarEvolutionWrapperPass>();
 }
@@ -31,6 +31,9 @@
 #include "llvm/IR/InstVisitor.h"
 #endif
 #include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+
+#include "../../common/sharedStructCompileRuntime.h"
 
 #include <list>
 #include <iostream>
@@ -48,9 +51,20 @@ namespace htrop {
         virtual void getAnalysisUsage(AnalysisUsage &AU) const;
         
         int getMaxCodegenLoopDepth();
+        ScopReductionInfo getReduction();
+        unsigned int getWavefrontSkew();
+        ScopScatterInfo getScatter();
         
     private:
         int max_codegen_loop_depth=0;
+        ScopReductionInfo reduction;
+        unsigned int wavefrontSkew=0;
+        ScopScatterInfo scatter;
+        
+        bool getReductionOperator(BinaryOperator *binOp, ReductionOperator &reductionOperator);
+        void detectReduction(Function &F);
+        void detectWavefront(Function &F);
+        void detectScatter(Function &F);
     };
     
     llvm::FunctionPass *createDepDetectPass();
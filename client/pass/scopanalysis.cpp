@@ -0,0 +1,456 @@
+//    Copyright (c) 2019 University of Paderborn 
+//                         (Marvin Damschen <marvin.damschen@gullz.de>,
+//                          Gavin Vaz <gavin.vaz@uni-paderborn.de>,
+//                          Heinrich Riebler <heinrich.riebler@uni-paderborn.de>)
+
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+
+//    The above copyright notice and this permission notice shall be included in
+//    all copies or substantial portions of the Software.
+
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//    THE SOFTWARE.
+
+#include "scopanalysis.h"
+#include "scopdetect.h"
+#include "accscore.h"
+
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/LegacyPassManager.h"
+#include "llvm/Transforms/Utils/Cloning.h"
+#if LLVM_VERSION == 3 && LLVM_MINOR_VERSION < 5
+#include "llvm/Support/InstIterator.h"
+#else
+#include "llvm/IR/InstIterator.h"
+#endif
+
+#include "polly/Canonicalization.h"
+#include "polly/LinkAllPasses.h"
+
+#include "../../consts.h"
+#include "../../common/math_parser.h"
+
+#include <algorithm>
+#include <iostream>
+#include <list>
+
+//Polly's isl scheduler (tiling, interchange, fusion of the loops of a scop) and code generation rewrite the loop nests.
+//The runtime checks of the optimized code are taken as true, the kernels make the same no-alias assumption.
+static void optimizeScopSchedules(Module * mod) {
+    llvm::legacy::PassManager schedulePM;
+    schedulePM.add(polly::createIslScheduleOptimizerPass());
+    schedulePM.add(polly::createCodeGenerationPass());
+    schedulePM.run(*mod);
+
+    for (Function & function:*mod) {
+        for (BasicBlock & block:function) {
+            auto branchInst = dyn_cast_or_null < BranchInst > (block.getTerminator());
+            if (branchInst != NULL && branchInst->isConditional() && block.getName().startswith("polly.split_new_and_old"))
+                branchInst->setCondition(ConstantInt::getTrue(mod->getContext()));
+        }
+    }
+
+    //Drop the original loops and canonicalize the generated ones for the scop detection
+    llvm::legacy::PassManager canonicalizePM;
+    canonicalizePM.add(polly::createPollyCanonicalizePass());
+    canonicalizePM.run(*mod);
+}
+
+void htrop::prepareModuleForPolly(Module * mod, bool optimizeSchedule) {
+    /*
+     *  -polly-canonicalize -polly-run-inliner \
+     *      -polly-detect -polly-scops \
+     *       -polly-dce -polly-opt-isl \
+     *      -polly-codegen -polly-parallel \
+     *      seidel-2d-no-dependency/out/seidel-2d.O0.ll \
+     *      | opt -O3 > seidel-2d-no-dependency/out/seidel-2d.openmp.dance.ll
+     */
+
+    // Build up all of the passes that we want to run on the module.
+    llvm::legacy::PassManager pm;
+    pm.add(polly::createPollyCanonicalizePass());
+    pm.run(*mod);
+
+    if (optimizeSchedule)
+        optimizeScopSchedules(mod);
+}
+
+static ScopDS *runScopDetection(Module * mod, Function * function, std::vector < int >maxScopLoopDepth, htrop::ScopDSMap & scopList, Function * &scopFunctionParent) {
+    llvm::legacy::FunctionPassManager ScopDetectPM(mod);
+    htrop::ScopDetect * ScopDetectPass = static_cast < htrop::ScopDetect * >(htrop::createScopDetectPass(maxScopLoopDepth));
+    ScopDetectPM.add(ScopDetectPass);
+
+    // NOTE:
+    // if we iterate over several functions then we would overwrite the results.
+    // The idea should be to loop over the given functions (analysisCandidates) 
+    // and try to match whatever we would like to detect.
+
+    ScopDetectPass->clear();
+    ScopDetectPM.run(*function);
+
+    //Assumption only one scop per function
+    if (!ScopDetectPass->containsScop())
+        return NULL;
+
+    ScopDS *scopDS = new ScopDS();
+
+    scopDS->scopFunction = ScopDetectPass->getScopFunction();
+    scopDS->scopFunctionParent = ScopDetectPass->getScopFunctionParent();
+    scopDS->scopFunctonArgs = ScopDetectPass->getScopFuncitonArgs();
+    scopDS->scopLoopInfo = ScopDetectPass->getScopLoopInfo();
+
+    // Get accelerator affinity. 
+    // Run the scoring pass.
+    llvm::legacy::FunctionPassManager ScopScorePM(mod);
+    htrop::AccScore * ScopScorePass = static_cast < htrop::AccScore * >(htrop::createScoringPass());
+    ScopScorePM.add(ScopScorePass);
+    ScopScorePM.run(*function);
+
+    // Set accelerator affinity.
+    ResourceInfo LEG_Resource, MCPU_Resource, GPU_Resource, MIC_Resource;
+
+    LEG_Resource.affinity = MCPU_Resource.affinity = GPU_Resource.affinity = MIC_Resource.affinity = 0;
+    LEG_Resource.codeGenTime = MCPU_Resource.codeGenTime = GPU_Resource.codeGenTime = MIC_Resource.codeGenTime = 0;
+    LEG_Resource.function = MCPU_Resource.function = GPU_Resource.function = MIC_Resource.function = NULL;
+    LEG_Resource.registrationFunction = MCPU_Resource.registrationFunction = GPU_Resource.registrationFunction = MIC_Resource.registrationFunction = NULL;
+
+    scopDS->resources.insert(std::pair < DeviceType, ResourceInfo > (LEG, LEG_Resource));
+    scopDS->resources.insert(std::pair < DeviceType, ResourceInfo > (MCPU, MCPU_Resource));
+    scopDS->resources.insert(std::pair < DeviceType, ResourceInfo > (GPU, GPU_Resource));
+    scopDS->resources.insert(std::pair < DeviceType, ResourceInfo > (MIC, MIC_Resource));
+
+    scopList.insert(std::pair < std::string, ScopDS * >(ScopDetectPass->getScopFunction()->getName(), scopDS));
+    scopFunctionParent = ScopDetectPass->getScopFunctionParent();
+
+    scopDS->maxParalleizationDepth = ScopDetectPass->getMaxCodegenLoopDepth();
+    scopDS->reduction = ScopDetectPass->getReduction();
+    scopDS->wavefrontSkew = ScopDetectPass->getWavefrontSkew();
+    scopDS->scatter = ScopDetectPass->getScatter();
+
+#ifdef HTROP_DEBUG
+    std::cout << "\nHTROP INFO: Max codegen depth : " << scopDS->maxParalleizationDepth << "\n";
+    if (scopDS->reduction.argPosition >= 0)
+        std::cout << "HTROP INFO: Reduction into argument " << scopDS->reduction.argPosition << " over loop depth " << scopDS->reduction.loopDepth << "\n";
+    if (scopDS->wavefrontSkew > 0)
+        std::cout << "HTROP INFO: Wavefronts t = " << scopDS->wavefrontSkew << " * i + j\n";
+    if (scopDS->scatter.argPosition >= 0)
+        std::cout << "HTROP INFO: Scatter update of argument " << scopDS->scatter.argPosition << "\n";
+    std::cout.flush();
+#endif
+
+    return scopDS;
+}
+
+Function *htrop::detectScops(Module * mod, std::vector < int >maxScopLoopDepth, ScopDSMap & scopList) {
+    Function *scopFunctionParent = NULL;
+
+    // Functions to analyse. 
+    std::list < llvm::Function * >analysisCandidates;
+    for (llvm::Module::iterator I = mod->begin(); I != mod->end(); I++) {
+        if (I->getName().str().find(CHECK_RESULTS_CPU) != std::string::npos) {
+            std::cout << "INFO: " << "Skipped SCoP analysis for: \"" << (*I).getName().str() << "\"\n";
+        }
+        else {
+            analysisCandidates.push_back(&(*I));
+        }
+    }
+
+    //Go through all the functions and detect scops
+    for (const auto & function:analysisCandidates) {
+        runScopDetection(mod, function, maxScopLoopDepth, scopList, scopFunctionParent);
+    }
+
+    if (scopFunctionParent == NULL)
+        return NULL;
+
+    //run scop analysis for the cloned functions
+    for (auto newFn:cloneRepeatedScopCalls(scopFunctionParent, scopList)) {
+        runScopDetection(mod, newFn, maxScopLoopDepth, scopList, scopFunctionParent);
+    }
+
+#ifdef HTROP_SCOP_DEBUG
+    std::cout << "\nINFO : Updated the application.";
+    std::cout.flush();
+#endif
+
+    return scopFunctionParent;
+}
+
+std::vector < Function * >htrop::cloneRepeatedScopCalls(Function * scopFunctionParent, ScopDSMap & scopList) {
+    //Search for multiple calls to the same scop
+    std::vector<std::string> seenScop;
+    struct RepeatedCalls{
+        Function *calledF;
+        CallInst *callInst;
+    };
+    std::vector<RepeatedCalls*> repeatedCalls;
+    
+    // Iterate over instructions of the scop parent
+    for (inst_iterator I = inst_begin(scopFunctionParent), E = inst_end(scopFunctionParent); I != E; ++I) {
+        // Look for calls.
+        if (isa < llvm::CallInst > (&*I)) {
+            llvm::CallInst * callInst = dyn_cast < llvm::CallInst > (&*I);
+            Function *calledF = callInst->getCalledFunction();
+            // Look for calls to functions.
+            if (calledF) {
+                // Does it point to a Scop?
+                std::map < std::string, ScopDS * >::iterator scopListIt;
+                scopListIt = scopList.find(calledF->getName());
+                
+                if (scopListIt != scopList.end()) {
+                    //Check if the scop has been called more than once
+                    if(std::find(seenScop.begin(), seenScop.end(), calledF->getName()) != seenScop.end()){
+                        auto repeatedCall =  new RepeatedCalls();
+                        repeatedCall->calledF = calledF;
+                        repeatedCall->callInst = callInst;
+                        repeatedCalls.push_back(repeatedCall);
+                    }
+                    else{
+                        seenScop.push_back(calledF->getName());
+                    }
+                }
+            }
+        }
+    }
+    
+    //clone the scop functions and replace the corresponding calls
+    std::vector < Function * >clones;
+    int seq=1;
+    for(auto repeatedCall: repeatedCalls) {
+        
+        //Clone the scop function
+        llvm::ValueToValueMapTy VMap;
+        llvm::Function *newFn = llvm::CloneFunction(repeatedCall->calledF, VMap,
+                                                    /*ModuleLevelChanges=*/false);
+        newFn->setName(repeatedCall->calledF->getName().str() + std::to_string(seq++));
+        repeatedCall->calledF->getParent()->getFunctionList().push_back(newFn);
+        
+        //replace the call to the call to the new function
+        std::vector < Value * >newFn_params;
+        for (Use & U: repeatedCall->callInst->operands()) {
+            // Skip the Function declaration.
+            if (!isa < llvm::Function > (U)) {
+                newFn_params.push_back(U.get());
+            }
+        }
+        auto newCallInst = CallInst::Create(newFn, newFn_params, "", repeatedCall->callInst);
+        repeatedCall->callInst->eraseFromParent();
+        delete repeatedCall;
+
+        clones.push_back(newFn);
+    }
+
+    return clones;
+}
+
+void htrop::addScopsToCodeGenReq(HTROP_PB::Message_RCRS * codeGenMsgToServer, ScopDSMap & scopList, Function * scopFunctionParent, std::vector < int >maxCogeGenLoopDepth) {
+
+    codeGenMsgToServer->set_scopfunctionparentname(scopFunctionParent->getName().str());
+
+    // Debug flag to enable hand tuning, if automated detection is not sufficient.
+    //   Call stub for automated code tuner.
+    int debug_hand_tune_pos = 0;
+
+    for (auto scop:scopList) {
+        //NOTE do we check against a static threshold  here?
+
+        HTROP_PB::Message_RCRS::ScopInfo * scopInfo = codeGenMsgToServer->add_scoplist();
+        scopInfo->set_scopfunctionname(scop.second->scopFunction->getName().str());
+        // Use automatic detection of independent loops to parallelize.
+        if(maxCogeGenLoopDepth.size() == 0) {
+            scopInfo->set_max_codegen_loop_depth(scop.second->maxParalleizationDepth);
+        } 
+        // Use user provided flag to hand tune.
+        else if(maxCogeGenLoopDepth.size() == 1) {
+            scopInfo->set_max_codegen_loop_depth(maxCogeGenLoopDepth[0]);
+        } else {
+            // Reuse last to prevent overflow.
+            if((maxCogeGenLoopDepth.size()-1) == debug_hand_tune_pos) {
+                scopInfo->set_max_codegen_loop_depth(maxCogeGenLoopDepth[debug_hand_tune_pos]);
+            } else {
+                scopInfo->set_max_codegen_loop_depth(maxCogeGenLoopDepth[debug_hand_tune_pos++]);
+            }
+        }
+        if (scop.second->reduction.argPosition >= 0) {
+            reductionToProto(scop.second->reduction, scopInfo->mutable_reduction());
+        }
+        if (scop.second->wavefrontSkew > 0) {
+            scopInfo->set_wavefront_skew(scop.second->wavefrontSkew);
+        }
+        // A small scatter array may be updated in local memory first.
+        if (scop.second->scatter.argPosition >= 0) {
+            scatterToProto(scop.second->scatter, scopInfo->mutable_scatter());
+            scopInfo->mutable_scatter()->set_num_elements(getConstantArraySize(scop.second->scopFunctonArgs[scop.second->scatter.argPosition]));
+        }
+        // The server maps loops that are not bounded by an argument if the runtime can evaluate their trip count.
+        unsigned int numLoopTripCounts = 0;
+        while (numLoopTripCounts < scop.second->scopLoopInfo.size() && !scop.second->scopLoopInfo[numLoopTripCounts]->maxValueStr.empty())
+            numLoopTripCounts++;
+        scopInfo->set_num_loop_trip_counts(numLoopTripCounts);
+
+        // Read-only arrays may go to constant or image memory, small ones need their size.
+        for (unsigned int argPos = 0; argPos < scop.second->scopFunctonArgs.size(); argPos++) {
+            ScopFnArg *scopArg = scop.second->scopFunctonArgs[argPos];
+            if (!scopArg->isPointer || scopArg->type != IN)
+                continue;
+            HTROP_PB::ReadOnlyArgHint * readOnlyArg = scopInfo->add_read_only_args();
+            readOnlyArg->set_arg_position(argPos);
+            readOnlyArg->set_num_elements(getConstantArraySize(scopArg));
+        }
+
+        // A fused scop calls its producer and consumer, the server combines them into one kernel if it can.
+        for (Function * fusedFunction:scop.second->fusedFunctions) {
+            scopInfo->add_fused_functions(fusedFunction->getName().str());
+        }
+        for (unsigned int argPos:scop.second->fusedTmpArgs) {
+            scopInfo->add_fused_tmp_args(argPos);
+        }
+    }
+}
+
+uint64_t htrop::getConstantArraySize(ScopFnArg * scopArg) {
+    if (scopArg->dimension == 0)
+        return 0;
+
+    std::string sizeStr = scopArg->dimension_maxStr[0];
+    if (sizeStr.empty())
+        return 0;
+    for (char c:sizeStr) {
+        if (!isdigit(c) && c != ' ' && c != '+' && c != '-' && c != '*' && c != '/' && c != '(' && c != ')')
+            return 0;
+    }
+
+    ScopExp *scopAST = createASTfromScopString(sizeStr);
+    long size = scopAST->eval();
+    scopAST->cln();
+
+    return size > 0 ? size : 0;
+}
+
+void htrop::reductionToProto(const ScopReductionInfo & reduction, HTROP_PB::ReductionHint * reductionHint) {
+    reductionHint->set_arg_position(reduction.argPosition);
+    reductionHint->set_loop_depth(reduction.loopDepth);
+    reductionHint->set_reduction_operator(reduction.reductionOperator);
+}
+
+void htrop::scatterToProto(const ScopScatterInfo & scatter, HTROP_PB::ScatterHint * scatterHint) {
+    scatterHint->set_arg_position(scatter.argPosition);
+    scatterHint->set_scatter_operator(scatter.scatterOperator);
+}
+
+void htrop::scopDSToProto(ScopDS * scopDS, HTROP_PB::ScopAnalysisInfo * scopAnalysisInfo) {
+    scopAnalysisInfo->set_scopfunctionname(scopDS->scopFunction->getName().str());
+    scopAnalysisInfo->set_scopfunctionparentname(scopDS->scopFunctionParent->getName().str());
+    scopAnalysisInfo->set_maxparallelizationdepth(scopDS->maxParalleizationDepth);
+    if (scopDS->reduction.argPosition >= 0) {
+        reductionToProto(scopDS->reduction, scopAnalysisInfo->mutable_reduction());
+    }
+    if (scopDS->wavefrontSkew > 0) {
+        scopAnalysisInfo->set_wavefront_skew(scopDS->wavefrontSkew);
+    }
+    if (scopDS->scatter.argPosition >= 0) {
+        scatterToProto(scopDS->scatter, scopAnalysisInfo->mutable_scatter());
+    }
+
+    for (auto scopArg:scopDS->scopFunctonArgs) {
+        HTROP_PB::ScopArgInfo * argInfo = scopAnalysisInfo->add_scopfunctionargs();
+        argInfo->set_name(scopArg->name);
+        argInfo->set_type(scopArg->type);
+        argInfo->set_ispointer(scopArg->isPointer);
+        argInfo->set_dimension(scopArg->dimension);
+        for (unsigned int i = 0; i < scopArg->dimension; i++) {
+            argInfo->add_dimension_min(scopArg->dimension_min.at(i));
+            argInfo->add_dimension_max(scopArg->dimension_max.at(i));
+            argInfo->add_dimension_minstr(scopArg->dimension_minStr.at(i));
+            argInfo->add_dimension_maxstr(scopArg->dimension_maxStr.at(i));
+            argInfo->add_dimension_offset_min(scopArg->dimension_offset_min.at(i));
+            argInfo->add_dimension_offset_max(scopArg->dimension_offset_max.at(i));
+        }
+    }
+
+    for (auto scopLoop:scopDS->scopLoopInfo) {
+        HTROP_PB::ScopLoopBound * loopBound = scopAnalysisInfo->add_scoploops();
+        loopBound->set_namestr(scopLoop->nameStr);
+        loopBound->set_maxvalue(scopLoop->maxValue);
+        loopBound->set_maxvaluestr(scopLoop->maxValueStr);
+    }
+}
+
+ScopDS *htrop::scopDSFromProto(Module * mod, const HTROP_PB::ScopAnalysisInfo & scopAnalysisInfo) {
+    Function *scopFunction = mod->getFunction(scopAnalysisInfo.scopfunctionname());
+    Function *scopFunctionParent = mod->getFunction(scopAnalysisInfo.scopfunctionparentname());
+    if (scopFunction == NULL || scopFunctionParent == NULL)
+        return NULL;
+
+    ScopDS *scopDS = new ScopDS();
+    scopDS->scopFunction = scopFunction;
+    scopDS->scopFunctionParent = scopFunctionParent;
+    scopDS->maxParalleizationDepth = scopAnalysisInfo.maxparallelizationdepth();
+    if (scopAnalysisInfo.has_reduction()) {
+        scopDS->reduction.argPosition = scopAnalysisInfo.reduction().arg_position();
+        scopDS->reduction.loopDepth = scopAnalysisInfo.reduction().loop_depth();
+        scopDS->reduction.reductionOperator = (ReductionOperator) scopAnalysisInfo.reduction().reduction_operator();
+    }
+    scopDS->wavefrontSkew = scopAnalysisInfo.wavefront_skew();
+    if (scopAnalysisInfo.has_scatter()) {
+        scopDS->scatter.argPosition = scopAnalysisInfo.scatter().arg_position();
+        scopDS->scatter.scatterOperator = (ReductionOperator) scopAnalysisInfo.scatter().scatter_operator();
+    }
+
+    for (const auto & argInfo:scopAnalysisInfo.scopfunctionargs()) {
+        ScopFnArg *scopArg = new ScopFnArg();
+        scopArg->value = NULL;
+        scopArg->name = argInfo.name();
+        scopArg->type = (DataTransferType) argInfo.type();
+        scopArg->isPointer = argInfo.ispointer();
+        scopArg->resize(argInfo.dimension());
+        for (unsigned int i = 0; i < scopArg->dimension; i++) {
+            scopArg->dimension_min.at(i) = argInfo.dimension_min(i);
+            scopArg->dimension_max.at(i) = argInfo.dimension_max(i);
+            scopArg->dimension_minStr.at(i) = argInfo.dimension_minstr(i);
+            scopArg->dimension_maxStr.at(i) = argInfo.dimension_maxstr(i);
+            scopArg->dimension_offset_min.at(i) = argInfo.dimension_offset_min(i);
+            scopArg->dimension_offset_max.at(i) = argInfo.dimension_offset_max(i);
+        }
+
+        // Map to argument list of function.
+        for (llvm::Function::arg_iterator arg_I = scopFunction->arg_begin(); arg_I != scopFunction->arg_end(); arg_I++) {
+            if (arg_I->getName() == scopArg->name) {
+                scopArg->value = &*arg_I;
+                break;
+            }
+        }
+        scopDS->scopFunctonArgs.push_back(scopArg);
+    }
+
+    for (const auto & loopBound:scopAnalysisInfo.scoploops()) {
+        ScopLoopInfo *scopLoop = new ScopLoopInfo();
+        scopLoop->nameStr = loopBound.namestr();
+        scopLoop->maxValue = loopBound.maxvalue();
+        scopLoop->maxValueStr = loopBound.maxvaluestr();
+        scopDS->scopLoopInfo.push_back(scopLoop);
+    }
+
+    // No affinity information, same as the local detection.
+    ResourceInfo resource;
+    resource.affinity = 0;
+    resource.codeGenTime = 0;
+    resource.function = NULL;
+    resource.registrationFunction = NULL;
+    for (DeviceType deviceType:{LEG, MCPU, GPU, MIC}) {
+        scopDS->resources.insert(std::pair < DeviceType, ResourceInfo > (deviceType, resource));
+    }
+
+    return scopDS;
+}
@@ -0,0 +1,69 @@
+//    Copyright (c) 2019 University of Paderborn 
+//                         (Marvin Damschen <marvin.damschen@gullz.de>,
+//                          Gavin Vaz <gavin.vaz@uni-paderborn.de>,
+//                          Heinrich Riebler <heinrich.riebler@uni-paderborn.de>)
+
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+
+//    The above copyright notice and this permission notice shall be included in
+//    all copies or substantial portions of the Software.
+
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//    THE SOFTWARE.
+
+#ifndef SCOPANALYSIS_H
+#define SCOPANALYSIS_H
+
+#include "llvm/IR/Module.h"
+#include "llvm/IR/Function.h"
+
+#include "../../common/hds.pb.h"
+#include "../../common/sharedStructCompileRuntime.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+// SCoP detection on a complete module, shared by the HTROP Client and the
+// server-side analysis mode of the HTROP Server.
+namespace htrop {
+
+    typedef std::map < std::string, ScopDS * >ScopDSMap;
+
+    // Canonicalize the module for Polly. optimizeSchedule rewrites the loop nests of the scops
+    // with Polly's isl scheduler before they are detected.
+    void prepareModuleForPolly(Module * mod, bool optimizeSchedule = false);
+
+    // Detect the scops of all functions and clone scops called more than once,
+    // so that every call gets its own scop function. Returns the parent calling the scops.
+    Function *detectScops(Module * mod, std::vector < int >maxScopLoopDepth, ScopDSMap & scopList);
+
+    // Replace repeated calls of the same scop by calls to clones ("<scop>1", "<scop>2", ...).
+    // Naming only depends on the call order, so clients and server produce the same clones.
+    std::vector < Function * >cloneRepeatedScopCalls(Function * scopFunctionParent, ScopDSMap & scopList);
+
+    // Fill the scop list, parallelization depth, reduction, read-only array and fusion hints of a code gen request.
+    void addScopsToCodeGenReq(HTROP_PB::Message_RCRS * codeGenMsgToServer, ScopDSMap & scopList, Function * scopFunctionParent, std::vector < int >maxCogeGenLoopDepth);
+    void reductionToProto(const ScopReductionInfo & reduction, HTROP_PB::ReductionHint * reductionHint);
+    void scatterToProto(const ScopScatterInfo & scatter, HTROP_PB::ScatterHint * scatterHint);
+    // Number of elements of an array whose size does not depend on the scop arguments, 0 otherwise.
+    uint64_t getConstantArraySize(ScopFnArg * scopArg);
+
+    void scopDSToProto(ScopDS * scopDS, HTROP_PB::ScopAnalysisInfo * scopAnalysisInfo);
+    // Rebuild the analysis results for a function of mod, NULL if the function does not exist.
+    ScopDS *scopDSFromProto(Module * mod, const HTROP_PB::ScopAnalysisInfo & scopAnalysisInfo);
+}
+
+#endif                          // SCOPANALYSIS_H
@@ -61,6 +61,7 @@
 
 #include <iostream>
 #include <algorithm>
+#include <cctype>
 #include <list>
 
 char htrop::ScopDetect::ID = 0;
@@ -184,6 +185,84 @@ std::vector < htrop::InternArrayDimensionInfo > htrop::ScopDetect::resolveDomain
     return internArrayDimensionInfo;
 }
 
+//   - found "i0 <= -2 + n" .                 => loop 0: "-2 + n"
+//   - found "i1 <= -2 + n - i0" .            => loop 1: "-2 + n - (0)"
+//   - found "2i1 <= -3 + n" (step 2) .       => loop 1: "(-3 + n) / 2"
+void htrop::ScopDetect::resolveLoopTripCounts(std::string domainStr) {
+    domainStr = substring(domainStr, "{", "}");
+
+    // Disjunctions (" or ") are not resolved.
+    std::vector < std::string > domainStrSplit = explodeStr(domainStr, " : ");
+    if (domainStrSplit.size() != 2 || domainStrSplit[1].find(" or ") != std::string::npos)
+        return;
+
+    std::vector < std::string > stmtDimensions = explodeStr(substring(domainStrSplit[0], "[", "]"), ",");
+    for (std::vector < std::string >::iterator it = stmtDimensions.begin(); it != stmtDimensions.end(); ++it) {
+        trim(*it);
+    }
+
+    std::vector < std::string > minMaxExpressions = explodeStr(domainStrSplit[1], " and ");
+    for (std::vector < std::string >::iterator it = minMaxExpressions.begin(); it != minMaxExpressions.end(); ++it) {
+        trim(*it);
+    }
+
+    for (unsigned i = 0; i < stmtDimensions.size() && i < scopLoopInfo.size(); ++i) {
+        // Already known from another statement.
+        if (!scopLoopInfo.at(i)->maxValueStr.empty())
+            continue;
+
+        for (auto mm:minMaxExpressions) {
+            std::vector < std::string > minMaxTokens = explodeStr(mm, " <= ");
+            const std::string & dim = stmtDimensions[i];
+            if (minMaxTokens.size() != 2 || minMaxTokens[0].length() < dim.length() || minMaxTokens[0].compare(minMaxTokens[0].length() - dim.length(), dim.length(), dim) != 0)
+                continue;
+
+            // Coefficient of the counter, i.e. the step of the loop.
+            std::string coefficient = minMaxTokens[0].substr(0, minMaxTokens[0].length() - dim.length());
+            if (coefficient.find_first_not_of("0123456789") != std::string::npos)
+                continue;
+
+            std::string maxValueStr = minMaxTokens[1];
+            if (maxValueStr.find("floor") != std::string::npos)
+                break;
+
+            // Replace the outer counters: "- i0" by its minimum 0, "+ i0" by its maximum.
+            bool resolved = true;
+            for (unsigned k = 0; k < stmtDimensions.size() && resolved; ++k) {
+                if (k == i)
+                    continue;
+
+                int r_start = maxValueStr.find(stmtDimensions[k]);
+                while (r_start > -1) {
+                    if (k > i || scopLoopInfo.at(k)->maxValueStr.empty()) {
+                        resolved = false;
+                        break;
+                    }
+
+                    int signPos = r_start - 1;
+                    while (signPos >= 0 && (isdigit(maxValueStr[signPos]) || maxValueStr[signPos] == ' '))
+                        signPos--;
+
+                    std::string rpl_str = (signPos >= 0 && maxValueStr[signPos] == '-') ? "(0)" : "(" + scopLoopInfo.at(k)->maxValueStr + ")";
+                    maxValueStr.replace(r_start, stmtDimensions[k].length(), rpl_str);
+                    r_start = maxValueStr.find(stmtDimensions[k]);
+                }
+            }
+            if (!resolved)
+                break;
+
+            if (!coefficient.empty())
+                maxValueStr = "(" + maxValueStr + ") / " + coefficient;
+
+            scopLoopInfo.at(i)->maxValueStr = maxValueStr;
+#ifdef HTROP_SCOP_DEBUG
+            errs().indent(6) << "" << " - loop " << i << ".max \"" << maxValueStr << "\" .\n";
+#endif
+            break;
+        }
+    }
+}
+
 void htrop::ScopDetect::setDataTransferType(polly::MemoryAccess * MA, ScopFnArg * kernel_argument) {
     switch (MA->getType()) {
     case polly::MemoryAccess::AccessType::READ:
@@ -349,6 +428,11 @@ bool htrop::ScopDetect::runOnScop(polly::Scop & S) {
       }
     }
     
+    // The server only uses the reduction if its loop is parallelized.
+    reduction = DepDetectPass->getReduction();
+    wavefrontSkew = DepDetectPass->getWavefrontSkew();
+    scatter = DepDetectPass->getScatter();
+
     #ifdef HTROP_SCOP_DEBUG
     errs().indent(2) << "   - S.getMaxLoopDepth: " << S.getMaxLoopDepth() << ", DepDetectPass->getMaxCodegenLoopDepth(): " << DepDetectPass->getMaxCodegenLoopDepth() << ", hand-tuned: " << max_codegen_loop_depth << "\n";
     #endif    
@@ -578,6 +662,7 @@ bool htrop::ScopDetect::runOnScop(polly::Scop & S) {
 #endif
 
         std::vector < htrop::InternArrayDimensionInfo > internArrayDimensionInfo = resolveDomainString(Stmt.getDomainStr());
+        resolveLoopTripCounts(Stmt.getDomainStr());
 
         if (internArrayDimensionInfo.at(0).nameStr == "NULL")
             continue;
@@ -884,10 +969,24 @@ int htrop::ScopDetect::getMaxCodegenLoopDepth(){
   return max_codegen_loop_depth;
 }
 
+ScopReductionInfo htrop::ScopDetect::getReduction(){
+  return reduction;
+}
+
+unsigned int htrop::ScopDetect::getWavefrontSkew(){
+  return wavefrontSkew;
+}
+
+ScopScatterInfo htrop::ScopDetect::getScatter(){
+  return scatter;
+}
+
 void htrop::ScopDetect::clear() {
     scopFunctonArgs.clear();
     scopLoopInfo.clear();
     scopFound = false;
+    reduction = ScopReductionInfo();
+    scatter = ScopScatterInfo();
 }
 
 bool htrop::ScopDetect::containsScop() {
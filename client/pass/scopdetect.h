@@ -87,6 +87,9 @@ namespace htrop {
         void clear();
 
         int getMaxCodegenLoopDepth();
+        ScopReductionInfo getReduction();
+        unsigned int getWavefrontSkew();
+        ScopScatterInfo getScatter();
         
  private:
 
@@ -117,6 +120,15 @@ namespace htrop {
 
         std::vector < InternArrayDimensionInfo > resolveDomainString(std::string domainStr);
 
+        /**
+         * @brief Fills ScopLoopInfo maxValueStr from the domain of a statement. The loop counters of Polly start at 0,
+         *        so maxValueStr + 1 is the trip count. Outer counters are replaced by the bound that maximizes the expression.
+         * 
+         * @param domainStr i.e. [n] -> { Stmt_for_body6[i0, i1] : i0 >= 0 and i0 <= -2 + n and i1 >= 0 and i1 <= -2 + n - i0 }
+         * @return void
+         */
+        void resolveLoopTripCounts(std::string domainStr);
+
         // ### Set DataTransferType
         //           currently | UNKNOWN | IN    | OUT    | IN_OUT  | TMP
         //       statement     |
@@ -127,6 +139,9 @@ namespace htrop {
         void setDataTransferType(polly::MemoryAccess * MA, ScopFnArg * kernel_argument);
         
         int max_codegen_loop_depth = 0;
+        ScopReductionInfo reduction;
+        unsigned int wavefrontSkew = 0;
+        ScopScatterInfo scatter;
     };
 
     llvm::Pass * createScopDetectPass(std::vector<int> maxScopDepth);
@@ -0,0 +1,318 @@
+//    Copyright (c) 2019 University of Paderborn
+//                         (Gavin Vaz <gavin.vaz@uni-paderborn.de>,
+//                          Heinrich Riebler <heinrich.riebler@uni-paderborn.de>)
+
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+
+//    The above copyright notice and this permission notice shall be included in
+//    all copies or substantial portions of the Software.
+
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//    THE SOFTWARE.
+
+
+#include "scopfusion.h"
+
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/Analysis/ValueTracking.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <set>
+
+//Transfer type of an array accessed by the producer (first) and then by the consumer (second)
+static DataTransferType combineTransferTypes(DataTransferType first, DataTransferType second) {
+    if (first == UNKNOWN || first == TMP)
+        return second;
+    if (second == UNKNOWN || second == TMP)
+        return first;
+    if (first == IN)
+        return second == IN ? IN : IN_OUT;
+    return first;
+}
+
+//Replace the argument names of a formula of the scop analysis (i.e. "-1 + n") by the names in the fused scop
+static std::string renameFormula(std::string formula, const std::map < std::string, std::string > &names) {
+    std::string renamed;
+    unsigned int pos = 0;
+    while (pos < formula.size()) {
+        unsigned int end = pos;
+        while (end < formula.size() && (isalnum(formula[end]) || formula[end] == '_' || formula[end] == '.'))
+            end++;
+        if (end == pos) {
+            renamed += formula[pos++];
+            continue;
+        }
+        auto name = names.find(formula.substr(pos, end - pos));
+        renamed += name != names.end() ? name->second : formula.substr(pos, end - pos);
+        pos = end;
+    }
+    return renamed;
+}
+
+static bool isCallTo(const Instruction * inst, std::set < std::string > names) {
+    const CallInst *callInst = dyn_cast_or_null < CallInst > (inst);
+    return callInst != NULL && callInst->getCalledFunction() != NULL && names.count(callInst->getCalledFunction()->getName().str());
+}
+
+//The array passed to both calls is allocated in the parent and only used by them, the host never reads it
+static bool isHostDead(Value * array, CallInst * producerInst, CallInst * consumerInst) {
+    Value *root = array->stripPointerCasts();
+    if (!isa < AllocaInst > (root) && !isCallTo(dyn_cast < Instruction > (root), { "malloc", "calloc", "_Znwm", "_Znam" }))
+        return false;
+
+    std::vector < Value * >pointers(1, root);
+    while (!pointers.empty()) {
+        Value *pointer = pointers.back();
+        pointers.pop_back();
+        for (User * user:pointer->users()) {
+            if (isa < BitCastInst > (user)) {
+                pointers.push_back(user);
+                continue;
+            }
+            if (user == producerInst || user == consumerInst || isCallTo(dyn_cast < Instruction > (user), { "free", "_ZdlPv", "_ZdaPv" }))
+                continue;
+            if (const IntrinsicInst * intrinsic = dyn_cast < IntrinsicInst > (user)) {
+                if (intrinsic->getIntrinsicID() == Intrinsic::lifetime_start || intrinsic->getIntrinsicID() == Intrinsic::lifetime_end)
+                    continue;
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+//The consumer call follows the producer call, nothing in between touches memory the producer accesses.
+//The fused call replaces the consumer call, the producer then runs after these instructions.
+static bool areAdjacent(CallInst * producerInst, CallInst * consumerInst, const DataLayout & DL) {
+    if (producerInst->getParent() != consumerInst->getParent())
+        return false;
+
+    std::set < Value * >producerArrays;
+    for (unsigned int argPos = 0; argPos < producerInst->getNumArgOperands(); argPos++) {
+        if (producerInst->getArgOperand(argPos)->getType()->isPointerTy())
+            producerArrays.insert(GetUnderlyingObject(producerInst->getArgOperand(argPos), DL));
+    }
+
+    for (Instruction * inst = producerInst->getNextNode(); inst != consumerInst; inst = inst->getNextNode()) {
+        if (inst == NULL)
+            return false;
+        if (!inst->mayReadOrWriteMemory())
+            continue;
+        LoadInst *loadInst = dyn_cast < LoadInst > (inst);
+        if (loadInst == NULL || loadInst->isVolatile() || producerArrays.count(GetUnderlyingObject(loadInst->getPointerOperand(), DL)))
+            return false;
+    }
+    return true;
+}
+
+//Fused scop of producer and consumer, NULL if they do not pass an array or the consumer writes what the producer accesses
+static htrop::ScopFusionDS *createScopFusion(Module * mod, htrop::ScopDSMap & scopList, ScopCallDS * producerCall, ScopCallDS * consumerCall) {
+    ScopCallDS *calls[2] = { producerCall, consumerCall };
+    ScopDS *scops[2] = { scopList[producerCall->scopID], scopList[consumerCall->scopID] };
+    if (scops[0]->reduction.argPosition >= 0 || scops[1]->reduction.argPosition >= 0)
+        return NULL;
+
+    //Arguments of the fused scop: the values passed to the producer, then the new ones of the consumer
+    std::vector < Value * >fusedValues;
+    std::vector < std::pair < int, int > >fusedOrigins;       //Position in the producer and consumer call, -1 if not passed
+    for (int callIte = 0; callIte < 2; callIte++) {
+        for (unsigned int argPos = 0; argPos < calls[callIte]->scopCallFunctonArgs.size(); argPos++) {
+            Value *value = calls[callIte]->scopCallFunctonArgs[argPos]->value;
+            auto fusedValue = std::find(fusedValues.begin(), fusedValues.end(), value);
+            if (fusedValue == fusedValues.end()) {
+                fusedValues.push_back(value);
+                fusedOrigins.push_back(std::pair < int, int >(-1, -1));
+                fusedValue = fusedValues.end() - 1;
+            }
+            int &origin = callIte == 0 ? fusedOrigins[fusedValue - fusedValues.begin()].first : fusedOrigins[fusedValue - fusedValues.begin()].second;
+            if (origin >= 0)
+                return NULL;    //Same value passed twice to one scop
+            origin = argPos;
+        }
+    }
+
+    //The consumer may not write what the producer accesses, at least one array goes from the producer to the consumer
+    bool passesArray = false;
+    for (auto origin:fusedOrigins) {
+        if (origin.first < 0 || origin.second < 0)
+            continue;
+        DataTransferType producerType = scops[0]->scopFunctonArgs[origin.first]->type;
+        DataTransferType consumerType = scops[1]->scopFunctonArgs[origin.second]->type;
+        if (producerType != UNKNOWN && producerType != TMP && (consumerType == OUT || consumerType == IN_OUT))
+            return NULL;
+        if ((producerType == OUT || producerType == IN_OUT) && consumerType == IN)
+            passesArray = true;
+    }
+    if (!passesArray)
+        return NULL;
+
+    //The fused function only calls the producer and the consumer
+    std::vector < Type * >fusedTypes;
+    for (Value * value:fusedValues) {
+        fusedTypes.push_back(value->getType());
+    }
+    std::string fusedName = "fused_" + producerCall->scopID + "_" + consumerCall->scopID;
+    Function *fusedFunction = Function::Create(FunctionType::get(Type::getVoidTy(mod->getContext()), fusedTypes, false), scops[0]->scopFunction->getLinkage(), fusedName, mod);
+    BasicBlock *entryBlock = BasicBlock::Create(mod->getContext(), "entry", fusedFunction);
+
+    //The formulas of the scop analysis refer to the argument names, they have to be unique in the fused function
+    std::vector < Argument * >fusedArgs;
+    std::map < std::string, std::string > names[2];
+    for (auto argIter = fusedFunction->arg_begin(); argIter != fusedFunction->arg_end(); argIter++) {
+        std::pair < int, int >origin = fusedOrigins[fusedArgs.size()];
+        ScopFnArg *scopArg = origin.first >= 0 ? scops[0]->scopFunctonArgs[origin.first] : scops[1]->scopFunctonArgs[origin.second];
+        argIter->setName(scopArg->name);
+        if (origin.first >= 0)
+            names[0][scops[0]->scopFunctonArgs[origin.first]->name] = argIter->getName().str();
+        if (origin.second >= 0)
+            names[1][scops[1]->scopFunctonArgs[origin.second]->name] = argIter->getName().str();
+        fusedArgs.push_back(&*argIter);
+    }
+    for (int callIte = 0; callIte < 2; callIte++) {
+        std::vector < Value * >params;
+        for (unsigned int argPos = 0; argPos < calls[callIte]->scopCallFunctonArgs.size(); argPos++) {
+            auto fusedValue = std::find(fusedValues.begin(), fusedValues.end(), calls[callIte]->scopCallFunctonArgs[argPos]->value);
+            params.push_back(fusedArgs[fusedValue - fusedValues.begin()]);
+        }
+        CallInst::Create(scops[callIte]->scopFunction, params, "", entryBlock);
+    }
+    ReturnInst::Create(mod->getContext(), entryBlock);
+
+    ScopDS *fusedScop = new ScopDS();
+    fusedScop->scopFunction = fusedFunction;
+    fusedScop->scopFunctionParent = scops[0]->scopFunctionParent;
+    fusedScop->resources = scops[0]->resources;
+    fusedScop->maxParalleizationDepth = std::min(scops[0]->maxParalleizationDepth, scops[1]->maxParalleizationDepth);
+    fusedScop->fusedFunctions.push_back(scops[0]->scopFunction);
+    fusedScop->fusedFunctions.push_back(scops[1]->scopFunction);
+
+    ScopCallDS *fusedCall = new ScopCallDS();
+    fusedCall->scopID = fusedName;
+    fusedCall->callInst = NULL;
+
+    bool discard = false;
+    for (unsigned int fusedPos = 0; fusedPos < fusedArgs.size(); fusedPos++) {
+        std::pair < int, int >origin = fusedOrigins[fusedPos];
+        ScopFnArg *fusedArg = NULL;
+        ScopCallFnArg *fusedCallArg = new ScopCallFnArg();
+        fusedCallArg->value = fusedValues[fusedPos];
+        fusedCallArg->typeOptimized = UNKNOWN;
+
+        for (int callIte = 0; callIte < 2; callIte++) {
+            int argPos = callIte == 0 ? origin.first : origin.second;
+            if (argPos < 0)
+                continue;
+            ScopFnArg *scopArg = new ScopFnArg(*scops[callIte]->scopFunctonArgs[argPos]);
+            for (auto & formula:scopArg->dimension_minStr) {
+                formula = renameFormula(formula, names[callIte]);
+            }
+            for (auto & formula:scopArg->dimension_maxStr) {
+                formula = renameFormula(formula, names[callIte]);
+            }
+            ScopCallFnArg *scopCallArg = calls[callIte]->scopCallFunctonArgs[argPos];
+            fusedCallArg->positionInParent = scopCallArg->positionInParent;
+            fusedCallArg->typeOptimized = combineTransferTypes(fusedCallArg->typeOptimized, scopCallArg->typeOptimized);
+
+            if (fusedArg == NULL || fusedArg->dimension == 0) {
+                if (fusedArg != NULL)
+                    scopArg->type = combineTransferTypes(fusedArg->type, scopArg->type);
+                delete fusedArg;
+                fusedArg = scopArg;
+                continue;
+            }
+            //Both scops access the array, the transfer needs one size
+            if (scopArg->dimension > 0 && scopArg->dimension_maxStr != fusedArg->dimension_maxStr)
+                discard = true;
+            fusedArg->type = combineTransferTypes(fusedArg->type, scopArg->type);
+            delete scopArg;
+        }
+
+        fusedArg->value = fusedArgs[fusedPos];
+        fusedArg->name = fusedArgs[fusedPos]->getName().str();
+        fusedScop->scopFunctonArgs.push_back(fusedArg);
+
+        //Intermediate array of the fused kernel, the host never sees it
+        if (origin.first >= 0 && origin.second >= 0 && scops[0]->scopFunctonArgs[origin.first]->type == OUT && scops[1]->scopFunctonArgs[origin.second]->type == IN
+            && isHostDead(fusedValues[fusedPos], producerCall->callInst, consumerCall->callInst)) {
+            fusedScop->fusedTmpArgs.push_back(fusedPos);
+            fusedCallArg->typeOptimized = TMP;
+        }
+        fusedCallArg->dimension_maxStr = fusedArg->dimension_maxStr;
+        fusedCall->scopCallFunctonArgs.push_back(fusedCallArg);
+    }
+
+    htrop::ScopFusionDS *scopFusion = new htrop::ScopFusionDS();
+    scopFusion->scopID = fusedName;
+    scopFusion->producerCall = producerCall;
+    scopFusion->consumerCall = consumerCall;
+    scopFusion->fusedCall = fusedCall;
+    scopList.insert(std::pair < std::string, ScopDS * >(fusedName, fusedScop));
+
+    if (discard) {
+        htrop::discardScopFusion(scopFusion, scopList);
+        return NULL;
+    }
+    return scopFusion;
+}
+
+std::vector < htrop::ScopFusionDS * >htrop::findScopFusions(Module * mod, ScopDSMap & scopList, std::vector < ScopCallDS * >&scopCallList) {
+    std::vector < ScopFusionDS * >scopFusions;
+
+    for (unsigned int callIte = 0; callIte + 1 < scopCallList.size(); callIte++) {
+        ScopCallDS *producerCall = scopCallList[callIte];
+        ScopCallDS *consumerCall = scopCallList[callIte + 1];
+        if (!areAdjacent(producerCall->callInst, consumerCall->callInst, mod->getDataLayout()))
+            continue;
+
+        ScopFusionDS *scopFusion = createScopFusion(mod, scopList, producerCall, consumerCall);
+        if (scopFusion == NULL)
+            continue;
+
+#ifdef HTROP_DEBUG
+        std::cout << "\nHTROP INFO: Fusing scops " << producerCall->scopID << " and " << consumerCall->scopID << " (" << scopList[scopFusion->scopID]->fusedTmpArgs.size() << " device-only arrays)";
+        std::cout.flush();
+#endif
+
+        scopFusions.push_back(scopFusion);
+        //The calls of a fusion are not fused again
+        callIte++;
+    }
+
+    return scopFusions;
+}
+
+void htrop::applyScopFusion(ScopFusionDS * scopFusion, ScopDSMap & scopList, std::vector < ScopCallDS * >&scopCallList) {
+    std::vector < Value * >fusedParams;
+    for (ScopCallFnArg * fusedCallArg:scopFusion->fusedCall->scopCallFunctonArgs) {
+        fusedParams.push_back(fusedCallArg->value);
+    }
+    scopFusion->fusedCall->callInst = CallInst::Create(scopList[scopFusion->scopID]->scopFunction, fusedParams, "", scopFusion->consumerCall->callInst);
+    scopFusion->producerCall->callInst->eraseFromParent();
+    scopFusion->consumerCall->callInst->eraseFromParent();
+
+    *std::find(scopCallList.begin(), scopCallList.end(), scopFusion->producerCall) = scopFusion->fusedCall;
+    scopCallList.erase(std::find(scopCallList.begin(), scopCallList.end(), scopFusion->consumerCall));
+    scopList.erase(scopFusion->producerCall->scopID);
+    scopList.erase(scopFusion->consumerCall->scopID);
+}
+
+void htrop::discardScopFusion(ScopFusionDS * scopFusion, ScopDSMap & scopList) {
+    auto fusedScop = scopList.find(scopFusion->scopID);
+    if (fusedScop == scopList.end())
+        return;
+    fusedScop->second->scopFunction->eraseFromParent();
+    scopList.erase(fusedScop);
+}
@@ -0,0 +1,63 @@
+//    Copyright (c) 2019 University of Paderborn
+//                         (Gavin Vaz <gavin.vaz@uni-paderborn.de>,
+//                          Heinrich Riebler <heinrich.riebler@uni-paderborn.de>)
+
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+
+//    The above copyright notice and this permission notice shall be included in
+//    all copies or substantial portions of the Software.
+
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//    THE SOFTWARE.
+
+
+#ifndef SCOPFUSION_H
+#define SCOPFUSION_H
+
+#include "llvm/IR/Module.h"
+#include "llvm/IR/Function.h"
+
+#include "../../common/sharedStructCompileRuntime.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+// Fusion of consecutive scop calls. A producer scop that writes an array and the following consumer scop
+// that reads it become one fused scop function calling both. The HTROP Server turns it into one kernel
+// if every work-item of the consumer only reads what its producer wrote, the array then stays in registers.
+namespace htrop {
+
+    typedef std::map < std::string, ScopDS * >ScopDSMap;
+
+    struct ScopFusionDS {
+        std::string scopID;     // Fused scop in the ScopDSMap
+        ScopCallDS *producerCall;
+        ScopCallDS *consumerCall;
+        ScopCallDS *fusedCall;  // Replaces both calls, applyScopFusion creates its callInst
+    };
+
+    // Add a fused scop for each pair of consecutive, non-overlapping scop calls that pass an array from the producer
+    // to the consumer. The calls stay unchanged until applyScopFusion.
+    std::vector < ScopFusionDS * >findScopFusions(Module * mod, ScopDSMap & scopList, std::vector < ScopCallDS * >&scopCallList);
+
+    // Call the fused scop instead of the producer and consumer, they are removed from the scop lists.
+    void applyScopFusion(ScopFusionDS * scopFusion, ScopDSMap & scopList, std::vector < ScopCallDS * >&scopCallList);
+
+    // Keep the separate calls, e.g. the server did not generate a fused kernel.
+    void discardScopFusion(ScopFusionDS * scopFusion, ScopDSMap & scopList);
+}
+
+#endif                          // SCOPFUSION_H
@@ -38,4 +38,15 @@ typedef enum {
     MIC
 } DeviceType;
 
+// Combination of a reduction acc[x] = acc[x] op value. Min and max (signed) only combine scatter updates.
+typedef enum {
+    RED_ADD,
+    RED_MUL,
+    RED_AND,
+    RED_OR,
+    RED_XOR,
+    RED_MIN,
+    RED_MAX
+} ReductionOperator;
+
 #endif                          //DATATRANSFERTYPE_INCLUDED
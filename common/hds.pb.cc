@@ -1,656 +1,1030 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: hds.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "hds.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace HTROP_PB {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* LLVM_IR_Req_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  LLVM_IR_Req_reflection_ = NULL;
-const ::google::protobuf::Descriptor* BinaryData_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  BinaryData_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Message_RCRS_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Message_RCRS_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Message_RCRS_ScopInfo_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Message_RCRS_ScopInfo_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Message_RSRC_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Message_RSRC_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Message_RSRC_ScopFunctionOCLInfo_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Message_RSRC_ScopFunctionOCLInfo_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_hds_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AssignDesc_hds_2eproto() {
-  protobuf_AddDesc_hds_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "hds.proto");
-  GOOGLE_CHECK(file != NULL);
-  LLVM_IR_Req_descriptor_ = file->message_type(0);
-  static const int LLVM_IR_Req_offsets_[1] = {
+namespace HTROP_PB {
+PROTOBUF_CONSTEXPR LLVM_IR_Req::LLVM_IR_Req(
+    ::_pbi::ConstantInitialized) {}
+struct LLVM_IR_ReqDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LLVM_IR_ReqDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LLVM_IR_ReqDefaultTypeInternal() {}
+  union {
+    LLVM_IR_Req _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LLVM_IR_ReqDefaultTypeInternal _LLVM_IR_Req_default_instance_;
+PROTOBUF_CONSTEXPR BinaryData::BinaryData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.binary_data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct BinaryDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BinaryDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BinaryDataDefaultTypeInternal() {}
+  union {
+    BinaryData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BinaryDataDefaultTypeInternal _BinaryData_default_instance_;
+PROTOBUF_CONSTEXPR ReductionHint::ReductionHint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.arg_position_)*/0u
+  , /*decltype(_impl_.loop_depth_)*/0u
+  , /*decltype(_impl_.reduction_operator_)*/0} {}
+struct ReductionHintDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReductionHintDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReductionHintDefaultTypeInternal() {}
+  union {
+    ReductionHint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReductionHintDefaultTypeInternal _ReductionHint_default_instance_;
+PROTOBUF_CONSTEXPR ScatterHint::ScatterHint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.arg_position_)*/0u
+  , /*decltype(_impl_.scatter_operator_)*/0
+  , /*decltype(_impl_.num_elements_)*/uint64_t{0u}} {}
+struct ScatterHintDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScatterHintDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScatterHintDefaultTypeInternal() {}
+  union {
+    ScatterHint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScatterHintDefaultTypeInternal _ScatterHint_default_instance_;
+PROTOBUF_CONSTEXPR ReadOnlyArgHint::ReadOnlyArgHint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.num_elements_)*/uint64_t{0u}
+  , /*decltype(_impl_.arg_position_)*/0u} {}
+struct ReadOnlyArgHintDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadOnlyArgHintDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadOnlyArgHintDefaultTypeInternal() {}
+  union {
+    ReadOnlyArgHint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadOnlyArgHintDefaultTypeInternal _ReadOnlyArgHint_default_instance_;
+PROTOBUF_CONSTEXPR Message_RCRS_ScopInfo::Message_RCRS_ScopInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.read_only_args_)*/{}
+  , /*decltype(_impl_.fused_functions_)*/{}
+  , /*decltype(_impl_.fused_tmp_args_)*/{}
+  , /*decltype(_impl_.scopfunctionname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.reduction_)*/nullptr
+  , /*decltype(_impl_.scatter_)*/nullptr
+  , /*decltype(_impl_.max_codegen_loop_depth_)*/0u
+  , /*decltype(_impl_.num_loop_trip_counts_)*/0u
+  , /*decltype(_impl_.wavefront_skew_)*/0u} {}
+struct Message_RCRS_ScopInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Message_RCRS_ScopInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Message_RCRS_ScopInfoDefaultTypeInternal() {}
+  union {
+    Message_RCRS_ScopInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Message_RCRS_ScopInfoDefaultTypeInternal _Message_RCRS_ScopInfo_default_instance_;
+PROTOBUF_CONSTEXPR Message_RCRS::Message_RCRS(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.scoplist_)*/{}
+  , /*decltype(_impl_.scopfunctionparentname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.module_hash_)*/uint64_t{0u}} {}
+struct Message_RCRSDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Message_RCRSDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Message_RCRSDefaultTypeInternal() {}
+  union {
+    Message_RCRS _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Message_RCRSDefaultTypeInternal _Message_RCRS_default_instance_;
+PROTOBUF_CONSTEXPR Message_RSRC_WorkItemFactor::Message_RSRC_WorkItemFactor(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.dimension_)*/0u
+  , /*decltype(_impl_.factor_mcpu_)*/0u
+  , /*decltype(_impl_.factor_gpu_)*/0u
+  , /*decltype(_impl_.factor_mic_)*/0u} {}
+struct Message_RSRC_WorkItemFactorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Message_RSRC_WorkItemFactorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Message_RSRC_WorkItemFactorDefaultTypeInternal() {}
+  union {
+    Message_RSRC_WorkItemFactor _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Message_RSRC_WorkItemFactorDefaultTypeInternal _Message_RSRC_WorkItemFactor_default_instance_;
+PROTOBUF_CONSTEXPR Message_RSRC_Reduction::Message_RSRC_Reduction(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.arg_position_)*/0u
+  , /*decltype(_impl_.reduction_operator_)*/0
+  , /*decltype(_impl_.is_float_)*/false
+  , /*decltype(_impl_.data_type_size_)*/0u
+  , /*decltype(_impl_.partial_arg_position_)*/0u} {}
+struct Message_RSRC_ReductionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Message_RSRC_ReductionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Message_RSRC_ReductionDefaultTypeInternal() {}
+  union {
+    Message_RSRC_Reduction _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Message_RSRC_ReductionDefaultTypeInternal _Message_RSRC_Reduction_default_instance_;
+PROTOBUF_CONSTEXPR Message_RSRC_ImageArg::Message_RSRC_ImageArg(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.arg_position_)*/0u
+  , /*decltype(_impl_.row_width_arg_)*/0
+  , /*decltype(_impl_.is_float_)*/false} {}
+struct Message_RSRC_ImageArgDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Message_RSRC_ImageArgDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Message_RSRC_ImageArgDefaultTypeInternal() {}
+  union {
+    Message_RSRC_ImageArg _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Message_RSRC_ImageArgDefaultTypeInternal _Message_RSRC_ImageArg_default_instance_;
+PROTOBUF_CONSTEXPR Message_RSRC_PitchedArg::Message_RSRC_PitchedArg(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.row_width_)*/uint64_t{0u}
+  , /*decltype(_impl_.arg_position_)*/0u
+  , /*decltype(_impl_.data_type_size_)*/0u} {}
+struct Message_RSRC_PitchedArgDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Message_RSRC_PitchedArgDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Message_RSRC_PitchedArgDefaultTypeInternal() {}
+  union {
+    Message_RSRC_PitchedArg _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Message_RSRC_PitchedArgDefaultTypeInternal _Message_RSRC_PitchedArg_default_instance_;
+PROTOBUF_CONSTEXPR Message_RSRC_ScopFunctionOCLInfo::Message_RSRC_ScopFunctionOCLInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.workgroup_arg_index_)*/{}
+  , /*decltype(_impl_.workgroup_arg_index_offset_)*/{}
+  , /*decltype(_impl_.local_work_size_)*/{}
+  , /*decltype(_impl_.register_block_)*/{}
+  , /*decltype(_impl_.vector_width_)*/{}
+  , /*decltype(_impl_.coarsening_)*/{}
+  , /*decltype(_impl_.workgroup_loop_index_)*/{}
+  , /*decltype(_impl_.image_args_)*/{}
+  , /*decltype(_impl_.variants_)*/{}
+  , /*decltype(_impl_.size_versions_)*/{}
+  , /*decltype(_impl_.pitched_args_)*/{}
+  , /*decltype(_impl_.distributed_kernels_)*/{}
+  , /*decltype(_impl_.border_low_)*/{}
+  , /*decltype(_impl_.border_high_)*/{}
+  , /*decltype(_impl_.min_global_size_)*/{}
+  , /*decltype(_impl_.max_global_size_)*/{}
+  , /*decltype(_impl_.scopfunctionname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.scopoclkernelname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.reduction_)*/nullptr
+  , /*decltype(_impl_.interior_kernel_)*/nullptr
+  , /*decltype(_impl_.min_work_items_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_work_items_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.wavefront_skew_)*/0u} {}
+struct Message_RSRC_ScopFunctionOCLInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Message_RSRC_ScopFunctionOCLInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Message_RSRC_ScopFunctionOCLInfoDefaultTypeInternal() {}
+  union {
+    Message_RSRC_ScopFunctionOCLInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Message_RSRC_ScopFunctionOCLInfoDefaultTypeInternal _Message_RSRC_ScopFunctionOCLInfo_default_instance_;
+PROTOBUF_CONSTEXPR Message_RSRC::Message_RSRC(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.scopfunctions_)*/{}
+  , /*decltype(_impl_.oclkernelfilename_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.binarysize_)*/0u} {}
+struct Message_RSRCDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Message_RSRCDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Message_RSRCDefaultTypeInternal() {}
+  union {
+    Message_RSRC _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Message_RSRCDefaultTypeInternal _Message_RSRC_default_instance_;
+PROTOBUF_CONSTEXPR ScopArgInfo::ScopArgInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.dimension_min_)*/{}
+  , /*decltype(_impl_.dimension_max_)*/{}
+  , /*decltype(_impl_.dimension_minstr_)*/{}
+  , /*decltype(_impl_.dimension_maxstr_)*/{}
+  , /*decltype(_impl_.dimension_offset_min_)*/{}
+  , /*decltype(_impl_.dimension_offset_max_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.ispointer_)*/false
+  , /*decltype(_impl_.dimension_)*/0u} {}
+struct ScopArgInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScopArgInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScopArgInfoDefaultTypeInternal() {}
+  union {
+    ScopArgInfo _instance;
   };
-  LLVM_IR_Req_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      LLVM_IR_Req_descriptor_,
-      LLVM_IR_Req::default_instance_,
-      LLVM_IR_Req_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LLVM_IR_Req, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(LLVM_IR_Req),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LLVM_IR_Req, _internal_metadata_),
-      -1);
-  BinaryData_descriptor_ = file->message_type(1);
-  static const int BinaryData_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinaryData, binary_data_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScopArgInfoDefaultTypeInternal _ScopArgInfo_default_instance_;
+PROTOBUF_CONSTEXPR ScopLoopBound::ScopLoopBound(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.namestr_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.maxvaluestr_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.maxvalue_)*/uint64_t{0u}} {}
+struct ScopLoopBoundDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScopLoopBoundDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScopLoopBoundDefaultTypeInternal() {}
+  union {
+    ScopLoopBound _instance;
   };
-  BinaryData_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      BinaryData_descriptor_,
-      BinaryData::default_instance_,
-      BinaryData_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinaryData, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(BinaryData),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(BinaryData, _internal_metadata_),
-      -1);
-  Message_RCRS_descriptor_ = file->message_type(2);
-  static const int Message_RCRS_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RCRS, scoplist_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RCRS, scopfunctionparentname_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScopLoopBoundDefaultTypeInternal _ScopLoopBound_default_instance_;
+PROTOBUF_CONSTEXPR ScopAnalysisInfo::ScopAnalysisInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.scopfunctionargs_)*/{}
+  , /*decltype(_impl_.scoploops_)*/{}
+  , /*decltype(_impl_.scopfunctionname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.scopfunctionparentname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.reduction_)*/nullptr
+  , /*decltype(_impl_.scatter_)*/nullptr
+  , /*decltype(_impl_.maxparallelizationdepth_)*/0u
+  , /*decltype(_impl_.wavefront_skew_)*/0u} {}
+struct ScopAnalysisInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScopAnalysisInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScopAnalysisInfoDefaultTypeInternal() {}
+  union {
+    ScopAnalysisInfo _instance;
   };
-  Message_RCRS_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      Message_RCRS_descriptor_,
-      Message_RCRS::default_instance_,
-      Message_RCRS_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RCRS, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(Message_RCRS),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RCRS, _internal_metadata_),
-      -1);
-  Message_RCRS_ScopInfo_descriptor_ = Message_RCRS_descriptor_->nested_type(0);
-  static const int Message_RCRS_ScopInfo_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RCRS_ScopInfo, scopfunctionname_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RCRS_ScopInfo, max_codegen_loop_depth_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScopAnalysisInfoDefaultTypeInternal _ScopAnalysisInfo_default_instance_;
+PROTOBUF_CONSTEXPR Message_RCRS_Analysis::Message_RCRS_Analysis(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.max_scop_loop_depth_)*/{}
+  , /*decltype(_impl_.max_codegen_loop_depth_)*/{}
+  , /*decltype(_impl_.modulesize_)*/0u
+  , /*decltype(_impl_.optimize_schedule_)*/false} {}
+struct Message_RCRS_AnalysisDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Message_RCRS_AnalysisDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Message_RCRS_AnalysisDefaultTypeInternal() {}
+  union {
+    Message_RCRS_Analysis _instance;
   };
-  Message_RCRS_ScopInfo_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      Message_RCRS_ScopInfo_descriptor_,
-      Message_RCRS_ScopInfo::default_instance_,
-      Message_RCRS_ScopInfo_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RCRS_ScopInfo, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(Message_RCRS_ScopInfo),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RCRS_ScopInfo, _internal_metadata_),
-      -1);
-  Message_RSRC_descriptor_ = file->message_type(3);
-  static const int Message_RSRC_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RSRC, scopfunctions_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RSRC, oclkernelfilename_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RSRC, binarysize_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Message_RCRS_AnalysisDefaultTypeInternal _Message_RCRS_Analysis_default_instance_;
+PROTOBUF_CONSTEXPR Message_RSRC_Analysis::Message_RSRC_Analysis(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.resultsize_)*/0u} {}
+struct Message_RSRC_AnalysisDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Message_RSRC_AnalysisDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Message_RSRC_AnalysisDefaultTypeInternal() {}
+  union {
+    Message_RSRC_Analysis _instance;
   };
-  Message_RSRC_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      Message_RSRC_descriptor_,
-      Message_RSRC::default_instance_,
-      Message_RSRC_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RSRC, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(Message_RSRC),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RSRC, _internal_metadata_),
-      -1);
-  Message_RSRC_ScopFunctionOCLInfo_descriptor_ = Message_RSRC_descriptor_->nested_type(0);
-  static const int Message_RSRC_ScopFunctionOCLInfo_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RSRC_ScopFunctionOCLInfo, scopfunctionname_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RSRC_ScopFunctionOCLInfo, scopoclkernelname_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RSRC_ScopFunctionOCLInfo, workgroup_arg_index_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RSRC_ScopFunctionOCLInfo, workgroup_arg_index_offset_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Message_RSRC_AnalysisDefaultTypeInternal _Message_RSRC_Analysis_default_instance_;
+PROTOBUF_CONSTEXPR ScopAnalysisResult::ScopAnalysisResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.scops_)*/{}
+  , /*decltype(_impl_.codegen_)*/nullptr} {}
+struct ScopAnalysisResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScopAnalysisResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScopAnalysisResultDefaultTypeInternal() {}
+  union {
+    ScopAnalysisResult _instance;
   };
-  Message_RSRC_ScopFunctionOCLInfo_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      Message_RSRC_ScopFunctionOCLInfo_descriptor_,
-      Message_RSRC_ScopFunctionOCLInfo::default_instance_,
-      Message_RSRC_ScopFunctionOCLInfo_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RSRC_ScopFunctionOCLInfo, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(Message_RSRC_ScopFunctionOCLInfo),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Message_RSRC_ScopFunctionOCLInfo, _internal_metadata_),
-      -1);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_hds_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      LLVM_IR_Req_descriptor_, &LLVM_IR_Req::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      BinaryData_descriptor_, &BinaryData::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      Message_RCRS_descriptor_, &Message_RCRS::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      Message_RCRS_ScopInfo_descriptor_, &Message_RCRS_ScopInfo::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      Message_RSRC_descriptor_, &Message_RSRC::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      Message_RSRC_ScopFunctionOCLInfo_descriptor_, &Message_RSRC_ScopFunctionOCLInfo::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_hds_2eproto() {
-  delete LLVM_IR_Req::default_instance_;
-  delete LLVM_IR_Req_reflection_;
-  delete BinaryData::default_instance_;
-  delete BinaryData_reflection_;
-  delete Message_RCRS::default_instance_;
-  delete Message_RCRS_reflection_;
-  delete Message_RCRS_ScopInfo::default_instance_;
-  delete Message_RCRS_ScopInfo_reflection_;
-  delete Message_RSRC::default_instance_;
-  delete Message_RSRC_reflection_;
-  delete Message_RSRC_ScopFunctionOCLInfo::default_instance_;
-  delete Message_RSRC_ScopFunctionOCLInfo_reflection_;
-}
-
-void protobuf_AddDesc_hds_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AddDesc_hds_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\thds.proto\022\010HTROP_PB\"\r\n\013LLVM_IR_Req\"!\n\n"
-    "BinaryData\022\023\n\013binary_data\030\001 \001(\014\"\247\001\n\014Mess"
-    "age_RCRS\0221\n\010scopList\030\001 \003(\0132\037.HTROP_PB.Me"
-    "ssage_RCRS.ScopInfo\022\036\n\026scopFunctionParen"
-    "tName\030\002 \001(\t\032D\n\010ScopInfo\022\030\n\020scopFunctionN"
-    "ame\030\001 \001(\t\022\036\n\026max_codegen_loop_depth\030\002 \001("
-    "\r\"\216\002\n\014Message_RSRC\022A\n\rscopFunctions\030\001 \003("
-    "\0132*.HTROP_PB.Message_RSRC.ScopFunctionOC"
-    "LInfo\022\031\n\021oclKernelFileName\030\002 \001(\t\022\022\n\nbina"
-    "rySize\030\003 \001(\r\032\213\001\n\023ScopFunctionOCLInfo\022\030\n\020"
-    "scopFunctionName\030\001 \001(\t\022\031\n\021scopOCLKernelN"
-    "ame\030\002 \001(\t\022\033\n\023workgroup_arg_index\030\003 \003(\005\022\""
-    "\n\032workgroup_arg_index_offset\030\004 \003(\005", 514);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "hds.proto", &protobuf_RegisterTypes);
-  LLVM_IR_Req::default_instance_ = new LLVM_IR_Req();
-  BinaryData::default_instance_ = new BinaryData();
-  Message_RCRS::default_instance_ = new Message_RCRS();
-  Message_RCRS_ScopInfo::default_instance_ = new Message_RCRS_ScopInfo();
-  Message_RSRC::default_instance_ = new Message_RSRC();
-  Message_RSRC_ScopFunctionOCLInfo::default_instance_ = new Message_RSRC_ScopFunctionOCLInfo();
-  LLVM_IR_Req::default_instance_->InitAsDefaultInstance();
-  BinaryData::default_instance_->InitAsDefaultInstance();
-  Message_RCRS::default_instance_->InitAsDefaultInstance();
-  Message_RCRS_ScopInfo::default_instance_->InitAsDefaultInstance();
-  Message_RSRC::default_instance_->InitAsDefaultInstance();
-  Message_RSRC_ScopFunctionOCLInfo::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_hds_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_hds_2eproto {
-  StaticDescriptorInitializer_hds_2eproto() {
-    protobuf_AddDesc_hds_2eproto();
-  }
-} static_descriptor_initializer_hds_2eproto_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScopAnalysisResultDefaultTypeInternal _ScopAnalysisResult_default_instance_;
+}  // namespace HTROP_PB
+static ::_pb::Metadata file_level_metadata_hds_2eproto[19];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_hds_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_hds_2eproto = nullptr;
+
+const uint32_t TableStruct_hds_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::LLVM_IR_Req, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::BinaryData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::BinaryData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::BinaryData, _impl_.binary_data_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ReductionHint, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ReductionHint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ReductionHint, _impl_.arg_position_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ReductionHint, _impl_.loop_depth_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ReductionHint, _impl_.reduction_operator_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScatterHint, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScatterHint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScatterHint, _impl_.arg_position_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScatterHint, _impl_.scatter_operator_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScatterHint, _impl_.num_elements_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ReadOnlyArgHint, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ReadOnlyArgHint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ReadOnlyArgHint, _impl_.arg_position_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ReadOnlyArgHint, _impl_.num_elements_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_ScopInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_ScopInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_ScopInfo, _impl_.scopfunctionname_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_ScopInfo, _impl_.max_codegen_loop_depth_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_ScopInfo, _impl_.reduction_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_ScopInfo, _impl_.num_loop_trip_counts_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_ScopInfo, _impl_.read_only_args_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_ScopInfo, _impl_.fused_functions_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_ScopInfo, _impl_.fused_tmp_args_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_ScopInfo, _impl_.wavefront_skew_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_ScopInfo, _impl_.scatter_),
+  0,
+  3,
+  1,
+  4,
+  ~0u,
+  ~0u,
+  ~0u,
+  5,
+  2,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS, _impl_.scoplist_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS, _impl_.scopfunctionparentname_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS, _impl_.module_hash_),
+  ~0u,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_WorkItemFactor, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_WorkItemFactor, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_WorkItemFactor, _impl_.dimension_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_WorkItemFactor, _impl_.factor_mcpu_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_WorkItemFactor, _impl_.factor_gpu_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_WorkItemFactor, _impl_.factor_mic_),
+  0,
+  1,
+  2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_Reduction, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_Reduction, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_Reduction, _impl_.arg_position_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_Reduction, _impl_.reduction_operator_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_Reduction, _impl_.is_float_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_Reduction, _impl_.data_type_size_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_Reduction, _impl_.partial_arg_position_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ImageArg, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ImageArg, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ImageArg, _impl_.arg_position_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ImageArg, _impl_.row_width_arg_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ImageArg, _impl_.is_float_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_PitchedArg, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_PitchedArg, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_PitchedArg, _impl_.arg_position_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_PitchedArg, _impl_.row_width_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_PitchedArg, _impl_.data_type_size_),
+  1,
+  0,
+  2,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.scopfunctionname_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.scopoclkernelname_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.workgroup_arg_index_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.workgroup_arg_index_offset_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.local_work_size_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.register_block_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.vector_width_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.coarsening_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.reduction_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.workgroup_loop_index_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.image_args_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.variants_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.size_versions_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.min_work_items_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.max_work_items_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.pitched_args_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.max_index_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.wavefront_skew_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.distributed_kernels_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.interior_kernel_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.border_low_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.border_high_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.min_global_size_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo, _impl_.max_global_size_),
+  0,
+  1,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  2,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  4,
+  5,
+  ~0u,
+  6,
+  7,
+  ~0u,
+  3,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC, _impl_.scopfunctions_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC, _impl_.oclkernelfilename_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC, _impl_.binarysize_),
+  ~0u,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopArgInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopArgInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopArgInfo, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopArgInfo, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopArgInfo, _impl_.ispointer_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopArgInfo, _impl_.dimension_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopArgInfo, _impl_.dimension_min_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopArgInfo, _impl_.dimension_max_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopArgInfo, _impl_.dimension_minstr_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopArgInfo, _impl_.dimension_maxstr_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopArgInfo, _impl_.dimension_offset_min_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopArgInfo, _impl_.dimension_offset_max_),
+  0,
+  1,
+  2,
+  3,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopLoopBound, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopLoopBound, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopLoopBound, _impl_.namestr_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopLoopBound, _impl_.maxvalue_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopLoopBound, _impl_.maxvaluestr_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisInfo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisInfo, _impl_.scopfunctionname_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisInfo, _impl_.scopfunctionparentname_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisInfo, _impl_.scopfunctionargs_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisInfo, _impl_.scoploops_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisInfo, _impl_.maxparallelizationdepth_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisInfo, _impl_.reduction_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisInfo, _impl_.wavefront_skew_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisInfo, _impl_.scatter_),
+  0,
+  1,
+  ~0u,
+  ~0u,
+  4,
+  2,
+  5,
+  3,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_Analysis, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_Analysis, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_Analysis, _impl_.max_scop_loop_depth_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_Analysis, _impl_.max_codegen_loop_depth_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_Analysis, _impl_.modulesize_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RCRS_Analysis, _impl_.optimize_schedule_),
+  ~0u,
+  ~0u,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_Analysis, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_Analysis, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::Message_RSRC_Analysis, _impl_.resultsize_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisResult, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisResult, _impl_.scops_),
+  PROTOBUF_FIELD_OFFSET(::HTROP_PB::ScopAnalysisResult, _impl_.codegen_),
+  ~0u,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::HTROP_PB::LLVM_IR_Req)},
+  { 6, 13, -1, sizeof(::HTROP_PB::BinaryData)},
+  { 14, 23, -1, sizeof(::HTROP_PB::ReductionHint)},
+  { 26, 35, -1, sizeof(::HTROP_PB::ScatterHint)},
+  { 38, 46, -1, sizeof(::HTROP_PB::ReadOnlyArgHint)},
+  { 48, 63, -1, sizeof(::HTROP_PB::Message_RCRS_ScopInfo)},
+  { 72, 81, -1, sizeof(::HTROP_PB::Message_RCRS)},
+  { 84, 94, -1, sizeof(::HTROP_PB::Message_RSRC_WorkItemFactor)},
+  { 98, 109, -1, sizeof(::HTROP_PB::Message_RSRC_Reduction)},
+  { 114, 123, -1, sizeof(::HTROP_PB::Message_RSRC_ImageArg)},
+  { 126, 135, -1, sizeof(::HTROP_PB::Message_RSRC_PitchedArg)},
+  { 138, 168, -1, sizeof(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo)},
+  { 192, 201, -1, sizeof(::HTROP_PB::Message_RSRC)},
+  { 204, 220, -1, sizeof(::HTROP_PB::ScopArgInfo)},
+  { 230, 239, -1, sizeof(::HTROP_PB::ScopLoopBound)},
+  { 242, 256, -1, sizeof(::HTROP_PB::ScopAnalysisInfo)},
+  { 264, 274, -1, sizeof(::HTROP_PB::Message_RCRS_Analysis)},
+  { 278, 285, -1, sizeof(::HTROP_PB::Message_RSRC_Analysis)},
+  { 286, 294, -1, sizeof(::HTROP_PB::ScopAnalysisResult)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::HTROP_PB::_LLVM_IR_Req_default_instance_._instance,
+  &::HTROP_PB::_BinaryData_default_instance_._instance,
+  &::HTROP_PB::_ReductionHint_default_instance_._instance,
+  &::HTROP_PB::_ScatterHint_default_instance_._instance,
+  &::HTROP_PB::_ReadOnlyArgHint_default_instance_._instance,
+  &::HTROP_PB::_Message_RCRS_ScopInfo_default_instance_._instance,
+  &::HTROP_PB::_Message_RCRS_default_instance_._instance,
+  &::HTROP_PB::_Message_RSRC_WorkItemFactor_default_instance_._instance,
+  &::HTROP_PB::_Message_RSRC_Reduction_default_instance_._instance,
+  &::HTROP_PB::_Message_RSRC_ImageArg_default_instance_._instance,
+  &::HTROP_PB::_Message_RSRC_PitchedArg_default_instance_._instance,
+  &::HTROP_PB::_Message_RSRC_ScopFunctionOCLInfo_default_instance_._instance,
+  &::HTROP_PB::_Message_RSRC_default_instance_._instance,
+  &::HTROP_PB::_ScopArgInfo_default_instance_._instance,
+  &::HTROP_PB::_ScopLoopBound_default_instance_._instance,
+  &::HTROP_PB::_ScopAnalysisInfo_default_instance_._instance,
+  &::HTROP_PB::_Message_RCRS_Analysis_default_instance_._instance,
+  &::HTROP_PB::_Message_RSRC_Analysis_default_instance_._instance,
+  &::HTROP_PB::_ScopAnalysisResult_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_hds_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\thds.proto\022\010HTROP_PB\"\r\n\013LLVM_IR_Req\"!\n\n"
+  "BinaryData\022\023\n\013binary_data\030\001 \001(\014\"U\n\rReduc"
+  "tionHint\022\024\n\014arg_position\030\001 \001(\r\022\022\n\nloop_d"
+  "epth\030\002 \001(\r\022\032\n\022reduction_operator\030\003 \001(\005\"S"
+  "\n\013ScatterHint\022\024\n\014arg_position\030\001 \001(\r\022\030\n\020s"
+  "catter_operator\030\002 \001(\005\022\024\n\014num_elements\030\003 "
+  "\001(\004\"=\n\017ReadOnlyArgHint\022\024\n\014arg_position\030\001"
+  " \001(\r\022\024\n\014num_elements\030\002 \001(\004\"\253\003\n\014Message_R"
+  "CRS\0221\n\010scopList\030\001 \003(\0132\037.HTROP_PB.Message"
+  "_RCRS.ScopInfo\022\036\n\026scopFunctionParentName"
+  "\030\002 \001(\t\022\023\n\013module_hash\030\003 \001(\006\032\262\002\n\010ScopInfo"
+  "\022\030\n\020scopFunctionName\030\001 \001(\t\022\036\n\026max_codege"
+  "n_loop_depth\030\002 \001(\r\022*\n\treduction\030\003 \001(\0132\027."
+  "HTROP_PB.ReductionHint\022\034\n\024num_loop_trip_"
+  "counts\030\004 \001(\r\0221\n\016read_only_args\030\005 \003(\0132\031.H"
+  "TROP_PB.ReadOnlyArgHint\022\027\n\017fused_functio"
+  "ns\030\006 \003(\t\022\026\n\016fused_tmp_args\030\007 \003(\r\022\026\n\016wave"
+  "front_skew\030\010 \001(\r\022&\n\007scatter\030\t \001(\0132\025.HTRO"
+  "P_PB.ScatterHint\"\350\013\n\014Message_RSRC\022A\n\rsco"
+  "pFunctions\030\001 \003(\0132*.HTROP_PB.Message_RSRC"
+  ".ScopFunctionOCLInfo\022\031\n\021oclKernelFileNam"
+  "e\030\002 \001(\t\022\022\n\nbinarySize\030\003 \001(\r\032`\n\016WorkItemF"
+  "actor\022\021\n\tdimension\030\001 \001(\r\022\023\n\013factor_mcpu\030"
+  "\002 \001(\r\022\022\n\nfactor_gpu\030\003 \001(\r\022\022\n\nfactor_mic\030"
+  "\004 \001(\r\032\205\001\n\tReduction\022\024\n\014arg_position\030\001 \001("
+  "\r\022\032\n\022reduction_operator\030\002 \001(\005\022\020\n\010is_floa"
+  "t\030\003 \001(\010\022\026\n\016data_type_size\030\004 \001(\r\022\034\n\024parti"
+  "al_arg_position\030\005 \001(\r\032I\n\010ImageArg\022\024\n\014arg"
+  "_position\030\001 \001(\r\022\025\n\rrow_width_arg\030\002 \001(\005\022\020"
+  "\n\010is_float\030\003 \001(\010\032M\n\nPitchedArg\022\024\n\014arg_po"
+  "sition\030\001 \001(\r\022\021\n\trow_width\030\002 \001(\004\022\026\n\016data_"
+  "type_size\030\003 \001(\r\032\341\007\n\023ScopFunctionOCLInfo\022"
+  "\030\n\020scopFunctionName\030\001 \001(\t\022\031\n\021scopOCLKern"
+  "elName\030\002 \001(\t\022\033\n\023workgroup_arg_index\030\003 \003("
+  "\005\022\"\n\032workgroup_arg_index_offset\030\004 \003(\005\022\027\n"
+  "\017local_work_size\030\005 \003(\r\022=\n\016register_block"
+  "\030\006 \003(\0132%.HTROP_PB.Message_RSRC.WorkItemF"
+  "actor\022;\n\014vector_width\030\007 \003(\0132%.HTROP_PB.M"
+  "essage_RSRC.WorkItemFactor\0229\n\ncoarsening"
+  "\030\010 \003(\0132%.HTROP_PB.Message_RSRC.WorkItemF"
+  "actor\0223\n\treduction\030\t \001(\0132 .HTROP_PB.Mess"
+  "age_RSRC.Reduction\022\034\n\024workgroup_loop_ind"
+  "ex\030\n \003(\005\0223\n\nimage_args\030\013 \003(\0132\037.HTROP_PB."
+  "Message_RSRC.ImageArg\022<\n\010variants\030\014 \003(\0132"
+  "*.HTROP_PB.Message_RSRC.ScopFunctionOCLI"
+  "nfo\022A\n\rsize_versions\030\r \003(\0132*.HTROP_PB.Me"
+  "ssage_RSRC.ScopFunctionOCLInfo\022\026\n\016min_wo"
+  "rk_items\030\016 \001(\004\022\026\n\016max_work_items\030\017 \001(\004\0227"
+  "\n\014pitched_args\030\020 \003(\0132!.HTROP_PB.Message_"
+  "RSRC.PitchedArg\022\021\n\tmax_index\030\021 \001(\004\022\026\n\016wa"
+  "vefront_skew\030\022 \001(\r\022G\n\023distributed_kernel"
+  "s\030\023 \003(\0132*.HTROP_PB.Message_RSRC.ScopFunc"
+  "tionOCLInfo\022C\n\017interior_kernel\030\024 \001(\0132*.H"
+  "TROP_PB.Message_RSRC.ScopFunctionOCLInfo"
+  "\022\022\n\nborder_low\030\025 \003(\r\022\023\n\013border_high\030\026 \003("
+  "\r\022\027\n\017min_global_size\030\027 \003(\004\022\027\n\017max_global"
+  "_size\030\030 \003(\004\"\355\001\n\013ScopArgInfo\022\014\n\004name\030\001 \001("
+  "\t\022\014\n\004type\030\002 \001(\005\022\021\n\tisPointer\030\003 \001(\010\022\021\n\tdi"
+  "mension\030\004 \001(\r\022\025\n\rdimension_min\030\005 \003(\003\022\025\n\r"
+  "dimension_max\030\006 \003(\003\022\030\n\020dimension_minStr\030"
+  "\007 \003(\t\022\030\n\020dimension_maxStr\030\010 \003(\t\022\034\n\024dimen"
+  "sion_offset_min\030\t \003(\003\022\034\n\024dimension_offse"
+  "t_max\030\n \003(\003\"G\n\rScopLoopBound\022\017\n\007nameStr\030"
+  "\001 \001(\t\022\020\n\010maxValue\030\002 \001(\004\022\023\n\013maxValueStr\030\003"
+  " \001(\t\"\266\002\n\020ScopAnalysisInfo\022\030\n\020scopFunctio"
+  "nName\030\001 \001(\t\022\036\n\026scopFunctionParentName\030\002 "
+  "\001(\t\022/\n\020scopFunctionArgs\030\003 \003(\0132\025.HTROP_PB"
+  ".ScopArgInfo\022*\n\tscopLoops\030\004 \003(\0132\027.HTROP_"
+  "PB.ScopLoopBound\022\037\n\027maxParallelizationDe"
+  "pth\030\005 \001(\r\022*\n\treduction\030\006 \001(\0132\027.HTROP_PB."
+  "ReductionHint\022\026\n\016wavefront_skew\030\007 \001(\r\022&\n"
+  "\007scatter\030\010 \001(\0132\025.HTROP_PB.ScatterHint\"\203\001"
+  "\n\025Message_RCRS_Analysis\022\033\n\023max_scop_loop"
+  "_depth\030\001 \003(\005\022\036\n\026max_codegen_loop_depth\030\002"
+  " \003(\005\022\022\n\nmoduleSize\030\003 \001(\r\022\031\n\021optimize_sch"
+  "edule\030\004 \001(\010\"+\n\025Message_RSRC_Analysis\022\022\n\n"
+  "resultSize\030\001 \001(\r\"h\n\022ScopAnalysisResult\022)"
+  "\n\005scops\030\001 \003(\0132\032.HTROP_PB.ScopAnalysisInf"
+  "o\022\'\n\007codeGen\030\002 \001(\0132\026.HTROP_PB.Message_RS"
+  "RC"
+  ;
+static ::_pbi::once_flag descriptor_table_hds_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_hds_2eproto = {
+    false, false, 3162, descriptor_table_protodef_hds_2eproto,
+    "hds.proto",
+    &descriptor_table_hds_2eproto_once, nullptr, 0, 19,
+    schemas, file_default_instances, TableStruct_hds_2eproto::offsets,
+    file_level_metadata_hds_2eproto, file_level_enum_descriptors_hds_2eproto,
+    file_level_service_descriptors_hds_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_hds_2eproto_getter() {
+  return &descriptor_table_hds_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_hds_2eproto(&descriptor_table_hds_2eproto);
+namespace HTROP_PB {
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-LLVM_IR_Req::LLVM_IR_Req()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:HTROP_PB.LLVM_IR_Req)
-}
+class LLVM_IR_Req::_Internal {
+ public:
+};
 
-void LLVM_IR_Req::InitAsDefaultInstance() {
+LLVM_IR_Req::LLVM_IR_Req(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.LLVM_IR_Req)
 }
-
 LLVM_IR_Req::LLVM_IR_Req(const LLVM_IR_Req& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  LLVM_IR_Req* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:HTROP_PB.LLVM_IR_Req)
 }
 
-void LLVM_IR_Req::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
-
-LLVM_IR_Req::~LLVM_IR_Req() {
-  // @@protoc_insertion_point(destructor:HTROP_PB.LLVM_IR_Req)
-  SharedDtor();
-}
-
-void LLVM_IR_Req::SharedDtor() {
-  if (this != default_instance_) {
-  }
-}
-
-void LLVM_IR_Req::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* LLVM_IR_Req::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return LLVM_IR_Req_descriptor_;
-}
-
-const LLVM_IR_Req& LLVM_IR_Req::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_hds_2eproto();
-  return *default_instance_;
-}
-
-LLVM_IR_Req* LLVM_IR_Req::default_instance_ = NULL;
-
-LLVM_IR_Req* LLVM_IR_Req::New(::google::protobuf::Arena* arena) const {
-  LLVM_IR_Req* n = new LLVM_IR_Req;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
-}
-
-void LLVM_IR_Req::Clear() {
-// @@protoc_insertion_point(message_clear_start:HTROP_PB.LLVM_IR_Req)
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
-  }
-}
-
-bool LLVM_IR_Req::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:HTROP_PB.LLVM_IR_Req)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-  handle_unusual:
-    if (tag == 0 ||
-        ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-        ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-      goto success;
-    }
-    DO_(::google::protobuf::internal::WireFormat::SkipField(
-          input, tag, mutable_unknown_fields()));
-  }
-success:
-  // @@protoc_insertion_point(parse_success:HTROP_PB.LLVM_IR_Req)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:HTROP_PB.LLVM_IR_Req)
-  return false;
-#undef DO_
-}
-
-void LLVM_IR_Req::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:HTROP_PB.LLVM_IR_Req)
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:HTROP_PB.LLVM_IR_Req)
-}
 
-::google::protobuf::uint8* LLVM_IR_Req::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.LLVM_IR_Req)
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.LLVM_IR_Req)
-  return target;
-}
 
-int LLVM_IR_Req::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.LLVM_IR_Req)
-  int total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void LLVM_IR_Req::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:HTROP_PB.LLVM_IR_Req)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const LLVM_IR_Req* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const LLVM_IR_Req>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:HTROP_PB.LLVM_IR_Req)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:HTROP_PB.LLVM_IR_Req)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LLVM_IR_Req::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LLVM_IR_Req::GetClassData() const { return &_class_data_; }
 
-void LLVM_IR_Req::MergeFrom(const LLVM_IR_Req& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.LLVM_IR_Req)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-  }
-}
 
-void LLVM_IR_Req::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:HTROP_PB.LLVM_IR_Req)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-void LLVM_IR_Req::CopyFrom(const LLVM_IR_Req& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.LLVM_IR_Req)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
 
-bool LLVM_IR_Req::IsInitialized() const {
 
-  return true;
-}
 
-void LLVM_IR_Req::Swap(LLVM_IR_Req* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void LLVM_IR_Req::InternalSwap(LLVM_IR_Req* other) {
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
 
-::google::protobuf::Metadata LLVM_IR_Req::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = LLVM_IR_Req_descriptor_;
-  metadata.reflection = LLVM_IR_Req_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata LLVM_IR_Req::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[0]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// LLVM_IR_Req
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int BinaryData::kBinaryDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-BinaryData::BinaryData()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:HTROP_PB.BinaryData)
-}
+class BinaryData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BinaryData>()._impl_._has_bits_);
+  static void set_has_binary_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-void BinaryData::InitAsDefaultInstance() {
+BinaryData::BinaryData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.BinaryData)
 }
-
 BinaryData::BinaryData(const BinaryData& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BinaryData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.binary_data_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.binary_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.binary_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_binary_data()) {
+    _this->_impl_.binary_data_.Set(from._internal_binary_data(), 
+      _this->GetArenaForAllocation());
+  }
   // @@protoc_insertion_point(copy_constructor:HTROP_PB.BinaryData)
 }
 
-void BinaryData::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  binary_data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void BinaryData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.binary_data_){}
+  };
+  _impl_.binary_data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.binary_data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 BinaryData::~BinaryData() {
   // @@protoc_insertion_point(destructor:HTROP_PB.BinaryData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void BinaryData::SharedDtor() {
-  binary_data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
-  }
+inline void BinaryData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.binary_data_.Destroy();
 }
 
 void BinaryData::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* BinaryData::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return BinaryData_descriptor_;
-}
-
-const BinaryData& BinaryData::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_hds_2eproto();
-  return *default_instance_;
-}
-
-BinaryData* BinaryData::default_instance_ = NULL;
-
-BinaryData* BinaryData::New(::google::protobuf::Arena* arena) const {
-  BinaryData* n = new BinaryData;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void BinaryData::Clear() {
 // @@protoc_insertion_point(message_clear_start:HTROP_PB.BinaryData)
-  if (has_binary_data()) {
-    binary_data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.binary_data_.ClearNonDefaultToEmpty();
   }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool BinaryData::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:HTROP_PB.BinaryData)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* BinaryData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional bytes binary_data = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_binary_data()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:HTROP_PB.BinaryData)
-  return true;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_binary_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:HTROP_PB.BinaryData)
-  return false;
-#undef DO_
-}
-
-void BinaryData::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:HTROP_PB.BinaryData)
-  // optional bytes binary_data = 1;
-  if (has_binary_data()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      1, this->binary_data(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:HTROP_PB.BinaryData)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* BinaryData::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* BinaryData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.BinaryData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional bytes binary_data = 1;
-  if (has_binary_data()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->binary_data(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_binary_data(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.BinaryData)
   return target;
 }
 
-int BinaryData::ByteSize() const {
+size_t BinaryData::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:HTROP_PB.BinaryData)
-  int total_size = 0;
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // optional bytes binary_data = 1;
-  if (has_binary_data()) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->binary_data());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_binary_data());
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BinaryData::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:HTROP_PB.BinaryData)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const BinaryData* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const BinaryData>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:HTROP_PB.BinaryData)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:HTROP_PB.BinaryData)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BinaryData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BinaryData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BinaryData::GetClassData() const { return &_class_data_; }
 
-void BinaryData::MergeFrom(const BinaryData& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.BinaryData)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_binary_data()) {
-      set_has_binary_data();
-      binary_data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.binary_data_);
-    }
-  }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-  }
-}
 
-void BinaryData::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:HTROP_PB.BinaryData)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void BinaryData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BinaryData*>(&to_msg);
+  auto& from = static_cast<const BinaryData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.BinaryData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_binary_data()) {
+    _this->_internal_set_binary_data(from._internal_binary_data());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void BinaryData::CopyFrom(const BinaryData& from) {
@@ -661,1908 +1035,6320 @@ void BinaryData::CopyFrom(const BinaryData& from) {
 }
 
 bool BinaryData::IsInitialized() const {
-
   return true;
 }
 
-void BinaryData::Swap(BinaryData* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void BinaryData::InternalSwap(BinaryData* other) {
-  binary_data_.Swap(&other->binary_data_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.binary_data_, lhs_arena,
+      &other->_impl_.binary_data_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata BinaryData::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = BinaryData_descriptor_;
-  metadata.reflection = BinaryData_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata BinaryData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[1]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// BinaryData
+// ===================================================================
 
-// optional bytes binary_data = 1;
-bool BinaryData::has_binary_data() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-void BinaryData::set_has_binary_data() {
-  _has_bits_[0] |= 0x00000001u;
-}
-void BinaryData::clear_has_binary_data() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-void BinaryData::clear_binary_data() {
-  binary_data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_binary_data();
-}
- const ::std::string& BinaryData::binary_data() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.BinaryData.binary_data)
-  return binary_data_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void BinaryData::set_binary_data(const ::std::string& value) {
-  set_has_binary_data();
-  binary_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.BinaryData.binary_data)
-}
- void BinaryData::set_binary_data(const char* value) {
-  set_has_binary_data();
-  binary_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HTROP_PB.BinaryData.binary_data)
+class ReductionHint::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReductionHint>()._impl_._has_bits_);
+  static void set_has_arg_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_loop_depth(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_reduction_operator(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+ReductionHint::ReductionHint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.ReductionHint)
+}
+ReductionHint::ReductionHint(const ReductionHint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReductionHint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arg_position_){}
+    , decltype(_impl_.loop_depth_){}
+    , decltype(_impl_.reduction_operator_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.arg_position_, &from._impl_.arg_position_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.reduction_operator_) -
+    reinterpret_cast<char*>(&_impl_.arg_position_)) + sizeof(_impl_.reduction_operator_));
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.ReductionHint)
+}
+
+inline void ReductionHint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arg_position_){0u}
+    , decltype(_impl_.loop_depth_){0u}
+    , decltype(_impl_.reduction_operator_){0}
+  };
 }
- void BinaryData::set_binary_data(const void* value, size_t size) {
-  set_has_binary_data();
-  binary_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.BinaryData.binary_data)
+
+ReductionHint::~ReductionHint() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.ReductionHint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
- ::std::string* BinaryData::mutable_binary_data() {
-  set_has_binary_data();
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.BinaryData.binary_data)
-  return binary_data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+inline void ReductionHint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
- ::std::string* BinaryData::release_binary_data() {
-  // @@protoc_insertion_point(field_release:HTROP_PB.BinaryData.binary_data)
-  clear_has_binary_data();
-  return binary_data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+void ReductionHint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
- void BinaryData::set_allocated_binary_data(::std::string* binary_data) {
-  if (binary_data != NULL) {
-    set_has_binary_data();
-  } else {
-    clear_has_binary_data();
+
+void ReductionHint::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.ReductionHint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.arg_position_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.reduction_operator_) -
+        reinterpret_cast<char*>(&_impl_.arg_position_)) + sizeof(_impl_.reduction_operator_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReductionHint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 arg_position = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_arg_position(&has_bits);
+          _impl_.arg_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 loop_depth = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_loop_depth(&has_bits);
+          _impl_.loop_depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 reduction_operator = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_reduction_operator(&has_bits);
+          _impl_.reduction_operator_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReductionHint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.ReductionHint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 arg_position = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_arg_position(), target);
+  }
+
+  // optional uint32 loop_depth = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_loop_depth(), target);
+  }
+
+  // optional int32 reduction_operator = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_reduction_operator(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  binary_data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), binary_data);
-  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.BinaryData.binary_data)
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.ReductionHint)
+  return target;
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+size_t ReductionHint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.ReductionHint)
+  size_t total_size = 0;
 
-// ===================================================================
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Message_RCRS_ScopInfo::kScopFunctionNameFieldNumber;
-const int Message_RCRS_ScopInfo::kMaxCodegenLoopDepthFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional uint32 arg_position = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_arg_position());
+    }
 
-Message_RCRS_ScopInfo::Message_RCRS_ScopInfo()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:HTROP_PB.Message_RCRS.ScopInfo)
-}
+    // optional uint32 loop_depth = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_loop_depth());
+    }
 
-void Message_RCRS_ScopInfo::InitAsDefaultInstance() {
-}
+    // optional int32 reduction_operator = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_reduction_operator());
+    }
 
-Message_RCRS_ScopInfo::Message_RCRS_ScopInfo(const Message_RCRS_ScopInfo& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RCRS.ScopInfo)
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Message_RCRS_ScopInfo::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  scopfunctionname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  max_codegen_loop_depth_ = 0u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReductionHint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReductionHint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReductionHint::GetClassData() const { return &_class_data_; }
 
-Message_RCRS_ScopInfo::~Message_RCRS_ScopInfo() {
-  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RCRS.ScopInfo)
-  SharedDtor();
-}
 
-void Message_RCRS_ScopInfo::SharedDtor() {
-  scopfunctionname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
+void ReductionHint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReductionHint*>(&to_msg);
+  auto& from = static_cast<const ReductionHint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.ReductionHint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.arg_position_ = from._impl_.arg_position_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.loop_depth_ = from._impl_.loop_depth_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.reduction_operator_ = from._impl_.reduction_operator_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Message_RCRS_ScopInfo::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+void ReductionHint::CopyFrom(const ReductionHint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.ReductionHint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReductionHint::IsInitialized() const {
+  return true;
 }
-const ::google::protobuf::Descriptor* Message_RCRS_ScopInfo::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Message_RCRS_ScopInfo_descriptor_;
+
+void ReductionHint::InternalSwap(ReductionHint* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReductionHint, _impl_.reduction_operator_)
+      + sizeof(ReductionHint::_impl_.reduction_operator_)
+      - PROTOBUF_FIELD_OFFSET(ReductionHint, _impl_.arg_position_)>(
+          reinterpret_cast<char*>(&_impl_.arg_position_),
+          reinterpret_cast<char*>(&other->_impl_.arg_position_));
 }
 
-const Message_RCRS_ScopInfo& Message_RCRS_ScopInfo::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_hds_2eproto();
-  return *default_instance_;
+::PROTOBUF_NAMESPACE_ID::Metadata ReductionHint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[2]);
 }
 
-Message_RCRS_ScopInfo* Message_RCRS_ScopInfo::default_instance_ = NULL;
+// ===================================================================
 
-Message_RCRS_ScopInfo* Message_RCRS_ScopInfo::New(::google::protobuf::Arena* arena) const {
-  Message_RCRS_ScopInfo* n = new Message_RCRS_ScopInfo;
-  if (arena != NULL) {
-    arena->Own(n);
+class ScatterHint::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ScatterHint>()._impl_._has_bits_);
+  static void set_has_arg_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  return n;
+  static void set_has_scatter_operator(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_num_elements(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+ScatterHint::ScatterHint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.ScatterHint)
+}
+ScatterHint::ScatterHint(const ScatterHint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScatterHint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arg_position_){}
+    , decltype(_impl_.scatter_operator_){}
+    , decltype(_impl_.num_elements_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.arg_position_, &from._impl_.arg_position_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_elements_) -
+    reinterpret_cast<char*>(&_impl_.arg_position_)) + sizeof(_impl_.num_elements_));
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.ScatterHint)
+}
+
+inline void ScatterHint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arg_position_){0u}
+    , decltype(_impl_.scatter_operator_){0}
+    , decltype(_impl_.num_elements_){uint64_t{0u}}
+  };
 }
 
-void Message_RCRS_ScopInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RCRS.ScopInfo)
-  if (_has_bits_[0 / 32] & 3u) {
-    if (has_scopfunctionname()) {
-      scopfunctionname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-    }
-    max_codegen_loop_depth_ = 0u;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
+ScatterHint::~ScatterHint() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.ScatterHint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-bool Message_RCRS_ScopInfo::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:HTROP_PB.Message_RCRS.ScopInfo)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string scopFunctionName = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_scopfunctionname()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->scopfunctionname().data(), this->scopfunctionname().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName");
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_max_codegen_loop_depth;
-        break;
-      }
+inline void ScatterHint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
 
-      // optional uint32 max_codegen_loop_depth = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_max_codegen_loop_depth:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &max_codegen_loop_depth_)));
-          set_has_max_codegen_loop_depth();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:HTROP_PB.Message_RCRS.ScopInfo)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:HTROP_PB.Message_RCRS.ScopInfo)
-  return false;
-#undef DO_
+void ScatterHint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void Message_RCRS_ScopInfo::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:HTROP_PB.Message_RCRS.ScopInfo)
-  // optional string scopFunctionName = 1;
-  if (has_scopfunctionname()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->scopfunctionname().data(), this->scopfunctionname().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->scopfunctionname(), output);
-  }
+void ScatterHint::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.ScatterHint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional uint32 max_codegen_loop_depth = 2;
-  if (has_max_codegen_loop_depth()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->max_codegen_loop_depth(), output);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.arg_position_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_elements_) -
+        reinterpret_cast<char*>(&_impl_.arg_position_)) + sizeof(_impl_.num_elements_));
   }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScatterHint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 arg_position = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_arg_position(&has_bits);
+          _impl_.arg_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 scatter_operator = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_scatter_operator(&has_bits);
+          _impl_.scatter_operator_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 num_elements = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_num_elements(&has_bits);
+          _impl_.num_elements_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScatterHint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.ScatterHint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 arg_position = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_arg_position(), target);
   }
-  // @@protoc_insertion_point(serialize_end:HTROP_PB.Message_RCRS.ScopInfo)
-}
 
-::google::protobuf::uint8* Message_RCRS_ScopInfo::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RCRS.ScopInfo)
-  // optional string scopFunctionName = 1;
-  if (has_scopfunctionname()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->scopfunctionname().data(), this->scopfunctionname().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->scopfunctionname(), target);
+  // optional int32 scatter_operator = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_scatter_operator(), target);
   }
 
-  // optional uint32 max_codegen_loop_depth = 2;
-  if (has_max_codegen_loop_depth()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->max_codegen_loop_depth(), target);
+  // optional uint64 num_elements = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_num_elements(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RCRS.ScopInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.ScatterHint)
   return target;
 }
 
-int Message_RCRS_ScopInfo::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RCRS.ScopInfo)
-  int total_size = 0;
+size_t ScatterHint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.ScatterHint)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & 3u) {
-    // optional string scopFunctionName = 1;
-    if (has_scopfunctionname()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->scopfunctionname());
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional uint32 arg_position = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_arg_position());
     }
 
-    // optional uint32 max_codegen_loop_depth = 2;
-    if (has_max_codegen_loop_depth()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->max_codegen_loop_depth());
+    // optional int32 scatter_operator = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_scatter_operator());
     }
 
-  }
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional uint64 num_elements = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_elements());
+    }
 
-void Message_RCRS_ScopInfo::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:HTROP_PB.Message_RCRS.ScopInfo)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const Message_RCRS_ScopInfo* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const Message_RCRS_ScopInfo>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:HTROP_PB.Message_RCRS.ScopInfo)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:HTROP_PB.Message_RCRS.ScopInfo)
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Message_RCRS_ScopInfo::MergeFrom(const Message_RCRS_ScopInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RCRS.ScopInfo)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_scopfunctionname()) {
-      set_has_scopfunctionname();
-      scopfunctionname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.scopfunctionname_);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScatterHint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScatterHint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScatterHint::GetClassData() const { return &_class_data_; }
+
+
+void ScatterHint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScatterHint*>(&to_msg);
+  auto& from = static_cast<const ScatterHint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.ScatterHint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.arg_position_ = from._impl_.arg_position_;
     }
-    if (from.has_max_codegen_loop_depth()) {
-      set_max_codegen_loop_depth(from.max_codegen_loop_depth());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.scatter_operator_ = from._impl_.scatter_operator_;
     }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_elements_ = from._impl_.num_elements_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Message_RCRS_ScopInfo::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:HTROP_PB.Message_RCRS.ScopInfo)
+void ScatterHint::CopyFrom(const ScatterHint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.ScatterHint)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Message_RCRS_ScopInfo::CopyFrom(const Message_RCRS_ScopInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RCRS.ScopInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Message_RCRS_ScopInfo::IsInitialized() const {
-
+bool ScatterHint::IsInitialized() const {
   return true;
 }
 
-void Message_RCRS_ScopInfo::Swap(Message_RCRS_ScopInfo* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void Message_RCRS_ScopInfo::InternalSwap(Message_RCRS_ScopInfo* other) {
-  scopfunctionname_.Swap(&other->scopfunctionname_);
-  std::swap(max_codegen_loop_depth_, other->max_codegen_loop_depth_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+void ScatterHint::InternalSwap(ScatterHint* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ScatterHint, _impl_.num_elements_)
+      + sizeof(ScatterHint::_impl_.num_elements_)
+      - PROTOBUF_FIELD_OFFSET(ScatterHint, _impl_.arg_position_)>(
+          reinterpret_cast<char*>(&_impl_.arg_position_),
+          reinterpret_cast<char*>(&other->_impl_.arg_position_));
 }
 
-::google::protobuf::Metadata Message_RCRS_ScopInfo::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Message_RCRS_ScopInfo_descriptor_;
-  metadata.reflection = Message_RCRS_ScopInfo_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata ScatterHint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[3]);
 }
 
+// ===================================================================
 
-// -------------------------------------------------------------------
-
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Message_RCRS::kScopListFieldNumber;
-const int Message_RCRS::kScopFunctionParentNameFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Message_RCRS::Message_RCRS()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:HTROP_PB.Message_RCRS)
+class ReadOnlyArgHint::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ReadOnlyArgHint>()._impl_._has_bits_);
+  static void set_has_arg_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_num_elements(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ReadOnlyArgHint::ReadOnlyArgHint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.ReadOnlyArgHint)
+}
+ReadOnlyArgHint::ReadOnlyArgHint(const ReadOnlyArgHint& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadOnlyArgHint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.num_elements_){}
+    , decltype(_impl_.arg_position_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.num_elements_, &from._impl_.num_elements_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.arg_position_) -
+    reinterpret_cast<char*>(&_impl_.num_elements_)) + sizeof(_impl_.arg_position_));
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.ReadOnlyArgHint)
+}
+
+inline void ReadOnlyArgHint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.num_elements_){uint64_t{0u}}
+    , decltype(_impl_.arg_position_){0u}
+  };
 }
 
-void Message_RCRS::InitAsDefaultInstance() {
+ReadOnlyArgHint::~ReadOnlyArgHint() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.ReadOnlyArgHint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-Message_RCRS::Message_RCRS(const Message_RCRS& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RCRS)
+inline void ReadOnlyArgHint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Message_RCRS::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  scopfunctionparentname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+void ReadOnlyArgHint::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-Message_RCRS::~Message_RCRS() {
-  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RCRS)
+void ReadOnlyArgHint::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.ReadOnlyArgHint)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.num_elements_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.arg_position_) -
+        reinterpret_cast<char*>(&_impl_.num_elements_)) + sizeof(_impl_.arg_position_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReadOnlyArgHint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 arg_position = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_arg_position(&has_bits);
+          _impl_.arg_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 num_elements = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_num_elements(&has_bits);
+          _impl_.num_elements_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReadOnlyArgHint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.ReadOnlyArgHint)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 arg_position = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_arg_position(), target);
+  }
+
+  // optional uint64 num_elements = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_num_elements(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.ReadOnlyArgHint)
+  return target;
+}
+
+size_t ReadOnlyArgHint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.ReadOnlyArgHint)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint64 num_elements = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_elements());
+    }
+
+    // optional uint32 arg_position = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_arg_position());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadOnlyArgHint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadOnlyArgHint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadOnlyArgHint::GetClassData() const { return &_class_data_; }
+
+
+void ReadOnlyArgHint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadOnlyArgHint*>(&to_msg);
+  auto& from = static_cast<const ReadOnlyArgHint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.ReadOnlyArgHint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.num_elements_ = from._impl_.num_elements_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.arg_position_ = from._impl_.arg_position_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReadOnlyArgHint::CopyFrom(const ReadOnlyArgHint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.ReadOnlyArgHint)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReadOnlyArgHint::IsInitialized() const {
+  return true;
+}
+
+void ReadOnlyArgHint::InternalSwap(ReadOnlyArgHint* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReadOnlyArgHint, _impl_.arg_position_)
+      + sizeof(ReadOnlyArgHint::_impl_.arg_position_)
+      - PROTOBUF_FIELD_OFFSET(ReadOnlyArgHint, _impl_.num_elements_)>(
+          reinterpret_cast<char*>(&_impl_.num_elements_),
+          reinterpret_cast<char*>(&other->_impl_.num_elements_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReadOnlyArgHint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[4]);
+}
+
+// ===================================================================
+
+class Message_RCRS_ScopInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Message_RCRS_ScopInfo>()._impl_._has_bits_);
+  static void set_has_scopfunctionname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_max_codegen_loop_depth(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::HTROP_PB::ReductionHint& reduction(const Message_RCRS_ScopInfo* msg);
+  static void set_has_reduction(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_num_loop_trip_counts(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_wavefront_skew(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::HTROP_PB::ScatterHint& scatter(const Message_RCRS_ScopInfo* msg);
+  static void set_has_scatter(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::HTROP_PB::ReductionHint&
+Message_RCRS_ScopInfo::_Internal::reduction(const Message_RCRS_ScopInfo* msg) {
+  return *msg->_impl_.reduction_;
+}
+const ::HTROP_PB::ScatterHint&
+Message_RCRS_ScopInfo::_Internal::scatter(const Message_RCRS_ScopInfo* msg) {
+  return *msg->_impl_.scatter_;
+}
+Message_RCRS_ScopInfo::Message_RCRS_ScopInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.Message_RCRS.ScopInfo)
+}
+Message_RCRS_ScopInfo::Message_RCRS_ScopInfo(const Message_RCRS_ScopInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message_RCRS_ScopInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.read_only_args_){from._impl_.read_only_args_}
+    , decltype(_impl_.fused_functions_){from._impl_.fused_functions_}
+    , decltype(_impl_.fused_tmp_args_){from._impl_.fused_tmp_args_}
+    , decltype(_impl_.scopfunctionname_){}
+    , decltype(_impl_.reduction_){nullptr}
+    , decltype(_impl_.scatter_){nullptr}
+    , decltype(_impl_.max_codegen_loop_depth_){}
+    , decltype(_impl_.num_loop_trip_counts_){}
+    , decltype(_impl_.wavefront_skew_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.scopfunctionname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.scopfunctionname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_scopfunctionname()) {
+    _this->_impl_.scopfunctionname_.Set(from._internal_scopfunctionname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_reduction()) {
+    _this->_impl_.reduction_ = new ::HTROP_PB::ReductionHint(*from._impl_.reduction_);
+  }
+  if (from._internal_has_scatter()) {
+    _this->_impl_.scatter_ = new ::HTROP_PB::ScatterHint(*from._impl_.scatter_);
+  }
+  ::memcpy(&_impl_.max_codegen_loop_depth_, &from._impl_.max_codegen_loop_depth_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.wavefront_skew_) -
+    reinterpret_cast<char*>(&_impl_.max_codegen_loop_depth_)) + sizeof(_impl_.wavefront_skew_));
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RCRS.ScopInfo)
+}
+
+inline void Message_RCRS_ScopInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.read_only_args_){arena}
+    , decltype(_impl_.fused_functions_){arena}
+    , decltype(_impl_.fused_tmp_args_){arena}
+    , decltype(_impl_.scopfunctionname_){}
+    , decltype(_impl_.reduction_){nullptr}
+    , decltype(_impl_.scatter_){nullptr}
+    , decltype(_impl_.max_codegen_loop_depth_){0u}
+    , decltype(_impl_.num_loop_trip_counts_){0u}
+    , decltype(_impl_.wavefront_skew_){0u}
+  };
+  _impl_.scopfunctionname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.scopfunctionname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Message_RCRS_ScopInfo::~Message_RCRS_ScopInfo() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RCRS.ScopInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Message_RCRS_ScopInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.read_only_args_.~RepeatedPtrField();
+  _impl_.fused_functions_.~RepeatedPtrField();
+  _impl_.fused_tmp_args_.~RepeatedField();
+  _impl_.scopfunctionname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.reduction_;
+  if (this != internal_default_instance()) delete _impl_.scatter_;
+}
+
+void Message_RCRS_ScopInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Message_RCRS_ScopInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RCRS.ScopInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.read_only_args_.Clear();
+  _impl_.fused_functions_.Clear();
+  _impl_.fused_tmp_args_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.scopfunctionname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.reduction_ != nullptr);
+      _impl_.reduction_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.scatter_ != nullptr);
+      _impl_.scatter_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000038u) {
+    ::memset(&_impl_.max_codegen_loop_depth_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.wavefront_skew_) -
+        reinterpret_cast<char*>(&_impl_.max_codegen_loop_depth_)) + sizeof(_impl_.wavefront_skew_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Message_RCRS_ScopInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string scopFunctionName = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_scopfunctionname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 max_codegen_loop_depth = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_max_codegen_loop_depth(&has_bits);
+          _impl_.max_codegen_loop_depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .HTROP_PB.ReductionHint reduction = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reduction(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 num_loop_trip_counts = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_num_loop_trip_counts(&has_bits);
+          _impl_.num_loop_trip_counts_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .HTROP_PB.ReadOnlyArgHint read_only_args = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_read_only_args(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string fused_functions = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_fused_functions();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "HTROP_PB.Message_RCRS.ScopInfo.fused_functions");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 fused_tmp_args = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_fused_tmp_args(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<56>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 58) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_fused_tmp_args(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 wavefront_skew = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_wavefront_skew(&has_bits);
+          _impl_.wavefront_skew_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .HTROP_PB.ScatterHint scatter = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_scatter(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message_RCRS_ScopInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RCRS.ScopInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string scopFunctionName = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_scopfunctionname().data(), static_cast<int>(this->_internal_scopfunctionname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_scopfunctionname(), target);
+  }
+
+  // optional uint32 max_codegen_loop_depth = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_max_codegen_loop_depth(), target);
+  }
+
+  // optional .HTROP_PB.ReductionHint reduction = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::reduction(this),
+        _Internal::reduction(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 num_loop_trip_counts = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_num_loop_trip_counts(), target);
+  }
+
+  // repeated .HTROP_PB.ReadOnlyArgHint read_only_args = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_read_only_args_size()); i < n; i++) {
+    const auto& repfield = this->_internal_read_only_args(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated string fused_functions = 6;
+  for (int i = 0, n = this->_internal_fused_functions_size(); i < n; i++) {
+    const auto& s = this->_internal_fused_functions(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.Message_RCRS.ScopInfo.fused_functions");
+    target = stream->WriteString(6, s, target);
+  }
+
+  // repeated uint32 fused_tmp_args = 7;
+  for (int i = 0, n = this->_internal_fused_tmp_args_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_fused_tmp_args(i), target);
+  }
+
+  // optional uint32 wavefront_skew = 8;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_wavefront_skew(), target);
+  }
+
+  // optional .HTROP_PB.ScatterHint scatter = 9;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::scatter(this),
+        _Internal::scatter(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RCRS.ScopInfo)
+  return target;
+}
+
+size_t Message_RCRS_ScopInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RCRS.ScopInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .HTROP_PB.ReadOnlyArgHint read_only_args = 5;
+  total_size += 1UL * this->_internal_read_only_args_size();
+  for (const auto& msg : this->_impl_.read_only_args_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated string fused_functions = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.fused_functions_.size());
+  for (int i = 0, n = _impl_.fused_functions_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.fused_functions_.Get(i));
+  }
+
+  // repeated uint32 fused_tmp_args = 7;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.fused_tmp_args_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_fused_tmp_args_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional string scopFunctionName = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_scopfunctionname());
+    }
+
+    // optional .HTROP_PB.ReductionHint reduction = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.reduction_);
+    }
+
+    // optional .HTROP_PB.ScatterHint scatter = 9;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.scatter_);
+    }
+
+    // optional uint32 max_codegen_loop_depth = 2;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_codegen_loop_depth());
+    }
+
+    // optional uint32 num_loop_trip_counts = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_loop_trip_counts());
+    }
+
+    // optional uint32 wavefront_skew = 8;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_wavefront_skew());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message_RCRS_ScopInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message_RCRS_ScopInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message_RCRS_ScopInfo::GetClassData() const { return &_class_data_; }
+
+
+void Message_RCRS_ScopInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message_RCRS_ScopInfo*>(&to_msg);
+  auto& from = static_cast<const Message_RCRS_ScopInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RCRS.ScopInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.read_only_args_.MergeFrom(from._impl_.read_only_args_);
+  _this->_impl_.fused_functions_.MergeFrom(from._impl_.fused_functions_);
+  _this->_impl_.fused_tmp_args_.MergeFrom(from._impl_.fused_tmp_args_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_scopfunctionname(from._internal_scopfunctionname());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_reduction()->::HTROP_PB::ReductionHint::MergeFrom(
+          from._internal_reduction());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_scatter()->::HTROP_PB::ScatterHint::MergeFrom(
+          from._internal_scatter());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.max_codegen_loop_depth_ = from._impl_.max_codegen_loop_depth_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.num_loop_trip_counts_ = from._impl_.num_loop_trip_counts_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.wavefront_skew_ = from._impl_.wavefront_skew_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Message_RCRS_ScopInfo::CopyFrom(const Message_RCRS_ScopInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RCRS.ScopInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Message_RCRS_ScopInfo::IsInitialized() const {
+  return true;
+}
+
+void Message_RCRS_ScopInfo::InternalSwap(Message_RCRS_ScopInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.read_only_args_.InternalSwap(&other->_impl_.read_only_args_);
+  _impl_.fused_functions_.InternalSwap(&other->_impl_.fused_functions_);
+  _impl_.fused_tmp_args_.InternalSwap(&other->_impl_.fused_tmp_args_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.scopfunctionname_, lhs_arena,
+      &other->_impl_.scopfunctionname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Message_RCRS_ScopInfo, _impl_.wavefront_skew_)
+      + sizeof(Message_RCRS_ScopInfo::_impl_.wavefront_skew_)
+      - PROTOBUF_FIELD_OFFSET(Message_RCRS_ScopInfo, _impl_.reduction_)>(
+          reinterpret_cast<char*>(&_impl_.reduction_),
+          reinterpret_cast<char*>(&other->_impl_.reduction_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Message_RCRS_ScopInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[5]);
+}
+
+// ===================================================================
+
+class Message_RCRS::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Message_RCRS>()._impl_._has_bits_);
+  static void set_has_scopfunctionparentname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_module_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+Message_RCRS::Message_RCRS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.Message_RCRS)
+}
+Message_RCRS::Message_RCRS(const Message_RCRS& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message_RCRS* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scoplist_){from._impl_.scoplist_}
+    , decltype(_impl_.scopfunctionparentname_){}
+    , decltype(_impl_.module_hash_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.scopfunctionparentname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.scopfunctionparentname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_scopfunctionparentname()) {
+    _this->_impl_.scopfunctionparentname_.Set(from._internal_scopfunctionparentname(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.module_hash_ = from._impl_.module_hash_;
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RCRS)
+}
+
+inline void Message_RCRS::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scoplist_){arena}
+    , decltype(_impl_.scopfunctionparentname_){}
+    , decltype(_impl_.module_hash_){uint64_t{0u}}
+  };
+  _impl_.scopfunctionparentname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.scopfunctionparentname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Message_RCRS::~Message_RCRS() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RCRS)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Message_RCRS::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.scoplist_.~RepeatedPtrField();
+  _impl_.scopfunctionparentname_.Destroy();
+}
+
+void Message_RCRS::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Message_RCRS::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RCRS)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.scoplist_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.scopfunctionparentname_.ClearNonDefaultToEmpty();
+  }
+  _impl_.module_hash_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Message_RCRS::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .HTROP_PB.Message_RCRS.ScopInfo scopList = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_scoplist(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string scopFunctionParentName = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_scopfunctionparentname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "HTROP_PB.Message_RCRS.scopFunctionParentName");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 module_hash = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_module_hash(&has_bits);
+          _impl_.module_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message_RCRS::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RCRS)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .HTROP_PB.Message_RCRS.ScopInfo scopList = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_scoplist_size()); i < n; i++) {
+    const auto& repfield = this->_internal_scoplist(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string scopFunctionParentName = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_scopfunctionparentname().data(), static_cast<int>(this->_internal_scopfunctionparentname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.Message_RCRS.scopFunctionParentName");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_scopfunctionparentname(), target);
+  }
+
+  // optional fixed64 module_hash = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(3, this->_internal_module_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RCRS)
+  return target;
+}
+
+size_t Message_RCRS::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RCRS)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .HTROP_PB.Message_RCRS.ScopInfo scopList = 1;
+  total_size += 1UL * this->_internal_scoplist_size();
+  for (const auto& msg : this->_impl_.scoplist_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string scopFunctionParentName = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_scopfunctionparentname());
+    }
+
+    // optional fixed64 module_hash = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message_RCRS::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message_RCRS::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message_RCRS::GetClassData() const { return &_class_data_; }
+
+
+void Message_RCRS::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message_RCRS*>(&to_msg);
+  auto& from = static_cast<const Message_RCRS&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RCRS)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.scoplist_.MergeFrom(from._impl_.scoplist_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_scopfunctionparentname(from._internal_scopfunctionparentname());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.module_hash_ = from._impl_.module_hash_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Message_RCRS::CopyFrom(const Message_RCRS& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RCRS)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Message_RCRS::IsInitialized() const {
+  return true;
+}
+
+void Message_RCRS::InternalSwap(Message_RCRS* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.scoplist_.InternalSwap(&other->_impl_.scoplist_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.scopfunctionparentname_, lhs_arena,
+      &other->_impl_.scopfunctionparentname_, rhs_arena
+  );
+  swap(_impl_.module_hash_, other->_impl_.module_hash_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Message_RCRS::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[6]);
+}
+
+// ===================================================================
+
+class Message_RSRC_WorkItemFactor::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Message_RSRC_WorkItemFactor>()._impl_._has_bits_);
+  static void set_has_dimension(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_factor_mcpu(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_factor_gpu(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_factor_mic(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+Message_RSRC_WorkItemFactor::Message_RSRC_WorkItemFactor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.Message_RSRC.WorkItemFactor)
+}
+Message_RSRC_WorkItemFactor::Message_RSRC_WorkItemFactor(const Message_RSRC_WorkItemFactor& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message_RSRC_WorkItemFactor* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dimension_){}
+    , decltype(_impl_.factor_mcpu_){}
+    , decltype(_impl_.factor_gpu_){}
+    , decltype(_impl_.factor_mic_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.dimension_, &from._impl_.dimension_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.factor_mic_) -
+    reinterpret_cast<char*>(&_impl_.dimension_)) + sizeof(_impl_.factor_mic_));
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RSRC.WorkItemFactor)
+}
+
+inline void Message_RSRC_WorkItemFactor::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dimension_){0u}
+    , decltype(_impl_.factor_mcpu_){0u}
+    , decltype(_impl_.factor_gpu_){0u}
+    , decltype(_impl_.factor_mic_){0u}
+  };
+}
+
+Message_RSRC_WorkItemFactor::~Message_RSRC_WorkItemFactor() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RSRC.WorkItemFactor)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Message_RSRC_WorkItemFactor::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Message_RSRC_WorkItemFactor::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Message_RSRC_WorkItemFactor::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RSRC.WorkItemFactor)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.dimension_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.factor_mic_) -
+        reinterpret_cast<char*>(&_impl_.dimension_)) + sizeof(_impl_.factor_mic_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Message_RSRC_WorkItemFactor::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 dimension = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_dimension(&has_bits);
+          _impl_.dimension_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 factor_mcpu = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_factor_mcpu(&has_bits);
+          _impl_.factor_mcpu_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 factor_gpu = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_factor_gpu(&has_bits);
+          _impl_.factor_gpu_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 factor_mic = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_factor_mic(&has_bits);
+          _impl_.factor_mic_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message_RSRC_WorkItemFactor::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RSRC.WorkItemFactor)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 dimension = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_dimension(), target);
+  }
+
+  // optional uint32 factor_mcpu = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_factor_mcpu(), target);
+  }
+
+  // optional uint32 factor_gpu = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_factor_gpu(), target);
+  }
+
+  // optional uint32 factor_mic = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_factor_mic(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RSRC.WorkItemFactor)
+  return target;
+}
+
+size_t Message_RSRC_WorkItemFactor::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RSRC.WorkItemFactor)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional uint32 dimension = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dimension());
+    }
+
+    // optional uint32 factor_mcpu = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_factor_mcpu());
+    }
+
+    // optional uint32 factor_gpu = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_factor_gpu());
+    }
+
+    // optional uint32 factor_mic = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_factor_mic());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message_RSRC_WorkItemFactor::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message_RSRC_WorkItemFactor::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message_RSRC_WorkItemFactor::GetClassData() const { return &_class_data_; }
+
+
+void Message_RSRC_WorkItemFactor::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message_RSRC_WorkItemFactor*>(&to_msg);
+  auto& from = static_cast<const Message_RSRC_WorkItemFactor&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RSRC.WorkItemFactor)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.dimension_ = from._impl_.dimension_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.factor_mcpu_ = from._impl_.factor_mcpu_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.factor_gpu_ = from._impl_.factor_gpu_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.factor_mic_ = from._impl_.factor_mic_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Message_RSRC_WorkItemFactor::CopyFrom(const Message_RSRC_WorkItemFactor& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RSRC.WorkItemFactor)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Message_RSRC_WorkItemFactor::IsInitialized() const {
+  return true;
+}
+
+void Message_RSRC_WorkItemFactor::InternalSwap(Message_RSRC_WorkItemFactor* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Message_RSRC_WorkItemFactor, _impl_.factor_mic_)
+      + sizeof(Message_RSRC_WorkItemFactor::_impl_.factor_mic_)
+      - PROTOBUF_FIELD_OFFSET(Message_RSRC_WorkItemFactor, _impl_.dimension_)>(
+          reinterpret_cast<char*>(&_impl_.dimension_),
+          reinterpret_cast<char*>(&other->_impl_.dimension_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Message_RSRC_WorkItemFactor::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[7]);
+}
+
+// ===================================================================
+
+class Message_RSRC_Reduction::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Message_RSRC_Reduction>()._impl_._has_bits_);
+  static void set_has_arg_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_reduction_operator(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_is_float(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_data_type_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_partial_arg_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+Message_RSRC_Reduction::Message_RSRC_Reduction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.Message_RSRC.Reduction)
+}
+Message_RSRC_Reduction::Message_RSRC_Reduction(const Message_RSRC_Reduction& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message_RSRC_Reduction* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arg_position_){}
+    , decltype(_impl_.reduction_operator_){}
+    , decltype(_impl_.is_float_){}
+    , decltype(_impl_.data_type_size_){}
+    , decltype(_impl_.partial_arg_position_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.arg_position_, &from._impl_.arg_position_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.partial_arg_position_) -
+    reinterpret_cast<char*>(&_impl_.arg_position_)) + sizeof(_impl_.partial_arg_position_));
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RSRC.Reduction)
+}
+
+inline void Message_RSRC_Reduction::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arg_position_){0u}
+    , decltype(_impl_.reduction_operator_){0}
+    , decltype(_impl_.is_float_){false}
+    , decltype(_impl_.data_type_size_){0u}
+    , decltype(_impl_.partial_arg_position_){0u}
+  };
+}
+
+Message_RSRC_Reduction::~Message_RSRC_Reduction() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RSRC.Reduction)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Message_RSRC_Reduction::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Message_RSRC_Reduction::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Message_RSRC_Reduction::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RSRC.Reduction)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.arg_position_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.partial_arg_position_) -
+        reinterpret_cast<char*>(&_impl_.arg_position_)) + sizeof(_impl_.partial_arg_position_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Message_RSRC_Reduction::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 arg_position = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_arg_position(&has_bits);
+          _impl_.arg_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 reduction_operator = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_reduction_operator(&has_bits);
+          _impl_.reduction_operator_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_float = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_is_float(&has_bits);
+          _impl_.is_float_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 data_type_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_data_type_size(&has_bits);
+          _impl_.data_type_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 partial_arg_position = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_partial_arg_position(&has_bits);
+          _impl_.partial_arg_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message_RSRC_Reduction::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RSRC.Reduction)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 arg_position = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_arg_position(), target);
+  }
+
+  // optional int32 reduction_operator = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_reduction_operator(), target);
+  }
+
+  // optional bool is_float = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_float(), target);
+  }
+
+  // optional uint32 data_type_size = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_data_type_size(), target);
+  }
+
+  // optional uint32 partial_arg_position = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_partial_arg_position(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RSRC.Reduction)
+  return target;
+}
+
+size_t Message_RSRC_Reduction::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RSRC.Reduction)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional uint32 arg_position = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_arg_position());
+    }
+
+    // optional int32 reduction_operator = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_reduction_operator());
+    }
+
+    // optional bool is_float = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 data_type_size = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_data_type_size());
+    }
+
+    // optional uint32 partial_arg_position = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_partial_arg_position());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message_RSRC_Reduction::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message_RSRC_Reduction::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message_RSRC_Reduction::GetClassData() const { return &_class_data_; }
+
+
+void Message_RSRC_Reduction::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message_RSRC_Reduction*>(&to_msg);
+  auto& from = static_cast<const Message_RSRC_Reduction&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RSRC.Reduction)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.arg_position_ = from._impl_.arg_position_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.reduction_operator_ = from._impl_.reduction_operator_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.is_float_ = from._impl_.is_float_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.data_type_size_ = from._impl_.data_type_size_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.partial_arg_position_ = from._impl_.partial_arg_position_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Message_RSRC_Reduction::CopyFrom(const Message_RSRC_Reduction& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RSRC.Reduction)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Message_RSRC_Reduction::IsInitialized() const {
+  return true;
+}
+
+void Message_RSRC_Reduction::InternalSwap(Message_RSRC_Reduction* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Message_RSRC_Reduction, _impl_.partial_arg_position_)
+      + sizeof(Message_RSRC_Reduction::_impl_.partial_arg_position_)
+      - PROTOBUF_FIELD_OFFSET(Message_RSRC_Reduction, _impl_.arg_position_)>(
+          reinterpret_cast<char*>(&_impl_.arg_position_),
+          reinterpret_cast<char*>(&other->_impl_.arg_position_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Message_RSRC_Reduction::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[8]);
+}
+
+// ===================================================================
+
+class Message_RSRC_ImageArg::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Message_RSRC_ImageArg>()._impl_._has_bits_);
+  static void set_has_arg_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_row_width_arg(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_is_float(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+Message_RSRC_ImageArg::Message_RSRC_ImageArg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.Message_RSRC.ImageArg)
+}
+Message_RSRC_ImageArg::Message_RSRC_ImageArg(const Message_RSRC_ImageArg& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message_RSRC_ImageArg* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arg_position_){}
+    , decltype(_impl_.row_width_arg_){}
+    , decltype(_impl_.is_float_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.arg_position_, &from._impl_.arg_position_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_float_) -
+    reinterpret_cast<char*>(&_impl_.arg_position_)) + sizeof(_impl_.is_float_));
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RSRC.ImageArg)
+}
+
+inline void Message_RSRC_ImageArg::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.arg_position_){0u}
+    , decltype(_impl_.row_width_arg_){0}
+    , decltype(_impl_.is_float_){false}
+  };
+}
+
+Message_RSRC_ImageArg::~Message_RSRC_ImageArg() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RSRC.ImageArg)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Message_RSRC_ImageArg::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Message_RSRC_ImageArg::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Message_RSRC_ImageArg::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RSRC.ImageArg)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.arg_position_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.is_float_) -
+        reinterpret_cast<char*>(&_impl_.arg_position_)) + sizeof(_impl_.is_float_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Message_RSRC_ImageArg::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 arg_position = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_arg_position(&has_bits);
+          _impl_.arg_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 row_width_arg = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_row_width_arg(&has_bits);
+          _impl_.row_width_arg_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool is_float = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_is_float(&has_bits);
+          _impl_.is_float_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message_RSRC_ImageArg::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RSRC.ImageArg)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 arg_position = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_arg_position(), target);
+  }
+
+  // optional int32 row_width_arg = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_row_width_arg(), target);
+  }
+
+  // optional bool is_float = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_float(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RSRC.ImageArg)
+  return target;
+}
+
+size_t Message_RSRC_ImageArg::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RSRC.ImageArg)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional uint32 arg_position = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_arg_position());
+    }
+
+    // optional int32 row_width_arg = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_row_width_arg());
+    }
+
+    // optional bool is_float = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message_RSRC_ImageArg::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message_RSRC_ImageArg::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message_RSRC_ImageArg::GetClassData() const { return &_class_data_; }
+
+
+void Message_RSRC_ImageArg::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message_RSRC_ImageArg*>(&to_msg);
+  auto& from = static_cast<const Message_RSRC_ImageArg&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RSRC.ImageArg)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.arg_position_ = from._impl_.arg_position_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.row_width_arg_ = from._impl_.row_width_arg_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.is_float_ = from._impl_.is_float_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Message_RSRC_ImageArg::CopyFrom(const Message_RSRC_ImageArg& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RSRC.ImageArg)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Message_RSRC_ImageArg::IsInitialized() const {
+  return true;
+}
+
+void Message_RSRC_ImageArg::InternalSwap(Message_RSRC_ImageArg* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Message_RSRC_ImageArg, _impl_.is_float_)
+      + sizeof(Message_RSRC_ImageArg::_impl_.is_float_)
+      - PROTOBUF_FIELD_OFFSET(Message_RSRC_ImageArg, _impl_.arg_position_)>(
+          reinterpret_cast<char*>(&_impl_.arg_position_),
+          reinterpret_cast<char*>(&other->_impl_.arg_position_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Message_RSRC_ImageArg::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[9]);
+}
+
+// ===================================================================
+
+class Message_RSRC_PitchedArg::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Message_RSRC_PitchedArg>()._impl_._has_bits_);
+  static void set_has_arg_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_row_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_data_type_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+Message_RSRC_PitchedArg::Message_RSRC_PitchedArg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.Message_RSRC.PitchedArg)
+}
+Message_RSRC_PitchedArg::Message_RSRC_PitchedArg(const Message_RSRC_PitchedArg& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message_RSRC_PitchedArg* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.row_width_){}
+    , decltype(_impl_.arg_position_){}
+    , decltype(_impl_.data_type_size_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.row_width_, &from._impl_.row_width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.data_type_size_) -
+    reinterpret_cast<char*>(&_impl_.row_width_)) + sizeof(_impl_.data_type_size_));
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RSRC.PitchedArg)
+}
+
+inline void Message_RSRC_PitchedArg::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.row_width_){uint64_t{0u}}
+    , decltype(_impl_.arg_position_){0u}
+    , decltype(_impl_.data_type_size_){0u}
+  };
+}
+
+Message_RSRC_PitchedArg::~Message_RSRC_PitchedArg() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RSRC.PitchedArg)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Message_RSRC_PitchedArg::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Message_RSRC_PitchedArg::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Message_RSRC_PitchedArg::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RSRC.PitchedArg)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.row_width_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.data_type_size_) -
+        reinterpret_cast<char*>(&_impl_.row_width_)) + sizeof(_impl_.data_type_size_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Message_RSRC_PitchedArg::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 arg_position = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_arg_position(&has_bits);
+          _impl_.arg_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 row_width = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_row_width(&has_bits);
+          _impl_.row_width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 data_type_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_data_type_size(&has_bits);
+          _impl_.data_type_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message_RSRC_PitchedArg::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RSRC.PitchedArg)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 arg_position = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_arg_position(), target);
+  }
+
+  // optional uint64 row_width = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_row_width(), target);
+  }
+
+  // optional uint32 data_type_size = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_data_type_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RSRC.PitchedArg)
+  return target;
+}
+
+size_t Message_RSRC_PitchedArg::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RSRC.PitchedArg)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional uint64 row_width = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_row_width());
+    }
+
+    // optional uint32 arg_position = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_arg_position());
+    }
+
+    // optional uint32 data_type_size = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_data_type_size());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message_RSRC_PitchedArg::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message_RSRC_PitchedArg::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message_RSRC_PitchedArg::GetClassData() const { return &_class_data_; }
+
+
+void Message_RSRC_PitchedArg::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message_RSRC_PitchedArg*>(&to_msg);
+  auto& from = static_cast<const Message_RSRC_PitchedArg&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RSRC.PitchedArg)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.row_width_ = from._impl_.row_width_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.arg_position_ = from._impl_.arg_position_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.data_type_size_ = from._impl_.data_type_size_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Message_RSRC_PitchedArg::CopyFrom(const Message_RSRC_PitchedArg& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RSRC.PitchedArg)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Message_RSRC_PitchedArg::IsInitialized() const {
+  return true;
+}
+
+void Message_RSRC_PitchedArg::InternalSwap(Message_RSRC_PitchedArg* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Message_RSRC_PitchedArg, _impl_.data_type_size_)
+      + sizeof(Message_RSRC_PitchedArg::_impl_.data_type_size_)
+      - PROTOBUF_FIELD_OFFSET(Message_RSRC_PitchedArg, _impl_.row_width_)>(
+          reinterpret_cast<char*>(&_impl_.row_width_),
+          reinterpret_cast<char*>(&other->_impl_.row_width_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Message_RSRC_PitchedArg::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[10]);
+}
+
+// ===================================================================
+
+class Message_RSRC_ScopFunctionOCLInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Message_RSRC_ScopFunctionOCLInfo>()._impl_._has_bits_);
+  static void set_has_scopfunctionname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_scopoclkernelname(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::HTROP_PB::Message_RSRC_Reduction& reduction(const Message_RSRC_ScopFunctionOCLInfo* msg);
+  static void set_has_reduction(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_min_work_items(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_max_work_items(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_max_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_wavefront_skew(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& interior_kernel(const Message_RSRC_ScopFunctionOCLInfo* msg);
+  static void set_has_interior_kernel(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+const ::HTROP_PB::Message_RSRC_Reduction&
+Message_RSRC_ScopFunctionOCLInfo::_Internal::reduction(const Message_RSRC_ScopFunctionOCLInfo* msg) {
+  return *msg->_impl_.reduction_;
+}
+const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo&
+Message_RSRC_ScopFunctionOCLInfo::_Internal::interior_kernel(const Message_RSRC_ScopFunctionOCLInfo* msg) {
+  return *msg->_impl_.interior_kernel_;
+}
+Message_RSRC_ScopFunctionOCLInfo::Message_RSRC_ScopFunctionOCLInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+}
+Message_RSRC_ScopFunctionOCLInfo::Message_RSRC_ScopFunctionOCLInfo(const Message_RSRC_ScopFunctionOCLInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message_RSRC_ScopFunctionOCLInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.workgroup_arg_index_){from._impl_.workgroup_arg_index_}
+    , decltype(_impl_.workgroup_arg_index_offset_){from._impl_.workgroup_arg_index_offset_}
+    , decltype(_impl_.local_work_size_){from._impl_.local_work_size_}
+    , decltype(_impl_.register_block_){from._impl_.register_block_}
+    , decltype(_impl_.vector_width_){from._impl_.vector_width_}
+    , decltype(_impl_.coarsening_){from._impl_.coarsening_}
+    , decltype(_impl_.workgroup_loop_index_){from._impl_.workgroup_loop_index_}
+    , decltype(_impl_.image_args_){from._impl_.image_args_}
+    , decltype(_impl_.variants_){from._impl_.variants_}
+    , decltype(_impl_.size_versions_){from._impl_.size_versions_}
+    , decltype(_impl_.pitched_args_){from._impl_.pitched_args_}
+    , decltype(_impl_.distributed_kernels_){from._impl_.distributed_kernels_}
+    , decltype(_impl_.border_low_){from._impl_.border_low_}
+    , decltype(_impl_.border_high_){from._impl_.border_high_}
+    , decltype(_impl_.min_global_size_){from._impl_.min_global_size_}
+    , decltype(_impl_.max_global_size_){from._impl_.max_global_size_}
+    , decltype(_impl_.scopfunctionname_){}
+    , decltype(_impl_.scopoclkernelname_){}
+    , decltype(_impl_.reduction_){nullptr}
+    , decltype(_impl_.interior_kernel_){nullptr}
+    , decltype(_impl_.min_work_items_){}
+    , decltype(_impl_.max_work_items_){}
+    , decltype(_impl_.max_index_){}
+    , decltype(_impl_.wavefront_skew_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.scopfunctionname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.scopfunctionname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_scopfunctionname()) {
+    _this->_impl_.scopfunctionname_.Set(from._internal_scopfunctionname(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.scopoclkernelname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.scopoclkernelname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_scopoclkernelname()) {
+    _this->_impl_.scopoclkernelname_.Set(from._internal_scopoclkernelname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_reduction()) {
+    _this->_impl_.reduction_ = new ::HTROP_PB::Message_RSRC_Reduction(*from._impl_.reduction_);
+  }
+  if (from._internal_has_interior_kernel()) {
+    _this->_impl_.interior_kernel_ = new ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo(*from._impl_.interior_kernel_);
+  }
+  ::memcpy(&_impl_.min_work_items_, &from._impl_.min_work_items_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.wavefront_skew_) -
+    reinterpret_cast<char*>(&_impl_.min_work_items_)) + sizeof(_impl_.wavefront_skew_));
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+}
+
+inline void Message_RSRC_ScopFunctionOCLInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.workgroup_arg_index_){arena}
+    , decltype(_impl_.workgroup_arg_index_offset_){arena}
+    , decltype(_impl_.local_work_size_){arena}
+    , decltype(_impl_.register_block_){arena}
+    , decltype(_impl_.vector_width_){arena}
+    , decltype(_impl_.coarsening_){arena}
+    , decltype(_impl_.workgroup_loop_index_){arena}
+    , decltype(_impl_.image_args_){arena}
+    , decltype(_impl_.variants_){arena}
+    , decltype(_impl_.size_versions_){arena}
+    , decltype(_impl_.pitched_args_){arena}
+    , decltype(_impl_.distributed_kernels_){arena}
+    , decltype(_impl_.border_low_){arena}
+    , decltype(_impl_.border_high_){arena}
+    , decltype(_impl_.min_global_size_){arena}
+    , decltype(_impl_.max_global_size_){arena}
+    , decltype(_impl_.scopfunctionname_){}
+    , decltype(_impl_.scopoclkernelname_){}
+    , decltype(_impl_.reduction_){nullptr}
+    , decltype(_impl_.interior_kernel_){nullptr}
+    , decltype(_impl_.min_work_items_){uint64_t{0u}}
+    , decltype(_impl_.max_work_items_){uint64_t{0u}}
+    , decltype(_impl_.max_index_){uint64_t{0u}}
+    , decltype(_impl_.wavefront_skew_){0u}
+  };
+  _impl_.scopfunctionname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.scopfunctionname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.scopoclkernelname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.scopoclkernelname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Message_RSRC_ScopFunctionOCLInfo::~Message_RSRC_ScopFunctionOCLInfo() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Message_RSRC_ScopFunctionOCLInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.workgroup_arg_index_.~RepeatedField();
+  _impl_.workgroup_arg_index_offset_.~RepeatedField();
+  _impl_.local_work_size_.~RepeatedField();
+  _impl_.register_block_.~RepeatedPtrField();
+  _impl_.vector_width_.~RepeatedPtrField();
+  _impl_.coarsening_.~RepeatedPtrField();
+  _impl_.workgroup_loop_index_.~RepeatedField();
+  _impl_.image_args_.~RepeatedPtrField();
+  _impl_.variants_.~RepeatedPtrField();
+  _impl_.size_versions_.~RepeatedPtrField();
+  _impl_.pitched_args_.~RepeatedPtrField();
+  _impl_.distributed_kernels_.~RepeatedPtrField();
+  _impl_.border_low_.~RepeatedField();
+  _impl_.border_high_.~RepeatedField();
+  _impl_.min_global_size_.~RepeatedField();
+  _impl_.max_global_size_.~RepeatedField();
+  _impl_.scopfunctionname_.Destroy();
+  _impl_.scopoclkernelname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.reduction_;
+  if (this != internal_default_instance()) delete _impl_.interior_kernel_;
+}
+
+void Message_RSRC_ScopFunctionOCLInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Message_RSRC_ScopFunctionOCLInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.workgroup_arg_index_.Clear();
+  _impl_.workgroup_arg_index_offset_.Clear();
+  _impl_.local_work_size_.Clear();
+  _impl_.register_block_.Clear();
+  _impl_.vector_width_.Clear();
+  _impl_.coarsening_.Clear();
+  _impl_.workgroup_loop_index_.Clear();
+  _impl_.image_args_.Clear();
+  _impl_.variants_.Clear();
+  _impl_.size_versions_.Clear();
+  _impl_.pitched_args_.Clear();
+  _impl_.distributed_kernels_.Clear();
+  _impl_.border_low_.Clear();
+  _impl_.border_high_.Clear();
+  _impl_.min_global_size_.Clear();
+  _impl_.max_global_size_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.scopfunctionname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.scopoclkernelname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.reduction_ != nullptr);
+      _impl_.reduction_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.interior_kernel_ != nullptr);
+      _impl_.interior_kernel_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f0u) {
+    ::memset(&_impl_.min_work_items_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.wavefront_skew_) -
+        reinterpret_cast<char*>(&_impl_.min_work_items_)) + sizeof(_impl_.wavefront_skew_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Message_RSRC_ScopFunctionOCLInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string scopFunctionName = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_scopfunctionname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string scopOCLKernelName = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_scopoclkernelname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 workgroup_arg_index = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_workgroup_arg_index(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<24>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_workgroup_arg_index(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 workgroup_arg_index_offset = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_workgroup_arg_index_offset(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<32>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_workgroup_arg_index_offset(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 local_work_size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_local_work_size(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<40>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 42) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_local_work_size(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .HTROP_PB.Message_RSRC.WorkItemFactor register_block = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_register_block(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .HTROP_PB.Message_RSRC.WorkItemFactor vector_width = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_vector_width(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .HTROP_PB.Message_RSRC.WorkItemFactor coarsening = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_coarsening(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .HTROP_PB.Message_RSRC.Reduction reduction = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reduction(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 workgroup_loop_index = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_workgroup_loop_index(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<80>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 82) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_workgroup_loop_index(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .HTROP_PB.Message_RSRC.ImageArg image_args = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_image_args(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo variants = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_variants(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo size_versions = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_size_versions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<106>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 min_work_items = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_min_work_items(&has_bits);
+          _impl_.min_work_items_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 max_work_items = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_max_work_items(&has_bits);
+          _impl_.max_work_items_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .HTROP_PB.Message_RSRC.PitchedArg pitched_args = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_pitched_args(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<130>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 max_index = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _Internal::set_has_max_index(&has_bits);
+          _impl_.max_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 wavefront_skew = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _Internal::set_has_wavefront_skew(&has_bits);
+          _impl_.wavefront_skew_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo distributed_kernels = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_distributed_kernels(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<154>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo interior_kernel = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          ptr = ctx->ParseMessage(_internal_mutable_interior_kernel(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 border_low = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_border_low(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<168>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 170) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_border_low(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 border_high = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 176)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_border_high(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<176>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 178) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_border_high(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 min_global_size = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 184)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_min_global_size(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<184>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 186) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_min_global_size(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 max_global_size = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 192)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_max_global_size(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<192>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 194) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_max_global_size(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message_RSRC_ScopFunctionOCLInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string scopFunctionName = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_scopfunctionname().data(), static_cast<int>(this->_internal_scopfunctionname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_scopfunctionname(), target);
+  }
+
+  // optional string scopOCLKernelName = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_scopoclkernelname().data(), static_cast<int>(this->_internal_scopoclkernelname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_scopoclkernelname(), target);
+  }
+
+  // repeated int32 workgroup_arg_index = 3;
+  for (int i = 0, n = this->_internal_workgroup_arg_index_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_workgroup_arg_index(i), target);
+  }
+
+  // repeated int32 workgroup_arg_index_offset = 4;
+  for (int i = 0, n = this->_internal_workgroup_arg_index_offset_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_workgroup_arg_index_offset(i), target);
+  }
+
+  // repeated uint32 local_work_size = 5;
+  for (int i = 0, n = this->_internal_local_work_size_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_local_work_size(i), target);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.WorkItemFactor register_block = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_register_block_size()); i < n; i++) {
+    const auto& repfield = this->_internal_register_block(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.WorkItemFactor vector_width = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_vector_width_size()); i < n; i++) {
+    const auto& repfield = this->_internal_vector_width(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.WorkItemFactor coarsening = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_coarsening_size()); i < n; i++) {
+    const auto& repfield = this->_internal_coarsening(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .HTROP_PB.Message_RSRC.Reduction reduction = 9;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::reduction(this),
+        _Internal::reduction(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated int32 workgroup_loop_index = 10;
+  for (int i = 0, n = this->_internal_workgroup_loop_index_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_workgroup_loop_index(i), target);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.ImageArg image_args = 11;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_image_args_size()); i < n; i++) {
+    const auto& repfield = this->_internal_image_args(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo variants = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_variants_size()); i < n; i++) {
+    const auto& repfield = this->_internal_variants(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo size_versions = 13;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_size_versions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_size_versions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(13, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 min_work_items = 14;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(14, this->_internal_min_work_items(), target);
+  }
+
+  // optional uint64 max_work_items = 15;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(15, this->_internal_max_work_items(), target);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.PitchedArg pitched_args = 16;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_pitched_args_size()); i < n; i++) {
+    const auto& repfield = this->_internal_pitched_args(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(16, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 max_index = 17;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(17, this->_internal_max_index(), target);
+  }
+
+  // optional uint32 wavefront_skew = 18;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(18, this->_internal_wavefront_skew(), target);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo distributed_kernels = 19;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_distributed_kernels_size()); i < n; i++) {
+    const auto& repfield = this->_internal_distributed_kernels(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(19, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo interior_kernel = 20;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(20, _Internal::interior_kernel(this),
+        _Internal::interior_kernel(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated uint32 border_low = 21;
+  for (int i = 0, n = this->_internal_border_low_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(21, this->_internal_border_low(i), target);
+  }
+
+  // repeated uint32 border_high = 22;
+  for (int i = 0, n = this->_internal_border_high_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(22, this->_internal_border_high(i), target);
+  }
+
+  // repeated uint64 min_global_size = 23;
+  for (int i = 0, n = this->_internal_min_global_size_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(23, this->_internal_min_global_size(i), target);
+  }
+
+  // repeated uint64 max_global_size = 24;
+  for (int i = 0, n = this->_internal_max_global_size_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(24, this->_internal_max_global_size(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+  return target;
+}
+
+size_t Message_RSRC_ScopFunctionOCLInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 workgroup_arg_index = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.workgroup_arg_index_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_workgroup_arg_index_size());
+    total_size += data_size;
+  }
+
+  // repeated int32 workgroup_arg_index_offset = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.workgroup_arg_index_offset_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_workgroup_arg_index_offset_size());
+    total_size += data_size;
+  }
+
+  // repeated uint32 local_work_size = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.local_work_size_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_local_work_size_size());
+    total_size += data_size;
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.WorkItemFactor register_block = 6;
+  total_size += 1UL * this->_internal_register_block_size();
+  for (const auto& msg : this->_impl_.register_block_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.WorkItemFactor vector_width = 7;
+  total_size += 1UL * this->_internal_vector_width_size();
+  for (const auto& msg : this->_impl_.vector_width_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.WorkItemFactor coarsening = 8;
+  total_size += 1UL * this->_internal_coarsening_size();
+  for (const auto& msg : this->_impl_.coarsening_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated int32 workgroup_loop_index = 10;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.workgroup_loop_index_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_workgroup_loop_index_size());
+    total_size += data_size;
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.ImageArg image_args = 11;
+  total_size += 1UL * this->_internal_image_args_size();
+  for (const auto& msg : this->_impl_.image_args_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo variants = 12;
+  total_size += 1UL * this->_internal_variants_size();
+  for (const auto& msg : this->_impl_.variants_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo size_versions = 13;
+  total_size += 1UL * this->_internal_size_versions_size();
+  for (const auto& msg : this->_impl_.size_versions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.PitchedArg pitched_args = 16;
+  total_size += 2UL * this->_internal_pitched_args_size();
+  for (const auto& msg : this->_impl_.pitched_args_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo distributed_kernels = 19;
+  total_size += 2UL * this->_internal_distributed_kernels_size();
+  for (const auto& msg : this->_impl_.distributed_kernels_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated uint32 border_low = 21;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.border_low_);
+    total_size += 2 *
+                  ::_pbi::FromIntSize(this->_internal_border_low_size());
+    total_size += data_size;
+  }
+
+  // repeated uint32 border_high = 22;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.border_high_);
+    total_size += 2 *
+                  ::_pbi::FromIntSize(this->_internal_border_high_size());
+    total_size += data_size;
+  }
+
+  // repeated uint64 min_global_size = 23;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.min_global_size_);
+    total_size += 2 *
+                  ::_pbi::FromIntSize(this->_internal_min_global_size_size());
+    total_size += data_size;
+  }
+
+  // repeated uint64 max_global_size = 24;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.max_global_size_);
+    total_size += 2 *
+                  ::_pbi::FromIntSize(this->_internal_max_global_size_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string scopFunctionName = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_scopfunctionname());
+    }
+
+    // optional string scopOCLKernelName = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_scopoclkernelname());
+    }
+
+    // optional .HTROP_PB.Message_RSRC.Reduction reduction = 9;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.reduction_);
+    }
+
+    // optional .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo interior_kernel = 20;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.interior_kernel_);
+    }
+
+    // optional uint64 min_work_items = 14;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_min_work_items());
+    }
+
+    // optional uint64 max_work_items = 15;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_work_items());
+    }
+
+    // optional uint64 max_index = 17;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt64Size(
+          this->_internal_max_index());
+    }
+
+    // optional uint32 wavefront_skew = 18;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::UInt32Size(
+          this->_internal_wavefront_skew());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message_RSRC_ScopFunctionOCLInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message_RSRC_ScopFunctionOCLInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message_RSRC_ScopFunctionOCLInfo::GetClassData() const { return &_class_data_; }
+
+
+void Message_RSRC_ScopFunctionOCLInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message_RSRC_ScopFunctionOCLInfo*>(&to_msg);
+  auto& from = static_cast<const Message_RSRC_ScopFunctionOCLInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.workgroup_arg_index_.MergeFrom(from._impl_.workgroup_arg_index_);
+  _this->_impl_.workgroup_arg_index_offset_.MergeFrom(from._impl_.workgroup_arg_index_offset_);
+  _this->_impl_.local_work_size_.MergeFrom(from._impl_.local_work_size_);
+  _this->_impl_.register_block_.MergeFrom(from._impl_.register_block_);
+  _this->_impl_.vector_width_.MergeFrom(from._impl_.vector_width_);
+  _this->_impl_.coarsening_.MergeFrom(from._impl_.coarsening_);
+  _this->_impl_.workgroup_loop_index_.MergeFrom(from._impl_.workgroup_loop_index_);
+  _this->_impl_.image_args_.MergeFrom(from._impl_.image_args_);
+  _this->_impl_.variants_.MergeFrom(from._impl_.variants_);
+  _this->_impl_.size_versions_.MergeFrom(from._impl_.size_versions_);
+  _this->_impl_.pitched_args_.MergeFrom(from._impl_.pitched_args_);
+  _this->_impl_.distributed_kernels_.MergeFrom(from._impl_.distributed_kernels_);
+  _this->_impl_.border_low_.MergeFrom(from._impl_.border_low_);
+  _this->_impl_.border_high_.MergeFrom(from._impl_.border_high_);
+  _this->_impl_.min_global_size_.MergeFrom(from._impl_.min_global_size_);
+  _this->_impl_.max_global_size_.MergeFrom(from._impl_.max_global_size_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_scopfunctionname(from._internal_scopfunctionname());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_scopoclkernelname(from._internal_scopoclkernelname());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_reduction()->::HTROP_PB::Message_RSRC_Reduction::MergeFrom(
+          from._internal_reduction());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_interior_kernel()->::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo::MergeFrom(
+          from._internal_interior_kernel());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.min_work_items_ = from._impl_.min_work_items_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.max_work_items_ = from._impl_.max_work_items_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.max_index_ = from._impl_.max_index_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.wavefront_skew_ = from._impl_.wavefront_skew_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Message_RSRC_ScopFunctionOCLInfo::CopyFrom(const Message_RSRC_ScopFunctionOCLInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Message_RSRC_ScopFunctionOCLInfo::IsInitialized() const {
+  return true;
+}
+
+void Message_RSRC_ScopFunctionOCLInfo::InternalSwap(Message_RSRC_ScopFunctionOCLInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.workgroup_arg_index_.InternalSwap(&other->_impl_.workgroup_arg_index_);
+  _impl_.workgroup_arg_index_offset_.InternalSwap(&other->_impl_.workgroup_arg_index_offset_);
+  _impl_.local_work_size_.InternalSwap(&other->_impl_.local_work_size_);
+  _impl_.register_block_.InternalSwap(&other->_impl_.register_block_);
+  _impl_.vector_width_.InternalSwap(&other->_impl_.vector_width_);
+  _impl_.coarsening_.InternalSwap(&other->_impl_.coarsening_);
+  _impl_.workgroup_loop_index_.InternalSwap(&other->_impl_.workgroup_loop_index_);
+  _impl_.image_args_.InternalSwap(&other->_impl_.image_args_);
+  _impl_.variants_.InternalSwap(&other->_impl_.variants_);
+  _impl_.size_versions_.InternalSwap(&other->_impl_.size_versions_);
+  _impl_.pitched_args_.InternalSwap(&other->_impl_.pitched_args_);
+  _impl_.distributed_kernels_.InternalSwap(&other->_impl_.distributed_kernels_);
+  _impl_.border_low_.InternalSwap(&other->_impl_.border_low_);
+  _impl_.border_high_.InternalSwap(&other->_impl_.border_high_);
+  _impl_.min_global_size_.InternalSwap(&other->_impl_.min_global_size_);
+  _impl_.max_global_size_.InternalSwap(&other->_impl_.max_global_size_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.scopfunctionname_, lhs_arena,
+      &other->_impl_.scopfunctionname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.scopoclkernelname_, lhs_arena,
+      &other->_impl_.scopoclkernelname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Message_RSRC_ScopFunctionOCLInfo, _impl_.wavefront_skew_)
+      + sizeof(Message_RSRC_ScopFunctionOCLInfo::_impl_.wavefront_skew_)
+      - PROTOBUF_FIELD_OFFSET(Message_RSRC_ScopFunctionOCLInfo, _impl_.reduction_)>(
+          reinterpret_cast<char*>(&_impl_.reduction_),
+          reinterpret_cast<char*>(&other->_impl_.reduction_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Message_RSRC_ScopFunctionOCLInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[11]);
+}
+
+// ===================================================================
+
+class Message_RSRC::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Message_RSRC>()._impl_._has_bits_);
+  static void set_has_oclkernelfilename(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_binarysize(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+Message_RSRC::Message_RSRC(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.Message_RSRC)
+}
+Message_RSRC::Message_RSRC(const Message_RSRC& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message_RSRC* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scopfunctions_){from._impl_.scopfunctions_}
+    , decltype(_impl_.oclkernelfilename_){}
+    , decltype(_impl_.binarysize_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.oclkernelfilename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.oclkernelfilename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_oclkernelfilename()) {
+    _this->_impl_.oclkernelfilename_.Set(from._internal_oclkernelfilename(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.binarysize_ = from._impl_.binarysize_;
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RSRC)
+}
+
+inline void Message_RSRC::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scopfunctions_){arena}
+    , decltype(_impl_.oclkernelfilename_){}
+    , decltype(_impl_.binarysize_){0u}
+  };
+  _impl_.oclkernelfilename_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.oclkernelfilename_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Message_RSRC::~Message_RSRC() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RSRC)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Message_RCRS::SharedDtor() {
-  scopfunctionparentname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
+inline void Message_RSRC::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.scopfunctions_.~RepeatedPtrField();
+  _impl_.oclkernelfilename_.Destroy();
+}
+
+void Message_RSRC::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Message_RSRC::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RSRC)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.scopfunctions_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.oclkernelfilename_.ClearNonDefaultToEmpty();
+  }
+  _impl_.binarysize_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Message_RSRC::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo scopFunctions = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_scopfunctions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string oclKernelFileName = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_oclkernelfilename();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "HTROP_PB.Message_RSRC.oclKernelFileName");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 binarySize = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_binarysize(&has_bits);
+          _impl_.binarysize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message_RSRC::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RSRC)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo scopFunctions = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_scopfunctions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_scopfunctions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string oclKernelFileName = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_oclkernelfilename().data(), static_cast<int>(this->_internal_oclkernelfilename().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.Message_RSRC.oclKernelFileName");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_oclkernelfilename(), target);
+  }
+
+  // optional uint32 binarySize = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_binarysize(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RSRC)
+  return target;
 }
 
-void Message_RCRS::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+size_t Message_RSRC::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RSRC)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo scopFunctions = 1;
+  total_size += 1UL * this->_internal_scopfunctions_size();
+  for (const auto& msg : this->_impl_.scopfunctions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string oclKernelFileName = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_oclkernelfilename());
+    }
+
+    // optional uint32 binarySize = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_binarysize());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
-const ::google::protobuf::Descriptor* Message_RCRS::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Message_RCRS_descriptor_;
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message_RSRC::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message_RSRC::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message_RSRC::GetClassData() const { return &_class_data_; }
+
+
+void Message_RSRC::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message_RSRC*>(&to_msg);
+  auto& from = static_cast<const Message_RSRC&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RSRC)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.scopfunctions_.MergeFrom(from._impl_.scopfunctions_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_oclkernelfilename(from._internal_oclkernelfilename());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.binarysize_ = from._impl_.binarysize_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Message_RSRC::CopyFrom(const Message_RSRC& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RSRC)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Message_RSRC::IsInitialized() const {
+  return true;
+}
+
+void Message_RSRC::InternalSwap(Message_RSRC* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.scopfunctions_.InternalSwap(&other->_impl_.scopfunctions_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.oclkernelfilename_, lhs_arena,
+      &other->_impl_.oclkernelfilename_, rhs_arena
+  );
+  swap(_impl_.binarysize_, other->_impl_.binarysize_);
 }
 
-const Message_RCRS& Message_RCRS::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_hds_2eproto();
-  return *default_instance_;
+::PROTOBUF_NAMESPACE_ID::Metadata Message_RSRC::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[12]);
 }
 
-Message_RCRS* Message_RCRS::default_instance_ = NULL;
+// ===================================================================
 
-Message_RCRS* Message_RCRS::New(::google::protobuf::Arena* arena) const {
-  Message_RCRS* n = new Message_RCRS;
-  if (arena != NULL) {
-    arena->Own(n);
+class ScopArgInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ScopArgInfo>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_ispointer(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
   }
-  return n;
+  static void set_has_dimension(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+ScopArgInfo::ScopArgInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.ScopArgInfo)
+}
+ScopArgInfo::ScopArgInfo(const ScopArgInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScopArgInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dimension_min_){from._impl_.dimension_min_}
+    , decltype(_impl_.dimension_max_){from._impl_.dimension_max_}
+    , decltype(_impl_.dimension_minstr_){from._impl_.dimension_minstr_}
+    , decltype(_impl_.dimension_maxstr_){from._impl_.dimension_maxstr_}
+    , decltype(_impl_.dimension_offset_min_){from._impl_.dimension_offset_min_}
+    , decltype(_impl_.dimension_offset_max_){from._impl_.dimension_offset_max_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.ispointer_){}
+    , decltype(_impl_.dimension_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dimension_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.dimension_));
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.ScopArgInfo)
+}
+
+inline void ScopArgInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dimension_min_){arena}
+    , decltype(_impl_.dimension_max_){arena}
+    , decltype(_impl_.dimension_minstr_){arena}
+    , decltype(_impl_.dimension_maxstr_){arena}
+    , decltype(_impl_.dimension_offset_min_){arena}
+    , decltype(_impl_.dimension_offset_max_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.ispointer_){false}
+    , decltype(_impl_.dimension_){0u}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void Message_RCRS::Clear() {
-// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RCRS)
-  if (has_scopfunctionparentname()) {
-    scopfunctionparentname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  }
-  scoplist_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
-  }
-}
-
-bool Message_RCRS::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:HTROP_PB.Message_RCRS)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .HTROP_PB.Message_RCRS.ScopInfo scopList = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(input->IncrementRecursionDepth());
-         parse_loop_scopList:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
-                input, add_scoplist()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(10)) goto parse_loop_scopList;
-        input->UnsafeDecrementRecursionDepth();
-        if (input->ExpectTag(18)) goto parse_scopFunctionParentName;
-        break;
-      }
+ScopArgInfo::~ScopArgInfo() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.ScopArgInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
-      // optional string scopFunctionParentName = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_scopFunctionParentName:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_scopfunctionparentname()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->scopfunctionparentname().data(), this->scopfunctionparentname().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "HTROP_PB.Message_RCRS.scopFunctionParentName");
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:HTROP_PB.Message_RCRS)
-  return true;
+inline void ScopArgInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dimension_min_.~RepeatedField();
+  _impl_.dimension_max_.~RepeatedField();
+  _impl_.dimension_minstr_.~RepeatedPtrField();
+  _impl_.dimension_maxstr_.~RepeatedPtrField();
+  _impl_.dimension_offset_min_.~RepeatedField();
+  _impl_.dimension_offset_max_.~RepeatedField();
+  _impl_.name_.Destroy();
+}
+
+void ScopArgInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ScopArgInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.ScopArgInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.dimension_min_.Clear();
+  _impl_.dimension_max_.Clear();
+  _impl_.dimension_minstr_.Clear();
+  _impl_.dimension_maxstr_.Clear();
+  _impl_.dimension_offset_min_.Clear();
+  _impl_.dimension_offset_max_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.dimension_) -
+        reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.dimension_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScopArgInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "HTROP_PB.ScopArgInfo.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool isPointer = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_ispointer(&has_bits);
+          _impl_.ispointer_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 dimension = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_dimension(&has_bits);
+          _impl_.dimension_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 dimension_min = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_dimension_min(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<40>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 42) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_dimension_min(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 dimension_max = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_dimension_max(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<48>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_dimension_max(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string dimension_minStr = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_dimension_minstr();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "HTROP_PB.ScopArgInfo.dimension_minStr");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string dimension_maxStr = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_dimension_maxstr();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "HTROP_PB.ScopArgInfo.dimension_maxStr");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 dimension_offset_min = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_dimension_offset_min(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<72>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 74) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_dimension_offset_min(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 dimension_offset_max = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_dimension_offset_max(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<80>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 82) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_dimension_offset_max(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:HTROP_PB.Message_RCRS)
-  return false;
-#undef DO_
-}
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScopArgInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.ScopArgInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.ScopArgInfo.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
 
-void Message_RCRS::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:HTROP_PB.Message_RCRS)
-  // repeated .HTROP_PB.Message_RCRS.ScopInfo scopList = 1;
-  for (unsigned int i = 0, n = this->scoplist_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->scoplist(i), output);
+  // optional int32 type = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_type(), target);
   }
 
-  // optional string scopFunctionParentName = 2;
-  if (has_scopfunctionparentname()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->scopfunctionparentname().data(), this->scopfunctionparentname().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "HTROP_PB.Message_RCRS.scopFunctionParentName");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->scopfunctionparentname(), output);
+  // optional bool isPointer = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_ispointer(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional uint32 dimension = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_dimension(), target);
   }
-  // @@protoc_insertion_point(serialize_end:HTROP_PB.Message_RCRS)
-}
 
-::google::protobuf::uint8* Message_RCRS::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RCRS)
-  // repeated .HTROP_PB.Message_RCRS.ScopInfo scopList = 1;
-  for (unsigned int i = 0, n = this->scoplist_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        1, this->scoplist(i), false, target);
+  // repeated int64 dimension_min = 5;
+  for (int i = 0, n = this->_internal_dimension_min_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_dimension_min(i), target);
   }
 
-  // optional string scopFunctionParentName = 2;
-  if (has_scopfunctionparentname()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->scopfunctionparentname().data(), this->scopfunctionparentname().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "HTROP_PB.Message_RCRS.scopFunctionParentName");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->scopfunctionparentname(), target);
+  // repeated int64 dimension_max = 6;
+  for (int i = 0, n = this->_internal_dimension_max_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_dimension_max(i), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // repeated string dimension_minStr = 7;
+  for (int i = 0, n = this->_internal_dimension_minstr_size(); i < n; i++) {
+    const auto& s = this->_internal_dimension_minstr(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.ScopArgInfo.dimension_minStr");
+    target = stream->WriteString(7, s, target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RCRS)
+
+  // repeated string dimension_maxStr = 8;
+  for (int i = 0, n = this->_internal_dimension_maxstr_size(); i < n; i++) {
+    const auto& s = this->_internal_dimension_maxstr(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.ScopArgInfo.dimension_maxStr");
+    target = stream->WriteString(8, s, target);
+  }
+
+  // repeated int64 dimension_offset_min = 9;
+  for (int i = 0, n = this->_internal_dimension_offset_min_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_dimension_offset_min(i), target);
+  }
+
+  // repeated int64 dimension_offset_max = 10;
+  for (int i = 0, n = this->_internal_dimension_offset_max_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(10, this->_internal_dimension_offset_max(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.ScopArgInfo)
   return target;
 }
 
-int Message_RCRS::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RCRS)
-  int total_size = 0;
+size_t ScopArgInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.ScopArgInfo)
+  size_t total_size = 0;
 
-  // optional string scopFunctionParentName = 2;
-  if (has_scopfunctionparentname()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->scopfunctionparentname());
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int64 dimension_min = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.dimension_min_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_dimension_min_size());
+    total_size += data_size;
   }
 
-  // repeated .HTROP_PB.Message_RCRS.ScopInfo scopList = 1;
-  total_size += 1 * this->scoplist_size();
-  for (int i = 0; i < this->scoplist_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->scoplist(i));
+  // repeated int64 dimension_max = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.dimension_max_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_dimension_max_size());
+    total_size += data_size;
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // repeated string dimension_minStr = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.dimension_minstr_.size());
+  for (int i = 0, n = _impl_.dimension_minstr_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.dimension_minstr_.Get(i));
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Message_RCRS::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:HTROP_PB.Message_RCRS)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  // repeated string dimension_maxStr = 8;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.dimension_maxstr_.size());
+  for (int i = 0, n = _impl_.dimension_maxstr_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.dimension_maxstr_.Get(i));
   }
-  const Message_RCRS* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const Message_RCRS>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:HTROP_PB.Message_RCRS)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:HTROP_PB.Message_RCRS)
-    MergeFrom(*source);
+
+  // repeated int64 dimension_offset_min = 9;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.dimension_offset_min_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_dimension_offset_min_size());
+    total_size += data_size;
   }
-}
 
-void Message_RCRS::MergeFrom(const Message_RCRS& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RCRS)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  // repeated int64 dimension_offset_max = 10;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.dimension_offset_max_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_dimension_offset_max_size());
+    total_size += data_size;
   }
-  scoplist_.MergeFrom(from.scoplist_);
-  if (from._has_bits_[1 / 32] & (0xffu << (1 % 32))) {
-    if (from.has_scopfunctionparentname()) {
-      set_has_scopfunctionparentname();
-      scopfunctionparentname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.scopfunctionparentname_);
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional int32 type = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type());
+    }
+
+    // optional bool isPointer = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
     }
+
+    // optional uint32 dimension = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dimension());
+    }
+
   }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScopArgInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScopArgInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScopArgInfo::GetClassData() const { return &_class_data_; }
+
+
+void ScopArgInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScopArgInfo*>(&to_msg);
+  auto& from = static_cast<const ScopArgInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.ScopArgInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.dimension_min_.MergeFrom(from._impl_.dimension_min_);
+  _this->_impl_.dimension_max_.MergeFrom(from._impl_.dimension_max_);
+  _this->_impl_.dimension_minstr_.MergeFrom(from._impl_.dimension_minstr_);
+  _this->_impl_.dimension_maxstr_.MergeFrom(from._impl_.dimension_maxstr_);
+  _this->_impl_.dimension_offset_min_.MergeFrom(from._impl_.dimension_offset_min_);
+  _this->_impl_.dimension_offset_max_.MergeFrom(from._impl_.dimension_offset_max_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.ispointer_ = from._impl_.ispointer_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.dimension_ = from._impl_.dimension_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Message_RCRS::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:HTROP_PB.Message_RCRS)
+void ScopArgInfo::CopyFrom(const ScopArgInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.ScopArgInfo)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Message_RCRS::CopyFrom(const Message_RCRS& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RCRS)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+bool ScopArgInfo::IsInitialized() const {
+  return true;
 }
 
-bool Message_RCRS::IsInitialized() const {
-
-  return true;
+void ScopArgInfo::InternalSwap(ScopArgInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.dimension_min_.InternalSwap(&other->_impl_.dimension_min_);
+  _impl_.dimension_max_.InternalSwap(&other->_impl_.dimension_max_);
+  _impl_.dimension_minstr_.InternalSwap(&other->_impl_.dimension_minstr_);
+  _impl_.dimension_maxstr_.InternalSwap(&other->_impl_.dimension_maxstr_);
+  _impl_.dimension_offset_min_.InternalSwap(&other->_impl_.dimension_offset_min_);
+  _impl_.dimension_offset_max_.InternalSwap(&other->_impl_.dimension_offset_max_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ScopArgInfo, _impl_.dimension_)
+      + sizeof(ScopArgInfo::_impl_.dimension_)
+      - PROTOBUF_FIELD_OFFSET(ScopArgInfo, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScopArgInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[13]);
 }
 
-void Message_RCRS::Swap(Message_RCRS* other) {
-  if (other == this) return;
-  InternalSwap(other);
+// ===================================================================
+
+class ScopLoopBound::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ScopLoopBound>()._impl_._has_bits_);
+  static void set_has_namestr(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_maxvalue(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_maxvaluestr(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+ScopLoopBound::ScopLoopBound(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.ScopLoopBound)
+}
+ScopLoopBound::ScopLoopBound(const ScopLoopBound& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScopLoopBound* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.namestr_){}
+    , decltype(_impl_.maxvaluestr_){}
+    , decltype(_impl_.maxvalue_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.namestr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.namestr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_namestr()) {
+    _this->_impl_.namestr_.Set(from._internal_namestr(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.maxvaluestr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.maxvaluestr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_maxvaluestr()) {
+    _this->_impl_.maxvaluestr_.Set(from._internal_maxvaluestr(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.maxvalue_ = from._impl_.maxvalue_;
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.ScopLoopBound)
+}
+
+inline void ScopLoopBound::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.namestr_){}
+    , decltype(_impl_.maxvaluestr_){}
+    , decltype(_impl_.maxvalue_){uint64_t{0u}}
+  };
+  _impl_.namestr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.namestr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.maxvaluestr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.maxvaluestr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ScopLoopBound::~ScopLoopBound() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.ScopLoopBound)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-void Message_RCRS::InternalSwap(Message_RCRS* other) {
-  scoplist_.UnsafeArenaSwap(&other->scoplist_);
-  scopfunctionparentname_.Swap(&other->scopfunctionparentname_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+
+inline void ScopLoopBound::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.namestr_.Destroy();
+  _impl_.maxvaluestr_.Destroy();
 }
 
-::google::protobuf::Metadata Message_RCRS::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Message_RCRS_descriptor_;
-  metadata.reflection = Message_RCRS_reflection_;
-  return metadata;
+void ScopLoopBound::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// Message_RCRS_ScopInfo
+void ScopLoopBound::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.ScopLoopBound)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-// optional string scopFunctionName = 1;
-bool Message_RCRS_ScopInfo::has_scopfunctionname() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-void Message_RCRS_ScopInfo::set_has_scopfunctionname() {
-  _has_bits_[0] |= 0x00000001u;
-}
-void Message_RCRS_ScopInfo::clear_has_scopfunctionname() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-void Message_RCRS_ScopInfo::clear_scopfunctionname() {
-  scopfunctionname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_scopfunctionname();
-}
- const ::std::string& Message_RCRS_ScopInfo::scopfunctionname() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
-  return scopfunctionname_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Message_RCRS_ScopInfo::set_scopfunctionname(const ::std::string& value) {
-  set_has_scopfunctionname();
-  scopfunctionname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
-}
- void Message_RCRS_ScopInfo::set_scopfunctionname(const char* value) {
-  set_has_scopfunctionname();
-  scopfunctionname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
-}
- void Message_RCRS_ScopInfo::set_scopfunctionname(const char* value, size_t size) {
-  set_has_scopfunctionname();
-  scopfunctionname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
-}
- ::std::string* Message_RCRS_ScopInfo::mutable_scopfunctionname() {
-  set_has_scopfunctionname();
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
-  return scopfunctionname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* Message_RCRS_ScopInfo::release_scopfunctionname() {
-  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
-  clear_has_scopfunctionname();
-  return scopfunctionname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Message_RCRS_ScopInfo::set_allocated_scopfunctionname(::std::string* scopfunctionname) {
-  if (scopfunctionname != NULL) {
-    set_has_scopfunctionname();
-  } else {
-    clear_has_scopfunctionname();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.namestr_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.maxvaluestr_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.maxvalue_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScopLoopBound::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string nameStr = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_namestr();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "HTROP_PB.ScopLoopBound.nameStr");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 maxValue = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_maxvalue(&has_bits);
+          _impl_.maxvalue_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string maxValueStr = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_maxvaluestr();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "HTROP_PB.ScopLoopBound.maxValueStr");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScopLoopBound::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.ScopLoopBound)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string nameStr = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_namestr().data(), static_cast<int>(this->_internal_namestr().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.ScopLoopBound.nameStr");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_namestr(), target);
   }
-  scopfunctionname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), scopfunctionname);
-  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
-}
 
-// optional uint32 max_codegen_loop_depth = 2;
-bool Message_RCRS_ScopInfo::has_max_codegen_loop_depth() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-void Message_RCRS_ScopInfo::set_has_max_codegen_loop_depth() {
-  _has_bits_[0] |= 0x00000002u;
-}
-void Message_RCRS_ScopInfo::clear_has_max_codegen_loop_depth() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-void Message_RCRS_ScopInfo::clear_max_codegen_loop_depth() {
-  max_codegen_loop_depth_ = 0u;
-  clear_has_max_codegen_loop_depth();
-}
- ::google::protobuf::uint32 Message_RCRS_ScopInfo::max_codegen_loop_depth() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.max_codegen_loop_depth)
-  return max_codegen_loop_depth_;
-}
- void Message_RCRS_ScopInfo::set_max_codegen_loop_depth(::google::protobuf::uint32 value) {
-  set_has_max_codegen_loop_depth();
-  max_codegen_loop_depth_ = value;
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.ScopInfo.max_codegen_loop_depth)
+  // optional uint64 maxValue = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_maxvalue(), target);
+  }
+
+  // optional string maxValueStr = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_maxvaluestr().data(), static_cast<int>(this->_internal_maxvaluestr().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.ScopLoopBound.maxValueStr");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_maxvaluestr(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.ScopLoopBound)
+  return target;
 }
 
-// -------------------------------------------------------------------
+size_t ScopLoopBound::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.ScopLoopBound)
+  size_t total_size = 0;
 
-// Message_RCRS
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-// repeated .HTROP_PB.Message_RCRS.ScopInfo scopList = 1;
-int Message_RCRS::scoplist_size() const {
-  return scoplist_.size();
-}
-void Message_RCRS::clear_scoplist() {
-  scoplist_.Clear();
-}
-const ::HTROP_PB::Message_RCRS_ScopInfo& Message_RCRS::scoplist(int index) const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.scopList)
-  return scoplist_.Get(index);
-}
-::HTROP_PB::Message_RCRS_ScopInfo* Message_RCRS::mutable_scoplist(int index) {
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.scopList)
-  return scoplist_.Mutable(index);
-}
-::HTROP_PB::Message_RCRS_ScopInfo* Message_RCRS::add_scoplist() {
-  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RCRS.scopList)
-  return scoplist_.Add();
-}
-::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RCRS_ScopInfo >*
-Message_RCRS::mutable_scoplist() {
-  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RCRS.scopList)
-  return &scoplist_;
-}
-const ::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RCRS_ScopInfo >&
-Message_RCRS::scoplist() const {
-  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RCRS.scopList)
-  return scoplist_;
-}
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string nameStr = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_namestr());
+    }
+
+    // optional string maxValueStr = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_maxvaluestr());
+    }
+
+    // optional uint64 maxValue = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_maxvalue());
+    }
 
-// optional string scopFunctionParentName = 2;
-bool Message_RCRS::has_scopfunctionparentname() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-void Message_RCRS::set_has_scopfunctionparentname() {
-  _has_bits_[0] |= 0x00000002u;
-}
-void Message_RCRS::clear_has_scopfunctionparentname() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-void Message_RCRS::clear_scopfunctionparentname() {
-  scopfunctionparentname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_scopfunctionparentname();
-}
- const ::std::string& Message_RCRS::scopfunctionparentname() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.scopFunctionParentName)
-  return scopfunctionparentname_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Message_RCRS::set_scopfunctionparentname(const ::std::string& value) {
-  set_has_scopfunctionparentname();
-  scopfunctionparentname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.scopFunctionParentName)
-}
- void Message_RCRS::set_scopfunctionparentname(const char* value) {
-  set_has_scopfunctionparentname();
-  scopfunctionparentname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HTROP_PB.Message_RCRS.scopFunctionParentName)
-}
- void Message_RCRS::set_scopfunctionparentname(const char* value, size_t size) {
-  set_has_scopfunctionparentname();
-  scopfunctionparentname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.Message_RCRS.scopFunctionParentName)
-}
- ::std::string* Message_RCRS::mutable_scopfunctionparentname() {
-  set_has_scopfunctionparentname();
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.scopFunctionParentName)
-  return scopfunctionparentname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* Message_RCRS::release_scopfunctionparentname() {
-  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RCRS.scopFunctionParentName)
-  clear_has_scopfunctionparentname();
-  return scopfunctionparentname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Message_RCRS::set_allocated_scopfunctionparentname(::std::string* scopfunctionparentname) {
-  if (scopfunctionparentname != NULL) {
-    set_has_scopfunctionparentname();
-  } else {
-    clear_has_scopfunctionparentname();
   }
-  scopfunctionparentname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), scopfunctionparentname);
-  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RCRS.scopFunctionParentName)
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScopLoopBound::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScopLoopBound::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScopLoopBound::GetClassData() const { return &_class_data_; }
 
-// ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Message_RSRC_ScopFunctionOCLInfo::kScopFunctionNameFieldNumber;
-const int Message_RSRC_ScopFunctionOCLInfo::kScopOCLKernelNameFieldNumber;
-const int Message_RSRC_ScopFunctionOCLInfo::kWorkgroupArgIndexFieldNumber;
-const int Message_RSRC_ScopFunctionOCLInfo::kWorkgroupArgIndexOffsetFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+void ScopLoopBound::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScopLoopBound*>(&to_msg);
+  auto& from = static_cast<const ScopLoopBound&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.ScopLoopBound)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-Message_RSRC_ScopFunctionOCLInfo::Message_RSRC_ScopFunctionOCLInfo()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_namestr(from._internal_namestr());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_maxvaluestr(from._internal_maxvaluestr());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.maxvalue_ = from._impl_.maxvalue_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Message_RSRC_ScopFunctionOCLInfo::InitAsDefaultInstance() {
+void ScopLoopBound::CopyFrom(const ScopLoopBound& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.ScopLoopBound)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
 
-Message_RSRC_ScopFunctionOCLInfo::Message_RSRC_ScopFunctionOCLInfo(const Message_RSRC_ScopFunctionOCLInfo& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+bool ScopLoopBound::IsInitialized() const {
+  return true;
 }
 
-void Message_RSRC_ScopFunctionOCLInfo::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  scopfunctionname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  scopoclkernelname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+void ScopLoopBound::InternalSwap(ScopLoopBound* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.namestr_, lhs_arena,
+      &other->_impl_.namestr_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.maxvaluestr_, lhs_arena,
+      &other->_impl_.maxvaluestr_, rhs_arena
+  );
+  swap(_impl_.maxvalue_, other->_impl_.maxvalue_);
 }
 
-Message_RSRC_ScopFunctionOCLInfo::~Message_RSRC_ScopFunctionOCLInfo() {
-  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-  SharedDtor();
+::PROTOBUF_NAMESPACE_ID::Metadata ScopLoopBound::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[14]);
 }
 
-void Message_RSRC_ScopFunctionOCLInfo::SharedDtor() {
-  scopfunctionname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  scopoclkernelname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
+// ===================================================================
+
+class ScopAnalysisInfo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ScopAnalysisInfo>()._impl_._has_bits_);
+  static void set_has_scopfunctionname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_scopfunctionparentname(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_maxparallelizationdepth(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::HTROP_PB::ReductionHint& reduction(const ScopAnalysisInfo* msg);
+  static void set_has_reduction(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_wavefront_skew(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
   }
+  static const ::HTROP_PB::ScatterHint& scatter(const ScopAnalysisInfo* msg);
+  static void set_has_scatter(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+const ::HTROP_PB::ReductionHint&
+ScopAnalysisInfo::_Internal::reduction(const ScopAnalysisInfo* msg) {
+  return *msg->_impl_.reduction_;
+}
+const ::HTROP_PB::ScatterHint&
+ScopAnalysisInfo::_Internal::scatter(const ScopAnalysisInfo* msg) {
+  return *msg->_impl_.scatter_;
+}
+ScopAnalysisInfo::ScopAnalysisInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.ScopAnalysisInfo)
+}
+ScopAnalysisInfo::ScopAnalysisInfo(const ScopAnalysisInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScopAnalysisInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scopfunctionargs_){from._impl_.scopfunctionargs_}
+    , decltype(_impl_.scoploops_){from._impl_.scoploops_}
+    , decltype(_impl_.scopfunctionname_){}
+    , decltype(_impl_.scopfunctionparentname_){}
+    , decltype(_impl_.reduction_){nullptr}
+    , decltype(_impl_.scatter_){nullptr}
+    , decltype(_impl_.maxparallelizationdepth_){}
+    , decltype(_impl_.wavefront_skew_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.scopfunctionname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.scopfunctionname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_scopfunctionname()) {
+    _this->_impl_.scopfunctionname_.Set(from._internal_scopfunctionname(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.scopfunctionparentname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.scopfunctionparentname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_scopfunctionparentname()) {
+    _this->_impl_.scopfunctionparentname_.Set(from._internal_scopfunctionparentname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_reduction()) {
+    _this->_impl_.reduction_ = new ::HTROP_PB::ReductionHint(*from._impl_.reduction_);
+  }
+  if (from._internal_has_scatter()) {
+    _this->_impl_.scatter_ = new ::HTROP_PB::ScatterHint(*from._impl_.scatter_);
+  }
+  ::memcpy(&_impl_.maxparallelizationdepth_, &from._impl_.maxparallelizationdepth_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.wavefront_skew_) -
+    reinterpret_cast<char*>(&_impl_.maxparallelizationdepth_)) + sizeof(_impl_.wavefront_skew_));
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.ScopAnalysisInfo)
+}
+
+inline void ScopAnalysisInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scopfunctionargs_){arena}
+    , decltype(_impl_.scoploops_){arena}
+    , decltype(_impl_.scopfunctionname_){}
+    , decltype(_impl_.scopfunctionparentname_){}
+    , decltype(_impl_.reduction_){nullptr}
+    , decltype(_impl_.scatter_){nullptr}
+    , decltype(_impl_.maxparallelizationdepth_){0u}
+    , decltype(_impl_.wavefront_skew_){0u}
+  };
+  _impl_.scopfunctionname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.scopfunctionname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.scopfunctionparentname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.scopfunctionparentname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ScopAnalysisInfo::~ScopAnalysisInfo() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.ScopAnalysisInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-void Message_RSRC_ScopFunctionOCLInfo::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Message_RSRC_ScopFunctionOCLInfo::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Message_RSRC_ScopFunctionOCLInfo_descriptor_;
+inline void ScopAnalysisInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.scopfunctionargs_.~RepeatedPtrField();
+  _impl_.scoploops_.~RepeatedPtrField();
+  _impl_.scopfunctionname_.Destroy();
+  _impl_.scopfunctionparentname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.reduction_;
+  if (this != internal_default_instance()) delete _impl_.scatter_;
 }
 
-const Message_RSRC_ScopFunctionOCLInfo& Message_RSRC_ScopFunctionOCLInfo::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_hds_2eproto();
-  return *default_instance_;
+void ScopAnalysisInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::default_instance_ = NULL;
-
-Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::New(::google::protobuf::Arena* arena) const {
-  Message_RSRC_ScopFunctionOCLInfo* n = new Message_RSRC_ScopFunctionOCLInfo;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
-}
+void ScopAnalysisInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.ScopAnalysisInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void Message_RSRC_ScopFunctionOCLInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-  if (_has_bits_[0 / 32] & 3u) {
-    if (has_scopfunctionname()) {
-      scopfunctionname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.scopfunctionargs_.Clear();
+  _impl_.scoploops_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.scopfunctionname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.scopfunctionparentname_.ClearNonDefaultToEmpty();
     }
-    if (has_scopoclkernelname()) {
-      scopoclkernelname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.reduction_ != nullptr);
+      _impl_.reduction_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.scatter_ != nullptr);
+      _impl_.scatter_->Clear();
     }
   }
-  workgroup_arg_index_.Clear();
-  workgroup_arg_index_offset_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
+  if (cached_has_bits & 0x00000030u) {
+    ::memset(&_impl_.maxparallelizationdepth_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.wavefront_skew_) -
+        reinterpret_cast<char*>(&_impl_.maxparallelizationdepth_)) + sizeof(_impl_.wavefront_skew_));
   }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Message_RSRC_ScopFunctionOCLInfo::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* ScopAnalysisInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string scopFunctionName = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_scopfunctionname()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->scopfunctionname().data(), this->scopfunctionname().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName");
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_scopOCLKernelName;
-        break;
-      }
-
-      // optional string scopOCLKernelName = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_scopOCLKernelName:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_scopoclkernelname()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->scopoclkernelname().data(), this->scopoclkernelname().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName");
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_workgroup_arg_index;
-        break;
-      }
-
-      // repeated int32 workgroup_arg_index = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_workgroup_arg_index:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 1, 24, input, this->mutable_workgroup_arg_index())));
-        } else if (tag == 26) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, this->mutable_workgroup_arg_index())));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_workgroup_arg_index;
-        if (input->ExpectTag(32)) goto parse_workgroup_arg_index_offset;
-        break;
-      }
-
-      // repeated int32 workgroup_arg_index_offset = 4;
-      case 4: {
-        if (tag == 32) {
-         parse_workgroup_arg_index_offset:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 1, 32, input, this->mutable_workgroup_arg_index_offset())));
-        } else if (tag == 34) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, this->mutable_workgroup_arg_index_offset())));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(32)) goto parse_workgroup_arg_index_offset;
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-  return true;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_scopfunctionname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "HTROP_PB.ScopAnalysisInfo.scopFunctionName");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string scopFunctionParentName = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_scopfunctionparentname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "HTROP_PB.ScopAnalysisInfo.scopFunctionParentName");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .HTROP_PB.ScopArgInfo scopFunctionArgs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_scopfunctionargs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .HTROP_PB.ScopLoopBound scopLoops = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_scoploops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 maxParallelizationDepth = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_maxparallelizationdepth(&has_bits);
+          _impl_.maxparallelizationdepth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .HTROP_PB.ReductionHint reduction = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reduction(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 wavefront_skew = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_wavefront_skew(&has_bits);
+          _impl_.wavefront_skew_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .HTROP_PB.ScatterHint scatter = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_scatter(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Message_RSRC_ScopFunctionOCLInfo::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-  // optional string scopFunctionName = 1;
-  if (has_scopfunctionname()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->scopfunctionname().data(), this->scopfunctionname().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->scopfunctionname(), output);
-  }
+uint8_t* ScopAnalysisInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.ScopAnalysisInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // optional string scopOCLKernelName = 2;
-  if (has_scopoclkernelname()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->scopoclkernelname().data(), this->scopoclkernelname().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->scopoclkernelname(), output);
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string scopFunctionName = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_scopfunctionname().data(), static_cast<int>(this->_internal_scopfunctionname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.ScopAnalysisInfo.scopFunctionName");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_scopfunctionname(), target);
   }
 
-  // repeated int32 workgroup_arg_index = 3;
-  for (int i = 0; i < this->workgroup_arg_index_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(
-      3, this->workgroup_arg_index(i), output);
+  // optional string scopFunctionParentName = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_scopfunctionparentname().data(), static_cast<int>(this->_internal_scopfunctionparentname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "HTROP_PB.ScopAnalysisInfo.scopFunctionParentName");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_scopfunctionparentname(), target);
   }
 
-  // repeated int32 workgroup_arg_index_offset = 4;
-  for (int i = 0; i < this->workgroup_arg_index_offset_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(
-      4, this->workgroup_arg_index_offset(i), output);
+  // repeated .HTROP_PB.ScopArgInfo scopFunctionArgs = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_scopfunctionargs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_scopfunctionargs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // repeated .HTROP_PB.ScopLoopBound scopLoops = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_scoploops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_scoploops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-}
 
-::google::protobuf::uint8* Message_RSRC_ScopFunctionOCLInfo::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-  // optional string scopFunctionName = 1;
-  if (has_scopfunctionname()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->scopfunctionname().data(), this->scopfunctionname().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->scopfunctionname(), target);
+  // optional uint32 maxParallelizationDepth = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_maxparallelizationdepth(), target);
   }
 
-  // optional string scopOCLKernelName = 2;
-  if (has_scopoclkernelname()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->scopoclkernelname().data(), this->scopoclkernelname().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->scopoclkernelname(), target);
+  // optional .HTROP_PB.ReductionHint reduction = 6;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::reduction(this),
+        _Internal::reduction(this).GetCachedSize(), target, stream);
   }
 
-  // repeated int32 workgroup_arg_index = 3;
-  for (int i = 0; i < this->workgroup_arg_index_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteInt32ToArray(3, this->workgroup_arg_index(i), target);
+  // optional uint32 wavefront_skew = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_wavefront_skew(), target);
   }
 
-  // repeated int32 workgroup_arg_index_offset = 4;
-  for (int i = 0; i < this->workgroup_arg_index_offset_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteInt32ToArray(4, this->workgroup_arg_index_offset(i), target);
+  // optional .HTROP_PB.ScatterHint scatter = 8;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::scatter(this),
+        _Internal::scatter(this).GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.ScopAnalysisInfo)
   return target;
 }
 
-int Message_RSRC_ScopFunctionOCLInfo::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-  int total_size = 0;
+size_t ScopAnalysisInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.ScopAnalysisInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .HTROP_PB.ScopArgInfo scopFunctionArgs = 3;
+  total_size += 1UL * this->_internal_scopfunctionargs_size();
+  for (const auto& msg : this->_impl_.scopfunctionargs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .HTROP_PB.ScopLoopBound scopLoops = 4;
+  total_size += 1UL * this->_internal_scoploops_size();
+  for (const auto& msg : this->_impl_.scoploops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
 
-  if (_has_bits_[0 / 32] & 3u) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
     // optional string scopFunctionName = 1;
-    if (has_scopfunctionname()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->scopfunctionname());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_scopfunctionname());
     }
 
-    // optional string scopOCLKernelName = 2;
-    if (has_scopoclkernelname()) {
+    // optional string scopFunctionParentName = 2;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->scopoclkernelname());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_scopfunctionparentname());
     }
 
-  }
-  // repeated int32 workgroup_arg_index = 3;
-  {
-    int data_size = 0;
-    for (int i = 0; i < this->workgroup_arg_index_size(); i++) {
-      data_size += ::google::protobuf::internal::WireFormatLite::
-        Int32Size(this->workgroup_arg_index(i));
+    // optional .HTROP_PB.ReductionHint reduction = 6;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.reduction_);
     }
-    total_size += 1 * this->workgroup_arg_index_size() + data_size;
-  }
 
-  // repeated int32 workgroup_arg_index_offset = 4;
-  {
-    int data_size = 0;
-    for (int i = 0; i < this->workgroup_arg_index_offset_size(); i++) {
-      data_size += ::google::protobuf::internal::WireFormatLite::
-        Int32Size(this->workgroup_arg_index_offset(i));
+    // optional .HTROP_PB.ScatterHint scatter = 8;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.scatter_);
     }
-    total_size += 1 * this->workgroup_arg_index_offset_size() + data_size;
-  }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional uint32 maxParallelizationDepth = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_maxparallelizationdepth());
+    }
 
-void Message_RSRC_ScopFunctionOCLInfo::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const Message_RSRC_ScopFunctionOCLInfo* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const Message_RSRC_ScopFunctionOCLInfo>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-    MergeFrom(*source);
-  }
-}
+    // optional uint32 wavefront_skew = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_wavefront_skew());
+    }
 
-void Message_RSRC_ScopFunctionOCLInfo::MergeFrom(const Message_RSRC_ScopFunctionOCLInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  workgroup_arg_index_.MergeFrom(from.workgroup_arg_index_);
-  workgroup_arg_index_offset_.MergeFrom(from.workgroup_arg_index_offset_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_scopfunctionname()) {
-      set_has_scopfunctionname();
-      scopfunctionname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.scopfunctionname_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScopAnalysisInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScopAnalysisInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScopAnalysisInfo::GetClassData() const { return &_class_data_; }
+
+
+void ScopAnalysisInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScopAnalysisInfo*>(&to_msg);
+  auto& from = static_cast<const ScopAnalysisInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.ScopAnalysisInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.scopfunctionargs_.MergeFrom(from._impl_.scopfunctionargs_);
+  _this->_impl_.scoploops_.MergeFrom(from._impl_.scoploops_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_scopfunctionname(from._internal_scopfunctionname());
     }
-    if (from.has_scopoclkernelname()) {
-      set_has_scopoclkernelname();
-      scopoclkernelname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.scopoclkernelname_);
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_scopfunctionparentname(from._internal_scopfunctionparentname());
     }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_reduction()->::HTROP_PB::ReductionHint::MergeFrom(
+          from._internal_reduction());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_scatter()->::HTROP_PB::ScatterHint::MergeFrom(
+          from._internal_scatter());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.maxparallelizationdepth_ = from._impl_.maxparallelizationdepth_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.wavefront_skew_ = from._impl_.wavefront_skew_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-  }
-}
-
-void Message_RSRC_ScopFunctionOCLInfo::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Message_RSRC_ScopFunctionOCLInfo::CopyFrom(const Message_RSRC_ScopFunctionOCLInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+void ScopAnalysisInfo::CopyFrom(const ScopAnalysisInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.ScopAnalysisInfo)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Message_RSRC_ScopFunctionOCLInfo::IsInitialized() const {
-
+bool ScopAnalysisInfo::IsInitialized() const {
   return true;
 }
 
-void Message_RSRC_ScopFunctionOCLInfo::Swap(Message_RSRC_ScopFunctionOCLInfo* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void Message_RSRC_ScopFunctionOCLInfo::InternalSwap(Message_RSRC_ScopFunctionOCLInfo* other) {
-  scopfunctionname_.Swap(&other->scopfunctionname_);
-  scopoclkernelname_.Swap(&other->scopoclkernelname_);
-  workgroup_arg_index_.UnsafeArenaSwap(&other->workgroup_arg_index_);
-  workgroup_arg_index_offset_.UnsafeArenaSwap(&other->workgroup_arg_index_offset_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata Message_RSRC_ScopFunctionOCLInfo::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Message_RSRC_ScopFunctionOCLInfo_descriptor_;
-  metadata.reflection = Message_RSRC_ScopFunctionOCLInfo_reflection_;
-  return metadata;
-}
-
-
-// -------------------------------------------------------------------
-
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Message_RSRC::kScopFunctionsFieldNumber;
-const int Message_RSRC::kOclKernelFileNameFieldNumber;
-const int Message_RSRC::kBinarySizeFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Message_RSRC::Message_RSRC()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:HTROP_PB.Message_RSRC)
-}
-
-void Message_RSRC::InitAsDefaultInstance() {
+void ScopAnalysisInfo::InternalSwap(ScopAnalysisInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.scopfunctionargs_.InternalSwap(&other->_impl_.scopfunctionargs_);
+  _impl_.scoploops_.InternalSwap(&other->_impl_.scoploops_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.scopfunctionname_, lhs_arena,
+      &other->_impl_.scopfunctionname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.scopfunctionparentname_, lhs_arena,
+      &other->_impl_.scopfunctionparentname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ScopAnalysisInfo, _impl_.wavefront_skew_)
+      + sizeof(ScopAnalysisInfo::_impl_.wavefront_skew_)
+      - PROTOBUF_FIELD_OFFSET(ScopAnalysisInfo, _impl_.reduction_)>(
+          reinterpret_cast<char*>(&_impl_.reduction_),
+          reinterpret_cast<char*>(&other->_impl_.reduction_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScopAnalysisInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[15]);
 }
 
-Message_RSRC::Message_RSRC(const Message_RSRC& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RSRC)
-}
-
-void Message_RSRC::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
-  _cached_size_ = 0;
-  oclkernelfilename_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  binarysize_ = 0u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+// ===================================================================
 
-Message_RSRC::~Message_RSRC() {
-  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RSRC)
-  SharedDtor();
+class Message_RCRS_Analysis::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Message_RCRS_Analysis>()._impl_._has_bits_);
+  static void set_has_modulesize(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_optimize_schedule(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+Message_RCRS_Analysis::Message_RCRS_Analysis(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.Message_RCRS_Analysis)
+}
+Message_RCRS_Analysis::Message_RCRS_Analysis(const Message_RCRS_Analysis& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message_RCRS_Analysis* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.max_scop_loop_depth_){from._impl_.max_scop_loop_depth_}
+    , decltype(_impl_.max_codegen_loop_depth_){from._impl_.max_codegen_loop_depth_}
+    , decltype(_impl_.modulesize_){}
+    , decltype(_impl_.optimize_schedule_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.modulesize_, &from._impl_.modulesize_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.optimize_schedule_) -
+    reinterpret_cast<char*>(&_impl_.modulesize_)) + sizeof(_impl_.optimize_schedule_));
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RCRS_Analysis)
+}
+
+inline void Message_RCRS_Analysis::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.max_scop_loop_depth_){arena}
+    , decltype(_impl_.max_codegen_loop_depth_){arena}
+    , decltype(_impl_.modulesize_){0u}
+    , decltype(_impl_.optimize_schedule_){false}
+  };
 }
 
-void Message_RSRC::SharedDtor() {
-  oclkernelfilename_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != default_instance_) {
+Message_RCRS_Analysis::~Message_RCRS_Analysis() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RCRS_Analysis)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-void Message_RSRC::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Message_RSRC::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Message_RSRC_descriptor_;
+inline void Message_RCRS_Analysis::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.max_scop_loop_depth_.~RepeatedField();
+  _impl_.max_codegen_loop_depth_.~RepeatedField();
 }
 
-const Message_RSRC& Message_RSRC::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_hds_2eproto();
-  return *default_instance_;
+void Message_RCRS_Analysis::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-Message_RSRC* Message_RSRC::default_instance_ = NULL;
+void Message_RCRS_Analysis::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RCRS_Analysis)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-Message_RSRC* Message_RSRC::New(::google::protobuf::Arena* arena) const {
-  Message_RSRC* n = new Message_RSRC;
-  if (arena != NULL) {
-    arena->Own(n);
+  _impl_.max_scop_loop_depth_.Clear();
+  _impl_.max_codegen_loop_depth_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.modulesize_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.optimize_schedule_) -
+        reinterpret_cast<char*>(&_impl_.modulesize_)) + sizeof(_impl_.optimize_schedule_));
   }
-  return n;
-}
-
-void Message_RSRC::Clear() {
-// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RSRC)
-  if (_has_bits_[0 / 32] & 6u) {
-    if (has_oclkernelfilename()) {
-      oclkernelfilename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Message_RCRS_Analysis::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated int32 max_scop_loop_depth = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_max_scop_loop_depth(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<8>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_max_scop_loop_depth(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 max_codegen_loop_depth = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_max_codegen_loop_depth(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<16>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_max_codegen_loop_depth(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 moduleSize = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_modulesize(&has_bits);
+          _impl_.modulesize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool optimize_schedule = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_optimize_schedule(&has_bits);
+          _impl_.optimize_schedule_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-    binarysize_ = 0u;
-  }
-  scopfunctions_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
-  }
-}
-
-bool Message_RSRC::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:HTROP_PB.Message_RSRC)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo scopFunctions = 1;
-      case 1: {
-        if (tag == 10) {
-          DO_(input->IncrementRecursionDepth());
-         parse_loop_scopFunctions:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
-                input, add_scopfunctions()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(10)) goto parse_loop_scopFunctions;
-        input->UnsafeDecrementRecursionDepth();
-        if (input->ExpectTag(18)) goto parse_oclKernelFileName;
-        break;
-      }
-
-      // optional string oclKernelFileName = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_oclKernelFileName:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_oclkernelfilename()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->oclkernelfilename().data(), this->oclkernelfilename().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "HTROP_PB.Message_RSRC.oclKernelFileName");
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_binarySize;
-        break;
-      }
-
-      // optional uint32 binarySize = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_binarySize:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &binarysize_)));
-          set_has_binarysize();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:HTROP_PB.Message_RSRC)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:HTROP_PB.Message_RSRC)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Message_RSRC::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:HTROP_PB.Message_RSRC)
-  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo scopFunctions = 1;
-  for (unsigned int i = 0, n = this->scopfunctions_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->scopfunctions(i), output);
-  }
-
-  // optional string oclKernelFileName = 2;
-  if (has_oclkernelfilename()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->oclkernelfilename().data(), this->oclkernelfilename().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "HTROP_PB.Message_RSRC.oclKernelFileName");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->oclkernelfilename(), output);
-  }
-
-  // optional uint32 binarySize = 3;
-  if (has_binarysize()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->binarysize(), output);
-  }
+uint8_t* Message_RCRS_Analysis::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RCRS_Analysis)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // repeated int32 max_scop_loop_depth = 1;
+  for (int i = 0, n = this->_internal_max_scop_loop_depth_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_max_scop_loop_depth(i), target);
   }
-  // @@protoc_insertion_point(serialize_end:HTROP_PB.Message_RSRC)
-}
 
-::google::protobuf::uint8* Message_RSRC::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RSRC)
-  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo scopFunctions = 1;
-  for (unsigned int i = 0, n = this->scopfunctions_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        1, this->scopfunctions(i), false, target);
+  // repeated int32 max_codegen_loop_depth = 2;
+  for (int i = 0, n = this->_internal_max_codegen_loop_depth_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_max_codegen_loop_depth(i), target);
   }
 
-  // optional string oclKernelFileName = 2;
-  if (has_oclkernelfilename()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->oclkernelfilename().data(), this->oclkernelfilename().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "HTROP_PB.Message_RSRC.oclKernelFileName");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->oclkernelfilename(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 moduleSize = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_modulesize(), target);
   }
 
-  // optional uint32 binarySize = 3;
-  if (has_binarysize()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->binarysize(), target);
+  // optional bool optimize_schedule = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_optimize_schedule(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RSRC)
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RCRS_Analysis)
   return target;
 }
 
-int Message_RSRC::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RSRC)
-  int total_size = 0;
-
-  if (_has_bits_[1 / 32] & 6u) {
-    // optional string oclKernelFileName = 2;
-    if (has_oclkernelfilename()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->oclkernelfilename());
-    }
+size_t Message_RCRS_Analysis::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RCRS_Analysis)
+  size_t total_size = 0;
 
-    // optional uint32 binarySize = 3;
-    if (has_binarysize()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->binarysize());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  }
-  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo scopFunctions = 1;
-  total_size += 1 * this->scopfunctions_size();
-  for (int i = 0; i < this->scopfunctions_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->scopfunctions(i));
+  // repeated int32 max_scop_loop_depth = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.max_scop_loop_depth_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_max_scop_loop_depth_size());
+    total_size += data_size;
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // repeated int32 max_codegen_loop_depth = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.max_codegen_loop_depth_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_max_codegen_loop_depth_size());
+    total_size += data_size;
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Message_RSRC::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:HTROP_PB.Message_RSRC)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const Message_RSRC* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const Message_RSRC>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:HTROP_PB.Message_RSRC)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:HTROP_PB.Message_RSRC)
-    MergeFrom(*source);
-  }
-}
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint32 moduleSize = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_modulesize());
+    }
+
+    // optional bool optimize_schedule = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
 
-void Message_RSRC::MergeFrom(const Message_RSRC& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RSRC)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  scopfunctions_.MergeFrom(from.scopfunctions_);
-  if (from._has_bits_[1 / 32] & (0xffu << (1 % 32))) {
-    if (from.has_oclkernelfilename()) {
-      set_has_oclkernelfilename();
-      oclkernelfilename_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.oclkernelfilename_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message_RCRS_Analysis::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message_RCRS_Analysis::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message_RCRS_Analysis::GetClassData() const { return &_class_data_; }
+
+
+void Message_RCRS_Analysis::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message_RCRS_Analysis*>(&to_msg);
+  auto& from = static_cast<const Message_RCRS_Analysis&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RCRS_Analysis)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.max_scop_loop_depth_.MergeFrom(from._impl_.max_scop_loop_depth_);
+  _this->_impl_.max_codegen_loop_depth_.MergeFrom(from._impl_.max_codegen_loop_depth_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.modulesize_ = from._impl_.modulesize_;
     }
-    if (from.has_binarysize()) {
-      set_binarysize(from.binarysize());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.optimize_schedule_ = from._impl_.optimize_schedule_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-  }
-}
-
-void Message_RSRC::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:HTROP_PB.Message_RSRC)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Message_RSRC::CopyFrom(const Message_RSRC& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RSRC)
+void Message_RCRS_Analysis::CopyFrom(const Message_RCRS_Analysis& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RCRS_Analysis)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Message_RSRC::IsInitialized() const {
-
+bool Message_RCRS_Analysis::IsInitialized() const {
   return true;
 }
 
-void Message_RSRC::Swap(Message_RSRC* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void Message_RSRC::InternalSwap(Message_RSRC* other) {
-  scopfunctions_.UnsafeArenaSwap(&other->scopfunctions_);
-  oclkernelfilename_.Swap(&other->oclkernelfilename_);
-  std::swap(binarysize_, other->binarysize_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+void Message_RCRS_Analysis::InternalSwap(Message_RCRS_Analysis* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.max_scop_loop_depth_.InternalSwap(&other->_impl_.max_scop_loop_depth_);
+  _impl_.max_codegen_loop_depth_.InternalSwap(&other->_impl_.max_codegen_loop_depth_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Message_RCRS_Analysis, _impl_.optimize_schedule_)
+      + sizeof(Message_RCRS_Analysis::_impl_.optimize_schedule_)
+      - PROTOBUF_FIELD_OFFSET(Message_RCRS_Analysis, _impl_.modulesize_)>(
+          reinterpret_cast<char*>(&_impl_.modulesize_),
+          reinterpret_cast<char*>(&other->_impl_.modulesize_));
 }
-
-::google::protobuf::Metadata Message_RSRC::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Message_RSRC_descriptor_;
-  metadata.reflection = Message_RSRC_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// Message_RSRC_ScopFunctionOCLInfo
-
-// optional string scopFunctionName = 1;
-bool Message_RSRC_ScopFunctionOCLInfo::has_scopfunctionname() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-void Message_RSRC_ScopFunctionOCLInfo::set_has_scopfunctionname() {
-  _has_bits_[0] |= 0x00000001u;
-}
-void Message_RSRC_ScopFunctionOCLInfo::clear_has_scopfunctionname() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-void Message_RSRC_ScopFunctionOCLInfo::clear_scopfunctionname() {
-  scopfunctionname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_scopfunctionname();
-}
- const ::std::string& Message_RSRC_ScopFunctionOCLInfo::scopfunctionname() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
-  return scopfunctionname_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Message_RSRC_ScopFunctionOCLInfo::set_scopfunctionname(const ::std::string& value) {
-  set_has_scopfunctionname();
-  scopfunctionname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
-}
- void Message_RSRC_ScopFunctionOCLInfo::set_scopfunctionname(const char* value) {
-  set_has_scopfunctionname();
-  scopfunctionname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
-}
- void Message_RSRC_ScopFunctionOCLInfo::set_scopfunctionname(const char* value, size_t size) {
-  set_has_scopfunctionname();
-  scopfunctionname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
-}
- ::std::string* Message_RSRC_ScopFunctionOCLInfo::mutable_scopfunctionname() {
-  set_has_scopfunctionname();
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
-  return scopfunctionname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* Message_RSRC_ScopFunctionOCLInfo::release_scopfunctionname() {
-  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
-  clear_has_scopfunctionname();
-  return scopfunctionname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+::PROTOBUF_NAMESPACE_ID::Metadata Message_RCRS_Analysis::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[16]);
 }
- void Message_RSRC_ScopFunctionOCLInfo::set_allocated_scopfunctionname(::std::string* scopfunctionname) {
-  if (scopfunctionname != NULL) {
-    set_has_scopfunctionname();
-  } else {
-    clear_has_scopfunctionname();
+
+// ===================================================================
+
+class Message_RSRC_Analysis::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Message_RSRC_Analysis>()._impl_._has_bits_);
+  static void set_has_resultsize(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  scopfunctionname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), scopfunctionname);
-  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
+};
+
+Message_RSRC_Analysis::Message_RSRC_Analysis(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.Message_RSRC_Analysis)
+}
+Message_RSRC_Analysis::Message_RSRC_Analysis(const Message_RSRC_Analysis& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message_RSRC_Analysis* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.resultsize_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.resultsize_ = from._impl_.resultsize_;
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.Message_RSRC_Analysis)
+}
+
+inline void Message_RSRC_Analysis::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.resultsize_){0u}
+  };
 }
 
-// optional string scopOCLKernelName = 2;
-bool Message_RSRC_ScopFunctionOCLInfo::has_scopoclkernelname() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-void Message_RSRC_ScopFunctionOCLInfo::set_has_scopoclkernelname() {
-  _has_bits_[0] |= 0x00000002u;
-}
-void Message_RSRC_ScopFunctionOCLInfo::clear_has_scopoclkernelname() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-void Message_RSRC_ScopFunctionOCLInfo::clear_scopoclkernelname() {
-  scopoclkernelname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_scopoclkernelname();
-}
- const ::std::string& Message_RSRC_ScopFunctionOCLInfo::scopoclkernelname() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
-  return scopoclkernelname_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void Message_RSRC_ScopFunctionOCLInfo::set_scopoclkernelname(const ::std::string& value) {
-  set_has_scopoclkernelname();
-  scopoclkernelname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
-}
- void Message_RSRC_ScopFunctionOCLInfo::set_scopoclkernelname(const char* value) {
-  set_has_scopoclkernelname();
-  scopoclkernelname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
+Message_RSRC_Analysis::~Message_RSRC_Analysis() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.Message_RSRC_Analysis)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
- void Message_RSRC_ScopFunctionOCLInfo::set_scopoclkernelname(const char* value, size_t size) {
-  set_has_scopoclkernelname();
-  scopoclkernelname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
+
+inline void Message_RSRC_Analysis::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
- ::std::string* Message_RSRC_ScopFunctionOCLInfo::mutable_scopoclkernelname() {
-  set_has_scopoclkernelname();
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
-  return scopoclkernelname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+void Message_RSRC_Analysis::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
- ::std::string* Message_RSRC_ScopFunctionOCLInfo::release_scopoclkernelname() {
-  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
-  clear_has_scopoclkernelname();
-  return scopoclkernelname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+void Message_RSRC_Analysis::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.Message_RSRC_Analysis)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.resultsize_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
- void Message_RSRC_ScopFunctionOCLInfo::set_allocated_scopoclkernelname(::std::string* scopoclkernelname) {
-  if (scopoclkernelname != NULL) {
-    set_has_scopoclkernelname();
-  } else {
-    clear_has_scopoclkernelname();
+
+const char* Message_RSRC_Analysis::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 resultSize = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_resultsize(&has_bits);
+          _impl_.resultsize_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Message_RSRC_Analysis::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.Message_RSRC_Analysis)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 resultSize = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_resultsize(), target);
   }
-  scopoclkernelname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), scopoclkernelname);
-  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
-}
 
-// repeated int32 workgroup_arg_index = 3;
-int Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index_size() const {
-  return workgroup_arg_index_.size();
-}
-void Message_RSRC_ScopFunctionOCLInfo::clear_workgroup_arg_index() {
-  workgroup_arg_index_.Clear();
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.Message_RSRC_Analysis)
+  return target;
 }
- ::google::protobuf::int32 Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index(int index) const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
-  return workgroup_arg_index_.Get(index);
+
+size_t Message_RSRC_Analysis::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.Message_RSRC_Analysis)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint32 resultSize = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_resultsize());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
- void Message_RSRC_ScopFunctionOCLInfo::set_workgroup_arg_index(int index, ::google::protobuf::int32 value) {
-  workgroup_arg_index_.Set(index, value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message_RSRC_Analysis::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message_RSRC_Analysis::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message_RSRC_Analysis::GetClassData() const { return &_class_data_; }
+
+
+void Message_RSRC_Analysis::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message_RSRC_Analysis*>(&to_msg);
+  auto& from = static_cast<const Message_RSRC_Analysis&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.Message_RSRC_Analysis)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_resultsize()) {
+    _this->_internal_set_resultsize(from._internal_resultsize());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
- void Message_RSRC_ScopFunctionOCLInfo::add_workgroup_arg_index(::google::protobuf::int32 value) {
-  workgroup_arg_index_.Add(value);
-  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
+
+void Message_RSRC_Analysis::CopyFrom(const Message_RSRC_Analysis& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.Message_RSRC_Analysis)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
- const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index() const {
-  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
-  return workgroup_arg_index_;
+
+bool Message_RSRC_Analysis::IsInitialized() const {
+  return true;
 }
- ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-Message_RSRC_ScopFunctionOCLInfo::mutable_workgroup_arg_index() {
-  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
-  return &workgroup_arg_index_;
+
+void Message_RSRC_Analysis::InternalSwap(Message_RSRC_Analysis* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.resultsize_, other->_impl_.resultsize_);
 }
 
-// repeated int32 workgroup_arg_index_offset = 4;
-int Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index_offset_size() const {
-  return workgroup_arg_index_offset_.size();
+::PROTOBUF_NAMESPACE_ID::Metadata Message_RSRC_Analysis::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[17]);
 }
-void Message_RSRC_ScopFunctionOCLInfo::clear_workgroup_arg_index_offset() {
-  workgroup_arg_index_offset_.Clear();
+
+// ===================================================================
+
+class ScopAnalysisResult::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ScopAnalysisResult>()._impl_._has_bits_);
+  static const ::HTROP_PB::Message_RSRC& codegen(const ScopAnalysisResult* msg);
+  static void set_has_codegen(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::HTROP_PB::Message_RSRC&
+ScopAnalysisResult::_Internal::codegen(const ScopAnalysisResult* msg) {
+  return *msg->_impl_.codegen_;
+}
+ScopAnalysisResult::ScopAnalysisResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HTROP_PB.ScopAnalysisResult)
+}
+ScopAnalysisResult::ScopAnalysisResult(const ScopAnalysisResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScopAnalysisResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scops_){from._impl_.scops_}
+    , decltype(_impl_.codegen_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_codegen()) {
+    _this->_impl_.codegen_ = new ::HTROP_PB::Message_RSRC(*from._impl_.codegen_);
+  }
+  // @@protoc_insertion_point(copy_constructor:HTROP_PB.ScopAnalysisResult)
+}
+
+inline void ScopAnalysisResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scops_){arena}
+    , decltype(_impl_.codegen_){nullptr}
+  };
 }
- ::google::protobuf::int32 Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index_offset(int index) const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
-  return workgroup_arg_index_offset_.Get(index);
+
+ScopAnalysisResult::~ScopAnalysisResult() {
+  // @@protoc_insertion_point(destructor:HTROP_PB.ScopAnalysisResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
- void Message_RSRC_ScopFunctionOCLInfo::set_workgroup_arg_index_offset(int index, ::google::protobuf::int32 value) {
-  workgroup_arg_index_offset_.Set(index, value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
+
+inline void ScopAnalysisResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.scops_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.codegen_;
 }
- void Message_RSRC_ScopFunctionOCLInfo::add_workgroup_arg_index_offset(::google::protobuf::int32 value) {
-  workgroup_arg_index_offset_.Add(value);
-  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
+
+void ScopAnalysisResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
- const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index_offset() const {
-  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
-  return workgroup_arg_index_offset_;
+
+void ScopAnalysisResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:HTROP_PB.ScopAnalysisResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.scops_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.codegen_ != nullptr);
+    _impl_.codegen_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScopAnalysisResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .HTROP_PB.ScopAnalysisInfo scops = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_scops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .HTROP_PB.Message_RSRC codeGen = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_codegen(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScopAnalysisResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HTROP_PB.ScopAnalysisResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .HTROP_PB.ScopAnalysisInfo scops = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_scops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_scops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .HTROP_PB.Message_RSRC codeGen = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::codegen(this),
+        _Internal::codegen(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HTROP_PB.ScopAnalysisResult)
+  return target;
 }
- ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-Message_RSRC_ScopFunctionOCLInfo::mutable_workgroup_arg_index_offset() {
-  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
-  return &workgroup_arg_index_offset_;
+
+size_t ScopAnalysisResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HTROP_PB.ScopAnalysisResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .HTROP_PB.ScopAnalysisInfo scops = 1;
+  total_size += 1UL * this->_internal_scops_size();
+  for (const auto& msg : this->_impl_.scops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional .HTROP_PB.Message_RSRC codeGen = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.codegen_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-// -------------------------------------------------------------------
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScopAnalysisResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScopAnalysisResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScopAnalysisResult::GetClassData() const { return &_class_data_; }
+
 
-// Message_RSRC
+void ScopAnalysisResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScopAnalysisResult*>(&to_msg);
+  auto& from = static_cast<const ScopAnalysisResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:HTROP_PB.ScopAnalysisResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-// repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo scopFunctions = 1;
-int Message_RSRC::scopfunctions_size() const {
-  return scopfunctions_.size();
+  _this->_impl_.scops_.MergeFrom(from._impl_.scops_);
+  if (from._internal_has_codegen()) {
+    _this->_internal_mutable_codegen()->::HTROP_PB::Message_RSRC::MergeFrom(
+        from._internal_codegen());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-void Message_RSRC::clear_scopfunctions() {
-  scopfunctions_.Clear();
+
+void ScopAnalysisResult::CopyFrom(const ScopAnalysisResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HTROP_PB.ScopAnalysisResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& Message_RSRC::scopfunctions(int index) const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.scopFunctions)
-  return scopfunctions_.Get(index);
+
+bool ScopAnalysisResult::IsInitialized() const {
+  return true;
 }
-::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC::mutable_scopfunctions(int index) {
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.scopFunctions)
-  return scopfunctions_.Mutable(index);
+
+void ScopAnalysisResult::InternalSwap(ScopAnalysisResult* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.scops_.InternalSwap(&other->_impl_.scops_);
+  swap(_impl_.codegen_, other->_impl_.codegen_);
 }
-::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC::add_scopfunctions() {
-  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.scopFunctions)
-  return scopfunctions_.Add();
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScopAnalysisResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_hds_2eproto_getter, &descriptor_table_hds_2eproto_once,
+      file_level_metadata_hds_2eproto[18]);
 }
-::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >*
-Message_RSRC::mutable_scopfunctions() {
-  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.scopFunctions)
-  return &scopfunctions_;
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace HTROP_PB
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::HTROP_PB::LLVM_IR_Req*
+Arena::CreateMaybeMessage< ::HTROP_PB::LLVM_IR_Req >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::LLVM_IR_Req >(arena);
 }
-const ::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >&
-Message_RSRC::scopfunctions() const {
-  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.scopFunctions)
-  return scopfunctions_;
+template<> PROTOBUF_NOINLINE ::HTROP_PB::BinaryData*
+Arena::CreateMaybeMessage< ::HTROP_PB::BinaryData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::BinaryData >(arena);
 }
-
-// optional string oclKernelFileName = 2;
-bool Message_RSRC::has_oclkernelfilename() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+template<> PROTOBUF_NOINLINE ::HTROP_PB::ReductionHint*
+Arena::CreateMaybeMessage< ::HTROP_PB::ReductionHint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::ReductionHint >(arena);
 }
-void Message_RSRC::set_has_oclkernelfilename() {
-  _has_bits_[0] |= 0x00000002u;
+template<> PROTOBUF_NOINLINE ::HTROP_PB::ScatterHint*
+Arena::CreateMaybeMessage< ::HTROP_PB::ScatterHint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::ScatterHint >(arena);
 }
-void Message_RSRC::clear_has_oclkernelfilename() {
-  _has_bits_[0] &= ~0x00000002u;
+template<> PROTOBUF_NOINLINE ::HTROP_PB::ReadOnlyArgHint*
+Arena::CreateMaybeMessage< ::HTROP_PB::ReadOnlyArgHint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::ReadOnlyArgHint >(arena);
 }
-void Message_RSRC::clear_oclkernelfilename() {
-  oclkernelfilename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_oclkernelfilename();
+template<> PROTOBUF_NOINLINE ::HTROP_PB::Message_RCRS_ScopInfo*
+Arena::CreateMaybeMessage< ::HTROP_PB::Message_RCRS_ScopInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::Message_RCRS_ScopInfo >(arena);
 }
- const ::std::string& Message_RSRC::oclkernelfilename() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.oclKernelFileName)
-  return oclkernelfilename_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+template<> PROTOBUF_NOINLINE ::HTROP_PB::Message_RCRS*
+Arena::CreateMaybeMessage< ::HTROP_PB::Message_RCRS >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::Message_RCRS >(arena);
 }
- void Message_RSRC::set_oclkernelfilename(const ::std::string& value) {
-  set_has_oclkernelfilename();
-  oclkernelfilename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.oclKernelFileName)
+template<> PROTOBUF_NOINLINE ::HTROP_PB::Message_RSRC_WorkItemFactor*
+Arena::CreateMaybeMessage< ::HTROP_PB::Message_RSRC_WorkItemFactor >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::Message_RSRC_WorkItemFactor >(arena);
 }
- void Message_RSRC::set_oclkernelfilename(const char* value) {
-  set_has_oclkernelfilename();
-  oclkernelfilename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HTROP_PB.Message_RSRC.oclKernelFileName)
+template<> PROTOBUF_NOINLINE ::HTROP_PB::Message_RSRC_Reduction*
+Arena::CreateMaybeMessage< ::HTROP_PB::Message_RSRC_Reduction >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::Message_RSRC_Reduction >(arena);
 }
- void Message_RSRC::set_oclkernelfilename(const char* value, size_t size) {
-  set_has_oclkernelfilename();
-  oclkernelfilename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.Message_RSRC.oclKernelFileName)
+template<> PROTOBUF_NOINLINE ::HTROP_PB::Message_RSRC_ImageArg*
+Arena::CreateMaybeMessage< ::HTROP_PB::Message_RSRC_ImageArg >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::Message_RSRC_ImageArg >(arena);
 }
- ::std::string* Message_RSRC::mutable_oclkernelfilename() {
-  set_has_oclkernelfilename();
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.oclKernelFileName)
-  return oclkernelfilename_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+template<> PROTOBUF_NOINLINE ::HTROP_PB::Message_RSRC_PitchedArg*
+Arena::CreateMaybeMessage< ::HTROP_PB::Message_RSRC_PitchedArg >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::Message_RSRC_PitchedArg >(arena);
 }
- ::std::string* Message_RSRC::release_oclkernelfilename() {
-  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RSRC.oclKernelFileName)
-  clear_has_oclkernelfilename();
-  return oclkernelfilename_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+template<> PROTOBUF_NOINLINE ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo*
+Arena::CreateMaybeMessage< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >(arena);
 }
- void Message_RSRC::set_allocated_oclkernelfilename(::std::string* oclkernelfilename) {
-  if (oclkernelfilename != NULL) {
-    set_has_oclkernelfilename();
-  } else {
-    clear_has_oclkernelfilename();
-  }
-  oclkernelfilename_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), oclkernelfilename);
-  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RSRC.oclKernelFileName)
+template<> PROTOBUF_NOINLINE ::HTROP_PB::Message_RSRC*
+Arena::CreateMaybeMessage< ::HTROP_PB::Message_RSRC >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::Message_RSRC >(arena);
 }
-
-// optional uint32 binarySize = 3;
-bool Message_RSRC::has_binarysize() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+template<> PROTOBUF_NOINLINE ::HTROP_PB::ScopArgInfo*
+Arena::CreateMaybeMessage< ::HTROP_PB::ScopArgInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::ScopArgInfo >(arena);
 }
-void Message_RSRC::set_has_binarysize() {
-  _has_bits_[0] |= 0x00000004u;
+template<> PROTOBUF_NOINLINE ::HTROP_PB::ScopLoopBound*
+Arena::CreateMaybeMessage< ::HTROP_PB::ScopLoopBound >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::ScopLoopBound >(arena);
 }
-void Message_RSRC::clear_has_binarysize() {
-  _has_bits_[0] &= ~0x00000004u;
+template<> PROTOBUF_NOINLINE ::HTROP_PB::ScopAnalysisInfo*
+Arena::CreateMaybeMessage< ::HTROP_PB::ScopAnalysisInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::ScopAnalysisInfo >(arena);
 }
-void Message_RSRC::clear_binarysize() {
-  binarysize_ = 0u;
-  clear_has_binarysize();
+template<> PROTOBUF_NOINLINE ::HTROP_PB::Message_RCRS_Analysis*
+Arena::CreateMaybeMessage< ::HTROP_PB::Message_RCRS_Analysis >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::Message_RCRS_Analysis >(arena);
 }
- ::google::protobuf::uint32 Message_RSRC::binarysize() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.binarySize)
-  return binarysize_;
+template<> PROTOBUF_NOINLINE ::HTROP_PB::Message_RSRC_Analysis*
+Arena::CreateMaybeMessage< ::HTROP_PB::Message_RSRC_Analysis >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::Message_RSRC_Analysis >(arena);
 }
- void Message_RSRC::set_binarysize(::google::protobuf::uint32 value) {
-  set_has_binarysize();
-  binarysize_ = value;
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.binarySize)
+template<> PROTOBUF_NOINLINE ::HTROP_PB::ScopAnalysisResult*
+Arena::CreateMaybeMessage< ::HTROP_PB::ScopAnalysisResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HTROP_PB::ScopAnalysisResult >(arena);
 }
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace HTROP_PB
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,113 +1,241 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: hds.proto
 
-#ifndef PROTOBUF_hds_2eproto__INCLUDED
-#define PROTOBUF_hds_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_hds_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_hds_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2007000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2007000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_hds_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_hds_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_hds_2eproto;
 namespace HTROP_PB {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_hds_2eproto();
-void protobuf_AssignDesc_hds_2eproto();
-void protobuf_ShutdownFile_hds_2eproto();
-
 class BinaryData;
+struct BinaryDataDefaultTypeInternal;
+extern BinaryDataDefaultTypeInternal _BinaryData_default_instance_;
 class LLVM_IR_Req;
+struct LLVM_IR_ReqDefaultTypeInternal;
+extern LLVM_IR_ReqDefaultTypeInternal _LLVM_IR_Req_default_instance_;
 class Message_RCRS;
+struct Message_RCRSDefaultTypeInternal;
+extern Message_RCRSDefaultTypeInternal _Message_RCRS_default_instance_;
+class Message_RCRS_Analysis;
+struct Message_RCRS_AnalysisDefaultTypeInternal;
+extern Message_RCRS_AnalysisDefaultTypeInternal _Message_RCRS_Analysis_default_instance_;
 class Message_RCRS_ScopInfo;
+struct Message_RCRS_ScopInfoDefaultTypeInternal;
+extern Message_RCRS_ScopInfoDefaultTypeInternal _Message_RCRS_ScopInfo_default_instance_;
 class Message_RSRC;
+struct Message_RSRCDefaultTypeInternal;
+extern Message_RSRCDefaultTypeInternal _Message_RSRC_default_instance_;
+class Message_RSRC_Analysis;
+struct Message_RSRC_AnalysisDefaultTypeInternal;
+extern Message_RSRC_AnalysisDefaultTypeInternal _Message_RSRC_Analysis_default_instance_;
+class Message_RSRC_ImageArg;
+struct Message_RSRC_ImageArgDefaultTypeInternal;
+extern Message_RSRC_ImageArgDefaultTypeInternal _Message_RSRC_ImageArg_default_instance_;
+class Message_RSRC_PitchedArg;
+struct Message_RSRC_PitchedArgDefaultTypeInternal;
+extern Message_RSRC_PitchedArgDefaultTypeInternal _Message_RSRC_PitchedArg_default_instance_;
+class Message_RSRC_Reduction;
+struct Message_RSRC_ReductionDefaultTypeInternal;
+extern Message_RSRC_ReductionDefaultTypeInternal _Message_RSRC_Reduction_default_instance_;
 class Message_RSRC_ScopFunctionOCLInfo;
+struct Message_RSRC_ScopFunctionOCLInfoDefaultTypeInternal;
+extern Message_RSRC_ScopFunctionOCLInfoDefaultTypeInternal _Message_RSRC_ScopFunctionOCLInfo_default_instance_;
+class Message_RSRC_WorkItemFactor;
+struct Message_RSRC_WorkItemFactorDefaultTypeInternal;
+extern Message_RSRC_WorkItemFactorDefaultTypeInternal _Message_RSRC_WorkItemFactor_default_instance_;
+class ReadOnlyArgHint;
+struct ReadOnlyArgHintDefaultTypeInternal;
+extern ReadOnlyArgHintDefaultTypeInternal _ReadOnlyArgHint_default_instance_;
+class ReductionHint;
+struct ReductionHintDefaultTypeInternal;
+extern ReductionHintDefaultTypeInternal _ReductionHint_default_instance_;
+class ScatterHint;
+struct ScatterHintDefaultTypeInternal;
+extern ScatterHintDefaultTypeInternal _ScatterHint_default_instance_;
+class ScopAnalysisInfo;
+struct ScopAnalysisInfoDefaultTypeInternal;
+extern ScopAnalysisInfoDefaultTypeInternal _ScopAnalysisInfo_default_instance_;
+class ScopAnalysisResult;
+struct ScopAnalysisResultDefaultTypeInternal;
+extern ScopAnalysisResultDefaultTypeInternal _ScopAnalysisResult_default_instance_;
+class ScopArgInfo;
+struct ScopArgInfoDefaultTypeInternal;
+extern ScopArgInfoDefaultTypeInternal _ScopArgInfo_default_instance_;
+class ScopLoopBound;
+struct ScopLoopBoundDefaultTypeInternal;
+extern ScopLoopBoundDefaultTypeInternal _ScopLoopBound_default_instance_;
+}  // namespace HTROP_PB
+PROTOBUF_NAMESPACE_OPEN
+template<> ::HTROP_PB::BinaryData* Arena::CreateMaybeMessage<::HTROP_PB::BinaryData>(Arena*);
+template<> ::HTROP_PB::LLVM_IR_Req* Arena::CreateMaybeMessage<::HTROP_PB::LLVM_IR_Req>(Arena*);
+template<> ::HTROP_PB::Message_RCRS* Arena::CreateMaybeMessage<::HTROP_PB::Message_RCRS>(Arena*);
+template<> ::HTROP_PB::Message_RCRS_Analysis* Arena::CreateMaybeMessage<::HTROP_PB::Message_RCRS_Analysis>(Arena*);
+template<> ::HTROP_PB::Message_RCRS_ScopInfo* Arena::CreateMaybeMessage<::HTROP_PB::Message_RCRS_ScopInfo>(Arena*);
+template<> ::HTROP_PB::Message_RSRC* Arena::CreateMaybeMessage<::HTROP_PB::Message_RSRC>(Arena*);
+template<> ::HTROP_PB::Message_RSRC_Analysis* Arena::CreateMaybeMessage<::HTROP_PB::Message_RSRC_Analysis>(Arena*);
+template<> ::HTROP_PB::Message_RSRC_ImageArg* Arena::CreateMaybeMessage<::HTROP_PB::Message_RSRC_ImageArg>(Arena*);
+template<> ::HTROP_PB::Message_RSRC_PitchedArg* Arena::CreateMaybeMessage<::HTROP_PB::Message_RSRC_PitchedArg>(Arena*);
+template<> ::HTROP_PB::Message_RSRC_Reduction* Arena::CreateMaybeMessage<::HTROP_PB::Message_RSRC_Reduction>(Arena*);
+template<> ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Arena::CreateMaybeMessage<::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo>(Arena*);
+template<> ::HTROP_PB::Message_RSRC_WorkItemFactor* Arena::CreateMaybeMessage<::HTROP_PB::Message_RSRC_WorkItemFactor>(Arena*);
+template<> ::HTROP_PB::ReadOnlyArgHint* Arena::CreateMaybeMessage<::HTROP_PB::ReadOnlyArgHint>(Arena*);
+template<> ::HTROP_PB::ReductionHint* Arena::CreateMaybeMessage<::HTROP_PB::ReductionHint>(Arena*);
+template<> ::HTROP_PB::ScatterHint* Arena::CreateMaybeMessage<::HTROP_PB::ScatterHint>(Arena*);
+template<> ::HTROP_PB::ScopAnalysisInfo* Arena::CreateMaybeMessage<::HTROP_PB::ScopAnalysisInfo>(Arena*);
+template<> ::HTROP_PB::ScopAnalysisResult* Arena::CreateMaybeMessage<::HTROP_PB::ScopAnalysisResult>(Arena*);
+template<> ::HTROP_PB::ScopArgInfo* Arena::CreateMaybeMessage<::HTROP_PB::ScopArgInfo>(Arena*);
+template<> ::HTROP_PB::ScopLoopBound* Arena::CreateMaybeMessage<::HTROP_PB::ScopLoopBound>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace HTROP_PB {
 
 // ===================================================================
 
-class LLVM_IR_Req : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.LLVM_IR_Req) */ {
+class LLVM_IR_Req final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:HTROP_PB.LLVM_IR_Req) */ {
  public:
-  LLVM_IR_Req();
-  virtual ~LLVM_IR_Req();
+  inline LLVM_IR_Req() : LLVM_IR_Req(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR LLVM_IR_Req(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LLVM_IR_Req(const LLVM_IR_Req& from);
+  LLVM_IR_Req(LLVM_IR_Req&& from) noexcept
+    : LLVM_IR_Req() {
+    *this = ::std::move(from);
+  }
 
   inline LLVM_IR_Req& operator=(const LLVM_IR_Req& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline LLVM_IR_Req& operator=(LLVM_IR_Req&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LLVM_IR_Req& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LLVM_IR_Req& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LLVM_IR_Req* internal_default_instance() {
+    return reinterpret_cast<const LLVM_IR_Req*>(
+               &_LLVM_IR_Req_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(LLVM_IR_Req* other);
+  friend void swap(LLVM_IR_Req& a, LLVM_IR_Req& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LLVM_IR_Req* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LLVM_IR_Req* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LLVM_IR_Req* New() const { return New(NULL); }
-
-  LLVM_IR_Req* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const LLVM_IR_Req& from);
-  void MergeFrom(const LLVM_IR_Req& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(LLVM_IR_Req* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
+  LLVM_IR_Req* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LLVM_IR_Req>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const LLVM_IR_Req& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
   }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const LLVM_IR_Req& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.LLVM_IR_Req";
   }
+  protected:
+  explicit LLVM_IR_Req(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -115,1119 +243,8454 @@ class LLVM_IR_Req : public ::google::protobuf::Message /* @@protoc_insertion_poi
 
   // @@protoc_insertion_point(class_scope:HTROP_PB.LLVM_IR_Req)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_hds_2eproto();
-  friend void protobuf_AssignDesc_hds_2eproto();
-  friend void protobuf_ShutdownFile_hds_2eproto();
-
-  void InitAsDefaultInstance();
-  static LLVM_IR_Req* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_hds_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BinaryData : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.BinaryData) */ {
+class BinaryData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.BinaryData) */ {
  public:
-  BinaryData();
-  virtual ~BinaryData();
+  inline BinaryData() : BinaryData(nullptr) {}
+  ~BinaryData() override;
+  explicit PROTOBUF_CONSTEXPR BinaryData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BinaryData(const BinaryData& from);
+  BinaryData(BinaryData&& from) noexcept
+    : BinaryData() {
+    *this = ::std::move(from);
+  }
 
   inline BinaryData& operator=(const BinaryData& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline BinaryData& operator=(BinaryData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const BinaryData& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BinaryData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BinaryData* internal_default_instance() {
+    return reinterpret_cast<const BinaryData*>(
+               &_BinaryData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(BinaryData* other);
+  friend void swap(BinaryData& a, BinaryData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BinaryData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BinaryData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline BinaryData* New() const { return New(NULL); }
-
-  BinaryData* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  BinaryData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BinaryData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BinaryData& from);
-  void MergeFrom(const BinaryData& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BinaryData& from) {
+    BinaryData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(BinaryData* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.BinaryData";
   }
+  protected:
+  explicit BinaryData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kBinaryDataFieldNumber = 1,
+  };
   // optional bytes binary_data = 1;
   bool has_binary_data() const;
+  private:
+  bool _internal_has_binary_data() const;
+  public:
   void clear_binary_data();
-  static const int kBinaryDataFieldNumber = 1;
-  const ::std::string& binary_data() const;
-  void set_binary_data(const ::std::string& value);
-  void set_binary_data(const char* value);
-  void set_binary_data(const void* value, size_t size);
-  ::std::string* mutable_binary_data();
-  ::std::string* release_binary_data();
-  void set_allocated_binary_data(::std::string* binary_data);
+  const std::string& binary_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_binary_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_binary_data();
+  PROTOBUF_NODISCARD std::string* release_binary_data();
+  void set_allocated_binary_data(std::string* binary_data);
+  private:
+  const std::string& _internal_binary_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_binary_data(const std::string& value);
+  std::string* _internal_mutable_binary_data();
+  public:
 
   // @@protoc_insertion_point(class_scope:HTROP_PB.BinaryData)
  private:
-  inline void set_has_binary_data();
-  inline void clear_has_binary_data();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::internal::ArenaStringPtr binary_data_;
-  friend void  protobuf_AddDesc_hds_2eproto();
-  friend void protobuf_AssignDesc_hds_2eproto();
-  friend void protobuf_ShutdownFile_hds_2eproto();
-
-  void InitAsDefaultInstance();
-  static BinaryData* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr binary_data_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Message_RCRS_ScopInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RCRS.ScopInfo) */ {
+class ReductionHint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.ReductionHint) */ {
  public:
-  Message_RCRS_ScopInfo();
-  virtual ~Message_RCRS_ScopInfo();
-
-  Message_RCRS_ScopInfo(const Message_RCRS_ScopInfo& from);
+  inline ReductionHint() : ReductionHint(nullptr) {}
+  ~ReductionHint() override;
+  explicit PROTOBUF_CONSTEXPR ReductionHint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReductionHint(const ReductionHint& from);
+  ReductionHint(ReductionHint&& from) noexcept
+    : ReductionHint() {
+    *this = ::std::move(from);
+  }
 
-  inline Message_RCRS_ScopInfo& operator=(const Message_RCRS_ScopInfo& from) {
+  inline ReductionHint& operator=(const ReductionHint& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline ReductionHint& operator=(ReductionHint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Message_RCRS_ScopInfo& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReductionHint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReductionHint* internal_default_instance() {
+    return reinterpret_cast<const ReductionHint*>(
+               &_ReductionHint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(Message_RCRS_ScopInfo* other);
+  friend void swap(ReductionHint& a, ReductionHint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReductionHint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReductionHint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Message_RCRS_ScopInfo* New() const { return New(NULL); }
+  ReductionHint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReductionHint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReductionHint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReductionHint& from) {
+    ReductionHint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  Message_RCRS_ScopInfo* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Message_RCRS_ScopInfo& from);
-  void MergeFrom(const Message_RCRS_ScopInfo& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(Message_RCRS_ScopInfo* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReductionHint* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.ReductionHint";
   }
+  protected:
+  explicit ReductionHint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string scopFunctionName = 1;
-  bool has_scopfunctionname() const;
-  void clear_scopfunctionname();
-  static const int kScopFunctionNameFieldNumber = 1;
-  const ::std::string& scopfunctionname() const;
-  void set_scopfunctionname(const ::std::string& value);
-  void set_scopfunctionname(const char* value);
-  void set_scopfunctionname(const char* value, size_t size);
-  ::std::string* mutable_scopfunctionname();
-  ::std::string* release_scopfunctionname();
-  void set_allocated_scopfunctionname(::std::string* scopfunctionname);
+  enum : int {
+    kArgPositionFieldNumber = 1,
+    kLoopDepthFieldNumber = 2,
+    kReductionOperatorFieldNumber = 3,
+  };
+  // optional uint32 arg_position = 1;
+  bool has_arg_position() const;
+  private:
+  bool _internal_has_arg_position() const;
+  public:
+  void clear_arg_position();
+  uint32_t arg_position() const;
+  void set_arg_position(uint32_t value);
+  private:
+  uint32_t _internal_arg_position() const;
+  void _internal_set_arg_position(uint32_t value);
+  public:
 
-  // optional uint32 max_codegen_loop_depth = 2;
-  bool has_max_codegen_loop_depth() const;
-  void clear_max_codegen_loop_depth();
-  static const int kMaxCodegenLoopDepthFieldNumber = 2;
-  ::google::protobuf::uint32 max_codegen_loop_depth() const;
-  void set_max_codegen_loop_depth(::google::protobuf::uint32 value);
+  // optional uint32 loop_depth = 2;
+  bool has_loop_depth() const;
+  private:
+  bool _internal_has_loop_depth() const;
+  public:
+  void clear_loop_depth();
+  uint32_t loop_depth() const;
+  void set_loop_depth(uint32_t value);
+  private:
+  uint32_t _internal_loop_depth() const;
+  void _internal_set_loop_depth(uint32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RCRS.ScopInfo)
+  // optional int32 reduction_operator = 3;
+  bool has_reduction_operator() const;
+  private:
+  bool _internal_has_reduction_operator() const;
+  public:
+  void clear_reduction_operator();
+  int32_t reduction_operator() const;
+  void set_reduction_operator(int32_t value);
+  private:
+  int32_t _internal_reduction_operator() const;
+  void _internal_set_reduction_operator(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.ReductionHint)
  private:
-  inline void set_has_scopfunctionname();
-  inline void clear_has_scopfunctionname();
-  inline void set_has_max_codegen_loop_depth();
-  inline void clear_has_max_codegen_loop_depth();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::internal::ArenaStringPtr scopfunctionname_;
-  ::google::protobuf::uint32 max_codegen_loop_depth_;
-  friend void  protobuf_AddDesc_hds_2eproto();
-  friend void protobuf_AssignDesc_hds_2eproto();
-  friend void protobuf_ShutdownFile_hds_2eproto();
-
-  void InitAsDefaultInstance();
-  static Message_RCRS_ScopInfo* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t arg_position_;
+    uint32_t loop_depth_;
+    int32_t reduction_operator_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Message_RCRS : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RCRS) */ {
+class ScatterHint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.ScatterHint) */ {
  public:
-  Message_RCRS();
-  virtual ~Message_RCRS();
-
-  Message_RCRS(const Message_RCRS& from);
+  inline ScatterHint() : ScatterHint(nullptr) {}
+  ~ScatterHint() override;
+  explicit PROTOBUF_CONSTEXPR ScatterHint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScatterHint(const ScatterHint& from);
+  ScatterHint(ScatterHint&& from) noexcept
+    : ScatterHint() {
+    *this = ::std::move(from);
+  }
 
-  inline Message_RCRS& operator=(const Message_RCRS& from) {
+  inline ScatterHint& operator=(const ScatterHint& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline ScatterHint& operator=(ScatterHint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Message_RCRS& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScatterHint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScatterHint* internal_default_instance() {
+    return reinterpret_cast<const ScatterHint*>(
+               &_ScatterHint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(Message_RCRS* other);
+  friend void swap(ScatterHint& a, ScatterHint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScatterHint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScatterHint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Message_RCRS* New() const { return New(NULL); }
+  ScatterHint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScatterHint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScatterHint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScatterHint& from) {
+    ScatterHint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  Message_RCRS* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Message_RCRS& from);
-  void MergeFrom(const Message_RCRS& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(Message_RCRS* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScatterHint* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.ScatterHint";
   }
+  protected:
+  explicit ScatterHint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // nested types ----------------------------------------------------
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  typedef Message_RCRS_ScopInfo ScopInfo;
+  // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // repeated .HTROP_PB.Message_RCRS.ScopInfo scopList = 1;
-  int scoplist_size() const;
-  void clear_scoplist();
-  static const int kScopListFieldNumber = 1;
-  const ::HTROP_PB::Message_RCRS_ScopInfo& scoplist(int index) const;
-  ::HTROP_PB::Message_RCRS_ScopInfo* mutable_scoplist(int index);
-  ::HTROP_PB::Message_RCRS_ScopInfo* add_scoplist();
-  ::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RCRS_ScopInfo >*
-      mutable_scoplist();
-  const ::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RCRS_ScopInfo >&
-      scoplist() const;
+  enum : int {
+    kArgPositionFieldNumber = 1,
+    kScatterOperatorFieldNumber = 2,
+    kNumElementsFieldNumber = 3,
+  };
+  // optional uint32 arg_position = 1;
+  bool has_arg_position() const;
+  private:
+  bool _internal_has_arg_position() const;
+  public:
+  void clear_arg_position();
+  uint32_t arg_position() const;
+  void set_arg_position(uint32_t value);
+  private:
+  uint32_t _internal_arg_position() const;
+  void _internal_set_arg_position(uint32_t value);
+  public:
 
-  // optional string scopFunctionParentName = 2;
-  bool has_scopfunctionparentname() const;
-  void clear_scopfunctionparentname();
-  static const int kScopFunctionParentNameFieldNumber = 2;
-  const ::std::string& scopfunctionparentname() const;
-  void set_scopfunctionparentname(const ::std::string& value);
-  void set_scopfunctionparentname(const char* value);
-  void set_scopfunctionparentname(const char* value, size_t size);
-  ::std::string* mutable_scopfunctionparentname();
-  ::std::string* release_scopfunctionparentname();
-  void set_allocated_scopfunctionparentname(::std::string* scopfunctionparentname);
+  // optional int32 scatter_operator = 2;
+  bool has_scatter_operator() const;
+  private:
+  bool _internal_has_scatter_operator() const;
+  public:
+  void clear_scatter_operator();
+  int32_t scatter_operator() const;
+  void set_scatter_operator(int32_t value);
+  private:
+  int32_t _internal_scatter_operator() const;
+  void _internal_set_scatter_operator(int32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RCRS)
+  // optional uint64 num_elements = 3;
+  bool has_num_elements() const;
+  private:
+  bool _internal_has_num_elements() const;
+  public:
+  void clear_num_elements();
+  uint64_t num_elements() const;
+  void set_num_elements(uint64_t value);
+  private:
+  uint64_t _internal_num_elements() const;
+  void _internal_set_num_elements(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.ScatterHint)
  private:
-  inline void set_has_scopfunctionparentname();
-  inline void clear_has_scopfunctionparentname();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RCRS_ScopInfo > scoplist_;
-  ::google::protobuf::internal::ArenaStringPtr scopfunctionparentname_;
-  friend void  protobuf_AddDesc_hds_2eproto();
-  friend void protobuf_AssignDesc_hds_2eproto();
-  friend void protobuf_ShutdownFile_hds_2eproto();
-
-  void InitAsDefaultInstance();
-  static Message_RCRS* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t arg_position_;
+    int32_t scatter_operator_;
+    uint64_t num_elements_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Message_RSRC_ScopFunctionOCLInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo) */ {
+class ReadOnlyArgHint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.ReadOnlyArgHint) */ {
  public:
-  Message_RSRC_ScopFunctionOCLInfo();
-  virtual ~Message_RSRC_ScopFunctionOCLInfo();
-
-  Message_RSRC_ScopFunctionOCLInfo(const Message_RSRC_ScopFunctionOCLInfo& from);
+  inline ReadOnlyArgHint() : ReadOnlyArgHint(nullptr) {}
+  ~ReadOnlyArgHint() override;
+  explicit PROTOBUF_CONSTEXPR ReadOnlyArgHint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadOnlyArgHint(const ReadOnlyArgHint& from);
+  ReadOnlyArgHint(ReadOnlyArgHint&& from) noexcept
+    : ReadOnlyArgHint() {
+    *this = ::std::move(from);
+  }
 
-  inline Message_RSRC_ScopFunctionOCLInfo& operator=(const Message_RSRC_ScopFunctionOCLInfo& from) {
+  inline ReadOnlyArgHint& operator=(const ReadOnlyArgHint& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline ReadOnlyArgHint& operator=(ReadOnlyArgHint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Message_RSRC_ScopFunctionOCLInfo& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadOnlyArgHint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadOnlyArgHint* internal_default_instance() {
+    return reinterpret_cast<const ReadOnlyArgHint*>(
+               &_ReadOnlyArgHint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(Message_RSRC_ScopFunctionOCLInfo* other);
+  friend void swap(ReadOnlyArgHint& a, ReadOnlyArgHint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadOnlyArgHint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadOnlyArgHint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Message_RSRC_ScopFunctionOCLInfo* New() const { return New(NULL); }
+  ReadOnlyArgHint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadOnlyArgHint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadOnlyArgHint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadOnlyArgHint& from) {
+    ReadOnlyArgHint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  Message_RSRC_ScopFunctionOCLInfo* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Message_RSRC_ScopFunctionOCLInfo& from);
-  void MergeFrom(const Message_RSRC_ScopFunctionOCLInfo& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(Message_RSRC_ScopFunctionOCLInfo* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadOnlyArgHint* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.ReadOnlyArgHint";
   }
+  protected:
+  explicit ReadOnlyArgHint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string scopFunctionName = 1;
-  bool has_scopfunctionname() const;
-  void clear_scopfunctionname();
-  static const int kScopFunctionNameFieldNumber = 1;
-  const ::std::string& scopfunctionname() const;
-  void set_scopfunctionname(const ::std::string& value);
-  void set_scopfunctionname(const char* value);
-  void set_scopfunctionname(const char* value, size_t size);
-  ::std::string* mutable_scopfunctionname();
-  ::std::string* release_scopfunctionname();
-  void set_allocated_scopfunctionname(::std::string* scopfunctionname);
-
-  // optional string scopOCLKernelName = 2;
-  bool has_scopoclkernelname() const;
-  void clear_scopoclkernelname();
-  static const int kScopOCLKernelNameFieldNumber = 2;
-  const ::std::string& scopoclkernelname() const;
-  void set_scopoclkernelname(const ::std::string& value);
-  void set_scopoclkernelname(const char* value);
-  void set_scopoclkernelname(const char* value, size_t size);
-  ::std::string* mutable_scopoclkernelname();
-  ::std::string* release_scopoclkernelname();
-  void set_allocated_scopoclkernelname(::std::string* scopoclkernelname);
-
-  // repeated int32 workgroup_arg_index = 3;
-  int workgroup_arg_index_size() const;
-  void clear_workgroup_arg_index();
-  static const int kWorkgroupArgIndexFieldNumber = 3;
-  ::google::protobuf::int32 workgroup_arg_index(int index) const;
-  void set_workgroup_arg_index(int index, ::google::protobuf::int32 value);
-  void add_workgroup_arg_index(::google::protobuf::int32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-      workgroup_arg_index() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-      mutable_workgroup_arg_index();
+  enum : int {
+    kNumElementsFieldNumber = 2,
+    kArgPositionFieldNumber = 1,
+  };
+  // optional uint64 num_elements = 2;
+  bool has_num_elements() const;
+  private:
+  bool _internal_has_num_elements() const;
+  public:
+  void clear_num_elements();
+  uint64_t num_elements() const;
+  void set_num_elements(uint64_t value);
+  private:
+  uint64_t _internal_num_elements() const;
+  void _internal_set_num_elements(uint64_t value);
+  public:
 
-  // repeated int32 workgroup_arg_index_offset = 4;
-  int workgroup_arg_index_offset_size() const;
-  void clear_workgroup_arg_index_offset();
-  static const int kWorkgroupArgIndexOffsetFieldNumber = 4;
-  ::google::protobuf::int32 workgroup_arg_index_offset(int index) const;
-  void set_workgroup_arg_index_offset(int index, ::google::protobuf::int32 value);
-  void add_workgroup_arg_index_offset(::google::protobuf::int32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-      workgroup_arg_index_offset() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-      mutable_workgroup_arg_index_offset();
+  // optional uint32 arg_position = 1;
+  bool has_arg_position() const;
+  private:
+  bool _internal_has_arg_position() const;
+  public:
+  void clear_arg_position();
+  uint32_t arg_position() const;
+  void set_arg_position(uint32_t value);
+  private:
+  uint32_t _internal_arg_position() const;
+  void _internal_set_arg_position(uint32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+  // @@protoc_insertion_point(class_scope:HTROP_PB.ReadOnlyArgHint)
  private:
-  inline void set_has_scopfunctionname();
-  inline void clear_has_scopfunctionname();
-  inline void set_has_scopoclkernelname();
-  inline void clear_has_scopoclkernelname();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::internal::ArenaStringPtr scopfunctionname_;
-  ::google::protobuf::internal::ArenaStringPtr scopoclkernelname_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > workgroup_arg_index_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > workgroup_arg_index_offset_;
-  friend void  protobuf_AddDesc_hds_2eproto();
-  friend void protobuf_AssignDesc_hds_2eproto();
-  friend void protobuf_ShutdownFile_hds_2eproto();
-
-  void InitAsDefaultInstance();
-  static Message_RSRC_ScopFunctionOCLInfo* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t num_elements_;
+    uint32_t arg_position_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Message_RSRC : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RSRC) */ {
+class Message_RCRS_ScopInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RCRS.ScopInfo) */ {
  public:
-  Message_RSRC();
-  virtual ~Message_RSRC();
+  inline Message_RCRS_ScopInfo() : Message_RCRS_ScopInfo(nullptr) {}
+  ~Message_RCRS_ScopInfo() override;
+  explicit PROTOBUF_CONSTEXPR Message_RCRS_ScopInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Message_RSRC(const Message_RSRC& from);
+  Message_RCRS_ScopInfo(const Message_RCRS_ScopInfo& from);
+  Message_RCRS_ScopInfo(Message_RCRS_ScopInfo&& from) noexcept
+    : Message_RCRS_ScopInfo() {
+    *this = ::std::move(from);
+  }
 
-  inline Message_RSRC& operator=(const Message_RSRC& from) {
+  inline Message_RCRS_ScopInfo& operator=(const Message_RCRS_ScopInfo& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline Message_RCRS_ScopInfo& operator=(Message_RCRS_ScopInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Message_RSRC& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message_RCRS_ScopInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message_RCRS_ScopInfo* internal_default_instance() {
+    return reinterpret_cast<const Message_RCRS_ScopInfo*>(
+               &_Message_RCRS_ScopInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(Message_RSRC* other);
+  friend void swap(Message_RCRS_ScopInfo& a, Message_RCRS_ScopInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message_RCRS_ScopInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message_RCRS_ScopInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Message_RSRC* New() const { return New(NULL); }
+  Message_RCRS_ScopInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message_RCRS_ScopInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message_RCRS_ScopInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message_RCRS_ScopInfo& from) {
+    Message_RCRS_ScopInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  Message_RSRC* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Message_RSRC& from);
-  void MergeFrom(const Message_RSRC& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(Message_RSRC* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message_RCRS_ScopInfo* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.Message_RCRS.ScopInfo";
   }
+  protected:
+  explicit Message_RCRS_ScopInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  // nested types ----------------------------------------------------
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
-  typedef Message_RSRC_ScopFunctionOCLInfo ScopFunctionOCLInfo;
+  // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo scopFunctions = 1;
-  int scopfunctions_size() const;
-  void clear_scopfunctions();
-  static const int kScopFunctionsFieldNumber = 1;
-  const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& scopfunctions(int index) const;
-  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* mutable_scopfunctions(int index);
-  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* add_scopfunctions();
-  ::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >*
-      mutable_scopfunctions();
-  const ::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >&
-      scopfunctions() const;
-
-  // optional string oclKernelFileName = 2;
-  bool has_oclkernelfilename() const;
-  void clear_oclkernelfilename();
-  static const int kOclKernelFileNameFieldNumber = 2;
-  const ::std::string& oclkernelfilename() const;
-  void set_oclkernelfilename(const ::std::string& value);
-  void set_oclkernelfilename(const char* value);
-  void set_oclkernelfilename(const char* value, size_t size);
-  ::std::string* mutable_oclkernelfilename();
-  ::std::string* release_oclkernelfilename();
-  void set_allocated_oclkernelfilename(::std::string* oclkernelfilename);
+  enum : int {
+    kReadOnlyArgsFieldNumber = 5,
+    kFusedFunctionsFieldNumber = 6,
+    kFusedTmpArgsFieldNumber = 7,
+    kScopFunctionNameFieldNumber = 1,
+    kReductionFieldNumber = 3,
+    kScatterFieldNumber = 9,
+    kMaxCodegenLoopDepthFieldNumber = 2,
+    kNumLoopTripCountsFieldNumber = 4,
+    kWavefrontSkewFieldNumber = 8,
+  };
+  // repeated .HTROP_PB.ReadOnlyArgHint read_only_args = 5;
+  int read_only_args_size() const;
+  private:
+  int _internal_read_only_args_size() const;
+  public:
+  void clear_read_only_args();
+  ::HTROP_PB::ReadOnlyArgHint* mutable_read_only_args(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ReadOnlyArgHint >*
+      mutable_read_only_args();
+  private:
+  const ::HTROP_PB::ReadOnlyArgHint& _internal_read_only_args(int index) const;
+  ::HTROP_PB::ReadOnlyArgHint* _internal_add_read_only_args();
+  public:
+  const ::HTROP_PB::ReadOnlyArgHint& read_only_args(int index) const;
+  ::HTROP_PB::ReadOnlyArgHint* add_read_only_args();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ReadOnlyArgHint >&
+      read_only_args() const;
 
-  // optional uint32 binarySize = 3;
-  bool has_binarysize() const;
-  void clear_binarysize();
-  static const int kBinarySizeFieldNumber = 3;
-  ::google::protobuf::uint32 binarysize() const;
-  void set_binarysize(::google::protobuf::uint32 value);
+  // repeated string fused_functions = 6;
+  int fused_functions_size() const;
+  private:
+  int _internal_fused_functions_size() const;
+  public:
+  void clear_fused_functions();
+  const std::string& fused_functions(int index) const;
+  std::string* mutable_fused_functions(int index);
+  void set_fused_functions(int index, const std::string& value);
+  void set_fused_functions(int index, std::string&& value);
+  void set_fused_functions(int index, const char* value);
+  void set_fused_functions(int index, const char* value, size_t size);
+  std::string* add_fused_functions();
+  void add_fused_functions(const std::string& value);
+  void add_fused_functions(std::string&& value);
+  void add_fused_functions(const char* value);
+  void add_fused_functions(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& fused_functions() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_fused_functions();
+  private:
+  const std::string& _internal_fused_functions(int index) const;
+  std::string* _internal_add_fused_functions();
+  public:
 
-  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RSRC)
+  // repeated uint32 fused_tmp_args = 7;
+  int fused_tmp_args_size() const;
+  private:
+  int _internal_fused_tmp_args_size() const;
+  public:
+  void clear_fused_tmp_args();
+  private:
+  uint32_t _internal_fused_tmp_args(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_fused_tmp_args() const;
+  void _internal_add_fused_tmp_args(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_fused_tmp_args();
+  public:
+  uint32_t fused_tmp_args(int index) const;
+  void set_fused_tmp_args(int index, uint32_t value);
+  void add_fused_tmp_args(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      fused_tmp_args() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_fused_tmp_args();
+
+  // optional string scopFunctionName = 1;
+  bool has_scopfunctionname() const;
+  private:
+  bool _internal_has_scopfunctionname() const;
+  public:
+  void clear_scopfunctionname();
+  const std::string& scopfunctionname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_scopfunctionname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_scopfunctionname();
+  PROTOBUF_NODISCARD std::string* release_scopfunctionname();
+  void set_allocated_scopfunctionname(std::string* scopfunctionname);
+  private:
+  const std::string& _internal_scopfunctionname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_scopfunctionname(const std::string& value);
+  std::string* _internal_mutable_scopfunctionname();
+  public:
+
+  // optional .HTROP_PB.ReductionHint reduction = 3;
+  bool has_reduction() const;
+  private:
+  bool _internal_has_reduction() const;
+  public:
+  void clear_reduction();
+  const ::HTROP_PB::ReductionHint& reduction() const;
+  PROTOBUF_NODISCARD ::HTROP_PB::ReductionHint* release_reduction();
+  ::HTROP_PB::ReductionHint* mutable_reduction();
+  void set_allocated_reduction(::HTROP_PB::ReductionHint* reduction);
+  private:
+  const ::HTROP_PB::ReductionHint& _internal_reduction() const;
+  ::HTROP_PB::ReductionHint* _internal_mutable_reduction();
+  public:
+  void unsafe_arena_set_allocated_reduction(
+      ::HTROP_PB::ReductionHint* reduction);
+  ::HTROP_PB::ReductionHint* unsafe_arena_release_reduction();
+
+  // optional .HTROP_PB.ScatterHint scatter = 9;
+  bool has_scatter() const;
+  private:
+  bool _internal_has_scatter() const;
+  public:
+  void clear_scatter();
+  const ::HTROP_PB::ScatterHint& scatter() const;
+  PROTOBUF_NODISCARD ::HTROP_PB::ScatterHint* release_scatter();
+  ::HTROP_PB::ScatterHint* mutable_scatter();
+  void set_allocated_scatter(::HTROP_PB::ScatterHint* scatter);
+  private:
+  const ::HTROP_PB::ScatterHint& _internal_scatter() const;
+  ::HTROP_PB::ScatterHint* _internal_mutable_scatter();
+  public:
+  void unsafe_arena_set_allocated_scatter(
+      ::HTROP_PB::ScatterHint* scatter);
+  ::HTROP_PB::ScatterHint* unsafe_arena_release_scatter();
+
+  // optional uint32 max_codegen_loop_depth = 2;
+  bool has_max_codegen_loop_depth() const;
+  private:
+  bool _internal_has_max_codegen_loop_depth() const;
+  public:
+  void clear_max_codegen_loop_depth();
+  uint32_t max_codegen_loop_depth() const;
+  void set_max_codegen_loop_depth(uint32_t value);
+  private:
+  uint32_t _internal_max_codegen_loop_depth() const;
+  void _internal_set_max_codegen_loop_depth(uint32_t value);
+  public:
+
+  // optional uint32 num_loop_trip_counts = 4;
+  bool has_num_loop_trip_counts() const;
+  private:
+  bool _internal_has_num_loop_trip_counts() const;
+  public:
+  void clear_num_loop_trip_counts();
+  uint32_t num_loop_trip_counts() const;
+  void set_num_loop_trip_counts(uint32_t value);
+  private:
+  uint32_t _internal_num_loop_trip_counts() const;
+  void _internal_set_num_loop_trip_counts(uint32_t value);
+  public:
+
+  // optional uint32 wavefront_skew = 8;
+  bool has_wavefront_skew() const;
+  private:
+  bool _internal_has_wavefront_skew() const;
+  public:
+  void clear_wavefront_skew();
+  uint32_t wavefront_skew() const;
+  void set_wavefront_skew(uint32_t value);
+  private:
+  uint32_t _internal_wavefront_skew() const;
+  void _internal_set_wavefront_skew(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RCRS.ScopInfo)
  private:
-  inline void set_has_oclkernelfilename();
-  inline void clear_has_oclkernelfilename();
-  inline void set_has_binarysize();
-  inline void clear_has_binarysize();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo > scopfunctions_;
-  ::google::protobuf::internal::ArenaStringPtr oclkernelfilename_;
-  ::google::protobuf::uint32 binarysize_;
-  friend void  protobuf_AddDesc_hds_2eproto();
-  friend void protobuf_AssignDesc_hds_2eproto();
-  friend void protobuf_ShutdownFile_hds_2eproto();
-
-  void InitAsDefaultInstance();
-  static Message_RSRC* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ReadOnlyArgHint > read_only_args_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> fused_functions_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > fused_tmp_args_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr scopfunctionname_;
+    ::HTROP_PB::ReductionHint* reduction_;
+    ::HTROP_PB::ScatterHint* scatter_;
+    uint32_t max_codegen_loop_depth_;
+    uint32_t num_loop_trip_counts_;
+    uint32_t wavefront_skew_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
+
+class Message_RCRS final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RCRS) */ {
+ public:
+  inline Message_RCRS() : Message_RCRS(nullptr) {}
+  ~Message_RCRS() override;
+  explicit PROTOBUF_CONSTEXPR Message_RCRS(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message_RCRS(const Message_RCRS& from);
+  Message_RCRS(Message_RCRS&& from) noexcept
+    : Message_RCRS() {
+    *this = ::std::move(from);
+  }
+
+  inline Message_RCRS& operator=(const Message_RCRS& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message_RCRS& operator=(Message_RCRS&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message_RCRS& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message_RCRS* internal_default_instance() {
+    return reinterpret_cast<const Message_RCRS*>(
+               &_Message_RCRS_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(Message_RCRS& a, Message_RCRS& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message_RCRS* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message_RCRS* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message_RCRS* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message_RCRS>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message_RCRS& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message_RCRS& from) {
+    Message_RCRS::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message_RCRS* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.Message_RCRS";
+  }
+  protected:
+  explicit Message_RCRS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Message_RCRS_ScopInfo ScopInfo;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kScopListFieldNumber = 1,
+    kScopFunctionParentNameFieldNumber = 2,
+    kModuleHashFieldNumber = 3,
+  };
+  // repeated .HTROP_PB.Message_RCRS.ScopInfo scopList = 1;
+  int scoplist_size() const;
+  private:
+  int _internal_scoplist_size() const;
+  public:
+  void clear_scoplist();
+  ::HTROP_PB::Message_RCRS_ScopInfo* mutable_scoplist(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RCRS_ScopInfo >*
+      mutable_scoplist();
+  private:
+  const ::HTROP_PB::Message_RCRS_ScopInfo& _internal_scoplist(int index) const;
+  ::HTROP_PB::Message_RCRS_ScopInfo* _internal_add_scoplist();
+  public:
+  const ::HTROP_PB::Message_RCRS_ScopInfo& scoplist(int index) const;
+  ::HTROP_PB::Message_RCRS_ScopInfo* add_scoplist();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RCRS_ScopInfo >&
+      scoplist() const;
+
+  // optional string scopFunctionParentName = 2;
+  bool has_scopfunctionparentname() const;
+  private:
+  bool _internal_has_scopfunctionparentname() const;
+  public:
+  void clear_scopfunctionparentname();
+  const std::string& scopfunctionparentname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_scopfunctionparentname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_scopfunctionparentname();
+  PROTOBUF_NODISCARD std::string* release_scopfunctionparentname();
+  void set_allocated_scopfunctionparentname(std::string* scopfunctionparentname);
+  private:
+  const std::string& _internal_scopfunctionparentname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_scopfunctionparentname(const std::string& value);
+  std::string* _internal_mutable_scopfunctionparentname();
+  public:
+
+  // optional fixed64 module_hash = 3;
+  bool has_module_hash() const;
+  private:
+  bool _internal_has_module_hash() const;
+  public:
+  void clear_module_hash();
+  uint64_t module_hash() const;
+  void set_module_hash(uint64_t value);
+  private:
+  uint64_t _internal_module_hash() const;
+  void _internal_set_module_hash(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RCRS)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RCRS_ScopInfo > scoplist_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr scopfunctionparentname_;
+    uint64_t module_hash_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Message_RSRC_WorkItemFactor final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RSRC.WorkItemFactor) */ {
+ public:
+  inline Message_RSRC_WorkItemFactor() : Message_RSRC_WorkItemFactor(nullptr) {}
+  ~Message_RSRC_WorkItemFactor() override;
+  explicit PROTOBUF_CONSTEXPR Message_RSRC_WorkItemFactor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message_RSRC_WorkItemFactor(const Message_RSRC_WorkItemFactor& from);
+  Message_RSRC_WorkItemFactor(Message_RSRC_WorkItemFactor&& from) noexcept
+    : Message_RSRC_WorkItemFactor() {
+    *this = ::std::move(from);
+  }
+
+  inline Message_RSRC_WorkItemFactor& operator=(const Message_RSRC_WorkItemFactor& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message_RSRC_WorkItemFactor& operator=(Message_RSRC_WorkItemFactor&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message_RSRC_WorkItemFactor& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message_RSRC_WorkItemFactor* internal_default_instance() {
+    return reinterpret_cast<const Message_RSRC_WorkItemFactor*>(
+               &_Message_RSRC_WorkItemFactor_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(Message_RSRC_WorkItemFactor& a, Message_RSRC_WorkItemFactor& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message_RSRC_WorkItemFactor* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message_RSRC_WorkItemFactor* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message_RSRC_WorkItemFactor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message_RSRC_WorkItemFactor>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message_RSRC_WorkItemFactor& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message_RSRC_WorkItemFactor& from) {
+    Message_RSRC_WorkItemFactor::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message_RSRC_WorkItemFactor* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.Message_RSRC.WorkItemFactor";
+  }
+  protected:
+  explicit Message_RSRC_WorkItemFactor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDimensionFieldNumber = 1,
+    kFactorMcpuFieldNumber = 2,
+    kFactorGpuFieldNumber = 3,
+    kFactorMicFieldNumber = 4,
+  };
+  // optional uint32 dimension = 1;
+  bool has_dimension() const;
+  private:
+  bool _internal_has_dimension() const;
+  public:
+  void clear_dimension();
+  uint32_t dimension() const;
+  void set_dimension(uint32_t value);
+  private:
+  uint32_t _internal_dimension() const;
+  void _internal_set_dimension(uint32_t value);
+  public:
+
+  // optional uint32 factor_mcpu = 2;
+  bool has_factor_mcpu() const;
+  private:
+  bool _internal_has_factor_mcpu() const;
+  public:
+  void clear_factor_mcpu();
+  uint32_t factor_mcpu() const;
+  void set_factor_mcpu(uint32_t value);
+  private:
+  uint32_t _internal_factor_mcpu() const;
+  void _internal_set_factor_mcpu(uint32_t value);
+  public:
+
+  // optional uint32 factor_gpu = 3;
+  bool has_factor_gpu() const;
+  private:
+  bool _internal_has_factor_gpu() const;
+  public:
+  void clear_factor_gpu();
+  uint32_t factor_gpu() const;
+  void set_factor_gpu(uint32_t value);
+  private:
+  uint32_t _internal_factor_gpu() const;
+  void _internal_set_factor_gpu(uint32_t value);
+  public:
+
+  // optional uint32 factor_mic = 4;
+  bool has_factor_mic() const;
+  private:
+  bool _internal_has_factor_mic() const;
+  public:
+  void clear_factor_mic();
+  uint32_t factor_mic() const;
+  void set_factor_mic(uint32_t value);
+  private:
+  uint32_t _internal_factor_mic() const;
+  void _internal_set_factor_mic(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RSRC.WorkItemFactor)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t dimension_;
+    uint32_t factor_mcpu_;
+    uint32_t factor_gpu_;
+    uint32_t factor_mic_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Message_RSRC_Reduction final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RSRC.Reduction) */ {
+ public:
+  inline Message_RSRC_Reduction() : Message_RSRC_Reduction(nullptr) {}
+  ~Message_RSRC_Reduction() override;
+  explicit PROTOBUF_CONSTEXPR Message_RSRC_Reduction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message_RSRC_Reduction(const Message_RSRC_Reduction& from);
+  Message_RSRC_Reduction(Message_RSRC_Reduction&& from) noexcept
+    : Message_RSRC_Reduction() {
+    *this = ::std::move(from);
+  }
+
+  inline Message_RSRC_Reduction& operator=(const Message_RSRC_Reduction& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message_RSRC_Reduction& operator=(Message_RSRC_Reduction&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message_RSRC_Reduction& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message_RSRC_Reduction* internal_default_instance() {
+    return reinterpret_cast<const Message_RSRC_Reduction*>(
+               &_Message_RSRC_Reduction_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(Message_RSRC_Reduction& a, Message_RSRC_Reduction& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message_RSRC_Reduction* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message_RSRC_Reduction* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message_RSRC_Reduction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message_RSRC_Reduction>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message_RSRC_Reduction& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message_RSRC_Reduction& from) {
+    Message_RSRC_Reduction::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message_RSRC_Reduction* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.Message_RSRC.Reduction";
+  }
+  protected:
+  explicit Message_RSRC_Reduction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
 
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArgPositionFieldNumber = 1,
+    kReductionOperatorFieldNumber = 2,
+    kIsFloatFieldNumber = 3,
+    kDataTypeSizeFieldNumber = 4,
+    kPartialArgPositionFieldNumber = 5,
+  };
+  // optional uint32 arg_position = 1;
+  bool has_arg_position() const;
+  private:
+  bool _internal_has_arg_position() const;
+  public:
+  void clear_arg_position();
+  uint32_t arg_position() const;
+  void set_arg_position(uint32_t value);
+  private:
+  uint32_t _internal_arg_position() const;
+  void _internal_set_arg_position(uint32_t value);
+  public:
+
+  // optional int32 reduction_operator = 2;
+  bool has_reduction_operator() const;
+  private:
+  bool _internal_has_reduction_operator() const;
+  public:
+  void clear_reduction_operator();
+  int32_t reduction_operator() const;
+  void set_reduction_operator(int32_t value);
+  private:
+  int32_t _internal_reduction_operator() const;
+  void _internal_set_reduction_operator(int32_t value);
+  public:
+
+  // optional bool is_float = 3;
+  bool has_is_float() const;
+  private:
+  bool _internal_has_is_float() const;
+  public:
+  void clear_is_float();
+  bool is_float() const;
+  void set_is_float(bool value);
+  private:
+  bool _internal_is_float() const;
+  void _internal_set_is_float(bool value);
+  public:
+
+  // optional uint32 data_type_size = 4;
+  bool has_data_type_size() const;
+  private:
+  bool _internal_has_data_type_size() const;
+  public:
+  void clear_data_type_size();
+  uint32_t data_type_size() const;
+  void set_data_type_size(uint32_t value);
+  private:
+  uint32_t _internal_data_type_size() const;
+  void _internal_set_data_type_size(uint32_t value);
+  public:
+
+  // optional uint32 partial_arg_position = 5;
+  bool has_partial_arg_position() const;
+  private:
+  bool _internal_has_partial_arg_position() const;
+  public:
+  void clear_partial_arg_position();
+  uint32_t partial_arg_position() const;
+  void set_partial_arg_position(uint32_t value);
+  private:
+  uint32_t _internal_partial_arg_position() const;
+  void _internal_set_partial_arg_position(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RSRC.Reduction)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t arg_position_;
+    int32_t reduction_operator_;
+    bool is_float_;
+    uint32_t data_type_size_;
+    uint32_t partial_arg_position_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Message_RSRC_ImageArg final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RSRC.ImageArg) */ {
+ public:
+  inline Message_RSRC_ImageArg() : Message_RSRC_ImageArg(nullptr) {}
+  ~Message_RSRC_ImageArg() override;
+  explicit PROTOBUF_CONSTEXPR Message_RSRC_ImageArg(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message_RSRC_ImageArg(const Message_RSRC_ImageArg& from);
+  Message_RSRC_ImageArg(Message_RSRC_ImageArg&& from) noexcept
+    : Message_RSRC_ImageArg() {
+    *this = ::std::move(from);
+  }
+
+  inline Message_RSRC_ImageArg& operator=(const Message_RSRC_ImageArg& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message_RSRC_ImageArg& operator=(Message_RSRC_ImageArg&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message_RSRC_ImageArg& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message_RSRC_ImageArg* internal_default_instance() {
+    return reinterpret_cast<const Message_RSRC_ImageArg*>(
+               &_Message_RSRC_ImageArg_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(Message_RSRC_ImageArg& a, Message_RSRC_ImageArg& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message_RSRC_ImageArg* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message_RSRC_ImageArg* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message_RSRC_ImageArg* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message_RSRC_ImageArg>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message_RSRC_ImageArg& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message_RSRC_ImageArg& from) {
+    Message_RSRC_ImageArg::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message_RSRC_ImageArg* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.Message_RSRC.ImageArg";
+  }
+  protected:
+  explicit Message_RSRC_ImageArg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArgPositionFieldNumber = 1,
+    kRowWidthArgFieldNumber = 2,
+    kIsFloatFieldNumber = 3,
+  };
+  // optional uint32 arg_position = 1;
+  bool has_arg_position() const;
+  private:
+  bool _internal_has_arg_position() const;
+  public:
+  void clear_arg_position();
+  uint32_t arg_position() const;
+  void set_arg_position(uint32_t value);
+  private:
+  uint32_t _internal_arg_position() const;
+  void _internal_set_arg_position(uint32_t value);
+  public:
+
+  // optional int32 row_width_arg = 2;
+  bool has_row_width_arg() const;
+  private:
+  bool _internal_has_row_width_arg() const;
+  public:
+  void clear_row_width_arg();
+  int32_t row_width_arg() const;
+  void set_row_width_arg(int32_t value);
+  private:
+  int32_t _internal_row_width_arg() const;
+  void _internal_set_row_width_arg(int32_t value);
+  public:
+
+  // optional bool is_float = 3;
+  bool has_is_float() const;
+  private:
+  bool _internal_has_is_float() const;
+  public:
+  void clear_is_float();
+  bool is_float() const;
+  void set_is_float(bool value);
+  private:
+  bool _internal_is_float() const;
+  void _internal_set_is_float(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RSRC.ImageArg)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t arg_position_;
+    int32_t row_width_arg_;
+    bool is_float_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Message_RSRC_PitchedArg final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RSRC.PitchedArg) */ {
+ public:
+  inline Message_RSRC_PitchedArg() : Message_RSRC_PitchedArg(nullptr) {}
+  ~Message_RSRC_PitchedArg() override;
+  explicit PROTOBUF_CONSTEXPR Message_RSRC_PitchedArg(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message_RSRC_PitchedArg(const Message_RSRC_PitchedArg& from);
+  Message_RSRC_PitchedArg(Message_RSRC_PitchedArg&& from) noexcept
+    : Message_RSRC_PitchedArg() {
+    *this = ::std::move(from);
+  }
+
+  inline Message_RSRC_PitchedArg& operator=(const Message_RSRC_PitchedArg& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message_RSRC_PitchedArg& operator=(Message_RSRC_PitchedArg&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message_RSRC_PitchedArg& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message_RSRC_PitchedArg* internal_default_instance() {
+    return reinterpret_cast<const Message_RSRC_PitchedArg*>(
+               &_Message_RSRC_PitchedArg_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(Message_RSRC_PitchedArg& a, Message_RSRC_PitchedArg& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message_RSRC_PitchedArg* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message_RSRC_PitchedArg* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message_RSRC_PitchedArg* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message_RSRC_PitchedArg>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message_RSRC_PitchedArg& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message_RSRC_PitchedArg& from) {
+    Message_RSRC_PitchedArg::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message_RSRC_PitchedArg* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.Message_RSRC.PitchedArg";
+  }
+  protected:
+  explicit Message_RSRC_PitchedArg(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRowWidthFieldNumber = 2,
+    kArgPositionFieldNumber = 1,
+    kDataTypeSizeFieldNumber = 3,
+  };
+  // optional uint64 row_width = 2;
+  bool has_row_width() const;
+  private:
+  bool _internal_has_row_width() const;
+  public:
+  void clear_row_width();
+  uint64_t row_width() const;
+  void set_row_width(uint64_t value);
+  private:
+  uint64_t _internal_row_width() const;
+  void _internal_set_row_width(uint64_t value);
+  public:
+
+  // optional uint32 arg_position = 1;
+  bool has_arg_position() const;
+  private:
+  bool _internal_has_arg_position() const;
+  public:
+  void clear_arg_position();
+  uint32_t arg_position() const;
+  void set_arg_position(uint32_t value);
+  private:
+  uint32_t _internal_arg_position() const;
+  void _internal_set_arg_position(uint32_t value);
+  public:
+
+  // optional uint32 data_type_size = 3;
+  bool has_data_type_size() const;
+  private:
+  bool _internal_has_data_type_size() const;
+  public:
+  void clear_data_type_size();
+  uint32_t data_type_size() const;
+  void set_data_type_size(uint32_t value);
+  private:
+  uint32_t _internal_data_type_size() const;
+  void _internal_set_data_type_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RSRC.PitchedArg)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t row_width_;
+    uint32_t arg_position_;
+    uint32_t data_type_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Message_RSRC_ScopFunctionOCLInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo) */ {
+ public:
+  inline Message_RSRC_ScopFunctionOCLInfo() : Message_RSRC_ScopFunctionOCLInfo(nullptr) {}
+  ~Message_RSRC_ScopFunctionOCLInfo() override;
+  explicit PROTOBUF_CONSTEXPR Message_RSRC_ScopFunctionOCLInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message_RSRC_ScopFunctionOCLInfo(const Message_RSRC_ScopFunctionOCLInfo& from);
+  Message_RSRC_ScopFunctionOCLInfo(Message_RSRC_ScopFunctionOCLInfo&& from) noexcept
+    : Message_RSRC_ScopFunctionOCLInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline Message_RSRC_ScopFunctionOCLInfo& operator=(const Message_RSRC_ScopFunctionOCLInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message_RSRC_ScopFunctionOCLInfo& operator=(Message_RSRC_ScopFunctionOCLInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message_RSRC_ScopFunctionOCLInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message_RSRC_ScopFunctionOCLInfo* internal_default_instance() {
+    return reinterpret_cast<const Message_RSRC_ScopFunctionOCLInfo*>(
+               &_Message_RSRC_ScopFunctionOCLInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(Message_RSRC_ScopFunctionOCLInfo& a, Message_RSRC_ScopFunctionOCLInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message_RSRC_ScopFunctionOCLInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message_RSRC_ScopFunctionOCLInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message_RSRC_ScopFunctionOCLInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message_RSRC_ScopFunctionOCLInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message_RSRC_ScopFunctionOCLInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message_RSRC_ScopFunctionOCLInfo& from) {
+    Message_RSRC_ScopFunctionOCLInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message_RSRC_ScopFunctionOCLInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.Message_RSRC.ScopFunctionOCLInfo";
+  }
+  protected:
+  explicit Message_RSRC_ScopFunctionOCLInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWorkgroupArgIndexFieldNumber = 3,
+    kWorkgroupArgIndexOffsetFieldNumber = 4,
+    kLocalWorkSizeFieldNumber = 5,
+    kRegisterBlockFieldNumber = 6,
+    kVectorWidthFieldNumber = 7,
+    kCoarseningFieldNumber = 8,
+    kWorkgroupLoopIndexFieldNumber = 10,
+    kImageArgsFieldNumber = 11,
+    kVariantsFieldNumber = 12,
+    kSizeVersionsFieldNumber = 13,
+    kPitchedArgsFieldNumber = 16,
+    kDistributedKernelsFieldNumber = 19,
+    kBorderLowFieldNumber = 21,
+    kBorderHighFieldNumber = 22,
+    kMinGlobalSizeFieldNumber = 23,
+    kMaxGlobalSizeFieldNumber = 24,
+    kScopFunctionNameFieldNumber = 1,
+    kScopOCLKernelNameFieldNumber = 2,
+    kReductionFieldNumber = 9,
+    kInteriorKernelFieldNumber = 20,
+    kMinWorkItemsFieldNumber = 14,
+    kMaxWorkItemsFieldNumber = 15,
+    kMaxIndexFieldNumber = 17,
+    kWavefrontSkewFieldNumber = 18,
+  };
+  // repeated int32 workgroup_arg_index = 3;
+  int workgroup_arg_index_size() const;
+  private:
+  int _internal_workgroup_arg_index_size() const;
+  public:
+  void clear_workgroup_arg_index();
+  private:
+  int32_t _internal_workgroup_arg_index(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_workgroup_arg_index() const;
+  void _internal_add_workgroup_arg_index(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_workgroup_arg_index();
+  public:
+  int32_t workgroup_arg_index(int index) const;
+  void set_workgroup_arg_index(int index, int32_t value);
+  void add_workgroup_arg_index(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      workgroup_arg_index() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_workgroup_arg_index();
+
+  // repeated int32 workgroup_arg_index_offset = 4;
+  int workgroup_arg_index_offset_size() const;
+  private:
+  int _internal_workgroup_arg_index_offset_size() const;
+  public:
+  void clear_workgroup_arg_index_offset();
+  private:
+  int32_t _internal_workgroup_arg_index_offset(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_workgroup_arg_index_offset() const;
+  void _internal_add_workgroup_arg_index_offset(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_workgroup_arg_index_offset();
+  public:
+  int32_t workgroup_arg_index_offset(int index) const;
+  void set_workgroup_arg_index_offset(int index, int32_t value);
+  void add_workgroup_arg_index_offset(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      workgroup_arg_index_offset() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_workgroup_arg_index_offset();
+
+  // repeated uint32 local_work_size = 5;
+  int local_work_size_size() const;
+  private:
+  int _internal_local_work_size_size() const;
+  public:
+  void clear_local_work_size();
+  private:
+  uint32_t _internal_local_work_size(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_local_work_size() const;
+  void _internal_add_local_work_size(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_local_work_size();
+  public:
+  uint32_t local_work_size(int index) const;
+  void set_local_work_size(int index, uint32_t value);
+  void add_local_work_size(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      local_work_size() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_local_work_size();
+
+  // repeated .HTROP_PB.Message_RSRC.WorkItemFactor register_block = 6;
+  int register_block_size() const;
+  private:
+  int _internal_register_block_size() const;
+  public:
+  void clear_register_block();
+  ::HTROP_PB::Message_RSRC_WorkItemFactor* mutable_register_block(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor >*
+      mutable_register_block();
+  private:
+  const ::HTROP_PB::Message_RSRC_WorkItemFactor& _internal_register_block(int index) const;
+  ::HTROP_PB::Message_RSRC_WorkItemFactor* _internal_add_register_block();
+  public:
+  const ::HTROP_PB::Message_RSRC_WorkItemFactor& register_block(int index) const;
+  ::HTROP_PB::Message_RSRC_WorkItemFactor* add_register_block();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor >&
+      register_block() const;
+
+  // repeated .HTROP_PB.Message_RSRC.WorkItemFactor vector_width = 7;
+  int vector_width_size() const;
+  private:
+  int _internal_vector_width_size() const;
+  public:
+  void clear_vector_width();
+  ::HTROP_PB::Message_RSRC_WorkItemFactor* mutable_vector_width(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor >*
+      mutable_vector_width();
+  private:
+  const ::HTROP_PB::Message_RSRC_WorkItemFactor& _internal_vector_width(int index) const;
+  ::HTROP_PB::Message_RSRC_WorkItemFactor* _internal_add_vector_width();
+  public:
+  const ::HTROP_PB::Message_RSRC_WorkItemFactor& vector_width(int index) const;
+  ::HTROP_PB::Message_RSRC_WorkItemFactor* add_vector_width();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor >&
+      vector_width() const;
+
+  // repeated .HTROP_PB.Message_RSRC.WorkItemFactor coarsening = 8;
+  int coarsening_size() const;
+  private:
+  int _internal_coarsening_size() const;
+  public:
+  void clear_coarsening();
+  ::HTROP_PB::Message_RSRC_WorkItemFactor* mutable_coarsening(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor >*
+      mutable_coarsening();
+  private:
+  const ::HTROP_PB::Message_RSRC_WorkItemFactor& _internal_coarsening(int index) const;
+  ::HTROP_PB::Message_RSRC_WorkItemFactor* _internal_add_coarsening();
+  public:
+  const ::HTROP_PB::Message_RSRC_WorkItemFactor& coarsening(int index) const;
+  ::HTROP_PB::Message_RSRC_WorkItemFactor* add_coarsening();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor >&
+      coarsening() const;
+
+  // repeated int32 workgroup_loop_index = 10;
+  int workgroup_loop_index_size() const;
+  private:
+  int _internal_workgroup_loop_index_size() const;
+  public:
+  void clear_workgroup_loop_index();
+  private:
+  int32_t _internal_workgroup_loop_index(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_workgroup_loop_index() const;
+  void _internal_add_workgroup_loop_index(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_workgroup_loop_index();
+  public:
+  int32_t workgroup_loop_index(int index) const;
+  void set_workgroup_loop_index(int index, int32_t value);
+  void add_workgroup_loop_index(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      workgroup_loop_index() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_workgroup_loop_index();
+
+  // repeated .HTROP_PB.Message_RSRC.ImageArg image_args = 11;
+  int image_args_size() const;
+  private:
+  int _internal_image_args_size() const;
+  public:
+  void clear_image_args();
+  ::HTROP_PB::Message_RSRC_ImageArg* mutable_image_args(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ImageArg >*
+      mutable_image_args();
+  private:
+  const ::HTROP_PB::Message_RSRC_ImageArg& _internal_image_args(int index) const;
+  ::HTROP_PB::Message_RSRC_ImageArg* _internal_add_image_args();
+  public:
+  const ::HTROP_PB::Message_RSRC_ImageArg& image_args(int index) const;
+  ::HTROP_PB::Message_RSRC_ImageArg* add_image_args();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ImageArg >&
+      image_args() const;
+
+  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo variants = 12;
+  int variants_size() const;
+  private:
+  int _internal_variants_size() const;
+  public:
+  void clear_variants();
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* mutable_variants(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >*
+      mutable_variants();
+  private:
+  const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& _internal_variants(int index) const;
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* _internal_add_variants();
+  public:
+  const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& variants(int index) const;
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* add_variants();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >&
+      variants() const;
+
+  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo size_versions = 13;
+  int size_versions_size() const;
+  private:
+  int _internal_size_versions_size() const;
+  public:
+  void clear_size_versions();
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* mutable_size_versions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >*
+      mutable_size_versions();
+  private:
+  const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& _internal_size_versions(int index) const;
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* _internal_add_size_versions();
+  public:
+  const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& size_versions(int index) const;
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* add_size_versions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >&
+      size_versions() const;
+
+  // repeated .HTROP_PB.Message_RSRC.PitchedArg pitched_args = 16;
+  int pitched_args_size() const;
+  private:
+  int _internal_pitched_args_size() const;
+  public:
+  void clear_pitched_args();
+  ::HTROP_PB::Message_RSRC_PitchedArg* mutable_pitched_args(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_PitchedArg >*
+      mutable_pitched_args();
+  private:
+  const ::HTROP_PB::Message_RSRC_PitchedArg& _internal_pitched_args(int index) const;
+  ::HTROP_PB::Message_RSRC_PitchedArg* _internal_add_pitched_args();
+  public:
+  const ::HTROP_PB::Message_RSRC_PitchedArg& pitched_args(int index) const;
+  ::HTROP_PB::Message_RSRC_PitchedArg* add_pitched_args();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_PitchedArg >&
+      pitched_args() const;
+
+  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo distributed_kernels = 19;
+  int distributed_kernels_size() const;
+  private:
+  int _internal_distributed_kernels_size() const;
+  public:
+  void clear_distributed_kernels();
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* mutable_distributed_kernels(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >*
+      mutable_distributed_kernels();
+  private:
+  const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& _internal_distributed_kernels(int index) const;
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* _internal_add_distributed_kernels();
+  public:
+  const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& distributed_kernels(int index) const;
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* add_distributed_kernels();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >&
+      distributed_kernels() const;
+
+  // repeated uint32 border_low = 21;
+  int border_low_size() const;
+  private:
+  int _internal_border_low_size() const;
+  public:
+  void clear_border_low();
+  private:
+  uint32_t _internal_border_low(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_border_low() const;
+  void _internal_add_border_low(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_border_low();
+  public:
+  uint32_t border_low(int index) const;
+  void set_border_low(int index, uint32_t value);
+  void add_border_low(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      border_low() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_border_low();
+
+  // repeated uint32 border_high = 22;
+  int border_high_size() const;
+  private:
+  int _internal_border_high_size() const;
+  public:
+  void clear_border_high();
+  private:
+  uint32_t _internal_border_high(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_border_high() const;
+  void _internal_add_border_high(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_border_high();
+  public:
+  uint32_t border_high(int index) const;
+  void set_border_high(int index, uint32_t value);
+  void add_border_high(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      border_high() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_border_high();
+
+  // repeated uint64 min_global_size = 23;
+  int min_global_size_size() const;
+  private:
+  int _internal_min_global_size_size() const;
+  public:
+  void clear_min_global_size();
+  private:
+  uint64_t _internal_min_global_size(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_min_global_size() const;
+  void _internal_add_min_global_size(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_min_global_size();
+  public:
+  uint64_t min_global_size(int index) const;
+  void set_min_global_size(int index, uint64_t value);
+  void add_min_global_size(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      min_global_size() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_min_global_size();
+
+  // repeated uint64 max_global_size = 24;
+  int max_global_size_size() const;
+  private:
+  int _internal_max_global_size_size() const;
+  public:
+  void clear_max_global_size();
+  private:
+  uint64_t _internal_max_global_size(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_max_global_size() const;
+  void _internal_add_max_global_size(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_max_global_size();
+  public:
+  uint64_t max_global_size(int index) const;
+  void set_max_global_size(int index, uint64_t value);
+  void add_max_global_size(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      max_global_size() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_max_global_size();
+
+  // optional string scopFunctionName = 1;
+  bool has_scopfunctionname() const;
+  private:
+  bool _internal_has_scopfunctionname() const;
+  public:
+  void clear_scopfunctionname();
+  const std::string& scopfunctionname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_scopfunctionname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_scopfunctionname();
+  PROTOBUF_NODISCARD std::string* release_scopfunctionname();
+  void set_allocated_scopfunctionname(std::string* scopfunctionname);
+  private:
+  const std::string& _internal_scopfunctionname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_scopfunctionname(const std::string& value);
+  std::string* _internal_mutable_scopfunctionname();
+  public:
+
+  // optional string scopOCLKernelName = 2;
+  bool has_scopoclkernelname() const;
+  private:
+  bool _internal_has_scopoclkernelname() const;
+  public:
+  void clear_scopoclkernelname();
+  const std::string& scopoclkernelname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_scopoclkernelname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_scopoclkernelname();
+  PROTOBUF_NODISCARD std::string* release_scopoclkernelname();
+  void set_allocated_scopoclkernelname(std::string* scopoclkernelname);
+  private:
+  const std::string& _internal_scopoclkernelname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_scopoclkernelname(const std::string& value);
+  std::string* _internal_mutable_scopoclkernelname();
+  public:
+
+  // optional .HTROP_PB.Message_RSRC.Reduction reduction = 9;
+  bool has_reduction() const;
+  private:
+  bool _internal_has_reduction() const;
+  public:
+  void clear_reduction();
+  const ::HTROP_PB::Message_RSRC_Reduction& reduction() const;
+  PROTOBUF_NODISCARD ::HTROP_PB::Message_RSRC_Reduction* release_reduction();
+  ::HTROP_PB::Message_RSRC_Reduction* mutable_reduction();
+  void set_allocated_reduction(::HTROP_PB::Message_RSRC_Reduction* reduction);
+  private:
+  const ::HTROP_PB::Message_RSRC_Reduction& _internal_reduction() const;
+  ::HTROP_PB::Message_RSRC_Reduction* _internal_mutable_reduction();
+  public:
+  void unsafe_arena_set_allocated_reduction(
+      ::HTROP_PB::Message_RSRC_Reduction* reduction);
+  ::HTROP_PB::Message_RSRC_Reduction* unsafe_arena_release_reduction();
+
+  // optional .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo interior_kernel = 20;
+  bool has_interior_kernel() const;
+  private:
+  bool _internal_has_interior_kernel() const;
+  public:
+  void clear_interior_kernel();
+  const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& interior_kernel() const;
+  PROTOBUF_NODISCARD ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* release_interior_kernel();
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* mutable_interior_kernel();
+  void set_allocated_interior_kernel(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* interior_kernel);
+  private:
+  const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& _internal_interior_kernel() const;
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* _internal_mutable_interior_kernel();
+  public:
+  void unsafe_arena_set_allocated_interior_kernel(
+      ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* interior_kernel);
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* unsafe_arena_release_interior_kernel();
+
+  // optional uint64 min_work_items = 14;
+  bool has_min_work_items() const;
+  private:
+  bool _internal_has_min_work_items() const;
+  public:
+  void clear_min_work_items();
+  uint64_t min_work_items() const;
+  void set_min_work_items(uint64_t value);
+  private:
+  uint64_t _internal_min_work_items() const;
+  void _internal_set_min_work_items(uint64_t value);
+  public:
+
+  // optional uint64 max_work_items = 15;
+  bool has_max_work_items() const;
+  private:
+  bool _internal_has_max_work_items() const;
+  public:
+  void clear_max_work_items();
+  uint64_t max_work_items() const;
+  void set_max_work_items(uint64_t value);
+  private:
+  uint64_t _internal_max_work_items() const;
+  void _internal_set_max_work_items(uint64_t value);
+  public:
+
+  // optional uint64 max_index = 17;
+  bool has_max_index() const;
+  private:
+  bool _internal_has_max_index() const;
+  public:
+  void clear_max_index();
+  uint64_t max_index() const;
+  void set_max_index(uint64_t value);
+  private:
+  uint64_t _internal_max_index() const;
+  void _internal_set_max_index(uint64_t value);
+  public:
+
+  // optional uint32 wavefront_skew = 18;
+  bool has_wavefront_skew() const;
+  private:
+  bool _internal_has_wavefront_skew() const;
+  public:
+  void clear_wavefront_skew();
+  uint32_t wavefront_skew() const;
+  void set_wavefront_skew(uint32_t value);
+  private:
+  uint32_t _internal_wavefront_skew() const;
+  void _internal_set_wavefront_skew(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > workgroup_arg_index_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > workgroup_arg_index_offset_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > local_work_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor > register_block_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor > vector_width_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor > coarsening_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > workgroup_loop_index_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ImageArg > image_args_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo > variants_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo > size_versions_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_PitchedArg > pitched_args_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo > distributed_kernels_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > border_low_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > border_high_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > min_global_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > max_global_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr scopfunctionname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr scopoclkernelname_;
+    ::HTROP_PB::Message_RSRC_Reduction* reduction_;
+    ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* interior_kernel_;
+    uint64_t min_work_items_;
+    uint64_t max_work_items_;
+    uint64_t max_index_;
+    uint32_t wavefront_skew_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Message_RSRC final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RSRC) */ {
+ public:
+  inline Message_RSRC() : Message_RSRC(nullptr) {}
+  ~Message_RSRC() override;
+  explicit PROTOBUF_CONSTEXPR Message_RSRC(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message_RSRC(const Message_RSRC& from);
+  Message_RSRC(Message_RSRC&& from) noexcept
+    : Message_RSRC() {
+    *this = ::std::move(from);
+  }
+
+  inline Message_RSRC& operator=(const Message_RSRC& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message_RSRC& operator=(Message_RSRC&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message_RSRC& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message_RSRC* internal_default_instance() {
+    return reinterpret_cast<const Message_RSRC*>(
+               &_Message_RSRC_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(Message_RSRC& a, Message_RSRC& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message_RSRC* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message_RSRC* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message_RSRC* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message_RSRC>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message_RSRC& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message_RSRC& from) {
+    Message_RSRC::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message_RSRC* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.Message_RSRC";
+  }
+  protected:
+  explicit Message_RSRC(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Message_RSRC_WorkItemFactor WorkItemFactor;
+  typedef Message_RSRC_Reduction Reduction;
+  typedef Message_RSRC_ImageArg ImageArg;
+  typedef Message_RSRC_PitchedArg PitchedArg;
+  typedef Message_RSRC_ScopFunctionOCLInfo ScopFunctionOCLInfo;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kScopFunctionsFieldNumber = 1,
+    kOclKernelFileNameFieldNumber = 2,
+    kBinarySizeFieldNumber = 3,
+  };
+  // repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo scopFunctions = 1;
+  int scopfunctions_size() const;
+  private:
+  int _internal_scopfunctions_size() const;
+  public:
+  void clear_scopfunctions();
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* mutable_scopfunctions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >*
+      mutable_scopfunctions();
+  private:
+  const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& _internal_scopfunctions(int index) const;
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* _internal_add_scopfunctions();
+  public:
+  const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& scopfunctions(int index) const;
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* add_scopfunctions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >&
+      scopfunctions() const;
+
+  // optional string oclKernelFileName = 2;
+  bool has_oclkernelfilename() const;
+  private:
+  bool _internal_has_oclkernelfilename() const;
+  public:
+  void clear_oclkernelfilename();
+  const std::string& oclkernelfilename() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_oclkernelfilename(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_oclkernelfilename();
+  PROTOBUF_NODISCARD std::string* release_oclkernelfilename();
+  void set_allocated_oclkernelfilename(std::string* oclkernelfilename);
+  private:
+  const std::string& _internal_oclkernelfilename() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_oclkernelfilename(const std::string& value);
+  std::string* _internal_mutable_oclkernelfilename();
+  public:
+
+  // optional uint32 binarySize = 3;
+  bool has_binarysize() const;
+  private:
+  bool _internal_has_binarysize() const;
+  public:
+  void clear_binarysize();
+  uint32_t binarysize() const;
+  void set_binarysize(uint32_t value);
+  private:
+  uint32_t _internal_binarysize() const;
+  void _internal_set_binarysize(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RSRC)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo > scopfunctions_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr oclkernelfilename_;
+    uint32_t binarysize_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScopArgInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.ScopArgInfo) */ {
+ public:
+  inline ScopArgInfo() : ScopArgInfo(nullptr) {}
+  ~ScopArgInfo() override;
+  explicit PROTOBUF_CONSTEXPR ScopArgInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScopArgInfo(const ScopArgInfo& from);
+  ScopArgInfo(ScopArgInfo&& from) noexcept
+    : ScopArgInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline ScopArgInfo& operator=(const ScopArgInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScopArgInfo& operator=(ScopArgInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScopArgInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScopArgInfo* internal_default_instance() {
+    return reinterpret_cast<const ScopArgInfo*>(
+               &_ScopArgInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(ScopArgInfo& a, ScopArgInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScopArgInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScopArgInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScopArgInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScopArgInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScopArgInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScopArgInfo& from) {
+    ScopArgInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScopArgInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.ScopArgInfo";
+  }
+  protected:
+  explicit ScopArgInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDimensionMinFieldNumber = 5,
+    kDimensionMaxFieldNumber = 6,
+    kDimensionMinStrFieldNumber = 7,
+    kDimensionMaxStrFieldNumber = 8,
+    kDimensionOffsetMinFieldNumber = 9,
+    kDimensionOffsetMaxFieldNumber = 10,
+    kNameFieldNumber = 1,
+    kTypeFieldNumber = 2,
+    kIsPointerFieldNumber = 3,
+    kDimensionFieldNumber = 4,
+  };
+  // repeated int64 dimension_min = 5;
+  int dimension_min_size() const;
+  private:
+  int _internal_dimension_min_size() const;
+  public:
+  void clear_dimension_min();
+  private:
+  int64_t _internal_dimension_min(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_dimension_min() const;
+  void _internal_add_dimension_min(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_dimension_min();
+  public:
+  int64_t dimension_min(int index) const;
+  void set_dimension_min(int index, int64_t value);
+  void add_dimension_min(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      dimension_min() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_dimension_min();
+
+  // repeated int64 dimension_max = 6;
+  int dimension_max_size() const;
+  private:
+  int _internal_dimension_max_size() const;
+  public:
+  void clear_dimension_max();
+  private:
+  int64_t _internal_dimension_max(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_dimension_max() const;
+  void _internal_add_dimension_max(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_dimension_max();
+  public:
+  int64_t dimension_max(int index) const;
+  void set_dimension_max(int index, int64_t value);
+  void add_dimension_max(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      dimension_max() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_dimension_max();
+
+  // repeated string dimension_minStr = 7;
+  int dimension_minstr_size() const;
+  private:
+  int _internal_dimension_minstr_size() const;
+  public:
+  void clear_dimension_minstr();
+  const std::string& dimension_minstr(int index) const;
+  std::string* mutable_dimension_minstr(int index);
+  void set_dimension_minstr(int index, const std::string& value);
+  void set_dimension_minstr(int index, std::string&& value);
+  void set_dimension_minstr(int index, const char* value);
+  void set_dimension_minstr(int index, const char* value, size_t size);
+  std::string* add_dimension_minstr();
+  void add_dimension_minstr(const std::string& value);
+  void add_dimension_minstr(std::string&& value);
+  void add_dimension_minstr(const char* value);
+  void add_dimension_minstr(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& dimension_minstr() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_dimension_minstr();
+  private:
+  const std::string& _internal_dimension_minstr(int index) const;
+  std::string* _internal_add_dimension_minstr();
+  public:
+
+  // repeated string dimension_maxStr = 8;
+  int dimension_maxstr_size() const;
+  private:
+  int _internal_dimension_maxstr_size() const;
+  public:
+  void clear_dimension_maxstr();
+  const std::string& dimension_maxstr(int index) const;
+  std::string* mutable_dimension_maxstr(int index);
+  void set_dimension_maxstr(int index, const std::string& value);
+  void set_dimension_maxstr(int index, std::string&& value);
+  void set_dimension_maxstr(int index, const char* value);
+  void set_dimension_maxstr(int index, const char* value, size_t size);
+  std::string* add_dimension_maxstr();
+  void add_dimension_maxstr(const std::string& value);
+  void add_dimension_maxstr(std::string&& value);
+  void add_dimension_maxstr(const char* value);
+  void add_dimension_maxstr(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& dimension_maxstr() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_dimension_maxstr();
+  private:
+  const std::string& _internal_dimension_maxstr(int index) const;
+  std::string* _internal_add_dimension_maxstr();
+  public:
+
+  // repeated int64 dimension_offset_min = 9;
+  int dimension_offset_min_size() const;
+  private:
+  int _internal_dimension_offset_min_size() const;
+  public:
+  void clear_dimension_offset_min();
+  private:
+  int64_t _internal_dimension_offset_min(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_dimension_offset_min() const;
+  void _internal_add_dimension_offset_min(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_dimension_offset_min();
+  public:
+  int64_t dimension_offset_min(int index) const;
+  void set_dimension_offset_min(int index, int64_t value);
+  void add_dimension_offset_min(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      dimension_offset_min() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_dimension_offset_min();
+
+  // repeated int64 dimension_offset_max = 10;
+  int dimension_offset_max_size() const;
+  private:
+  int _internal_dimension_offset_max_size() const;
+  public:
+  void clear_dimension_offset_max();
+  private:
+  int64_t _internal_dimension_offset_max(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_dimension_offset_max() const;
+  void _internal_add_dimension_offset_max(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_dimension_offset_max();
+  public:
+  int64_t dimension_offset_max(int index) const;
+  void set_dimension_offset_max(int index, int64_t value);
+  void add_dimension_offset_max(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      dimension_offset_max() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_dimension_offset_max();
+
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional int32 type = 2;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
+
+  // optional bool isPointer = 3;
+  bool has_ispointer() const;
+  private:
+  bool _internal_has_ispointer() const;
+  public:
+  void clear_ispointer();
+  bool ispointer() const;
+  void set_ispointer(bool value);
+  private:
+  bool _internal_ispointer() const;
+  void _internal_set_ispointer(bool value);
+  public:
+
+  // optional uint32 dimension = 4;
+  bool has_dimension() const;
+  private:
+  bool _internal_has_dimension() const;
+  public:
+  void clear_dimension();
+  uint32_t dimension() const;
+  void set_dimension(uint32_t value);
+  private:
+  uint32_t _internal_dimension() const;
+  void _internal_set_dimension(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.ScopArgInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > dimension_min_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > dimension_max_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> dimension_minstr_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> dimension_maxstr_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > dimension_offset_min_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > dimension_offset_max_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int32_t type_;
+    bool ispointer_;
+    uint32_t dimension_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScopLoopBound final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.ScopLoopBound) */ {
+ public:
+  inline ScopLoopBound() : ScopLoopBound(nullptr) {}
+  ~ScopLoopBound() override;
+  explicit PROTOBUF_CONSTEXPR ScopLoopBound(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScopLoopBound(const ScopLoopBound& from);
+  ScopLoopBound(ScopLoopBound&& from) noexcept
+    : ScopLoopBound() {
+    *this = ::std::move(from);
+  }
+
+  inline ScopLoopBound& operator=(const ScopLoopBound& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScopLoopBound& operator=(ScopLoopBound&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScopLoopBound& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScopLoopBound* internal_default_instance() {
+    return reinterpret_cast<const ScopLoopBound*>(
+               &_ScopLoopBound_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(ScopLoopBound& a, ScopLoopBound& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScopLoopBound* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScopLoopBound* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScopLoopBound* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScopLoopBound>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScopLoopBound& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScopLoopBound& from) {
+    ScopLoopBound::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScopLoopBound* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.ScopLoopBound";
+  }
+  protected:
+  explicit ScopLoopBound(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameStrFieldNumber = 1,
+    kMaxValueStrFieldNumber = 3,
+    kMaxValueFieldNumber = 2,
+  };
+  // optional string nameStr = 1;
+  bool has_namestr() const;
+  private:
+  bool _internal_has_namestr() const;
+  public:
+  void clear_namestr();
+  const std::string& namestr() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_namestr(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_namestr();
+  PROTOBUF_NODISCARD std::string* release_namestr();
+  void set_allocated_namestr(std::string* namestr);
+  private:
+  const std::string& _internal_namestr() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_namestr(const std::string& value);
+  std::string* _internal_mutable_namestr();
+  public:
+
+  // optional string maxValueStr = 3;
+  bool has_maxvaluestr() const;
+  private:
+  bool _internal_has_maxvaluestr() const;
+  public:
+  void clear_maxvaluestr();
+  const std::string& maxvaluestr() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_maxvaluestr(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_maxvaluestr();
+  PROTOBUF_NODISCARD std::string* release_maxvaluestr();
+  void set_allocated_maxvaluestr(std::string* maxvaluestr);
+  private:
+  const std::string& _internal_maxvaluestr() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_maxvaluestr(const std::string& value);
+  std::string* _internal_mutable_maxvaluestr();
+  public:
+
+  // optional uint64 maxValue = 2;
+  bool has_maxvalue() const;
+  private:
+  bool _internal_has_maxvalue() const;
+  public:
+  void clear_maxvalue();
+  uint64_t maxvalue() const;
+  void set_maxvalue(uint64_t value);
+  private:
+  uint64_t _internal_maxvalue() const;
+  void _internal_set_maxvalue(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.ScopLoopBound)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr namestr_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr maxvaluestr_;
+    uint64_t maxvalue_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScopAnalysisInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.ScopAnalysisInfo) */ {
+ public:
+  inline ScopAnalysisInfo() : ScopAnalysisInfo(nullptr) {}
+  ~ScopAnalysisInfo() override;
+  explicit PROTOBUF_CONSTEXPR ScopAnalysisInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScopAnalysisInfo(const ScopAnalysisInfo& from);
+  ScopAnalysisInfo(ScopAnalysisInfo&& from) noexcept
+    : ScopAnalysisInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline ScopAnalysisInfo& operator=(const ScopAnalysisInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScopAnalysisInfo& operator=(ScopAnalysisInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScopAnalysisInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScopAnalysisInfo* internal_default_instance() {
+    return reinterpret_cast<const ScopAnalysisInfo*>(
+               &_ScopAnalysisInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(ScopAnalysisInfo& a, ScopAnalysisInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScopAnalysisInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScopAnalysisInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScopAnalysisInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScopAnalysisInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScopAnalysisInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScopAnalysisInfo& from) {
+    ScopAnalysisInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScopAnalysisInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.ScopAnalysisInfo";
+  }
+  protected:
+  explicit ScopAnalysisInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kScopFunctionArgsFieldNumber = 3,
+    kScopLoopsFieldNumber = 4,
+    kScopFunctionNameFieldNumber = 1,
+    kScopFunctionParentNameFieldNumber = 2,
+    kReductionFieldNumber = 6,
+    kScatterFieldNumber = 8,
+    kMaxParallelizationDepthFieldNumber = 5,
+    kWavefrontSkewFieldNumber = 7,
+  };
+  // repeated .HTROP_PB.ScopArgInfo scopFunctionArgs = 3;
+  int scopfunctionargs_size() const;
+  private:
+  int _internal_scopfunctionargs_size() const;
+  public:
+  void clear_scopfunctionargs();
+  ::HTROP_PB::ScopArgInfo* mutable_scopfunctionargs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopArgInfo >*
+      mutable_scopfunctionargs();
+  private:
+  const ::HTROP_PB::ScopArgInfo& _internal_scopfunctionargs(int index) const;
+  ::HTROP_PB::ScopArgInfo* _internal_add_scopfunctionargs();
+  public:
+  const ::HTROP_PB::ScopArgInfo& scopfunctionargs(int index) const;
+  ::HTROP_PB::ScopArgInfo* add_scopfunctionargs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopArgInfo >&
+      scopfunctionargs() const;
+
+  // repeated .HTROP_PB.ScopLoopBound scopLoops = 4;
+  int scoploops_size() const;
+  private:
+  int _internal_scoploops_size() const;
+  public:
+  void clear_scoploops();
+  ::HTROP_PB::ScopLoopBound* mutable_scoploops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopLoopBound >*
+      mutable_scoploops();
+  private:
+  const ::HTROP_PB::ScopLoopBound& _internal_scoploops(int index) const;
+  ::HTROP_PB::ScopLoopBound* _internal_add_scoploops();
+  public:
+  const ::HTROP_PB::ScopLoopBound& scoploops(int index) const;
+  ::HTROP_PB::ScopLoopBound* add_scoploops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopLoopBound >&
+      scoploops() const;
+
+  // optional string scopFunctionName = 1;
+  bool has_scopfunctionname() const;
+  private:
+  bool _internal_has_scopfunctionname() const;
+  public:
+  void clear_scopfunctionname();
+  const std::string& scopfunctionname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_scopfunctionname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_scopfunctionname();
+  PROTOBUF_NODISCARD std::string* release_scopfunctionname();
+  void set_allocated_scopfunctionname(std::string* scopfunctionname);
+  private:
+  const std::string& _internal_scopfunctionname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_scopfunctionname(const std::string& value);
+  std::string* _internal_mutable_scopfunctionname();
+  public:
+
+  // optional string scopFunctionParentName = 2;
+  bool has_scopfunctionparentname() const;
+  private:
+  bool _internal_has_scopfunctionparentname() const;
+  public:
+  void clear_scopfunctionparentname();
+  const std::string& scopfunctionparentname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_scopfunctionparentname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_scopfunctionparentname();
+  PROTOBUF_NODISCARD std::string* release_scopfunctionparentname();
+  void set_allocated_scopfunctionparentname(std::string* scopfunctionparentname);
+  private:
+  const std::string& _internal_scopfunctionparentname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_scopfunctionparentname(const std::string& value);
+  std::string* _internal_mutable_scopfunctionparentname();
+  public:
+
+  // optional .HTROP_PB.ReductionHint reduction = 6;
+  bool has_reduction() const;
+  private:
+  bool _internal_has_reduction() const;
+  public:
+  void clear_reduction();
+  const ::HTROP_PB::ReductionHint& reduction() const;
+  PROTOBUF_NODISCARD ::HTROP_PB::ReductionHint* release_reduction();
+  ::HTROP_PB::ReductionHint* mutable_reduction();
+  void set_allocated_reduction(::HTROP_PB::ReductionHint* reduction);
+  private:
+  const ::HTROP_PB::ReductionHint& _internal_reduction() const;
+  ::HTROP_PB::ReductionHint* _internal_mutable_reduction();
+  public:
+  void unsafe_arena_set_allocated_reduction(
+      ::HTROP_PB::ReductionHint* reduction);
+  ::HTROP_PB::ReductionHint* unsafe_arena_release_reduction();
+
+  // optional .HTROP_PB.ScatterHint scatter = 8;
+  bool has_scatter() const;
+  private:
+  bool _internal_has_scatter() const;
+  public:
+  void clear_scatter();
+  const ::HTROP_PB::ScatterHint& scatter() const;
+  PROTOBUF_NODISCARD ::HTROP_PB::ScatterHint* release_scatter();
+  ::HTROP_PB::ScatterHint* mutable_scatter();
+  void set_allocated_scatter(::HTROP_PB::ScatterHint* scatter);
+  private:
+  const ::HTROP_PB::ScatterHint& _internal_scatter() const;
+  ::HTROP_PB::ScatterHint* _internal_mutable_scatter();
+  public:
+  void unsafe_arena_set_allocated_scatter(
+      ::HTROP_PB::ScatterHint* scatter);
+  ::HTROP_PB::ScatterHint* unsafe_arena_release_scatter();
+
+  // optional uint32 maxParallelizationDepth = 5;
+  bool has_maxparallelizationdepth() const;
+  private:
+  bool _internal_has_maxparallelizationdepth() const;
+  public:
+  void clear_maxparallelizationdepth();
+  uint32_t maxparallelizationdepth() const;
+  void set_maxparallelizationdepth(uint32_t value);
+  private:
+  uint32_t _internal_maxparallelizationdepth() const;
+  void _internal_set_maxparallelizationdepth(uint32_t value);
+  public:
+
+  // optional uint32 wavefront_skew = 7;
+  bool has_wavefront_skew() const;
+  private:
+  bool _internal_has_wavefront_skew() const;
+  public:
+  void clear_wavefront_skew();
+  uint32_t wavefront_skew() const;
+  void set_wavefront_skew(uint32_t value);
+  private:
+  uint32_t _internal_wavefront_skew() const;
+  void _internal_set_wavefront_skew(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.ScopAnalysisInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopArgInfo > scopfunctionargs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopLoopBound > scoploops_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr scopfunctionname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr scopfunctionparentname_;
+    ::HTROP_PB::ReductionHint* reduction_;
+    ::HTROP_PB::ScatterHint* scatter_;
+    uint32_t maxparallelizationdepth_;
+    uint32_t wavefront_skew_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Message_RCRS_Analysis final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RCRS_Analysis) */ {
+ public:
+  inline Message_RCRS_Analysis() : Message_RCRS_Analysis(nullptr) {}
+  ~Message_RCRS_Analysis() override;
+  explicit PROTOBUF_CONSTEXPR Message_RCRS_Analysis(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message_RCRS_Analysis(const Message_RCRS_Analysis& from);
+  Message_RCRS_Analysis(Message_RCRS_Analysis&& from) noexcept
+    : Message_RCRS_Analysis() {
+    *this = ::std::move(from);
+  }
+
+  inline Message_RCRS_Analysis& operator=(const Message_RCRS_Analysis& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message_RCRS_Analysis& operator=(Message_RCRS_Analysis&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message_RCRS_Analysis& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message_RCRS_Analysis* internal_default_instance() {
+    return reinterpret_cast<const Message_RCRS_Analysis*>(
+               &_Message_RCRS_Analysis_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(Message_RCRS_Analysis& a, Message_RCRS_Analysis& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message_RCRS_Analysis* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message_RCRS_Analysis* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message_RCRS_Analysis* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message_RCRS_Analysis>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message_RCRS_Analysis& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message_RCRS_Analysis& from) {
+    Message_RCRS_Analysis::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message_RCRS_Analysis* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.Message_RCRS_Analysis";
+  }
+  protected:
+  explicit Message_RCRS_Analysis(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMaxScopLoopDepthFieldNumber = 1,
+    kMaxCodegenLoopDepthFieldNumber = 2,
+    kModuleSizeFieldNumber = 3,
+    kOptimizeScheduleFieldNumber = 4,
+  };
+  // repeated int32 max_scop_loop_depth = 1;
+  int max_scop_loop_depth_size() const;
+  private:
+  int _internal_max_scop_loop_depth_size() const;
+  public:
+  void clear_max_scop_loop_depth();
+  private:
+  int32_t _internal_max_scop_loop_depth(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_max_scop_loop_depth() const;
+  void _internal_add_max_scop_loop_depth(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_max_scop_loop_depth();
+  public:
+  int32_t max_scop_loop_depth(int index) const;
+  void set_max_scop_loop_depth(int index, int32_t value);
+  void add_max_scop_loop_depth(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      max_scop_loop_depth() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_max_scop_loop_depth();
+
+  // repeated int32 max_codegen_loop_depth = 2;
+  int max_codegen_loop_depth_size() const;
+  private:
+  int _internal_max_codegen_loop_depth_size() const;
+  public:
+  void clear_max_codegen_loop_depth();
+  private:
+  int32_t _internal_max_codegen_loop_depth(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_max_codegen_loop_depth() const;
+  void _internal_add_max_codegen_loop_depth(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_max_codegen_loop_depth();
+  public:
+  int32_t max_codegen_loop_depth(int index) const;
+  void set_max_codegen_loop_depth(int index, int32_t value);
+  void add_max_codegen_loop_depth(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      max_codegen_loop_depth() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_max_codegen_loop_depth();
+
+  // optional uint32 moduleSize = 3;
+  bool has_modulesize() const;
+  private:
+  bool _internal_has_modulesize() const;
+  public:
+  void clear_modulesize();
+  uint32_t modulesize() const;
+  void set_modulesize(uint32_t value);
+  private:
+  uint32_t _internal_modulesize() const;
+  void _internal_set_modulesize(uint32_t value);
+  public:
+
+  // optional bool optimize_schedule = 4;
+  bool has_optimize_schedule() const;
+  private:
+  bool _internal_has_optimize_schedule() const;
+  public:
+  void clear_optimize_schedule();
+  bool optimize_schedule() const;
+  void set_optimize_schedule(bool value);
+  private:
+  bool _internal_optimize_schedule() const;
+  void _internal_set_optimize_schedule(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RCRS_Analysis)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > max_scop_loop_depth_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > max_codegen_loop_depth_;
+    uint32_t modulesize_;
+    bool optimize_schedule_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Message_RSRC_Analysis final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.Message_RSRC_Analysis) */ {
+ public:
+  inline Message_RSRC_Analysis() : Message_RSRC_Analysis(nullptr) {}
+  ~Message_RSRC_Analysis() override;
+  explicit PROTOBUF_CONSTEXPR Message_RSRC_Analysis(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message_RSRC_Analysis(const Message_RSRC_Analysis& from);
+  Message_RSRC_Analysis(Message_RSRC_Analysis&& from) noexcept
+    : Message_RSRC_Analysis() {
+    *this = ::std::move(from);
+  }
+
+  inline Message_RSRC_Analysis& operator=(const Message_RSRC_Analysis& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message_RSRC_Analysis& operator=(Message_RSRC_Analysis&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message_RSRC_Analysis& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message_RSRC_Analysis* internal_default_instance() {
+    return reinterpret_cast<const Message_RSRC_Analysis*>(
+               &_Message_RSRC_Analysis_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(Message_RSRC_Analysis& a, Message_RSRC_Analysis& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message_RSRC_Analysis* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message_RSRC_Analysis* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message_RSRC_Analysis* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message_RSRC_Analysis>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message_RSRC_Analysis& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message_RSRC_Analysis& from) {
+    Message_RSRC_Analysis::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message_RSRC_Analysis* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.Message_RSRC_Analysis";
+  }
+  protected:
+  explicit Message_RSRC_Analysis(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultSizeFieldNumber = 1,
+  };
+  // optional uint32 resultSize = 1;
+  bool has_resultsize() const;
+  private:
+  bool _internal_has_resultsize() const;
+  public:
+  void clear_resultsize();
+  uint32_t resultsize() const;
+  void set_resultsize(uint32_t value);
+  private:
+  uint32_t _internal_resultsize() const;
+  void _internal_set_resultsize(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.Message_RSRC_Analysis)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t resultsize_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScopAnalysisResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:HTROP_PB.ScopAnalysisResult) */ {
+ public:
+  inline ScopAnalysisResult() : ScopAnalysisResult(nullptr) {}
+  ~ScopAnalysisResult() override;
+  explicit PROTOBUF_CONSTEXPR ScopAnalysisResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScopAnalysisResult(const ScopAnalysisResult& from);
+  ScopAnalysisResult(ScopAnalysisResult&& from) noexcept
+    : ScopAnalysisResult() {
+    *this = ::std::move(from);
+  }
+
+  inline ScopAnalysisResult& operator=(const ScopAnalysisResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScopAnalysisResult& operator=(ScopAnalysisResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScopAnalysisResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScopAnalysisResult* internal_default_instance() {
+    return reinterpret_cast<const ScopAnalysisResult*>(
+               &_ScopAnalysisResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(ScopAnalysisResult& a, ScopAnalysisResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScopAnalysisResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScopAnalysisResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScopAnalysisResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScopAnalysisResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScopAnalysisResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScopAnalysisResult& from) {
+    ScopAnalysisResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScopAnalysisResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HTROP_PB.ScopAnalysisResult";
+  }
+  protected:
+  explicit ScopAnalysisResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kScopsFieldNumber = 1,
+    kCodeGenFieldNumber = 2,
+  };
+  // repeated .HTROP_PB.ScopAnalysisInfo scops = 1;
+  int scops_size() const;
+  private:
+  int _internal_scops_size() const;
+  public:
+  void clear_scops();
+  ::HTROP_PB::ScopAnalysisInfo* mutable_scops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopAnalysisInfo >*
+      mutable_scops();
+  private:
+  const ::HTROP_PB::ScopAnalysisInfo& _internal_scops(int index) const;
+  ::HTROP_PB::ScopAnalysisInfo* _internal_add_scops();
+  public:
+  const ::HTROP_PB::ScopAnalysisInfo& scops(int index) const;
+  ::HTROP_PB::ScopAnalysisInfo* add_scops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopAnalysisInfo >&
+      scops() const;
+
+  // optional .HTROP_PB.Message_RSRC codeGen = 2;
+  bool has_codegen() const;
+  private:
+  bool _internal_has_codegen() const;
+  public:
+  void clear_codegen();
+  const ::HTROP_PB::Message_RSRC& codegen() const;
+  PROTOBUF_NODISCARD ::HTROP_PB::Message_RSRC* release_codegen();
+  ::HTROP_PB::Message_RSRC* mutable_codegen();
+  void set_allocated_codegen(::HTROP_PB::Message_RSRC* codegen);
+  private:
+  const ::HTROP_PB::Message_RSRC& _internal_codegen() const;
+  ::HTROP_PB::Message_RSRC* _internal_mutable_codegen();
+  public:
+  void unsafe_arena_set_allocated_codegen(
+      ::HTROP_PB::Message_RSRC* codegen);
+  ::HTROP_PB::Message_RSRC* unsafe_arena_release_codegen();
+
+  // @@protoc_insertion_point(class_scope:HTROP_PB.ScopAnalysisResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopAnalysisInfo > scops_;
+    ::HTROP_PB::Message_RSRC* codegen_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hds_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// LLVM_IR_Req
+
+// -------------------------------------------------------------------
+
+// BinaryData
+
+// optional bytes binary_data = 1;
+inline bool BinaryData::_internal_has_binary_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BinaryData::has_binary_data() const {
+  return _internal_has_binary_data();
+}
+inline void BinaryData::clear_binary_data() {
+  _impl_.binary_data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BinaryData::binary_data() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.BinaryData.binary_data)
+  return _internal_binary_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BinaryData::set_binary_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.binary_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HTROP_PB.BinaryData.binary_data)
+}
+inline std::string* BinaryData::mutable_binary_data() {
+  std::string* _s = _internal_mutable_binary_data();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.BinaryData.binary_data)
+  return _s;
+}
+inline const std::string& BinaryData::_internal_binary_data() const {
+  return _impl_.binary_data_.Get();
+}
+inline void BinaryData::_internal_set_binary_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.binary_data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BinaryData::_internal_mutable_binary_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.binary_data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BinaryData::release_binary_data() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.BinaryData.binary_data)
+  if (!_internal_has_binary_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.binary_data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.binary_data_.IsDefault()) {
+    _impl_.binary_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BinaryData::set_allocated_binary_data(std::string* binary_data) {
+  if (binary_data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.binary_data_.SetAllocated(binary_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.binary_data_.IsDefault()) {
+    _impl_.binary_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.BinaryData.binary_data)
+}
+
+// -------------------------------------------------------------------
+
+// ReductionHint
+
+// optional uint32 arg_position = 1;
+inline bool ReductionHint::_internal_has_arg_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReductionHint::has_arg_position() const {
+  return _internal_has_arg_position();
+}
+inline void ReductionHint::clear_arg_position() {
+  _impl_.arg_position_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t ReductionHint::_internal_arg_position() const {
+  return _impl_.arg_position_;
+}
+inline uint32_t ReductionHint::arg_position() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ReductionHint.arg_position)
+  return _internal_arg_position();
+}
+inline void ReductionHint::_internal_set_arg_position(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.arg_position_ = value;
+}
+inline void ReductionHint::set_arg_position(uint32_t value) {
+  _internal_set_arg_position(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ReductionHint.arg_position)
+}
+
+// optional uint32 loop_depth = 2;
+inline bool ReductionHint::_internal_has_loop_depth() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ReductionHint::has_loop_depth() const {
+  return _internal_has_loop_depth();
+}
+inline void ReductionHint::clear_loop_depth() {
+  _impl_.loop_depth_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t ReductionHint::_internal_loop_depth() const {
+  return _impl_.loop_depth_;
+}
+inline uint32_t ReductionHint::loop_depth() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ReductionHint.loop_depth)
+  return _internal_loop_depth();
+}
+inline void ReductionHint::_internal_set_loop_depth(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.loop_depth_ = value;
+}
+inline void ReductionHint::set_loop_depth(uint32_t value) {
+  _internal_set_loop_depth(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ReductionHint.loop_depth)
+}
+
+// optional int32 reduction_operator = 3;
+inline bool ReductionHint::_internal_has_reduction_operator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ReductionHint::has_reduction_operator() const {
+  return _internal_has_reduction_operator();
+}
+inline void ReductionHint::clear_reduction_operator() {
+  _impl_.reduction_operator_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t ReductionHint::_internal_reduction_operator() const {
+  return _impl_.reduction_operator_;
+}
+inline int32_t ReductionHint::reduction_operator() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ReductionHint.reduction_operator)
+  return _internal_reduction_operator();
+}
+inline void ReductionHint::_internal_set_reduction_operator(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.reduction_operator_ = value;
+}
+inline void ReductionHint::set_reduction_operator(int32_t value) {
+  _internal_set_reduction_operator(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ReductionHint.reduction_operator)
+}
+
+// -------------------------------------------------------------------
+
+// ScatterHint
+
+// optional uint32 arg_position = 1;
+inline bool ScatterHint::_internal_has_arg_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ScatterHint::has_arg_position() const {
+  return _internal_has_arg_position();
+}
+inline void ScatterHint::clear_arg_position() {
+  _impl_.arg_position_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t ScatterHint::_internal_arg_position() const {
+  return _impl_.arg_position_;
+}
+inline uint32_t ScatterHint::arg_position() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScatterHint.arg_position)
+  return _internal_arg_position();
+}
+inline void ScatterHint::_internal_set_arg_position(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.arg_position_ = value;
+}
+inline void ScatterHint::set_arg_position(uint32_t value) {
+  _internal_set_arg_position(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScatterHint.arg_position)
+}
+
+// optional int32 scatter_operator = 2;
+inline bool ScatterHint::_internal_has_scatter_operator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ScatterHint::has_scatter_operator() const {
+  return _internal_has_scatter_operator();
+}
+inline void ScatterHint::clear_scatter_operator() {
+  _impl_.scatter_operator_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t ScatterHint::_internal_scatter_operator() const {
+  return _impl_.scatter_operator_;
+}
+inline int32_t ScatterHint::scatter_operator() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScatterHint.scatter_operator)
+  return _internal_scatter_operator();
+}
+inline void ScatterHint::_internal_set_scatter_operator(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.scatter_operator_ = value;
+}
+inline void ScatterHint::set_scatter_operator(int32_t value) {
+  _internal_set_scatter_operator(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScatterHint.scatter_operator)
+}
+
+// optional uint64 num_elements = 3;
+inline bool ScatterHint::_internal_has_num_elements() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ScatterHint::has_num_elements() const {
+  return _internal_has_num_elements();
+}
+inline void ScatterHint::clear_num_elements() {
+  _impl_.num_elements_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ScatterHint::_internal_num_elements() const {
+  return _impl_.num_elements_;
+}
+inline uint64_t ScatterHint::num_elements() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScatterHint.num_elements)
+  return _internal_num_elements();
+}
+inline void ScatterHint::_internal_set_num_elements(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.num_elements_ = value;
+}
+inline void ScatterHint::set_num_elements(uint64_t value) {
+  _internal_set_num_elements(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScatterHint.num_elements)
+}
+
+// -------------------------------------------------------------------
+
+// ReadOnlyArgHint
+
+// optional uint32 arg_position = 1;
+inline bool ReadOnlyArgHint::_internal_has_arg_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ReadOnlyArgHint::has_arg_position() const {
+  return _internal_has_arg_position();
+}
+inline void ReadOnlyArgHint::clear_arg_position() {
+  _impl_.arg_position_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t ReadOnlyArgHint::_internal_arg_position() const {
+  return _impl_.arg_position_;
+}
+inline uint32_t ReadOnlyArgHint::arg_position() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ReadOnlyArgHint.arg_position)
+  return _internal_arg_position();
+}
+inline void ReadOnlyArgHint::_internal_set_arg_position(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.arg_position_ = value;
+}
+inline void ReadOnlyArgHint::set_arg_position(uint32_t value) {
+  _internal_set_arg_position(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ReadOnlyArgHint.arg_position)
+}
+
+// optional uint64 num_elements = 2;
+inline bool ReadOnlyArgHint::_internal_has_num_elements() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReadOnlyArgHint::has_num_elements() const {
+  return _internal_has_num_elements();
+}
+inline void ReadOnlyArgHint::clear_num_elements() {
+  _impl_.num_elements_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t ReadOnlyArgHint::_internal_num_elements() const {
+  return _impl_.num_elements_;
+}
+inline uint64_t ReadOnlyArgHint::num_elements() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ReadOnlyArgHint.num_elements)
+  return _internal_num_elements();
+}
+inline void ReadOnlyArgHint::_internal_set_num_elements(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.num_elements_ = value;
+}
+inline void ReadOnlyArgHint::set_num_elements(uint64_t value) {
+  _internal_set_num_elements(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ReadOnlyArgHint.num_elements)
+}
+
+// -------------------------------------------------------------------
+
+// Message_RCRS_ScopInfo
+
+// optional string scopFunctionName = 1;
+inline bool Message_RCRS_ScopInfo::_internal_has_scopfunctionname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Message_RCRS_ScopInfo::has_scopfunctionname() const {
+  return _internal_has_scopfunctionname();
+}
+inline void Message_RCRS_ScopInfo::clear_scopfunctionname() {
+  _impl_.scopfunctionname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Message_RCRS_ScopInfo::scopfunctionname() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
+  return _internal_scopfunctionname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message_RCRS_ScopInfo::set_scopfunctionname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.scopfunctionname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
+}
+inline std::string* Message_RCRS_ScopInfo::mutable_scopfunctionname() {
+  std::string* _s = _internal_mutable_scopfunctionname();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
+  return _s;
+}
+inline const std::string& Message_RCRS_ScopInfo::_internal_scopfunctionname() const {
+  return _impl_.scopfunctionname_.Get();
+}
+inline void Message_RCRS_ScopInfo::_internal_set_scopfunctionname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.scopfunctionname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message_RCRS_ScopInfo::_internal_mutable_scopfunctionname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.scopfunctionname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message_RCRS_ScopInfo::release_scopfunctionname() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
+  if (!_internal_has_scopfunctionname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.scopfunctionname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopfunctionname_.IsDefault()) {
+    _impl_.scopfunctionname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Message_RCRS_ScopInfo::set_allocated_scopfunctionname(std::string* scopfunctionname) {
+  if (scopfunctionname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.scopfunctionname_.SetAllocated(scopfunctionname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopfunctionname_.IsDefault()) {
+    _impl_.scopfunctionname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
+}
+
+// optional uint32 max_codegen_loop_depth = 2;
+inline bool Message_RCRS_ScopInfo::_internal_has_max_codegen_loop_depth() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Message_RCRS_ScopInfo::has_max_codegen_loop_depth() const {
+  return _internal_has_max_codegen_loop_depth();
+}
+inline void Message_RCRS_ScopInfo::clear_max_codegen_loop_depth() {
+  _impl_.max_codegen_loop_depth_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t Message_RCRS_ScopInfo::_internal_max_codegen_loop_depth() const {
+  return _impl_.max_codegen_loop_depth_;
+}
+inline uint32_t Message_RCRS_ScopInfo::max_codegen_loop_depth() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.max_codegen_loop_depth)
+  return _internal_max_codegen_loop_depth();
+}
+inline void Message_RCRS_ScopInfo::_internal_set_max_codegen_loop_depth(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.max_codegen_loop_depth_ = value;
+}
+inline void Message_RCRS_ScopInfo::set_max_codegen_loop_depth(uint32_t value) {
+  _internal_set_max_codegen_loop_depth(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.ScopInfo.max_codegen_loop_depth)
+}
+
+// optional .HTROP_PB.ReductionHint reduction = 3;
+inline bool Message_RCRS_ScopInfo::_internal_has_reduction() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.reduction_ != nullptr);
+  return value;
+}
+inline bool Message_RCRS_ScopInfo::has_reduction() const {
+  return _internal_has_reduction();
+}
+inline void Message_RCRS_ScopInfo::clear_reduction() {
+  if (_impl_.reduction_ != nullptr) _impl_.reduction_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::HTROP_PB::ReductionHint& Message_RCRS_ScopInfo::_internal_reduction() const {
+  const ::HTROP_PB::ReductionHint* p = _impl_.reduction_;
+  return p != nullptr ? *p : reinterpret_cast<const ::HTROP_PB::ReductionHint&>(
+      ::HTROP_PB::_ReductionHint_default_instance_);
+}
+inline const ::HTROP_PB::ReductionHint& Message_RCRS_ScopInfo::reduction() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.reduction)
+  return _internal_reduction();
+}
+inline void Message_RCRS_ScopInfo::unsafe_arena_set_allocated_reduction(
+    ::HTROP_PB::ReductionHint* reduction) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.reduction_);
+  }
+  _impl_.reduction_ = reduction;
+  if (reduction) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:HTROP_PB.Message_RCRS.ScopInfo.reduction)
+}
+inline ::HTROP_PB::ReductionHint* Message_RCRS_ScopInfo::release_reduction() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::HTROP_PB::ReductionHint* temp = _impl_.reduction_;
+  _impl_.reduction_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::HTROP_PB::ReductionHint* Message_RCRS_ScopInfo::unsafe_arena_release_reduction() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RCRS.ScopInfo.reduction)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::HTROP_PB::ReductionHint* temp = _impl_.reduction_;
+  _impl_.reduction_ = nullptr;
+  return temp;
+}
+inline ::HTROP_PB::ReductionHint* Message_RCRS_ScopInfo::_internal_mutable_reduction() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.reduction_ == nullptr) {
+    auto* p = CreateMaybeMessage<::HTROP_PB::ReductionHint>(GetArenaForAllocation());
+    _impl_.reduction_ = p;
+  }
+  return _impl_.reduction_;
+}
+inline ::HTROP_PB::ReductionHint* Message_RCRS_ScopInfo::mutable_reduction() {
+  ::HTROP_PB::ReductionHint* _msg = _internal_mutable_reduction();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.ScopInfo.reduction)
+  return _msg;
+}
+inline void Message_RCRS_ScopInfo::set_allocated_reduction(::HTROP_PB::ReductionHint* reduction) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.reduction_;
+  }
+  if (reduction) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reduction);
+    if (message_arena != submessage_arena) {
+      reduction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reduction, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.reduction_ = reduction;
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RCRS.ScopInfo.reduction)
+}
+
+// optional uint32 num_loop_trip_counts = 4;
+inline bool Message_RCRS_ScopInfo::_internal_has_num_loop_trip_counts() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Message_RCRS_ScopInfo::has_num_loop_trip_counts() const {
+  return _internal_has_num_loop_trip_counts();
+}
+inline void Message_RCRS_ScopInfo::clear_num_loop_trip_counts() {
+  _impl_.num_loop_trip_counts_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t Message_RCRS_ScopInfo::_internal_num_loop_trip_counts() const {
+  return _impl_.num_loop_trip_counts_;
+}
+inline uint32_t Message_RCRS_ScopInfo::num_loop_trip_counts() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.num_loop_trip_counts)
+  return _internal_num_loop_trip_counts();
+}
+inline void Message_RCRS_ScopInfo::_internal_set_num_loop_trip_counts(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.num_loop_trip_counts_ = value;
+}
+inline void Message_RCRS_ScopInfo::set_num_loop_trip_counts(uint32_t value) {
+  _internal_set_num_loop_trip_counts(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.ScopInfo.num_loop_trip_counts)
+}
+
+// repeated .HTROP_PB.ReadOnlyArgHint read_only_args = 5;
+inline int Message_RCRS_ScopInfo::_internal_read_only_args_size() const {
+  return _impl_.read_only_args_.size();
+}
+inline int Message_RCRS_ScopInfo::read_only_args_size() const {
+  return _internal_read_only_args_size();
+}
+inline void Message_RCRS_ScopInfo::clear_read_only_args() {
+  _impl_.read_only_args_.Clear();
+}
+inline ::HTROP_PB::ReadOnlyArgHint* Message_RCRS_ScopInfo::mutable_read_only_args(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.ScopInfo.read_only_args)
+  return _impl_.read_only_args_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ReadOnlyArgHint >*
+Message_RCRS_ScopInfo::mutable_read_only_args() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RCRS.ScopInfo.read_only_args)
+  return &_impl_.read_only_args_;
+}
+inline const ::HTROP_PB::ReadOnlyArgHint& Message_RCRS_ScopInfo::_internal_read_only_args(int index) const {
+  return _impl_.read_only_args_.Get(index);
+}
+inline const ::HTROP_PB::ReadOnlyArgHint& Message_RCRS_ScopInfo::read_only_args(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.read_only_args)
+  return _internal_read_only_args(index);
+}
+inline ::HTROP_PB::ReadOnlyArgHint* Message_RCRS_ScopInfo::_internal_add_read_only_args() {
+  return _impl_.read_only_args_.Add();
+}
+inline ::HTROP_PB::ReadOnlyArgHint* Message_RCRS_ScopInfo::add_read_only_args() {
+  ::HTROP_PB::ReadOnlyArgHint* _add = _internal_add_read_only_args();
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RCRS.ScopInfo.read_only_args)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ReadOnlyArgHint >&
+Message_RCRS_ScopInfo::read_only_args() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RCRS.ScopInfo.read_only_args)
+  return _impl_.read_only_args_;
+}
+
+// repeated string fused_functions = 6;
+inline int Message_RCRS_ScopInfo::_internal_fused_functions_size() const {
+  return _impl_.fused_functions_.size();
+}
+inline int Message_RCRS_ScopInfo::fused_functions_size() const {
+  return _internal_fused_functions_size();
+}
+inline void Message_RCRS_ScopInfo::clear_fused_functions() {
+  _impl_.fused_functions_.Clear();
+}
+inline std::string* Message_RCRS_ScopInfo::add_fused_functions() {
+  std::string* _s = _internal_add_fused_functions();
+  // @@protoc_insertion_point(field_add_mutable:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+  return _s;
+}
+inline const std::string& Message_RCRS_ScopInfo::_internal_fused_functions(int index) const {
+  return _impl_.fused_functions_.Get(index);
+}
+inline const std::string& Message_RCRS_ScopInfo::fused_functions(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+  return _internal_fused_functions(index);
+}
+inline std::string* Message_RCRS_ScopInfo::mutable_fused_functions(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+  return _impl_.fused_functions_.Mutable(index);
+}
+inline void Message_RCRS_ScopInfo::set_fused_functions(int index, const std::string& value) {
+  _impl_.fused_functions_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+}
+inline void Message_RCRS_ScopInfo::set_fused_functions(int index, std::string&& value) {
+  _impl_.fused_functions_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+}
+inline void Message_RCRS_ScopInfo::set_fused_functions(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.fused_functions_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+}
+inline void Message_RCRS_ScopInfo::set_fused_functions(int index, const char* value, size_t size) {
+  _impl_.fused_functions_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+}
+inline std::string* Message_RCRS_ScopInfo::_internal_add_fused_functions() {
+  return _impl_.fused_functions_.Add();
+}
+inline void Message_RCRS_ScopInfo::add_fused_functions(const std::string& value) {
+  _impl_.fused_functions_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+}
+inline void Message_RCRS_ScopInfo::add_fused_functions(std::string&& value) {
+  _impl_.fused_functions_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+}
+inline void Message_RCRS_ScopInfo::add_fused_functions(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.fused_functions_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+}
+inline void Message_RCRS_ScopInfo::add_fused_functions(const char* value, size_t size) {
+  _impl_.fused_functions_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Message_RCRS_ScopInfo::fused_functions() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+  return _impl_.fused_functions_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Message_RCRS_ScopInfo::mutable_fused_functions() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RCRS.ScopInfo.fused_functions)
+  return &_impl_.fused_functions_;
+}
+
+// repeated uint32 fused_tmp_args = 7;
+inline int Message_RCRS_ScopInfo::_internal_fused_tmp_args_size() const {
+  return _impl_.fused_tmp_args_.size();
+}
+inline int Message_RCRS_ScopInfo::fused_tmp_args_size() const {
+  return _internal_fused_tmp_args_size();
+}
+inline void Message_RCRS_ScopInfo::clear_fused_tmp_args() {
+  _impl_.fused_tmp_args_.Clear();
+}
+inline uint32_t Message_RCRS_ScopInfo::_internal_fused_tmp_args(int index) const {
+  return _impl_.fused_tmp_args_.Get(index);
+}
+inline uint32_t Message_RCRS_ScopInfo::fused_tmp_args(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.fused_tmp_args)
+  return _internal_fused_tmp_args(index);
+}
+inline void Message_RCRS_ScopInfo::set_fused_tmp_args(int index, uint32_t value) {
+  _impl_.fused_tmp_args_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.ScopInfo.fused_tmp_args)
+}
+inline void Message_RCRS_ScopInfo::_internal_add_fused_tmp_args(uint32_t value) {
+  _impl_.fused_tmp_args_.Add(value);
+}
+inline void Message_RCRS_ScopInfo::add_fused_tmp_args(uint32_t value) {
+  _internal_add_fused_tmp_args(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RCRS.ScopInfo.fused_tmp_args)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Message_RCRS_ScopInfo::_internal_fused_tmp_args() const {
+  return _impl_.fused_tmp_args_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Message_RCRS_ScopInfo::fused_tmp_args() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RCRS.ScopInfo.fused_tmp_args)
+  return _internal_fused_tmp_args();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Message_RCRS_ScopInfo::_internal_mutable_fused_tmp_args() {
+  return &_impl_.fused_tmp_args_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Message_RCRS_ScopInfo::mutable_fused_tmp_args() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RCRS.ScopInfo.fused_tmp_args)
+  return _internal_mutable_fused_tmp_args();
+}
+
+// optional uint32 wavefront_skew = 8;
+inline bool Message_RCRS_ScopInfo::_internal_has_wavefront_skew() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Message_RCRS_ScopInfo::has_wavefront_skew() const {
+  return _internal_has_wavefront_skew();
+}
+inline void Message_RCRS_ScopInfo::clear_wavefront_skew() {
+  _impl_.wavefront_skew_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t Message_RCRS_ScopInfo::_internal_wavefront_skew() const {
+  return _impl_.wavefront_skew_;
+}
+inline uint32_t Message_RCRS_ScopInfo::wavefront_skew() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.wavefront_skew)
+  return _internal_wavefront_skew();
+}
+inline void Message_RCRS_ScopInfo::_internal_set_wavefront_skew(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.wavefront_skew_ = value;
+}
+inline void Message_RCRS_ScopInfo::set_wavefront_skew(uint32_t value) {
+  _internal_set_wavefront_skew(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.ScopInfo.wavefront_skew)
+}
+
+// optional .HTROP_PB.ScatterHint scatter = 9;
+inline bool Message_RCRS_ScopInfo::_internal_has_scatter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.scatter_ != nullptr);
+  return value;
+}
+inline bool Message_RCRS_ScopInfo::has_scatter() const {
+  return _internal_has_scatter();
+}
+inline void Message_RCRS_ScopInfo::clear_scatter() {
+  if (_impl_.scatter_ != nullptr) _impl_.scatter_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::HTROP_PB::ScatterHint& Message_RCRS_ScopInfo::_internal_scatter() const {
+  const ::HTROP_PB::ScatterHint* p = _impl_.scatter_;
+  return p != nullptr ? *p : reinterpret_cast<const ::HTROP_PB::ScatterHint&>(
+      ::HTROP_PB::_ScatterHint_default_instance_);
+}
+inline const ::HTROP_PB::ScatterHint& Message_RCRS_ScopInfo::scatter() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.scatter)
+  return _internal_scatter();
+}
+inline void Message_RCRS_ScopInfo::unsafe_arena_set_allocated_scatter(
+    ::HTROP_PB::ScatterHint* scatter) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.scatter_);
+  }
+  _impl_.scatter_ = scatter;
+  if (scatter) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:HTROP_PB.Message_RCRS.ScopInfo.scatter)
+}
+inline ::HTROP_PB::ScatterHint* Message_RCRS_ScopInfo::release_scatter() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::HTROP_PB::ScatterHint* temp = _impl_.scatter_;
+  _impl_.scatter_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::HTROP_PB::ScatterHint* Message_RCRS_ScopInfo::unsafe_arena_release_scatter() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RCRS.ScopInfo.scatter)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::HTROP_PB::ScatterHint* temp = _impl_.scatter_;
+  _impl_.scatter_ = nullptr;
+  return temp;
+}
+inline ::HTROP_PB::ScatterHint* Message_RCRS_ScopInfo::_internal_mutable_scatter() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.scatter_ == nullptr) {
+    auto* p = CreateMaybeMessage<::HTROP_PB::ScatterHint>(GetArenaForAllocation());
+    _impl_.scatter_ = p;
+  }
+  return _impl_.scatter_;
+}
+inline ::HTROP_PB::ScatterHint* Message_RCRS_ScopInfo::mutable_scatter() {
+  ::HTROP_PB::ScatterHint* _msg = _internal_mutable_scatter();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.ScopInfo.scatter)
+  return _msg;
+}
+inline void Message_RCRS_ScopInfo::set_allocated_scatter(::HTROP_PB::ScatterHint* scatter) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.scatter_;
+  }
+  if (scatter) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(scatter);
+    if (message_arena != submessage_arena) {
+      scatter = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, scatter, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.scatter_ = scatter;
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RCRS.ScopInfo.scatter)
+}
+
+// -------------------------------------------------------------------
+
+// Message_RCRS
+
+// repeated .HTROP_PB.Message_RCRS.ScopInfo scopList = 1;
+inline int Message_RCRS::_internal_scoplist_size() const {
+  return _impl_.scoplist_.size();
+}
+inline int Message_RCRS::scoplist_size() const {
+  return _internal_scoplist_size();
+}
+inline void Message_RCRS::clear_scoplist() {
+  _impl_.scoplist_.Clear();
+}
+inline ::HTROP_PB::Message_RCRS_ScopInfo* Message_RCRS::mutable_scoplist(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.scopList)
+  return _impl_.scoplist_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RCRS_ScopInfo >*
+Message_RCRS::mutable_scoplist() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RCRS.scopList)
+  return &_impl_.scoplist_;
+}
+inline const ::HTROP_PB::Message_RCRS_ScopInfo& Message_RCRS::_internal_scoplist(int index) const {
+  return _impl_.scoplist_.Get(index);
+}
+inline const ::HTROP_PB::Message_RCRS_ScopInfo& Message_RCRS::scoplist(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.scopList)
+  return _internal_scoplist(index);
+}
+inline ::HTROP_PB::Message_RCRS_ScopInfo* Message_RCRS::_internal_add_scoplist() {
+  return _impl_.scoplist_.Add();
+}
+inline ::HTROP_PB::Message_RCRS_ScopInfo* Message_RCRS::add_scoplist() {
+  ::HTROP_PB::Message_RCRS_ScopInfo* _add = _internal_add_scoplist();
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RCRS.scopList)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RCRS_ScopInfo >&
+Message_RCRS::scoplist() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RCRS.scopList)
+  return _impl_.scoplist_;
+}
+
+// optional string scopFunctionParentName = 2;
+inline bool Message_RCRS::_internal_has_scopfunctionparentname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Message_RCRS::has_scopfunctionparentname() const {
+  return _internal_has_scopfunctionparentname();
+}
+inline void Message_RCRS::clear_scopfunctionparentname() {
+  _impl_.scopfunctionparentname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Message_RCRS::scopfunctionparentname() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.scopFunctionParentName)
+  return _internal_scopfunctionparentname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message_RCRS::set_scopfunctionparentname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.scopfunctionparentname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.scopFunctionParentName)
+}
+inline std::string* Message_RCRS::mutable_scopfunctionparentname() {
+  std::string* _s = _internal_mutable_scopfunctionparentname();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.scopFunctionParentName)
+  return _s;
+}
+inline const std::string& Message_RCRS::_internal_scopfunctionparentname() const {
+  return _impl_.scopfunctionparentname_.Get();
+}
+inline void Message_RCRS::_internal_set_scopfunctionparentname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.scopfunctionparentname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message_RCRS::_internal_mutable_scopfunctionparentname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.scopfunctionparentname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message_RCRS::release_scopfunctionparentname() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RCRS.scopFunctionParentName)
+  if (!_internal_has_scopfunctionparentname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.scopfunctionparentname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopfunctionparentname_.IsDefault()) {
+    _impl_.scopfunctionparentname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Message_RCRS::set_allocated_scopfunctionparentname(std::string* scopfunctionparentname) {
+  if (scopfunctionparentname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.scopfunctionparentname_.SetAllocated(scopfunctionparentname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopfunctionparentname_.IsDefault()) {
+    _impl_.scopfunctionparentname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RCRS.scopFunctionParentName)
+}
+
+// optional fixed64 module_hash = 3;
+inline bool Message_RCRS::_internal_has_module_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Message_RCRS::has_module_hash() const {
+  return _internal_has_module_hash();
+}
+inline void Message_RCRS::clear_module_hash() {
+  _impl_.module_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t Message_RCRS::_internal_module_hash() const {
+  return _impl_.module_hash_;
+}
+inline uint64_t Message_RCRS::module_hash() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.module_hash)
+  return _internal_module_hash();
+}
+inline void Message_RCRS::_internal_set_module_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.module_hash_ = value;
+}
+inline void Message_RCRS::set_module_hash(uint64_t value) {
+  _internal_set_module_hash(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.module_hash)
+}
+
+// -------------------------------------------------------------------
+
+// Message_RSRC_WorkItemFactor
+
+// optional uint32 dimension = 1;
+inline bool Message_RSRC_WorkItemFactor::_internal_has_dimension() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Message_RSRC_WorkItemFactor::has_dimension() const {
+  return _internal_has_dimension();
+}
+inline void Message_RSRC_WorkItemFactor::clear_dimension() {
+  _impl_.dimension_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t Message_RSRC_WorkItemFactor::_internal_dimension() const {
+  return _impl_.dimension_;
+}
+inline uint32_t Message_RSRC_WorkItemFactor::dimension() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.WorkItemFactor.dimension)
+  return _internal_dimension();
+}
+inline void Message_RSRC_WorkItemFactor::_internal_set_dimension(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.dimension_ = value;
+}
+inline void Message_RSRC_WorkItemFactor::set_dimension(uint32_t value) {
+  _internal_set_dimension(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.WorkItemFactor.dimension)
+}
+
+// optional uint32 factor_mcpu = 2;
+inline bool Message_RSRC_WorkItemFactor::_internal_has_factor_mcpu() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Message_RSRC_WorkItemFactor::has_factor_mcpu() const {
+  return _internal_has_factor_mcpu();
+}
+inline void Message_RSRC_WorkItemFactor::clear_factor_mcpu() {
+  _impl_.factor_mcpu_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t Message_RSRC_WorkItemFactor::_internal_factor_mcpu() const {
+  return _impl_.factor_mcpu_;
+}
+inline uint32_t Message_RSRC_WorkItemFactor::factor_mcpu() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.WorkItemFactor.factor_mcpu)
+  return _internal_factor_mcpu();
+}
+inline void Message_RSRC_WorkItemFactor::_internal_set_factor_mcpu(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.factor_mcpu_ = value;
+}
+inline void Message_RSRC_WorkItemFactor::set_factor_mcpu(uint32_t value) {
+  _internal_set_factor_mcpu(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.WorkItemFactor.factor_mcpu)
+}
+
+// optional uint32 factor_gpu = 3;
+inline bool Message_RSRC_WorkItemFactor::_internal_has_factor_gpu() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Message_RSRC_WorkItemFactor::has_factor_gpu() const {
+  return _internal_has_factor_gpu();
+}
+inline void Message_RSRC_WorkItemFactor::clear_factor_gpu() {
+  _impl_.factor_gpu_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t Message_RSRC_WorkItemFactor::_internal_factor_gpu() const {
+  return _impl_.factor_gpu_;
+}
+inline uint32_t Message_RSRC_WorkItemFactor::factor_gpu() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.WorkItemFactor.factor_gpu)
+  return _internal_factor_gpu();
+}
+inline void Message_RSRC_WorkItemFactor::_internal_set_factor_gpu(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.factor_gpu_ = value;
+}
+inline void Message_RSRC_WorkItemFactor::set_factor_gpu(uint32_t value) {
+  _internal_set_factor_gpu(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.WorkItemFactor.factor_gpu)
+}
+
+// optional uint32 factor_mic = 4;
+inline bool Message_RSRC_WorkItemFactor::_internal_has_factor_mic() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Message_RSRC_WorkItemFactor::has_factor_mic() const {
+  return _internal_has_factor_mic();
+}
+inline void Message_RSRC_WorkItemFactor::clear_factor_mic() {
+  _impl_.factor_mic_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t Message_RSRC_WorkItemFactor::_internal_factor_mic() const {
+  return _impl_.factor_mic_;
+}
+inline uint32_t Message_RSRC_WorkItemFactor::factor_mic() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.WorkItemFactor.factor_mic)
+  return _internal_factor_mic();
+}
+inline void Message_RSRC_WorkItemFactor::_internal_set_factor_mic(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.factor_mic_ = value;
+}
+inline void Message_RSRC_WorkItemFactor::set_factor_mic(uint32_t value) {
+  _internal_set_factor_mic(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.WorkItemFactor.factor_mic)
+}
+
+// -------------------------------------------------------------------
+
+// Message_RSRC_Reduction
+
+// optional uint32 arg_position = 1;
+inline bool Message_RSRC_Reduction::_internal_has_arg_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Message_RSRC_Reduction::has_arg_position() const {
+  return _internal_has_arg_position();
+}
+inline void Message_RSRC_Reduction::clear_arg_position() {
+  _impl_.arg_position_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t Message_RSRC_Reduction::_internal_arg_position() const {
+  return _impl_.arg_position_;
+}
+inline uint32_t Message_RSRC_Reduction::arg_position() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.Reduction.arg_position)
+  return _internal_arg_position();
+}
+inline void Message_RSRC_Reduction::_internal_set_arg_position(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.arg_position_ = value;
+}
+inline void Message_RSRC_Reduction::set_arg_position(uint32_t value) {
+  _internal_set_arg_position(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.Reduction.arg_position)
+}
+
+// optional int32 reduction_operator = 2;
+inline bool Message_RSRC_Reduction::_internal_has_reduction_operator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Message_RSRC_Reduction::has_reduction_operator() const {
+  return _internal_has_reduction_operator();
+}
+inline void Message_RSRC_Reduction::clear_reduction_operator() {
+  _impl_.reduction_operator_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Message_RSRC_Reduction::_internal_reduction_operator() const {
+  return _impl_.reduction_operator_;
+}
+inline int32_t Message_RSRC_Reduction::reduction_operator() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.Reduction.reduction_operator)
+  return _internal_reduction_operator();
+}
+inline void Message_RSRC_Reduction::_internal_set_reduction_operator(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.reduction_operator_ = value;
+}
+inline void Message_RSRC_Reduction::set_reduction_operator(int32_t value) {
+  _internal_set_reduction_operator(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.Reduction.reduction_operator)
+}
+
+// optional bool is_float = 3;
+inline bool Message_RSRC_Reduction::_internal_has_is_float() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Message_RSRC_Reduction::has_is_float() const {
+  return _internal_has_is_float();
+}
+inline void Message_RSRC_Reduction::clear_is_float() {
+  _impl_.is_float_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool Message_RSRC_Reduction::_internal_is_float() const {
+  return _impl_.is_float_;
+}
+inline bool Message_RSRC_Reduction::is_float() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.Reduction.is_float)
+  return _internal_is_float();
+}
+inline void Message_RSRC_Reduction::_internal_set_is_float(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.is_float_ = value;
+}
+inline void Message_RSRC_Reduction::set_is_float(bool value) {
+  _internal_set_is_float(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.Reduction.is_float)
+}
+
+// optional uint32 data_type_size = 4;
+inline bool Message_RSRC_Reduction::_internal_has_data_type_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Message_RSRC_Reduction::has_data_type_size() const {
+  return _internal_has_data_type_size();
+}
+inline void Message_RSRC_Reduction::clear_data_type_size() {
+  _impl_.data_type_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t Message_RSRC_Reduction::_internal_data_type_size() const {
+  return _impl_.data_type_size_;
+}
+inline uint32_t Message_RSRC_Reduction::data_type_size() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.Reduction.data_type_size)
+  return _internal_data_type_size();
+}
+inline void Message_RSRC_Reduction::_internal_set_data_type_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.data_type_size_ = value;
+}
+inline void Message_RSRC_Reduction::set_data_type_size(uint32_t value) {
+  _internal_set_data_type_size(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.Reduction.data_type_size)
+}
+
+// optional uint32 partial_arg_position = 5;
+inline bool Message_RSRC_Reduction::_internal_has_partial_arg_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Message_RSRC_Reduction::has_partial_arg_position() const {
+  return _internal_has_partial_arg_position();
+}
+inline void Message_RSRC_Reduction::clear_partial_arg_position() {
+  _impl_.partial_arg_position_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t Message_RSRC_Reduction::_internal_partial_arg_position() const {
+  return _impl_.partial_arg_position_;
+}
+inline uint32_t Message_RSRC_Reduction::partial_arg_position() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.Reduction.partial_arg_position)
+  return _internal_partial_arg_position();
+}
+inline void Message_RSRC_Reduction::_internal_set_partial_arg_position(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.partial_arg_position_ = value;
+}
+inline void Message_RSRC_Reduction::set_partial_arg_position(uint32_t value) {
+  _internal_set_partial_arg_position(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.Reduction.partial_arg_position)
+}
+
+// -------------------------------------------------------------------
+
+// Message_RSRC_ImageArg
+
+// optional uint32 arg_position = 1;
+inline bool Message_RSRC_ImageArg::_internal_has_arg_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Message_RSRC_ImageArg::has_arg_position() const {
+  return _internal_has_arg_position();
+}
+inline void Message_RSRC_ImageArg::clear_arg_position() {
+  _impl_.arg_position_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t Message_RSRC_ImageArg::_internal_arg_position() const {
+  return _impl_.arg_position_;
+}
+inline uint32_t Message_RSRC_ImageArg::arg_position() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ImageArg.arg_position)
+  return _internal_arg_position();
+}
+inline void Message_RSRC_ImageArg::_internal_set_arg_position(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.arg_position_ = value;
+}
+inline void Message_RSRC_ImageArg::set_arg_position(uint32_t value) {
+  _internal_set_arg_position(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ImageArg.arg_position)
+}
+
+// optional int32 row_width_arg = 2;
+inline bool Message_RSRC_ImageArg::_internal_has_row_width_arg() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Message_RSRC_ImageArg::has_row_width_arg() const {
+  return _internal_has_row_width_arg();
+}
+inline void Message_RSRC_ImageArg::clear_row_width_arg() {
+  _impl_.row_width_arg_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Message_RSRC_ImageArg::_internal_row_width_arg() const {
+  return _impl_.row_width_arg_;
+}
+inline int32_t Message_RSRC_ImageArg::row_width_arg() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ImageArg.row_width_arg)
+  return _internal_row_width_arg();
+}
+inline void Message_RSRC_ImageArg::_internal_set_row_width_arg(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.row_width_arg_ = value;
+}
+inline void Message_RSRC_ImageArg::set_row_width_arg(int32_t value) {
+  _internal_set_row_width_arg(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ImageArg.row_width_arg)
+}
+
+// optional bool is_float = 3;
+inline bool Message_RSRC_ImageArg::_internal_has_is_float() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Message_RSRC_ImageArg::has_is_float() const {
+  return _internal_has_is_float();
+}
+inline void Message_RSRC_ImageArg::clear_is_float() {
+  _impl_.is_float_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool Message_RSRC_ImageArg::_internal_is_float() const {
+  return _impl_.is_float_;
+}
+inline bool Message_RSRC_ImageArg::is_float() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ImageArg.is_float)
+  return _internal_is_float();
+}
+inline void Message_RSRC_ImageArg::_internal_set_is_float(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.is_float_ = value;
+}
+inline void Message_RSRC_ImageArg::set_is_float(bool value) {
+  _internal_set_is_float(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ImageArg.is_float)
+}
+
+// -------------------------------------------------------------------
+
+// Message_RSRC_PitchedArg
+
+// optional uint32 arg_position = 1;
+inline bool Message_RSRC_PitchedArg::_internal_has_arg_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Message_RSRC_PitchedArg::has_arg_position() const {
+  return _internal_has_arg_position();
+}
+inline void Message_RSRC_PitchedArg::clear_arg_position() {
+  _impl_.arg_position_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t Message_RSRC_PitchedArg::_internal_arg_position() const {
+  return _impl_.arg_position_;
+}
+inline uint32_t Message_RSRC_PitchedArg::arg_position() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.PitchedArg.arg_position)
+  return _internal_arg_position();
+}
+inline void Message_RSRC_PitchedArg::_internal_set_arg_position(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.arg_position_ = value;
+}
+inline void Message_RSRC_PitchedArg::set_arg_position(uint32_t value) {
+  _internal_set_arg_position(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.PitchedArg.arg_position)
+}
+
+// optional uint64 row_width = 2;
+inline bool Message_RSRC_PitchedArg::_internal_has_row_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Message_RSRC_PitchedArg::has_row_width() const {
+  return _internal_has_row_width();
+}
+inline void Message_RSRC_PitchedArg::clear_row_width() {
+  _impl_.row_width_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Message_RSRC_PitchedArg::_internal_row_width() const {
+  return _impl_.row_width_;
+}
+inline uint64_t Message_RSRC_PitchedArg::row_width() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.PitchedArg.row_width)
+  return _internal_row_width();
+}
+inline void Message_RSRC_PitchedArg::_internal_set_row_width(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.row_width_ = value;
+}
+inline void Message_RSRC_PitchedArg::set_row_width(uint64_t value) {
+  _internal_set_row_width(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.PitchedArg.row_width)
+}
+
+// optional uint32 data_type_size = 3;
+inline bool Message_RSRC_PitchedArg::_internal_has_data_type_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Message_RSRC_PitchedArg::has_data_type_size() const {
+  return _internal_has_data_type_size();
+}
+inline void Message_RSRC_PitchedArg::clear_data_type_size() {
+  _impl_.data_type_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t Message_RSRC_PitchedArg::_internal_data_type_size() const {
+  return _impl_.data_type_size_;
+}
+inline uint32_t Message_RSRC_PitchedArg::data_type_size() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.PitchedArg.data_type_size)
+  return _internal_data_type_size();
+}
+inline void Message_RSRC_PitchedArg::_internal_set_data_type_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.data_type_size_ = value;
+}
+inline void Message_RSRC_PitchedArg::set_data_type_size(uint32_t value) {
+  _internal_set_data_type_size(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.PitchedArg.data_type_size)
+}
+
+// -------------------------------------------------------------------
+
+// Message_RSRC_ScopFunctionOCLInfo
+
+// optional string scopFunctionName = 1;
+inline bool Message_RSRC_ScopFunctionOCLInfo::_internal_has_scopfunctionname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Message_RSRC_ScopFunctionOCLInfo::has_scopfunctionname() const {
+  return _internal_has_scopfunctionname();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_scopfunctionname() {
+  _impl_.scopfunctionname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Message_RSRC_ScopFunctionOCLInfo::scopfunctionname() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
+  return _internal_scopfunctionname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message_RSRC_ScopFunctionOCLInfo::set_scopfunctionname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.scopfunctionname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
+}
+inline std::string* Message_RSRC_ScopFunctionOCLInfo::mutable_scopfunctionname() {
+  std::string* _s = _internal_mutable_scopfunctionname();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
+  return _s;
+}
+inline const std::string& Message_RSRC_ScopFunctionOCLInfo::_internal_scopfunctionname() const {
+  return _impl_.scopfunctionname_.Get();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_set_scopfunctionname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.scopfunctionname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message_RSRC_ScopFunctionOCLInfo::_internal_mutable_scopfunctionname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.scopfunctionname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message_RSRC_ScopFunctionOCLInfo::release_scopfunctionname() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
+  if (!_internal_has_scopfunctionname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.scopfunctionname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopfunctionname_.IsDefault()) {
+    _impl_.scopfunctionname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_allocated_scopfunctionname(std::string* scopfunctionname) {
+  if (scopfunctionname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.scopfunctionname_.SetAllocated(scopfunctionname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopfunctionname_.IsDefault()) {
+    _impl_.scopfunctionname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
+}
+
+// optional string scopOCLKernelName = 2;
+inline bool Message_RSRC_ScopFunctionOCLInfo::_internal_has_scopoclkernelname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Message_RSRC_ScopFunctionOCLInfo::has_scopoclkernelname() const {
+  return _internal_has_scopoclkernelname();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_scopoclkernelname() {
+  _impl_.scopoclkernelname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Message_RSRC_ScopFunctionOCLInfo::scopoclkernelname() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
+  return _internal_scopoclkernelname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message_RSRC_ScopFunctionOCLInfo::set_scopoclkernelname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.scopoclkernelname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
+}
+inline std::string* Message_RSRC_ScopFunctionOCLInfo::mutable_scopoclkernelname() {
+  std::string* _s = _internal_mutable_scopoclkernelname();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
+  return _s;
+}
+inline const std::string& Message_RSRC_ScopFunctionOCLInfo::_internal_scopoclkernelname() const {
+  return _impl_.scopoclkernelname_.Get();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_set_scopoclkernelname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.scopoclkernelname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message_RSRC_ScopFunctionOCLInfo::_internal_mutable_scopoclkernelname() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.scopoclkernelname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message_RSRC_ScopFunctionOCLInfo::release_scopoclkernelname() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
+  if (!_internal_has_scopoclkernelname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.scopoclkernelname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopoclkernelname_.IsDefault()) {
+    _impl_.scopoclkernelname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_allocated_scopoclkernelname(std::string* scopoclkernelname) {
+  if (scopoclkernelname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.scopoclkernelname_.SetAllocated(scopoclkernelname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopoclkernelname_.IsDefault()) {
+    _impl_.scopoclkernelname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
+}
+
+// repeated int32 workgroup_arg_index = 3;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_workgroup_arg_index_size() const {
+  return _impl_.workgroup_arg_index_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index_size() const {
+  return _internal_workgroup_arg_index_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_workgroup_arg_index() {
+  _impl_.workgroup_arg_index_.Clear();
+}
+inline int32_t Message_RSRC_ScopFunctionOCLInfo::_internal_workgroup_arg_index(int index) const {
+  return _impl_.workgroup_arg_index_.Get(index);
+}
+inline int32_t Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
+  return _internal_workgroup_arg_index(index);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_workgroup_arg_index(int index, int32_t value) {
+  _impl_.workgroup_arg_index_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_add_workgroup_arg_index(int32_t value) {
+  _impl_.workgroup_arg_index_.Add(value);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::add_workgroup_arg_index(int32_t value) {
+  _internal_add_workgroup_arg_index(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Message_RSRC_ScopFunctionOCLInfo::_internal_workgroup_arg_index() const {
+  return _impl_.workgroup_arg_index_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
+  return _internal_workgroup_arg_index();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Message_RSRC_ScopFunctionOCLInfo::_internal_mutable_workgroup_arg_index() {
+  return &_impl_.workgroup_arg_index_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_workgroup_arg_index() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
+  return _internal_mutable_workgroup_arg_index();
+}
+
+// repeated int32 workgroup_arg_index_offset = 4;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_workgroup_arg_index_offset_size() const {
+  return _impl_.workgroup_arg_index_offset_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index_offset_size() const {
+  return _internal_workgroup_arg_index_offset_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_workgroup_arg_index_offset() {
+  _impl_.workgroup_arg_index_offset_.Clear();
+}
+inline int32_t Message_RSRC_ScopFunctionOCLInfo::_internal_workgroup_arg_index_offset(int index) const {
+  return _impl_.workgroup_arg_index_offset_.Get(index);
+}
+inline int32_t Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index_offset(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
+  return _internal_workgroup_arg_index_offset(index);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_workgroup_arg_index_offset(int index, int32_t value) {
+  _impl_.workgroup_arg_index_offset_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_add_workgroup_arg_index_offset(int32_t value) {
+  _impl_.workgroup_arg_index_offset_.Add(value);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::add_workgroup_arg_index_offset(int32_t value) {
+  _internal_add_workgroup_arg_index_offset(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Message_RSRC_ScopFunctionOCLInfo::_internal_workgroup_arg_index_offset() const {
+  return _impl_.workgroup_arg_index_offset_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index_offset() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
+  return _internal_workgroup_arg_index_offset();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Message_RSRC_ScopFunctionOCLInfo::_internal_mutable_workgroup_arg_index_offset() {
+  return &_impl_.workgroup_arg_index_offset_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_workgroup_arg_index_offset() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
+  return _internal_mutable_workgroup_arg_index_offset();
+}
+
+// repeated uint32 local_work_size = 5;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_local_work_size_size() const {
+  return _impl_.local_work_size_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::local_work_size_size() const {
+  return _internal_local_work_size_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_local_work_size() {
+  _impl_.local_work_size_.Clear();
+}
+inline uint32_t Message_RSRC_ScopFunctionOCLInfo::_internal_local_work_size(int index) const {
+  return _impl_.local_work_size_.Get(index);
+}
+inline uint32_t Message_RSRC_ScopFunctionOCLInfo::local_work_size(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.local_work_size)
+  return _internal_local_work_size(index);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_local_work_size(int index, uint32_t value) {
+  _impl_.local_work_size_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.local_work_size)
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_add_local_work_size(uint32_t value) {
+  _impl_.local_work_size_.Add(value);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::add_local_work_size(uint32_t value) {
+  _internal_add_local_work_size(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.local_work_size)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Message_RSRC_ScopFunctionOCLInfo::_internal_local_work_size() const {
+  return _impl_.local_work_size_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Message_RSRC_ScopFunctionOCLInfo::local_work_size() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.local_work_size)
+  return _internal_local_work_size();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Message_RSRC_ScopFunctionOCLInfo::_internal_mutable_local_work_size() {
+  return &_impl_.local_work_size_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_local_work_size() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.local_work_size)
+  return _internal_mutable_local_work_size();
+}
+
+// repeated .HTROP_PB.Message_RSRC.WorkItemFactor register_block = 6;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_register_block_size() const {
+  return _impl_.register_block_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::register_block_size() const {
+  return _internal_register_block_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_register_block() {
+  _impl_.register_block_.Clear();
+}
+inline ::HTROP_PB::Message_RSRC_WorkItemFactor* Message_RSRC_ScopFunctionOCLInfo::mutable_register_block(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.register_block)
+  return _impl_.register_block_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_register_block() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.register_block)
+  return &_impl_.register_block_;
+}
+inline const ::HTROP_PB::Message_RSRC_WorkItemFactor& Message_RSRC_ScopFunctionOCLInfo::_internal_register_block(int index) const {
+  return _impl_.register_block_.Get(index);
+}
+inline const ::HTROP_PB::Message_RSRC_WorkItemFactor& Message_RSRC_ScopFunctionOCLInfo::register_block(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.register_block)
+  return _internal_register_block(index);
+}
+inline ::HTROP_PB::Message_RSRC_WorkItemFactor* Message_RSRC_ScopFunctionOCLInfo::_internal_add_register_block() {
+  return _impl_.register_block_.Add();
+}
+inline ::HTROP_PB::Message_RSRC_WorkItemFactor* Message_RSRC_ScopFunctionOCLInfo::add_register_block() {
+  ::HTROP_PB::Message_RSRC_WorkItemFactor* _add = _internal_add_register_block();
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.register_block)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor >&
+Message_RSRC_ScopFunctionOCLInfo::register_block() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.register_block)
+  return _impl_.register_block_;
+}
+
+// repeated .HTROP_PB.Message_RSRC.WorkItemFactor vector_width = 7;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_vector_width_size() const {
+  return _impl_.vector_width_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::vector_width_size() const {
+  return _internal_vector_width_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_vector_width() {
+  _impl_.vector_width_.Clear();
+}
+inline ::HTROP_PB::Message_RSRC_WorkItemFactor* Message_RSRC_ScopFunctionOCLInfo::mutable_vector_width(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.vector_width)
+  return _impl_.vector_width_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_vector_width() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.vector_width)
+  return &_impl_.vector_width_;
+}
+inline const ::HTROP_PB::Message_RSRC_WorkItemFactor& Message_RSRC_ScopFunctionOCLInfo::_internal_vector_width(int index) const {
+  return _impl_.vector_width_.Get(index);
+}
+inline const ::HTROP_PB::Message_RSRC_WorkItemFactor& Message_RSRC_ScopFunctionOCLInfo::vector_width(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.vector_width)
+  return _internal_vector_width(index);
+}
+inline ::HTROP_PB::Message_RSRC_WorkItemFactor* Message_RSRC_ScopFunctionOCLInfo::_internal_add_vector_width() {
+  return _impl_.vector_width_.Add();
+}
+inline ::HTROP_PB::Message_RSRC_WorkItemFactor* Message_RSRC_ScopFunctionOCLInfo::add_vector_width() {
+  ::HTROP_PB::Message_RSRC_WorkItemFactor* _add = _internal_add_vector_width();
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.vector_width)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor >&
+Message_RSRC_ScopFunctionOCLInfo::vector_width() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.vector_width)
+  return _impl_.vector_width_;
+}
+
+// repeated .HTROP_PB.Message_RSRC.WorkItemFactor coarsening = 8;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_coarsening_size() const {
+  return _impl_.coarsening_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::coarsening_size() const {
+  return _internal_coarsening_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_coarsening() {
+  _impl_.coarsening_.Clear();
+}
+inline ::HTROP_PB::Message_RSRC_WorkItemFactor* Message_RSRC_ScopFunctionOCLInfo::mutable_coarsening(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.coarsening)
+  return _impl_.coarsening_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_coarsening() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.coarsening)
+  return &_impl_.coarsening_;
+}
+inline const ::HTROP_PB::Message_RSRC_WorkItemFactor& Message_RSRC_ScopFunctionOCLInfo::_internal_coarsening(int index) const {
+  return _impl_.coarsening_.Get(index);
+}
+inline const ::HTROP_PB::Message_RSRC_WorkItemFactor& Message_RSRC_ScopFunctionOCLInfo::coarsening(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.coarsening)
+  return _internal_coarsening(index);
+}
+inline ::HTROP_PB::Message_RSRC_WorkItemFactor* Message_RSRC_ScopFunctionOCLInfo::_internal_add_coarsening() {
+  return _impl_.coarsening_.Add();
+}
+inline ::HTROP_PB::Message_RSRC_WorkItemFactor* Message_RSRC_ScopFunctionOCLInfo::add_coarsening() {
+  ::HTROP_PB::Message_RSRC_WorkItemFactor* _add = _internal_add_coarsening();
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.coarsening)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_WorkItemFactor >&
+Message_RSRC_ScopFunctionOCLInfo::coarsening() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.coarsening)
+  return _impl_.coarsening_;
+}
+
+// optional .HTROP_PB.Message_RSRC.Reduction reduction = 9;
+inline bool Message_RSRC_ScopFunctionOCLInfo::_internal_has_reduction() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.reduction_ != nullptr);
+  return value;
+}
+inline bool Message_RSRC_ScopFunctionOCLInfo::has_reduction() const {
+  return _internal_has_reduction();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_reduction() {
+  if (_impl_.reduction_ != nullptr) _impl_.reduction_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::HTROP_PB::Message_RSRC_Reduction& Message_RSRC_ScopFunctionOCLInfo::_internal_reduction() const {
+  const ::HTROP_PB::Message_RSRC_Reduction* p = _impl_.reduction_;
+  return p != nullptr ? *p : reinterpret_cast<const ::HTROP_PB::Message_RSRC_Reduction&>(
+      ::HTROP_PB::_Message_RSRC_Reduction_default_instance_);
+}
+inline const ::HTROP_PB::Message_RSRC_Reduction& Message_RSRC_ScopFunctionOCLInfo::reduction() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.reduction)
+  return _internal_reduction();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::unsafe_arena_set_allocated_reduction(
+    ::HTROP_PB::Message_RSRC_Reduction* reduction) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.reduction_);
+  }
+  _impl_.reduction_ = reduction;
+  if (reduction) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.reduction)
+}
+inline ::HTROP_PB::Message_RSRC_Reduction* Message_RSRC_ScopFunctionOCLInfo::release_reduction() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::HTROP_PB::Message_RSRC_Reduction* temp = _impl_.reduction_;
+  _impl_.reduction_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::HTROP_PB::Message_RSRC_Reduction* Message_RSRC_ScopFunctionOCLInfo::unsafe_arena_release_reduction() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.reduction)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::HTROP_PB::Message_RSRC_Reduction* temp = _impl_.reduction_;
+  _impl_.reduction_ = nullptr;
+  return temp;
+}
+inline ::HTROP_PB::Message_RSRC_Reduction* Message_RSRC_ScopFunctionOCLInfo::_internal_mutable_reduction() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.reduction_ == nullptr) {
+    auto* p = CreateMaybeMessage<::HTROP_PB::Message_RSRC_Reduction>(GetArenaForAllocation());
+    _impl_.reduction_ = p;
+  }
+  return _impl_.reduction_;
+}
+inline ::HTROP_PB::Message_RSRC_Reduction* Message_RSRC_ScopFunctionOCLInfo::mutable_reduction() {
+  ::HTROP_PB::Message_RSRC_Reduction* _msg = _internal_mutable_reduction();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.reduction)
+  return _msg;
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_allocated_reduction(::HTROP_PB::Message_RSRC_Reduction* reduction) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.reduction_;
+  }
+  if (reduction) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reduction);
+    if (message_arena != submessage_arena) {
+      reduction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reduction, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.reduction_ = reduction;
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.reduction)
+}
+
+// repeated int32 workgroup_loop_index = 10;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_workgroup_loop_index_size() const {
+  return _impl_.workgroup_loop_index_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::workgroup_loop_index_size() const {
+  return _internal_workgroup_loop_index_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_workgroup_loop_index() {
+  _impl_.workgroup_loop_index_.Clear();
+}
+inline int32_t Message_RSRC_ScopFunctionOCLInfo::_internal_workgroup_loop_index(int index) const {
+  return _impl_.workgroup_loop_index_.Get(index);
+}
+inline int32_t Message_RSRC_ScopFunctionOCLInfo::workgroup_loop_index(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_loop_index)
+  return _internal_workgroup_loop_index(index);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_workgroup_loop_index(int index, int32_t value) {
+  _impl_.workgroup_loop_index_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_loop_index)
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_add_workgroup_loop_index(int32_t value) {
+  _impl_.workgroup_loop_index_.Add(value);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::add_workgroup_loop_index(int32_t value) {
+  _internal_add_workgroup_loop_index(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_loop_index)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Message_RSRC_ScopFunctionOCLInfo::_internal_workgroup_loop_index() const {
+  return _impl_.workgroup_loop_index_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Message_RSRC_ScopFunctionOCLInfo::workgroup_loop_index() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_loop_index)
+  return _internal_workgroup_loop_index();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Message_RSRC_ScopFunctionOCLInfo::_internal_mutable_workgroup_loop_index() {
+  return &_impl_.workgroup_loop_index_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_workgroup_loop_index() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_loop_index)
+  return _internal_mutable_workgroup_loop_index();
+}
+
+// repeated .HTROP_PB.Message_RSRC.ImageArg image_args = 11;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_image_args_size() const {
+  return _impl_.image_args_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::image_args_size() const {
+  return _internal_image_args_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_image_args() {
+  _impl_.image_args_.Clear();
+}
+inline ::HTROP_PB::Message_RSRC_ImageArg* Message_RSRC_ScopFunctionOCLInfo::mutable_image_args(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.image_args)
+  return _impl_.image_args_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ImageArg >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_image_args() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.image_args)
+  return &_impl_.image_args_;
+}
+inline const ::HTROP_PB::Message_RSRC_ImageArg& Message_RSRC_ScopFunctionOCLInfo::_internal_image_args(int index) const {
+  return _impl_.image_args_.Get(index);
+}
+inline const ::HTROP_PB::Message_RSRC_ImageArg& Message_RSRC_ScopFunctionOCLInfo::image_args(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.image_args)
+  return _internal_image_args(index);
+}
+inline ::HTROP_PB::Message_RSRC_ImageArg* Message_RSRC_ScopFunctionOCLInfo::_internal_add_image_args() {
+  return _impl_.image_args_.Add();
+}
+inline ::HTROP_PB::Message_RSRC_ImageArg* Message_RSRC_ScopFunctionOCLInfo::add_image_args() {
+  ::HTROP_PB::Message_RSRC_ImageArg* _add = _internal_add_image_args();
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.image_args)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ImageArg >&
+Message_RSRC_ScopFunctionOCLInfo::image_args() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.image_args)
+  return _impl_.image_args_;
+}
+
+// repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo variants = 12;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_variants_size() const {
+  return _impl_.variants_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::variants_size() const {
+  return _internal_variants_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_variants() {
+  _impl_.variants_.Clear();
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::mutable_variants(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.variants)
+  return _impl_.variants_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_variants() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.variants)
+  return &_impl_.variants_;
+}
+inline const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& Message_RSRC_ScopFunctionOCLInfo::_internal_variants(int index) const {
+  return _impl_.variants_.Get(index);
+}
+inline const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& Message_RSRC_ScopFunctionOCLInfo::variants(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.variants)
+  return _internal_variants(index);
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::_internal_add_variants() {
+  return _impl_.variants_.Add();
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::add_variants() {
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* _add = _internal_add_variants();
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.variants)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >&
+Message_RSRC_ScopFunctionOCLInfo::variants() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.variants)
+  return _impl_.variants_;
+}
+
+// repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo size_versions = 13;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_size_versions_size() const {
+  return _impl_.size_versions_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::size_versions_size() const {
+  return _internal_size_versions_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_size_versions() {
+  _impl_.size_versions_.Clear();
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::mutable_size_versions(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.size_versions)
+  return _impl_.size_versions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_size_versions() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.size_versions)
+  return &_impl_.size_versions_;
+}
+inline const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& Message_RSRC_ScopFunctionOCLInfo::_internal_size_versions(int index) const {
+  return _impl_.size_versions_.Get(index);
+}
+inline const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& Message_RSRC_ScopFunctionOCLInfo::size_versions(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.size_versions)
+  return _internal_size_versions(index);
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::_internal_add_size_versions() {
+  return _impl_.size_versions_.Add();
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::add_size_versions() {
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* _add = _internal_add_size_versions();
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.size_versions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >&
+Message_RSRC_ScopFunctionOCLInfo::size_versions() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.size_versions)
+  return _impl_.size_versions_;
+}
+
+// optional uint64 min_work_items = 14;
+inline bool Message_RSRC_ScopFunctionOCLInfo::_internal_has_min_work_items() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Message_RSRC_ScopFunctionOCLInfo::has_min_work_items() const {
+  return _internal_has_min_work_items();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_min_work_items() {
+  _impl_.min_work_items_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t Message_RSRC_ScopFunctionOCLInfo::_internal_min_work_items() const {
+  return _impl_.min_work_items_;
+}
+inline uint64_t Message_RSRC_ScopFunctionOCLInfo::min_work_items() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.min_work_items)
+  return _internal_min_work_items();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_set_min_work_items(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.min_work_items_ = value;
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_min_work_items(uint64_t value) {
+  _internal_set_min_work_items(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.min_work_items)
+}
+
+// optional uint64 max_work_items = 15;
+inline bool Message_RSRC_ScopFunctionOCLInfo::_internal_has_max_work_items() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Message_RSRC_ScopFunctionOCLInfo::has_max_work_items() const {
+  return _internal_has_max_work_items();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_max_work_items() {
+  _impl_.max_work_items_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t Message_RSRC_ScopFunctionOCLInfo::_internal_max_work_items() const {
+  return _impl_.max_work_items_;
+}
+inline uint64_t Message_RSRC_ScopFunctionOCLInfo::max_work_items() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.max_work_items)
+  return _internal_max_work_items();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_set_max_work_items(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.max_work_items_ = value;
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_max_work_items(uint64_t value) {
+  _internal_set_max_work_items(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.max_work_items)
+}
+
+// repeated .HTROP_PB.Message_RSRC.PitchedArg pitched_args = 16;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_pitched_args_size() const {
+  return _impl_.pitched_args_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::pitched_args_size() const {
+  return _internal_pitched_args_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_pitched_args() {
+  _impl_.pitched_args_.Clear();
+}
+inline ::HTROP_PB::Message_RSRC_PitchedArg* Message_RSRC_ScopFunctionOCLInfo::mutable_pitched_args(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.pitched_args)
+  return _impl_.pitched_args_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_PitchedArg >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_pitched_args() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.pitched_args)
+  return &_impl_.pitched_args_;
+}
+inline const ::HTROP_PB::Message_RSRC_PitchedArg& Message_RSRC_ScopFunctionOCLInfo::_internal_pitched_args(int index) const {
+  return _impl_.pitched_args_.Get(index);
+}
+inline const ::HTROP_PB::Message_RSRC_PitchedArg& Message_RSRC_ScopFunctionOCLInfo::pitched_args(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.pitched_args)
+  return _internal_pitched_args(index);
+}
+inline ::HTROP_PB::Message_RSRC_PitchedArg* Message_RSRC_ScopFunctionOCLInfo::_internal_add_pitched_args() {
+  return _impl_.pitched_args_.Add();
+}
+inline ::HTROP_PB::Message_RSRC_PitchedArg* Message_RSRC_ScopFunctionOCLInfo::add_pitched_args() {
+  ::HTROP_PB::Message_RSRC_PitchedArg* _add = _internal_add_pitched_args();
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.pitched_args)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_PitchedArg >&
+Message_RSRC_ScopFunctionOCLInfo::pitched_args() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.pitched_args)
+  return _impl_.pitched_args_;
+}
+
+// optional uint64 max_index = 17;
+inline bool Message_RSRC_ScopFunctionOCLInfo::_internal_has_max_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Message_RSRC_ScopFunctionOCLInfo::has_max_index() const {
+  return _internal_has_max_index();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_max_index() {
+  _impl_.max_index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t Message_RSRC_ScopFunctionOCLInfo::_internal_max_index() const {
+  return _impl_.max_index_;
+}
+inline uint64_t Message_RSRC_ScopFunctionOCLInfo::max_index() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.max_index)
+  return _internal_max_index();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_set_max_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.max_index_ = value;
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_max_index(uint64_t value) {
+  _internal_set_max_index(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.max_index)
+}
+
+// optional uint32 wavefront_skew = 18;
+inline bool Message_RSRC_ScopFunctionOCLInfo::_internal_has_wavefront_skew() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Message_RSRC_ScopFunctionOCLInfo::has_wavefront_skew() const {
+  return _internal_has_wavefront_skew();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_wavefront_skew() {
+  _impl_.wavefront_skew_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t Message_RSRC_ScopFunctionOCLInfo::_internal_wavefront_skew() const {
+  return _impl_.wavefront_skew_;
+}
+inline uint32_t Message_RSRC_ScopFunctionOCLInfo::wavefront_skew() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.wavefront_skew)
+  return _internal_wavefront_skew();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_set_wavefront_skew(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.wavefront_skew_ = value;
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_wavefront_skew(uint32_t value) {
+  _internal_set_wavefront_skew(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.wavefront_skew)
+}
+
+// repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo distributed_kernels = 19;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_distributed_kernels_size() const {
+  return _impl_.distributed_kernels_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::distributed_kernels_size() const {
+  return _internal_distributed_kernels_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_distributed_kernels() {
+  _impl_.distributed_kernels_.Clear();
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::mutable_distributed_kernels(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.distributed_kernels)
+  return _impl_.distributed_kernels_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_distributed_kernels() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.distributed_kernels)
+  return &_impl_.distributed_kernels_;
+}
+inline const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& Message_RSRC_ScopFunctionOCLInfo::_internal_distributed_kernels(int index) const {
+  return _impl_.distributed_kernels_.Get(index);
+}
+inline const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& Message_RSRC_ScopFunctionOCLInfo::distributed_kernels(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.distributed_kernels)
+  return _internal_distributed_kernels(index);
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::_internal_add_distributed_kernels() {
+  return _impl_.distributed_kernels_.Add();
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::add_distributed_kernels() {
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* _add = _internal_add_distributed_kernels();
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.distributed_kernels)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >&
+Message_RSRC_ScopFunctionOCLInfo::distributed_kernels() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.distributed_kernels)
+  return _impl_.distributed_kernels_;
+}
+
+// optional .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo interior_kernel = 20;
+inline bool Message_RSRC_ScopFunctionOCLInfo::_internal_has_interior_kernel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.interior_kernel_ != nullptr);
+  return value;
+}
+inline bool Message_RSRC_ScopFunctionOCLInfo::has_interior_kernel() const {
+  return _internal_has_interior_kernel();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_interior_kernel() {
+  if (_impl_.interior_kernel_ != nullptr) _impl_.interior_kernel_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& Message_RSRC_ScopFunctionOCLInfo::_internal_interior_kernel() const {
+  const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* p = _impl_.interior_kernel_;
+  return p != nullptr ? *p : reinterpret_cast<const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo&>(
+      ::HTROP_PB::_Message_RSRC_ScopFunctionOCLInfo_default_instance_);
+}
+inline const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& Message_RSRC_ScopFunctionOCLInfo::interior_kernel() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.interior_kernel)
+  return _internal_interior_kernel();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::unsafe_arena_set_allocated_interior_kernel(
+    ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* interior_kernel) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.interior_kernel_);
+  }
+  _impl_.interior_kernel_ = interior_kernel;
+  if (interior_kernel) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.interior_kernel)
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::release_interior_kernel() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* temp = _impl_.interior_kernel_;
+  _impl_.interior_kernel_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::unsafe_arena_release_interior_kernel() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.interior_kernel)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* temp = _impl_.interior_kernel_;
+  _impl_.interior_kernel_ = nullptr;
+  return temp;
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::_internal_mutable_interior_kernel() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.interior_kernel_ == nullptr) {
+    auto* p = CreateMaybeMessage<::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo>(GetArenaForAllocation());
+    _impl_.interior_kernel_ = p;
+  }
+  return _impl_.interior_kernel_;
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC_ScopFunctionOCLInfo::mutable_interior_kernel() {
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* _msg = _internal_mutable_interior_kernel();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.interior_kernel)
+  return _msg;
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_allocated_interior_kernel(::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* interior_kernel) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.interior_kernel_;
+  }
+  if (interior_kernel) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(interior_kernel);
+    if (message_arena != submessage_arena) {
+      interior_kernel = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, interior_kernel, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.interior_kernel_ = interior_kernel;
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.interior_kernel)
+}
+
+// repeated uint32 border_low = 21;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_border_low_size() const {
+  return _impl_.border_low_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::border_low_size() const {
+  return _internal_border_low_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_border_low() {
+  _impl_.border_low_.Clear();
+}
+inline uint32_t Message_RSRC_ScopFunctionOCLInfo::_internal_border_low(int index) const {
+  return _impl_.border_low_.Get(index);
+}
+inline uint32_t Message_RSRC_ScopFunctionOCLInfo::border_low(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.border_low)
+  return _internal_border_low(index);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_border_low(int index, uint32_t value) {
+  _impl_.border_low_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.border_low)
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_add_border_low(uint32_t value) {
+  _impl_.border_low_.Add(value);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::add_border_low(uint32_t value) {
+  _internal_add_border_low(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.border_low)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Message_RSRC_ScopFunctionOCLInfo::_internal_border_low() const {
+  return _impl_.border_low_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Message_RSRC_ScopFunctionOCLInfo::border_low() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.border_low)
+  return _internal_border_low();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Message_RSRC_ScopFunctionOCLInfo::_internal_mutable_border_low() {
+  return &_impl_.border_low_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_border_low() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.border_low)
+  return _internal_mutable_border_low();
+}
+
+// repeated uint32 border_high = 22;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_border_high_size() const {
+  return _impl_.border_high_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::border_high_size() const {
+  return _internal_border_high_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_border_high() {
+  _impl_.border_high_.Clear();
+}
+inline uint32_t Message_RSRC_ScopFunctionOCLInfo::_internal_border_high(int index) const {
+  return _impl_.border_high_.Get(index);
+}
+inline uint32_t Message_RSRC_ScopFunctionOCLInfo::border_high(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.border_high)
+  return _internal_border_high(index);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_border_high(int index, uint32_t value) {
+  _impl_.border_high_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.border_high)
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_add_border_high(uint32_t value) {
+  _impl_.border_high_.Add(value);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::add_border_high(uint32_t value) {
+  _internal_add_border_high(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.border_high)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Message_RSRC_ScopFunctionOCLInfo::_internal_border_high() const {
+  return _impl_.border_high_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Message_RSRC_ScopFunctionOCLInfo::border_high() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.border_high)
+  return _internal_border_high();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Message_RSRC_ScopFunctionOCLInfo::_internal_mutable_border_high() {
+  return &_impl_.border_high_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_border_high() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.border_high)
+  return _internal_mutable_border_high();
+}
+
+// repeated uint64 min_global_size = 23;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_min_global_size_size() const {
+  return _impl_.min_global_size_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::min_global_size_size() const {
+  return _internal_min_global_size_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_min_global_size() {
+  _impl_.min_global_size_.Clear();
+}
+inline uint64_t Message_RSRC_ScopFunctionOCLInfo::_internal_min_global_size(int index) const {
+  return _impl_.min_global_size_.Get(index);
+}
+inline uint64_t Message_RSRC_ScopFunctionOCLInfo::min_global_size(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.min_global_size)
+  return _internal_min_global_size(index);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_min_global_size(int index, uint64_t value) {
+  _impl_.min_global_size_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.min_global_size)
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_add_min_global_size(uint64_t value) {
+  _impl_.min_global_size_.Add(value);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::add_min_global_size(uint64_t value) {
+  _internal_add_min_global_size(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.min_global_size)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Message_RSRC_ScopFunctionOCLInfo::_internal_min_global_size() const {
+  return _impl_.min_global_size_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Message_RSRC_ScopFunctionOCLInfo::min_global_size() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.min_global_size)
+  return _internal_min_global_size();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Message_RSRC_ScopFunctionOCLInfo::_internal_mutable_min_global_size() {
+  return &_impl_.min_global_size_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_min_global_size() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.min_global_size)
+  return _internal_mutable_min_global_size();
+}
+
+// repeated uint64 max_global_size = 24;
+inline int Message_RSRC_ScopFunctionOCLInfo::_internal_max_global_size_size() const {
+  return _impl_.max_global_size_.size();
+}
+inline int Message_RSRC_ScopFunctionOCLInfo::max_global_size_size() const {
+  return _internal_max_global_size_size();
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::clear_max_global_size() {
+  _impl_.max_global_size_.Clear();
+}
+inline uint64_t Message_RSRC_ScopFunctionOCLInfo::_internal_max_global_size(int index) const {
+  return _impl_.max_global_size_.Get(index);
+}
+inline uint64_t Message_RSRC_ScopFunctionOCLInfo::max_global_size(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.max_global_size)
+  return _internal_max_global_size(index);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::set_max_global_size(int index, uint64_t value) {
+  _impl_.max_global_size_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.max_global_size)
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::_internal_add_max_global_size(uint64_t value) {
+  _impl_.max_global_size_.Add(value);
+}
+inline void Message_RSRC_ScopFunctionOCLInfo::add_max_global_size(uint64_t value) {
+  _internal_add_max_global_size(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.max_global_size)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Message_RSRC_ScopFunctionOCLInfo::_internal_max_global_size() const {
+  return _impl_.max_global_size_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Message_RSRC_ScopFunctionOCLInfo::max_global_size() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.max_global_size)
+  return _internal_max_global_size();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Message_RSRC_ScopFunctionOCLInfo::_internal_mutable_max_global_size() {
+  return &_impl_.max_global_size_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Message_RSRC_ScopFunctionOCLInfo::mutable_max_global_size() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.max_global_size)
+  return _internal_mutable_max_global_size();
+}
+
+// -------------------------------------------------------------------
+
+// Message_RSRC
+
+// repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo scopFunctions = 1;
+inline int Message_RSRC::_internal_scopfunctions_size() const {
+  return _impl_.scopfunctions_.size();
+}
+inline int Message_RSRC::scopfunctions_size() const {
+  return _internal_scopfunctions_size();
+}
+inline void Message_RSRC::clear_scopfunctions() {
+  _impl_.scopfunctions_.Clear();
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC::mutable_scopfunctions(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.scopFunctions)
+  return _impl_.scopfunctions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >*
+Message_RSRC::mutable_scopfunctions() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.scopFunctions)
+  return &_impl_.scopfunctions_;
+}
+inline const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& Message_RSRC::_internal_scopfunctions(int index) const {
+  return _impl_.scopfunctions_.Get(index);
+}
+inline const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& Message_RSRC::scopfunctions(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.scopFunctions)
+  return _internal_scopfunctions(index);
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC::_internal_add_scopfunctions() {
+  return _impl_.scopfunctions_.Add();
+}
+inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC::add_scopfunctions() {
+  ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* _add = _internal_add_scopfunctions();
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.scopFunctions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >&
+Message_RSRC::scopfunctions() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.scopFunctions)
+  return _impl_.scopfunctions_;
+}
+
+// optional string oclKernelFileName = 2;
+inline bool Message_RSRC::_internal_has_oclkernelfilename() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Message_RSRC::has_oclkernelfilename() const {
+  return _internal_has_oclkernelfilename();
+}
+inline void Message_RSRC::clear_oclkernelfilename() {
+  _impl_.oclkernelfilename_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Message_RSRC::oclkernelfilename() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.oclKernelFileName)
+  return _internal_oclkernelfilename();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message_RSRC::set_oclkernelfilename(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.oclkernelfilename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.oclKernelFileName)
+}
+inline std::string* Message_RSRC::mutable_oclkernelfilename() {
+  std::string* _s = _internal_mutable_oclkernelfilename();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.oclKernelFileName)
+  return _s;
+}
+inline const std::string& Message_RSRC::_internal_oclkernelfilename() const {
+  return _impl_.oclkernelfilename_.Get();
+}
+inline void Message_RSRC::_internal_set_oclkernelfilename(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.oclkernelfilename_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message_RSRC::_internal_mutable_oclkernelfilename() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.oclkernelfilename_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message_RSRC::release_oclkernelfilename() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RSRC.oclKernelFileName)
+  if (!_internal_has_oclkernelfilename()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.oclkernelfilename_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.oclkernelfilename_.IsDefault()) {
+    _impl_.oclkernelfilename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Message_RSRC::set_allocated_oclkernelfilename(std::string* oclkernelfilename) {
+  if (oclkernelfilename != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.oclkernelfilename_.SetAllocated(oclkernelfilename, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.oclkernelfilename_.IsDefault()) {
+    _impl_.oclkernelfilename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RSRC.oclKernelFileName)
+}
+
+// optional uint32 binarySize = 3;
+inline bool Message_RSRC::_internal_has_binarysize() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Message_RSRC::has_binarysize() const {
+  return _internal_has_binarysize();
+}
+inline void Message_RSRC::clear_binarysize() {
+  _impl_.binarysize_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t Message_RSRC::_internal_binarysize() const {
+  return _impl_.binarysize_;
+}
+inline uint32_t Message_RSRC::binarysize() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.binarySize)
+  return _internal_binarysize();
+}
+inline void Message_RSRC::_internal_set_binarysize(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.binarysize_ = value;
+}
+inline void Message_RSRC::set_binarysize(uint32_t value) {
+  _internal_set_binarysize(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.binarySize)
+}
+
+// -------------------------------------------------------------------
+
+// ScopArgInfo
+
+// optional string name = 1;
+inline bool ScopArgInfo::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ScopArgInfo::has_name() const {
+  return _internal_has_name();
+}
+inline void ScopArgInfo::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ScopArgInfo::name() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopArgInfo.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScopArgInfo::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopArgInfo.name)
+}
+inline std::string* ScopArgInfo::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopArgInfo.name)
+  return _s;
+}
+inline const std::string& ScopArgInfo::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void ScopArgInfo::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScopArgInfo::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScopArgInfo::release_name() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.ScopArgInfo.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ScopArgInfo::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.ScopArgInfo.name)
+}
+
+// optional int32 type = 2;
+inline bool ScopArgInfo::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ScopArgInfo::has_type() const {
+  return _internal_has_type();
+}
+inline void ScopArgInfo::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t ScopArgInfo::_internal_type() const {
+  return _impl_.type_;
+}
+inline int32_t ScopArgInfo::type() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopArgInfo.type)
+  return _internal_type();
+}
+inline void ScopArgInfo::_internal_set_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void ScopArgInfo::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopArgInfo.type)
+}
+
+// optional bool isPointer = 3;
+inline bool ScopArgInfo::_internal_has_ispointer() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ScopArgInfo::has_ispointer() const {
+  return _internal_has_ispointer();
+}
+inline void ScopArgInfo::clear_ispointer() {
+  _impl_.ispointer_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool ScopArgInfo::_internal_ispointer() const {
+  return _impl_.ispointer_;
+}
+inline bool ScopArgInfo::ispointer() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopArgInfo.isPointer)
+  return _internal_ispointer();
+}
+inline void ScopArgInfo::_internal_set_ispointer(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.ispointer_ = value;
+}
+inline void ScopArgInfo::set_ispointer(bool value) {
+  _internal_set_ispointer(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopArgInfo.isPointer)
+}
+
+// optional uint32 dimension = 4;
+inline bool ScopArgInfo::_internal_has_dimension() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ScopArgInfo::has_dimension() const {
+  return _internal_has_dimension();
+}
+inline void ScopArgInfo::clear_dimension() {
+  _impl_.dimension_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t ScopArgInfo::_internal_dimension() const {
+  return _impl_.dimension_;
+}
+inline uint32_t ScopArgInfo::dimension() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopArgInfo.dimension)
+  return _internal_dimension();
+}
+inline void ScopArgInfo::_internal_set_dimension(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.dimension_ = value;
+}
+inline void ScopArgInfo::set_dimension(uint32_t value) {
+  _internal_set_dimension(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopArgInfo.dimension)
+}
+
+// repeated int64 dimension_min = 5;
+inline int ScopArgInfo::_internal_dimension_min_size() const {
+  return _impl_.dimension_min_.size();
+}
+inline int ScopArgInfo::dimension_min_size() const {
+  return _internal_dimension_min_size();
+}
+inline void ScopArgInfo::clear_dimension_min() {
+  _impl_.dimension_min_.Clear();
+}
+inline int64_t ScopArgInfo::_internal_dimension_min(int index) const {
+  return _impl_.dimension_min_.Get(index);
+}
+inline int64_t ScopArgInfo::dimension_min(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopArgInfo.dimension_min)
+  return _internal_dimension_min(index);
+}
+inline void ScopArgInfo::set_dimension_min(int index, int64_t value) {
+  _impl_.dimension_min_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopArgInfo.dimension_min)
+}
+inline void ScopArgInfo::_internal_add_dimension_min(int64_t value) {
+  _impl_.dimension_min_.Add(value);
+}
+inline void ScopArgInfo::add_dimension_min(int64_t value) {
+  _internal_add_dimension_min(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.ScopArgInfo.dimension_min)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+ScopArgInfo::_internal_dimension_min() const {
+  return _impl_.dimension_min_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+ScopArgInfo::dimension_min() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.ScopArgInfo.dimension_min)
+  return _internal_dimension_min();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+ScopArgInfo::_internal_mutable_dimension_min() {
+  return &_impl_.dimension_min_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+ScopArgInfo::mutable_dimension_min() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.ScopArgInfo.dimension_min)
+  return _internal_mutable_dimension_min();
+}
+
+// repeated int64 dimension_max = 6;
+inline int ScopArgInfo::_internal_dimension_max_size() const {
+  return _impl_.dimension_max_.size();
+}
+inline int ScopArgInfo::dimension_max_size() const {
+  return _internal_dimension_max_size();
+}
+inline void ScopArgInfo::clear_dimension_max() {
+  _impl_.dimension_max_.Clear();
+}
+inline int64_t ScopArgInfo::_internal_dimension_max(int index) const {
+  return _impl_.dimension_max_.Get(index);
+}
+inline int64_t ScopArgInfo::dimension_max(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopArgInfo.dimension_max)
+  return _internal_dimension_max(index);
+}
+inline void ScopArgInfo::set_dimension_max(int index, int64_t value) {
+  _impl_.dimension_max_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopArgInfo.dimension_max)
+}
+inline void ScopArgInfo::_internal_add_dimension_max(int64_t value) {
+  _impl_.dimension_max_.Add(value);
+}
+inline void ScopArgInfo::add_dimension_max(int64_t value) {
+  _internal_add_dimension_max(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.ScopArgInfo.dimension_max)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+ScopArgInfo::_internal_dimension_max() const {
+  return _impl_.dimension_max_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+ScopArgInfo::dimension_max() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.ScopArgInfo.dimension_max)
+  return _internal_dimension_max();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+ScopArgInfo::_internal_mutable_dimension_max() {
+  return &_impl_.dimension_max_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+ScopArgInfo::mutable_dimension_max() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.ScopArgInfo.dimension_max)
+  return _internal_mutable_dimension_max();
+}
+
+// repeated string dimension_minStr = 7;
+inline int ScopArgInfo::_internal_dimension_minstr_size() const {
+  return _impl_.dimension_minstr_.size();
+}
+inline int ScopArgInfo::dimension_minstr_size() const {
+  return _internal_dimension_minstr_size();
+}
+inline void ScopArgInfo::clear_dimension_minstr() {
+  _impl_.dimension_minstr_.Clear();
+}
+inline std::string* ScopArgInfo::add_dimension_minstr() {
+  std::string* _s = _internal_add_dimension_minstr();
+  // @@protoc_insertion_point(field_add_mutable:HTROP_PB.ScopArgInfo.dimension_minStr)
+  return _s;
+}
+inline const std::string& ScopArgInfo::_internal_dimension_minstr(int index) const {
+  return _impl_.dimension_minstr_.Get(index);
+}
+inline const std::string& ScopArgInfo::dimension_minstr(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopArgInfo.dimension_minStr)
+  return _internal_dimension_minstr(index);
+}
+inline std::string* ScopArgInfo::mutable_dimension_minstr(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopArgInfo.dimension_minStr)
+  return _impl_.dimension_minstr_.Mutable(index);
+}
+inline void ScopArgInfo::set_dimension_minstr(int index, const std::string& value) {
+  _impl_.dimension_minstr_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopArgInfo.dimension_minStr)
+}
+inline void ScopArgInfo::set_dimension_minstr(int index, std::string&& value) {
+  _impl_.dimension_minstr_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopArgInfo.dimension_minStr)
+}
+inline void ScopArgInfo::set_dimension_minstr(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.dimension_minstr_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:HTROP_PB.ScopArgInfo.dimension_minStr)
+}
+inline void ScopArgInfo::set_dimension_minstr(int index, const char* value, size_t size) {
+  _impl_.dimension_minstr_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.ScopArgInfo.dimension_minStr)
+}
+inline std::string* ScopArgInfo::_internal_add_dimension_minstr() {
+  return _impl_.dimension_minstr_.Add();
+}
+inline void ScopArgInfo::add_dimension_minstr(const std::string& value) {
+  _impl_.dimension_minstr_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.ScopArgInfo.dimension_minStr)
+}
+inline void ScopArgInfo::add_dimension_minstr(std::string&& value) {
+  _impl_.dimension_minstr_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:HTROP_PB.ScopArgInfo.dimension_minStr)
+}
+inline void ScopArgInfo::add_dimension_minstr(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.dimension_minstr_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:HTROP_PB.ScopArgInfo.dimension_minStr)
+}
+inline void ScopArgInfo::add_dimension_minstr(const char* value, size_t size) {
+  _impl_.dimension_minstr_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:HTROP_PB.ScopArgInfo.dimension_minStr)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ScopArgInfo::dimension_minstr() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.ScopArgInfo.dimension_minStr)
+  return _impl_.dimension_minstr_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ScopArgInfo::mutable_dimension_minstr() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.ScopArgInfo.dimension_minStr)
+  return &_impl_.dimension_minstr_;
+}
+
+// repeated string dimension_maxStr = 8;
+inline int ScopArgInfo::_internal_dimension_maxstr_size() const {
+  return _impl_.dimension_maxstr_.size();
+}
+inline int ScopArgInfo::dimension_maxstr_size() const {
+  return _internal_dimension_maxstr_size();
+}
+inline void ScopArgInfo::clear_dimension_maxstr() {
+  _impl_.dimension_maxstr_.Clear();
+}
+inline std::string* ScopArgInfo::add_dimension_maxstr() {
+  std::string* _s = _internal_add_dimension_maxstr();
+  // @@protoc_insertion_point(field_add_mutable:HTROP_PB.ScopArgInfo.dimension_maxStr)
+  return _s;
+}
+inline const std::string& ScopArgInfo::_internal_dimension_maxstr(int index) const {
+  return _impl_.dimension_maxstr_.Get(index);
+}
+inline const std::string& ScopArgInfo::dimension_maxstr(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopArgInfo.dimension_maxStr)
+  return _internal_dimension_maxstr(index);
+}
+inline std::string* ScopArgInfo::mutable_dimension_maxstr(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopArgInfo.dimension_maxStr)
+  return _impl_.dimension_maxstr_.Mutable(index);
+}
+inline void ScopArgInfo::set_dimension_maxstr(int index, const std::string& value) {
+  _impl_.dimension_maxstr_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopArgInfo.dimension_maxStr)
+}
+inline void ScopArgInfo::set_dimension_maxstr(int index, std::string&& value) {
+  _impl_.dimension_maxstr_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopArgInfo.dimension_maxStr)
+}
+inline void ScopArgInfo::set_dimension_maxstr(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.dimension_maxstr_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:HTROP_PB.ScopArgInfo.dimension_maxStr)
+}
+inline void ScopArgInfo::set_dimension_maxstr(int index, const char* value, size_t size) {
+  _impl_.dimension_maxstr_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.ScopArgInfo.dimension_maxStr)
+}
+inline std::string* ScopArgInfo::_internal_add_dimension_maxstr() {
+  return _impl_.dimension_maxstr_.Add();
+}
+inline void ScopArgInfo::add_dimension_maxstr(const std::string& value) {
+  _impl_.dimension_maxstr_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.ScopArgInfo.dimension_maxStr)
+}
+inline void ScopArgInfo::add_dimension_maxstr(std::string&& value) {
+  _impl_.dimension_maxstr_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:HTROP_PB.ScopArgInfo.dimension_maxStr)
+}
+inline void ScopArgInfo::add_dimension_maxstr(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.dimension_maxstr_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:HTROP_PB.ScopArgInfo.dimension_maxStr)
+}
+inline void ScopArgInfo::add_dimension_maxstr(const char* value, size_t size) {
+  _impl_.dimension_maxstr_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:HTROP_PB.ScopArgInfo.dimension_maxStr)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ScopArgInfo::dimension_maxstr() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.ScopArgInfo.dimension_maxStr)
+  return _impl_.dimension_maxstr_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ScopArgInfo::mutable_dimension_maxstr() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.ScopArgInfo.dimension_maxStr)
+  return &_impl_.dimension_maxstr_;
+}
+
+// repeated int64 dimension_offset_min = 9;
+inline int ScopArgInfo::_internal_dimension_offset_min_size() const {
+  return _impl_.dimension_offset_min_.size();
+}
+inline int ScopArgInfo::dimension_offset_min_size() const {
+  return _internal_dimension_offset_min_size();
+}
+inline void ScopArgInfo::clear_dimension_offset_min() {
+  _impl_.dimension_offset_min_.Clear();
+}
+inline int64_t ScopArgInfo::_internal_dimension_offset_min(int index) const {
+  return _impl_.dimension_offset_min_.Get(index);
+}
+inline int64_t ScopArgInfo::dimension_offset_min(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopArgInfo.dimension_offset_min)
+  return _internal_dimension_offset_min(index);
+}
+inline void ScopArgInfo::set_dimension_offset_min(int index, int64_t value) {
+  _impl_.dimension_offset_min_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopArgInfo.dimension_offset_min)
+}
+inline void ScopArgInfo::_internal_add_dimension_offset_min(int64_t value) {
+  _impl_.dimension_offset_min_.Add(value);
+}
+inline void ScopArgInfo::add_dimension_offset_min(int64_t value) {
+  _internal_add_dimension_offset_min(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.ScopArgInfo.dimension_offset_min)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+ScopArgInfo::_internal_dimension_offset_min() const {
+  return _impl_.dimension_offset_min_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+ScopArgInfo::dimension_offset_min() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.ScopArgInfo.dimension_offset_min)
+  return _internal_dimension_offset_min();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+ScopArgInfo::_internal_mutable_dimension_offset_min() {
+  return &_impl_.dimension_offset_min_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+ScopArgInfo::mutable_dimension_offset_min() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.ScopArgInfo.dimension_offset_min)
+  return _internal_mutable_dimension_offset_min();
+}
+
+// repeated int64 dimension_offset_max = 10;
+inline int ScopArgInfo::_internal_dimension_offset_max_size() const {
+  return _impl_.dimension_offset_max_.size();
+}
+inline int ScopArgInfo::dimension_offset_max_size() const {
+  return _internal_dimension_offset_max_size();
+}
+inline void ScopArgInfo::clear_dimension_offset_max() {
+  _impl_.dimension_offset_max_.Clear();
+}
+inline int64_t ScopArgInfo::_internal_dimension_offset_max(int index) const {
+  return _impl_.dimension_offset_max_.Get(index);
+}
+inline int64_t ScopArgInfo::dimension_offset_max(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopArgInfo.dimension_offset_max)
+  return _internal_dimension_offset_max(index);
+}
+inline void ScopArgInfo::set_dimension_offset_max(int index, int64_t value) {
+  _impl_.dimension_offset_max_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopArgInfo.dimension_offset_max)
+}
+inline void ScopArgInfo::_internal_add_dimension_offset_max(int64_t value) {
+  _impl_.dimension_offset_max_.Add(value);
+}
+inline void ScopArgInfo::add_dimension_offset_max(int64_t value) {
+  _internal_add_dimension_offset_max(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.ScopArgInfo.dimension_offset_max)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+ScopArgInfo::_internal_dimension_offset_max() const {
+  return _impl_.dimension_offset_max_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+ScopArgInfo::dimension_offset_max() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.ScopArgInfo.dimension_offset_max)
+  return _internal_dimension_offset_max();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+ScopArgInfo::_internal_mutable_dimension_offset_max() {
+  return &_impl_.dimension_offset_max_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+ScopArgInfo::mutable_dimension_offset_max() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.ScopArgInfo.dimension_offset_max)
+  return _internal_mutable_dimension_offset_max();
+}
 
-// ===================================================================
+// -------------------------------------------------------------------
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
-// LLVM_IR_Req
+// ScopLoopBound
 
-// -------------------------------------------------------------------
+// optional string nameStr = 1;
+inline bool ScopLoopBound::_internal_has_namestr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ScopLoopBound::has_namestr() const {
+  return _internal_has_namestr();
+}
+inline void ScopLoopBound::clear_namestr() {
+  _impl_.namestr_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ScopLoopBound::namestr() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopLoopBound.nameStr)
+  return _internal_namestr();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScopLoopBound::set_namestr(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.namestr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopLoopBound.nameStr)
+}
+inline std::string* ScopLoopBound::mutable_namestr() {
+  std::string* _s = _internal_mutable_namestr();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopLoopBound.nameStr)
+  return _s;
+}
+inline const std::string& ScopLoopBound::_internal_namestr() const {
+  return _impl_.namestr_.Get();
+}
+inline void ScopLoopBound::_internal_set_namestr(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.namestr_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScopLoopBound::_internal_mutable_namestr() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.namestr_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScopLoopBound::release_namestr() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.ScopLoopBound.nameStr)
+  if (!_internal_has_namestr()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.namestr_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.namestr_.IsDefault()) {
+    _impl_.namestr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ScopLoopBound::set_allocated_namestr(std::string* namestr) {
+  if (namestr != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.namestr_.SetAllocated(namestr, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.namestr_.IsDefault()) {
+    _impl_.namestr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.ScopLoopBound.nameStr)
+}
 
-// BinaryData
+// optional uint64 maxValue = 2;
+inline bool ScopLoopBound::_internal_has_maxvalue() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ScopLoopBound::has_maxvalue() const {
+  return _internal_has_maxvalue();
+}
+inline void ScopLoopBound::clear_maxvalue() {
+  _impl_.maxvalue_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ScopLoopBound::_internal_maxvalue() const {
+  return _impl_.maxvalue_;
+}
+inline uint64_t ScopLoopBound::maxvalue() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopLoopBound.maxValue)
+  return _internal_maxvalue();
+}
+inline void ScopLoopBound::_internal_set_maxvalue(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.maxvalue_ = value;
+}
+inline void ScopLoopBound::set_maxvalue(uint64_t value) {
+  _internal_set_maxvalue(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopLoopBound.maxValue)
+}
 
-// optional bytes binary_data = 1;
-inline bool BinaryData::has_binary_data() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional string maxValueStr = 3;
+inline bool ScopLoopBound::_internal_has_maxvaluestr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void BinaryData::set_has_binary_data() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool ScopLoopBound::has_maxvaluestr() const {
+  return _internal_has_maxvaluestr();
 }
-inline void BinaryData::clear_has_binary_data() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void ScopLoopBound::clear_maxvaluestr() {
+  _impl_.maxvaluestr_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void BinaryData::clear_binary_data() {
-  binary_data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_binary_data();
+inline const std::string& ScopLoopBound::maxvaluestr() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopLoopBound.maxValueStr)
+  return _internal_maxvaluestr();
 }
-inline const ::std::string& BinaryData::binary_data() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.BinaryData.binary_data)
-  return binary_data_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScopLoopBound::set_maxvaluestr(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.maxvaluestr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopLoopBound.maxValueStr)
 }
-inline void BinaryData::set_binary_data(const ::std::string& value) {
-  set_has_binary_data();
-  binary_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.BinaryData.binary_data)
+inline std::string* ScopLoopBound::mutable_maxvaluestr() {
+  std::string* _s = _internal_mutable_maxvaluestr();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopLoopBound.maxValueStr)
+  return _s;
 }
-inline void BinaryData::set_binary_data(const char* value) {
-  set_has_binary_data();
-  binary_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HTROP_PB.BinaryData.binary_data)
+inline const std::string& ScopLoopBound::_internal_maxvaluestr() const {
+  return _impl_.maxvaluestr_.Get();
 }
-inline void BinaryData::set_binary_data(const void* value, size_t size) {
-  set_has_binary_data();
-  binary_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.BinaryData.binary_data)
+inline void ScopLoopBound::_internal_set_maxvaluestr(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.maxvaluestr_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* BinaryData::mutable_binary_data() {
-  set_has_binary_data();
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.BinaryData.binary_data)
-  return binary_data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* ScopLoopBound::_internal_mutable_maxvaluestr() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.maxvaluestr_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* BinaryData::release_binary_data() {
-  // @@protoc_insertion_point(field_release:HTROP_PB.BinaryData.binary_data)
-  clear_has_binary_data();
-  return binary_data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* ScopLoopBound::release_maxvaluestr() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.ScopLoopBound.maxValueStr)
+  if (!_internal_has_maxvaluestr()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.maxvaluestr_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.maxvaluestr_.IsDefault()) {
+    _impl_.maxvaluestr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void BinaryData::set_allocated_binary_data(::std::string* binary_data) {
-  if (binary_data != NULL) {
-    set_has_binary_data();
+inline void ScopLoopBound::set_allocated_maxvaluestr(std::string* maxvaluestr) {
+  if (maxvaluestr != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_binary_data();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  binary_data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), binary_data);
-  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.BinaryData.binary_data)
+  _impl_.maxvaluestr_.SetAllocated(maxvaluestr, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.maxvaluestr_.IsDefault()) {
+    _impl_.maxvaluestr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.ScopLoopBound.maxValueStr)
 }
 
 // -------------------------------------------------------------------
 
-// Message_RCRS_ScopInfo
+// ScopAnalysisInfo
 
 // optional string scopFunctionName = 1;
-inline bool Message_RCRS_ScopInfo::has_scopfunctionname() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool ScopAnalysisInfo::_internal_has_scopfunctionname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Message_RCRS_ScopInfo::set_has_scopfunctionname() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool ScopAnalysisInfo::has_scopfunctionname() const {
+  return _internal_has_scopfunctionname();
 }
-inline void Message_RCRS_ScopInfo::clear_has_scopfunctionname() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void ScopAnalysisInfo::clear_scopfunctionname() {
+  _impl_.scopfunctionname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void Message_RCRS_ScopInfo::clear_scopfunctionname() {
-  scopfunctionname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_scopfunctionname();
+inline const std::string& ScopAnalysisInfo::scopfunctionname() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopAnalysisInfo.scopFunctionName)
+  return _internal_scopfunctionname();
 }
-inline const ::std::string& Message_RCRS_ScopInfo::scopfunctionname() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
-  return scopfunctionname_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScopAnalysisInfo::set_scopfunctionname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.scopfunctionname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopAnalysisInfo.scopFunctionName)
 }
-inline void Message_RCRS_ScopInfo::set_scopfunctionname(const ::std::string& value) {
-  set_has_scopfunctionname();
-  scopfunctionname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
+inline std::string* ScopAnalysisInfo::mutable_scopfunctionname() {
+  std::string* _s = _internal_mutable_scopfunctionname();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopAnalysisInfo.scopFunctionName)
+  return _s;
 }
-inline void Message_RCRS_ScopInfo::set_scopfunctionname(const char* value) {
-  set_has_scopfunctionname();
-  scopfunctionname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
+inline const std::string& ScopAnalysisInfo::_internal_scopfunctionname() const {
+  return _impl_.scopfunctionname_.Get();
 }
-inline void Message_RCRS_ScopInfo::set_scopfunctionname(const char* value, size_t size) {
-  set_has_scopfunctionname();
-  scopfunctionname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
+inline void ScopAnalysisInfo::_internal_set_scopfunctionname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.scopfunctionname_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Message_RCRS_ScopInfo::mutable_scopfunctionname() {
-  set_has_scopfunctionname();
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
-  return scopfunctionname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* ScopAnalysisInfo::_internal_mutable_scopfunctionname() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.scopfunctionname_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Message_RCRS_ScopInfo::release_scopfunctionname() {
-  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
-  clear_has_scopfunctionname();
-  return scopfunctionname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* ScopAnalysisInfo::release_scopfunctionname() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.ScopAnalysisInfo.scopFunctionName)
+  if (!_internal_has_scopfunctionname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.scopfunctionname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopfunctionname_.IsDefault()) {
+    _impl_.scopfunctionname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void Message_RCRS_ScopInfo::set_allocated_scopfunctionname(::std::string* scopfunctionname) {
-  if (scopfunctionname != NULL) {
-    set_has_scopfunctionname();
+inline void ScopAnalysisInfo::set_allocated_scopfunctionname(std::string* scopfunctionname) {
+  if (scopfunctionname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_scopfunctionname();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  scopfunctionname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), scopfunctionname);
-  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RCRS.ScopInfo.scopFunctionName)
+  _impl_.scopfunctionname_.SetAllocated(scopfunctionname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopfunctionname_.IsDefault()) {
+    _impl_.scopfunctionname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.ScopAnalysisInfo.scopFunctionName)
 }
 
-// optional uint32 max_codegen_loop_depth = 2;
-inline bool Message_RCRS_ScopInfo::has_max_codegen_loop_depth() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional string scopFunctionParentName = 2;
+inline bool ScopAnalysisInfo::_internal_has_scopfunctionparentname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Message_RCRS_ScopInfo::set_has_max_codegen_loop_depth() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool ScopAnalysisInfo::has_scopfunctionparentname() const {
+  return _internal_has_scopfunctionparentname();
 }
-inline void Message_RCRS_ScopInfo::clear_has_max_codegen_loop_depth() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void ScopAnalysisInfo::clear_scopfunctionparentname() {
+  _impl_.scopfunctionparentname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Message_RCRS_ScopInfo::clear_max_codegen_loop_depth() {
-  max_codegen_loop_depth_ = 0u;
-  clear_has_max_codegen_loop_depth();
+inline const std::string& ScopAnalysisInfo::scopfunctionparentname() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopAnalysisInfo.scopFunctionParentName)
+  return _internal_scopfunctionparentname();
 }
-inline ::google::protobuf::uint32 Message_RCRS_ScopInfo::max_codegen_loop_depth() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.ScopInfo.max_codegen_loop_depth)
-  return max_codegen_loop_depth_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScopAnalysisInfo::set_scopfunctionparentname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.scopfunctionparentname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopAnalysisInfo.scopFunctionParentName)
 }
-inline void Message_RCRS_ScopInfo::set_max_codegen_loop_depth(::google::protobuf::uint32 value) {
-  set_has_max_codegen_loop_depth();
-  max_codegen_loop_depth_ = value;
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.ScopInfo.max_codegen_loop_depth)
+inline std::string* ScopAnalysisInfo::mutable_scopfunctionparentname() {
+  std::string* _s = _internal_mutable_scopfunctionparentname();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopAnalysisInfo.scopFunctionParentName)
+  return _s;
+}
+inline const std::string& ScopAnalysisInfo::_internal_scopfunctionparentname() const {
+  return _impl_.scopfunctionparentname_.Get();
+}
+inline void ScopAnalysisInfo::_internal_set_scopfunctionparentname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.scopfunctionparentname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScopAnalysisInfo::_internal_mutable_scopfunctionparentname() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.scopfunctionparentname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScopAnalysisInfo::release_scopfunctionparentname() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.ScopAnalysisInfo.scopFunctionParentName)
+  if (!_internal_has_scopfunctionparentname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.scopfunctionparentname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopfunctionparentname_.IsDefault()) {
+    _impl_.scopfunctionparentname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ScopAnalysisInfo::set_allocated_scopfunctionparentname(std::string* scopfunctionparentname) {
+  if (scopfunctionparentname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.scopfunctionparentname_.SetAllocated(scopfunctionparentname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopfunctionparentname_.IsDefault()) {
+    _impl_.scopfunctionparentname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.ScopAnalysisInfo.scopFunctionParentName)
 }
 
-// -------------------------------------------------------------------
+// repeated .HTROP_PB.ScopArgInfo scopFunctionArgs = 3;
+inline int ScopAnalysisInfo::_internal_scopfunctionargs_size() const {
+  return _impl_.scopfunctionargs_.size();
+}
+inline int ScopAnalysisInfo::scopfunctionargs_size() const {
+  return _internal_scopfunctionargs_size();
+}
+inline void ScopAnalysisInfo::clear_scopfunctionargs() {
+  _impl_.scopfunctionargs_.Clear();
+}
+inline ::HTROP_PB::ScopArgInfo* ScopAnalysisInfo::mutable_scopfunctionargs(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopAnalysisInfo.scopFunctionArgs)
+  return _impl_.scopfunctionargs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopArgInfo >*
+ScopAnalysisInfo::mutable_scopfunctionargs() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.ScopAnalysisInfo.scopFunctionArgs)
+  return &_impl_.scopfunctionargs_;
+}
+inline const ::HTROP_PB::ScopArgInfo& ScopAnalysisInfo::_internal_scopfunctionargs(int index) const {
+  return _impl_.scopfunctionargs_.Get(index);
+}
+inline const ::HTROP_PB::ScopArgInfo& ScopAnalysisInfo::scopfunctionargs(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopAnalysisInfo.scopFunctionArgs)
+  return _internal_scopfunctionargs(index);
+}
+inline ::HTROP_PB::ScopArgInfo* ScopAnalysisInfo::_internal_add_scopfunctionargs() {
+  return _impl_.scopfunctionargs_.Add();
+}
+inline ::HTROP_PB::ScopArgInfo* ScopAnalysisInfo::add_scopfunctionargs() {
+  ::HTROP_PB::ScopArgInfo* _add = _internal_add_scopfunctionargs();
+  // @@protoc_insertion_point(field_add:HTROP_PB.ScopAnalysisInfo.scopFunctionArgs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopArgInfo >&
+ScopAnalysisInfo::scopfunctionargs() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.ScopAnalysisInfo.scopFunctionArgs)
+  return _impl_.scopfunctionargs_;
+}
 
-// Message_RCRS
+// repeated .HTROP_PB.ScopLoopBound scopLoops = 4;
+inline int ScopAnalysisInfo::_internal_scoploops_size() const {
+  return _impl_.scoploops_.size();
+}
+inline int ScopAnalysisInfo::scoploops_size() const {
+  return _internal_scoploops_size();
+}
+inline void ScopAnalysisInfo::clear_scoploops() {
+  _impl_.scoploops_.Clear();
+}
+inline ::HTROP_PB::ScopLoopBound* ScopAnalysisInfo::mutable_scoploops(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopAnalysisInfo.scopLoops)
+  return _impl_.scoploops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopLoopBound >*
+ScopAnalysisInfo::mutable_scoploops() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.ScopAnalysisInfo.scopLoops)
+  return &_impl_.scoploops_;
+}
+inline const ::HTROP_PB::ScopLoopBound& ScopAnalysisInfo::_internal_scoploops(int index) const {
+  return _impl_.scoploops_.Get(index);
+}
+inline const ::HTROP_PB::ScopLoopBound& ScopAnalysisInfo::scoploops(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopAnalysisInfo.scopLoops)
+  return _internal_scoploops(index);
+}
+inline ::HTROP_PB::ScopLoopBound* ScopAnalysisInfo::_internal_add_scoploops() {
+  return _impl_.scoploops_.Add();
+}
+inline ::HTROP_PB::ScopLoopBound* ScopAnalysisInfo::add_scoploops() {
+  ::HTROP_PB::ScopLoopBound* _add = _internal_add_scoploops();
+  // @@protoc_insertion_point(field_add:HTROP_PB.ScopAnalysisInfo.scopLoops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopLoopBound >&
+ScopAnalysisInfo::scoploops() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.ScopAnalysisInfo.scopLoops)
+  return _impl_.scoploops_;
+}
 
-// repeated .HTROP_PB.Message_RCRS.ScopInfo scopList = 1;
-inline int Message_RCRS::scoplist_size() const {
-  return scoplist_.size();
+// optional uint32 maxParallelizationDepth = 5;
+inline bool ScopAnalysisInfo::_internal_has_maxparallelizationdepth() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void Message_RCRS::clear_scoplist() {
-  scoplist_.Clear();
+inline bool ScopAnalysisInfo::has_maxparallelizationdepth() const {
+  return _internal_has_maxparallelizationdepth();
 }
-inline const ::HTROP_PB::Message_RCRS_ScopInfo& Message_RCRS::scoplist(int index) const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.scopList)
-  return scoplist_.Get(index);
+inline void ScopAnalysisInfo::clear_maxparallelizationdepth() {
+  _impl_.maxparallelizationdepth_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline ::HTROP_PB::Message_RCRS_ScopInfo* Message_RCRS::mutable_scoplist(int index) {
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.scopList)
-  return scoplist_.Mutable(index);
+inline uint32_t ScopAnalysisInfo::_internal_maxparallelizationdepth() const {
+  return _impl_.maxparallelizationdepth_;
 }
-inline ::HTROP_PB::Message_RCRS_ScopInfo* Message_RCRS::add_scoplist() {
-  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RCRS.scopList)
-  return scoplist_.Add();
+inline uint32_t ScopAnalysisInfo::maxparallelizationdepth() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopAnalysisInfo.maxParallelizationDepth)
+  return _internal_maxparallelizationdepth();
 }
-inline ::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RCRS_ScopInfo >*
-Message_RCRS::mutable_scoplist() {
-  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RCRS.scopList)
-  return &scoplist_;
+inline void ScopAnalysisInfo::_internal_set_maxparallelizationdepth(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.maxparallelizationdepth_ = value;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RCRS_ScopInfo >&
-Message_RCRS::scoplist() const {
-  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RCRS.scopList)
-  return scoplist_;
+inline void ScopAnalysisInfo::set_maxparallelizationdepth(uint32_t value) {
+  _internal_set_maxparallelizationdepth(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopAnalysisInfo.maxParallelizationDepth)
 }
 
-// optional string scopFunctionParentName = 2;
-inline bool Message_RCRS::has_scopfunctionparentname() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional .HTROP_PB.ReductionHint reduction = 6;
+inline bool ScopAnalysisInfo::_internal_has_reduction() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.reduction_ != nullptr);
+  return value;
 }
-inline void Message_RCRS::set_has_scopfunctionparentname() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool ScopAnalysisInfo::has_reduction() const {
+  return _internal_has_reduction();
 }
-inline void Message_RCRS::clear_has_scopfunctionparentname() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void ScopAnalysisInfo::clear_reduction() {
+  if (_impl_.reduction_ != nullptr) _impl_.reduction_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void Message_RCRS::clear_scopfunctionparentname() {
-  scopfunctionparentname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_scopfunctionparentname();
+inline const ::HTROP_PB::ReductionHint& ScopAnalysisInfo::_internal_reduction() const {
+  const ::HTROP_PB::ReductionHint* p = _impl_.reduction_;
+  return p != nullptr ? *p : reinterpret_cast<const ::HTROP_PB::ReductionHint&>(
+      ::HTROP_PB::_ReductionHint_default_instance_);
 }
-inline const ::std::string& Message_RCRS::scopfunctionparentname() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS.scopFunctionParentName)
-  return scopfunctionparentname_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::HTROP_PB::ReductionHint& ScopAnalysisInfo::reduction() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopAnalysisInfo.reduction)
+  return _internal_reduction();
 }
-inline void Message_RCRS::set_scopfunctionparentname(const ::std::string& value) {
-  set_has_scopfunctionparentname();
-  scopfunctionparentname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS.scopFunctionParentName)
+inline void ScopAnalysisInfo::unsafe_arena_set_allocated_reduction(
+    ::HTROP_PB::ReductionHint* reduction) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.reduction_);
+  }
+  _impl_.reduction_ = reduction;
+  if (reduction) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:HTROP_PB.ScopAnalysisInfo.reduction)
 }
-inline void Message_RCRS::set_scopfunctionparentname(const char* value) {
-  set_has_scopfunctionparentname();
-  scopfunctionparentname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HTROP_PB.Message_RCRS.scopFunctionParentName)
+inline ::HTROP_PB::ReductionHint* ScopAnalysisInfo::release_reduction() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::HTROP_PB::ReductionHint* temp = _impl_.reduction_;
+  _impl_.reduction_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void Message_RCRS::set_scopfunctionparentname(const char* value, size_t size) {
-  set_has_scopfunctionparentname();
-  scopfunctionparentname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.Message_RCRS.scopFunctionParentName)
+inline ::HTROP_PB::ReductionHint* ScopAnalysisInfo::unsafe_arena_release_reduction() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.ScopAnalysisInfo.reduction)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::HTROP_PB::ReductionHint* temp = _impl_.reduction_;
+  _impl_.reduction_ = nullptr;
+  return temp;
 }
-inline ::std::string* Message_RCRS::mutable_scopfunctionparentname() {
-  set_has_scopfunctionparentname();
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RCRS.scopFunctionParentName)
-  return scopfunctionparentname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::HTROP_PB::ReductionHint* ScopAnalysisInfo::_internal_mutable_reduction() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.reduction_ == nullptr) {
+    auto* p = CreateMaybeMessage<::HTROP_PB::ReductionHint>(GetArenaForAllocation());
+    _impl_.reduction_ = p;
+  }
+  return _impl_.reduction_;
 }
-inline ::std::string* Message_RCRS::release_scopfunctionparentname() {
-  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RCRS.scopFunctionParentName)
-  clear_has_scopfunctionparentname();
-  return scopfunctionparentname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::HTROP_PB::ReductionHint* ScopAnalysisInfo::mutable_reduction() {
+  ::HTROP_PB::ReductionHint* _msg = _internal_mutable_reduction();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopAnalysisInfo.reduction)
+  return _msg;
 }
-inline void Message_RCRS::set_allocated_scopfunctionparentname(::std::string* scopfunctionparentname) {
-  if (scopfunctionparentname != NULL) {
-    set_has_scopfunctionparentname();
+inline void ScopAnalysisInfo::set_allocated_reduction(::HTROP_PB::ReductionHint* reduction) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.reduction_;
+  }
+  if (reduction) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reduction);
+    if (message_arena != submessage_arena) {
+      reduction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reduction, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_scopfunctionparentname();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  scopfunctionparentname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), scopfunctionparentname);
-  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RCRS.scopFunctionParentName)
+  _impl_.reduction_ = reduction;
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.ScopAnalysisInfo.reduction)
 }
 
-// -------------------------------------------------------------------
-
-// Message_RSRC_ScopFunctionOCLInfo
+// optional uint32 wavefront_skew = 7;
+inline bool ScopAnalysisInfo::_internal_has_wavefront_skew() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ScopAnalysisInfo::has_wavefront_skew() const {
+  return _internal_has_wavefront_skew();
+}
+inline void ScopAnalysisInfo::clear_wavefront_skew() {
+  _impl_.wavefront_skew_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t ScopAnalysisInfo::_internal_wavefront_skew() const {
+  return _impl_.wavefront_skew_;
+}
+inline uint32_t ScopAnalysisInfo::wavefront_skew() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopAnalysisInfo.wavefront_skew)
+  return _internal_wavefront_skew();
+}
+inline void ScopAnalysisInfo::_internal_set_wavefront_skew(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.wavefront_skew_ = value;
+}
+inline void ScopAnalysisInfo::set_wavefront_skew(uint32_t value) {
+  _internal_set_wavefront_skew(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.ScopAnalysisInfo.wavefront_skew)
+}
 
-// optional string scopFunctionName = 1;
-inline bool Message_RSRC_ScopFunctionOCLInfo::has_scopfunctionname() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional .HTROP_PB.ScatterHint scatter = 8;
+inline bool ScopAnalysisInfo::_internal_has_scatter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.scatter_ != nullptr);
+  return value;
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::set_has_scopfunctionname() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool ScopAnalysisInfo::has_scatter() const {
+  return _internal_has_scatter();
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::clear_has_scopfunctionname() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void ScopAnalysisInfo::clear_scatter() {
+  if (_impl_.scatter_ != nullptr) _impl_.scatter_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::clear_scopfunctionname() {
-  scopfunctionname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_scopfunctionname();
+inline const ::HTROP_PB::ScatterHint& ScopAnalysisInfo::_internal_scatter() const {
+  const ::HTROP_PB::ScatterHint* p = _impl_.scatter_;
+  return p != nullptr ? *p : reinterpret_cast<const ::HTROP_PB::ScatterHint&>(
+      ::HTROP_PB::_ScatterHint_default_instance_);
 }
-inline const ::std::string& Message_RSRC_ScopFunctionOCLInfo::scopfunctionname() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
-  return scopfunctionname_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::HTROP_PB::ScatterHint& ScopAnalysisInfo::scatter() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopAnalysisInfo.scatter)
+  return _internal_scatter();
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::set_scopfunctionname(const ::std::string& value) {
-  set_has_scopfunctionname();
-  scopfunctionname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
+inline void ScopAnalysisInfo::unsafe_arena_set_allocated_scatter(
+    ::HTROP_PB::ScatterHint* scatter) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.scatter_);
+  }
+  _impl_.scatter_ = scatter;
+  if (scatter) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:HTROP_PB.ScopAnalysisInfo.scatter)
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::set_scopfunctionname(const char* value) {
-  set_has_scopfunctionname();
-  scopfunctionname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
+inline ::HTROP_PB::ScatterHint* ScopAnalysisInfo::release_scatter() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::HTROP_PB::ScatterHint* temp = _impl_.scatter_;
+  _impl_.scatter_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::set_scopfunctionname(const char* value, size_t size) {
-  set_has_scopfunctionname();
-  scopfunctionname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
+inline ::HTROP_PB::ScatterHint* ScopAnalysisInfo::unsafe_arena_release_scatter() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.ScopAnalysisInfo.scatter)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::HTROP_PB::ScatterHint* temp = _impl_.scatter_;
+  _impl_.scatter_ = nullptr;
+  return temp;
 }
-inline ::std::string* Message_RSRC_ScopFunctionOCLInfo::mutable_scopfunctionname() {
-  set_has_scopfunctionname();
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
-  return scopfunctionname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::HTROP_PB::ScatterHint* ScopAnalysisInfo::_internal_mutable_scatter() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.scatter_ == nullptr) {
+    auto* p = CreateMaybeMessage<::HTROP_PB::ScatterHint>(GetArenaForAllocation());
+    _impl_.scatter_ = p;
+  }
+  return _impl_.scatter_;
 }
-inline ::std::string* Message_RSRC_ScopFunctionOCLInfo::release_scopfunctionname() {
-  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
-  clear_has_scopfunctionname();
-  return scopfunctionname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::HTROP_PB::ScatterHint* ScopAnalysisInfo::mutable_scatter() {
+  ::HTROP_PB::ScatterHint* _msg = _internal_mutable_scatter();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopAnalysisInfo.scatter)
+  return _msg;
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::set_allocated_scopfunctionname(::std::string* scopfunctionname) {
-  if (scopfunctionname != NULL) {
-    set_has_scopfunctionname();
+inline void ScopAnalysisInfo::set_allocated_scatter(::HTROP_PB::ScatterHint* scatter) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.scatter_;
+  }
+  if (scatter) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(scatter);
+    if (message_arena != submessage_arena) {
+      scatter = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, scatter, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_scopfunctionname();
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  scopfunctionname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), scopfunctionname);
-  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopFunctionName)
+  _impl_.scatter_ = scatter;
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.ScopAnalysisInfo.scatter)
 }
 
-// optional string scopOCLKernelName = 2;
-inline bool Message_RSRC_ScopFunctionOCLInfo::has_scopoclkernelname() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// -------------------------------------------------------------------
+
+// Message_RCRS_Analysis
+
+// repeated int32 max_scop_loop_depth = 1;
+inline int Message_RCRS_Analysis::_internal_max_scop_loop_depth_size() const {
+  return _impl_.max_scop_loop_depth_.size();
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::set_has_scopoclkernelname() {
-  _has_bits_[0] |= 0x00000002u;
+inline int Message_RCRS_Analysis::max_scop_loop_depth_size() const {
+  return _internal_max_scop_loop_depth_size();
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::clear_has_scopoclkernelname() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void Message_RCRS_Analysis::clear_max_scop_loop_depth() {
+  _impl_.max_scop_loop_depth_.Clear();
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::clear_scopoclkernelname() {
-  scopoclkernelname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_scopoclkernelname();
+inline int32_t Message_RCRS_Analysis::_internal_max_scop_loop_depth(int index) const {
+  return _impl_.max_scop_loop_depth_.Get(index);
 }
-inline const ::std::string& Message_RSRC_ScopFunctionOCLInfo::scopoclkernelname() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
-  return scopoclkernelname_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline int32_t Message_RCRS_Analysis::max_scop_loop_depth(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS_Analysis.max_scop_loop_depth)
+  return _internal_max_scop_loop_depth(index);
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::set_scopoclkernelname(const ::std::string& value) {
-  set_has_scopoclkernelname();
-  scopoclkernelname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
+inline void Message_RCRS_Analysis::set_max_scop_loop_depth(int index, int32_t value) {
+  _impl_.max_scop_loop_depth_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS_Analysis.max_scop_loop_depth)
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::set_scopoclkernelname(const char* value) {
-  set_has_scopoclkernelname();
-  scopoclkernelname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
+inline void Message_RCRS_Analysis::_internal_add_max_scop_loop_depth(int32_t value) {
+  _impl_.max_scop_loop_depth_.Add(value);
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::set_scopoclkernelname(const char* value, size_t size) {
-  set_has_scopoclkernelname();
-  scopoclkernelname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
+inline void Message_RCRS_Analysis::add_max_scop_loop_depth(int32_t value) {
+  _internal_add_max_scop_loop_depth(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RCRS_Analysis.max_scop_loop_depth)
 }
-inline ::std::string* Message_RSRC_ScopFunctionOCLInfo::mutable_scopoclkernelname() {
-  set_has_scopoclkernelname();
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
-  return scopoclkernelname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Message_RCRS_Analysis::_internal_max_scop_loop_depth() const {
+  return _impl_.max_scop_loop_depth_;
 }
-inline ::std::string* Message_RSRC_ScopFunctionOCLInfo::release_scopoclkernelname() {
-  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
-  clear_has_scopoclkernelname();
-  return scopoclkernelname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Message_RCRS_Analysis::max_scop_loop_depth() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RCRS_Analysis.max_scop_loop_depth)
+  return _internal_max_scop_loop_depth();
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::set_allocated_scopoclkernelname(::std::string* scopoclkernelname) {
-  if (scopoclkernelname != NULL) {
-    set_has_scopoclkernelname();
-  } else {
-    clear_has_scopoclkernelname();
-  }
-  scopoclkernelname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), scopoclkernelname);
-  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.scopOCLKernelName)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Message_RCRS_Analysis::_internal_mutable_max_scop_loop_depth() {
+  return &_impl_.max_scop_loop_depth_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Message_RCRS_Analysis::mutable_max_scop_loop_depth() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RCRS_Analysis.max_scop_loop_depth)
+  return _internal_mutable_max_scop_loop_depth();
 }
 
-// repeated int32 workgroup_arg_index = 3;
-inline int Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index_size() const {
-  return workgroup_arg_index_.size();
+// repeated int32 max_codegen_loop_depth = 2;
+inline int Message_RCRS_Analysis::_internal_max_codegen_loop_depth_size() const {
+  return _impl_.max_codegen_loop_depth_.size();
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::clear_workgroup_arg_index() {
-  workgroup_arg_index_.Clear();
+inline int Message_RCRS_Analysis::max_codegen_loop_depth_size() const {
+  return _internal_max_codegen_loop_depth_size();
 }
-inline ::google::protobuf::int32 Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index(int index) const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
-  return workgroup_arg_index_.Get(index);
+inline void Message_RCRS_Analysis::clear_max_codegen_loop_depth() {
+  _impl_.max_codegen_loop_depth_.Clear();
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::set_workgroup_arg_index(int index, ::google::protobuf::int32 value) {
-  workgroup_arg_index_.Set(index, value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
+inline int32_t Message_RCRS_Analysis::_internal_max_codegen_loop_depth(int index) const {
+  return _impl_.max_codegen_loop_depth_.Get(index);
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::add_workgroup_arg_index(::google::protobuf::int32 value) {
-  workgroup_arg_index_.Add(value);
-  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
+inline int32_t Message_RCRS_Analysis::max_codegen_loop_depth(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS_Analysis.max_codegen_loop_depth)
+  return _internal_max_codegen_loop_depth(index);
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index() const {
-  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
-  return workgroup_arg_index_;
+inline void Message_RCRS_Analysis::set_max_codegen_loop_depth(int index, int32_t value) {
+  _impl_.max_codegen_loop_depth_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS_Analysis.max_codegen_loop_depth)
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-Message_RSRC_ScopFunctionOCLInfo::mutable_workgroup_arg_index() {
-  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index)
-  return &workgroup_arg_index_;
+inline void Message_RCRS_Analysis::_internal_add_max_codegen_loop_depth(int32_t value) {
+  _impl_.max_codegen_loop_depth_.Add(value);
+}
+inline void Message_RCRS_Analysis::add_max_codegen_loop_depth(int32_t value) {
+  _internal_add_max_codegen_loop_depth(value);
+  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RCRS_Analysis.max_codegen_loop_depth)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Message_RCRS_Analysis::_internal_max_codegen_loop_depth() const {
+  return _impl_.max_codegen_loop_depth_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Message_RCRS_Analysis::max_codegen_loop_depth() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RCRS_Analysis.max_codegen_loop_depth)
+  return _internal_max_codegen_loop_depth();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Message_RCRS_Analysis::_internal_mutable_max_codegen_loop_depth() {
+  return &_impl_.max_codegen_loop_depth_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Message_RCRS_Analysis::mutable_max_codegen_loop_depth() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RCRS_Analysis.max_codegen_loop_depth)
+  return _internal_mutable_max_codegen_loop_depth();
 }
 
-// repeated int32 workgroup_arg_index_offset = 4;
-inline int Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index_offset_size() const {
-  return workgroup_arg_index_offset_.size();
+// optional uint32 moduleSize = 3;
+inline bool Message_RCRS_Analysis::_internal_has_modulesize() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::clear_workgroup_arg_index_offset() {
-  workgroup_arg_index_offset_.Clear();
+inline bool Message_RCRS_Analysis::has_modulesize() const {
+  return _internal_has_modulesize();
 }
-inline ::google::protobuf::int32 Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index_offset(int index) const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
-  return workgroup_arg_index_offset_.Get(index);
+inline void Message_RCRS_Analysis::clear_modulesize() {
+  _impl_.modulesize_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::set_workgroup_arg_index_offset(int index, ::google::protobuf::int32 value) {
-  workgroup_arg_index_offset_.Set(index, value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
+inline uint32_t Message_RCRS_Analysis::_internal_modulesize() const {
+  return _impl_.modulesize_;
 }
-inline void Message_RSRC_ScopFunctionOCLInfo::add_workgroup_arg_index_offset(::google::protobuf::int32 value) {
-  workgroup_arg_index_offset_.Add(value);
-  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
+inline uint32_t Message_RCRS_Analysis::modulesize() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS_Analysis.moduleSize)
+  return _internal_modulesize();
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-Message_RSRC_ScopFunctionOCLInfo::workgroup_arg_index_offset() const {
-  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
-  return workgroup_arg_index_offset_;
+inline void Message_RCRS_Analysis::_internal_set_modulesize(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.modulesize_ = value;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-Message_RSRC_ScopFunctionOCLInfo::mutable_workgroup_arg_index_offset() {
-  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.ScopFunctionOCLInfo.workgroup_arg_index_offset)
-  return &workgroup_arg_index_offset_;
+inline void Message_RCRS_Analysis::set_modulesize(uint32_t value) {
+  _internal_set_modulesize(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS_Analysis.moduleSize)
+}
+
+// optional bool optimize_schedule = 4;
+inline bool Message_RCRS_Analysis::_internal_has_optimize_schedule() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Message_RCRS_Analysis::has_optimize_schedule() const {
+  return _internal_has_optimize_schedule();
+}
+inline void Message_RCRS_Analysis::clear_optimize_schedule() {
+  _impl_.optimize_schedule_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool Message_RCRS_Analysis::_internal_optimize_schedule() const {
+  return _impl_.optimize_schedule_;
+}
+inline bool Message_RCRS_Analysis::optimize_schedule() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RCRS_Analysis.optimize_schedule)
+  return _internal_optimize_schedule();
+}
+inline void Message_RCRS_Analysis::_internal_set_optimize_schedule(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.optimize_schedule_ = value;
+}
+inline void Message_RCRS_Analysis::set_optimize_schedule(bool value) {
+  _internal_set_optimize_schedule(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RCRS_Analysis.optimize_schedule)
 }
 
 // -------------------------------------------------------------------
 
-// Message_RSRC
+// Message_RSRC_Analysis
 
-// repeated .HTROP_PB.Message_RSRC.ScopFunctionOCLInfo scopFunctions = 1;
-inline int Message_RSRC::scopfunctions_size() const {
-  return scopfunctions_.size();
+// optional uint32 resultSize = 1;
+inline bool Message_RSRC_Analysis::_internal_has_resultsize() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Message_RSRC::clear_scopfunctions() {
-  scopfunctions_.Clear();
+inline bool Message_RSRC_Analysis::has_resultsize() const {
+  return _internal_has_resultsize();
 }
-inline const ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo& Message_RSRC::scopfunctions(int index) const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.scopFunctions)
-  return scopfunctions_.Get(index);
+inline void Message_RSRC_Analysis::clear_resultsize() {
+  _impl_.resultsize_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC::mutable_scopfunctions(int index) {
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.scopFunctions)
-  return scopfunctions_.Mutable(index);
+inline uint32_t Message_RSRC_Analysis::_internal_resultsize() const {
+  return _impl_.resultsize_;
 }
-inline ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo* Message_RSRC::add_scopfunctions() {
-  // @@protoc_insertion_point(field_add:HTROP_PB.Message_RSRC.scopFunctions)
-  return scopfunctions_.Add();
+inline uint32_t Message_RSRC_Analysis::resultsize() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC_Analysis.resultSize)
+  return _internal_resultsize();
 }
-inline ::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >*
-Message_RSRC::mutable_scopfunctions() {
-  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.Message_RSRC.scopFunctions)
-  return &scopfunctions_;
+inline void Message_RSRC_Analysis::_internal_set_resultsize(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.resultsize_ = value;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::HTROP_PB::Message_RSRC_ScopFunctionOCLInfo >&
-Message_RSRC::scopfunctions() const {
-  // @@protoc_insertion_point(field_list:HTROP_PB.Message_RSRC.scopFunctions)
-  return scopfunctions_;
+inline void Message_RSRC_Analysis::set_resultsize(uint32_t value) {
+  _internal_set_resultsize(value);
+  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC_Analysis.resultSize)
 }
 
-// optional string oclKernelFileName = 2;
-inline bool Message_RSRC::has_oclkernelfilename() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// -------------------------------------------------------------------
+
+// ScopAnalysisResult
+
+// repeated .HTROP_PB.ScopAnalysisInfo scops = 1;
+inline int ScopAnalysisResult::_internal_scops_size() const {
+  return _impl_.scops_.size();
 }
-inline void Message_RSRC::set_has_oclkernelfilename() {
-  _has_bits_[0] |= 0x00000002u;
+inline int ScopAnalysisResult::scops_size() const {
+  return _internal_scops_size();
 }
-inline void Message_RSRC::clear_has_oclkernelfilename() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void ScopAnalysisResult::clear_scops() {
+  _impl_.scops_.Clear();
 }
-inline void Message_RSRC::clear_oclkernelfilename() {
-  oclkernelfilename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_oclkernelfilename();
+inline ::HTROP_PB::ScopAnalysisInfo* ScopAnalysisResult::mutable_scops(int index) {
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopAnalysisResult.scops)
+  return _impl_.scops_.Mutable(index);
 }
-inline const ::std::string& Message_RSRC::oclkernelfilename() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.oclKernelFileName)
-  return oclkernelfilename_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopAnalysisInfo >*
+ScopAnalysisResult::mutable_scops() {
+  // @@protoc_insertion_point(field_mutable_list:HTROP_PB.ScopAnalysisResult.scops)
+  return &_impl_.scops_;
 }
-inline void Message_RSRC::set_oclkernelfilename(const ::std::string& value) {
-  set_has_oclkernelfilename();
-  oclkernelfilename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.oclKernelFileName)
+inline const ::HTROP_PB::ScopAnalysisInfo& ScopAnalysisResult::_internal_scops(int index) const {
+  return _impl_.scops_.Get(index);
 }
-inline void Message_RSRC::set_oclkernelfilename(const char* value) {
-  set_has_oclkernelfilename();
-  oclkernelfilename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:HTROP_PB.Message_RSRC.oclKernelFileName)
+inline const ::HTROP_PB::ScopAnalysisInfo& ScopAnalysisResult::scops(int index) const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopAnalysisResult.scops)
+  return _internal_scops(index);
 }
-inline void Message_RSRC::set_oclkernelfilename(const char* value, size_t size) {
-  set_has_oclkernelfilename();
-  oclkernelfilename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:HTROP_PB.Message_RSRC.oclKernelFileName)
+inline ::HTROP_PB::ScopAnalysisInfo* ScopAnalysisResult::_internal_add_scops() {
+  return _impl_.scops_.Add();
 }
-inline ::std::string* Message_RSRC::mutable_oclkernelfilename() {
-  set_has_oclkernelfilename();
-  // @@protoc_insertion_point(field_mutable:HTROP_PB.Message_RSRC.oclKernelFileName)
-  return oclkernelfilename_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::HTROP_PB::ScopAnalysisInfo* ScopAnalysisResult::add_scops() {
+  ::HTROP_PB::ScopAnalysisInfo* _add = _internal_add_scops();
+  // @@protoc_insertion_point(field_add:HTROP_PB.ScopAnalysisResult.scops)
+  return _add;
 }
-inline ::std::string* Message_RSRC::release_oclkernelfilename() {
-  // @@protoc_insertion_point(field_release:HTROP_PB.Message_RSRC.oclKernelFileName)
-  clear_has_oclkernelfilename();
-  return oclkernelfilename_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HTROP_PB::ScopAnalysisInfo >&
+ScopAnalysisResult::scops() const {
+  // @@protoc_insertion_point(field_list:HTROP_PB.ScopAnalysisResult.scops)
+  return _impl_.scops_;
+}
+
+// optional .HTROP_PB.Message_RSRC codeGen = 2;
+inline bool ScopAnalysisResult::_internal_has_codegen() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.codegen_ != nullptr);
+  return value;
+}
+inline bool ScopAnalysisResult::has_codegen() const {
+  return _internal_has_codegen();
+}
+inline void ScopAnalysisResult::clear_codegen() {
+  if (_impl_.codegen_ != nullptr) _impl_.codegen_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::HTROP_PB::Message_RSRC& ScopAnalysisResult::_internal_codegen() const {
+  const ::HTROP_PB::Message_RSRC* p = _impl_.codegen_;
+  return p != nullptr ? *p : reinterpret_cast<const ::HTROP_PB::Message_RSRC&>(
+      ::HTROP_PB::_Message_RSRC_default_instance_);
+}
+inline const ::HTROP_PB::Message_RSRC& ScopAnalysisResult::codegen() const {
+  // @@protoc_insertion_point(field_get:HTROP_PB.ScopAnalysisResult.codeGen)
+  return _internal_codegen();
 }
-inline void Message_RSRC::set_allocated_oclkernelfilename(::std::string* oclkernelfilename) {
-  if (oclkernelfilename != NULL) {
-    set_has_oclkernelfilename();
+inline void ScopAnalysisResult::unsafe_arena_set_allocated_codegen(
+    ::HTROP_PB::Message_RSRC* codegen) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.codegen_);
+  }
+  _impl_.codegen_ = codegen;
+  if (codegen) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_oclkernelfilename();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  oclkernelfilename_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), oclkernelfilename);
-  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.Message_RSRC.oclKernelFileName)
-}
-
-// optional uint32 binarySize = 3;
-inline bool Message_RSRC::has_binarysize() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:HTROP_PB.ScopAnalysisResult.codeGen)
 }
-inline void Message_RSRC::set_has_binarysize() {
-  _has_bits_[0] |= 0x00000004u;
+inline ::HTROP_PB::Message_RSRC* ScopAnalysisResult::release_codegen() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::HTROP_PB::Message_RSRC* temp = _impl_.codegen_;
+  _impl_.codegen_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void Message_RSRC::clear_has_binarysize() {
-  _has_bits_[0] &= ~0x00000004u;
+inline ::HTROP_PB::Message_RSRC* ScopAnalysisResult::unsafe_arena_release_codegen() {
+  // @@protoc_insertion_point(field_release:HTROP_PB.ScopAnalysisResult.codeGen)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::HTROP_PB::Message_RSRC* temp = _impl_.codegen_;
+  _impl_.codegen_ = nullptr;
+  return temp;
 }
-inline void Message_RSRC::clear_binarysize() {
-  binarysize_ = 0u;
-  clear_has_binarysize();
+inline ::HTROP_PB::Message_RSRC* ScopAnalysisResult::_internal_mutable_codegen() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.codegen_ == nullptr) {
+    auto* p = CreateMaybeMessage<::HTROP_PB::Message_RSRC>(GetArenaForAllocation());
+    _impl_.codegen_ = p;
+  }
+  return _impl_.codegen_;
 }
-inline ::google::protobuf::uint32 Message_RSRC::binarysize() const {
-  // @@protoc_insertion_point(field_get:HTROP_PB.Message_RSRC.binarySize)
-  return binarysize_;
+inline ::HTROP_PB::Message_RSRC* ScopAnalysisResult::mutable_codegen() {
+  ::HTROP_PB::Message_RSRC* _msg = _internal_mutable_codegen();
+  // @@protoc_insertion_point(field_mutable:HTROP_PB.ScopAnalysisResult.codeGen)
+  return _msg;
 }
-inline void Message_RSRC::set_binarysize(::google::protobuf::uint32 value) {
-  set_has_binarysize();
-  binarysize_ = value;
-  // @@protoc_insertion_point(field_set:HTROP_PB.Message_RSRC.binarySize)
+inline void ScopAnalysisResult::set_allocated_codegen(::HTROP_PB::Message_RSRC* codegen) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.codegen_;
+  }
+  if (codegen) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(codegen);
+    if (message_arena != submessage_arena) {
+      codegen = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, codegen, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.codegen_ = codegen;
+  // @@protoc_insertion_point(field_set_allocated:HTROP_PB.ScopAnalysisResult.codeGen)
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -1245,4 +8708,5 @@ inline void Message_RSRC::set_binarysize(::google::protobuf::uint32 value) {
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_hds_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_hds_2eproto
@@ -0,0 +1,158 @@
+//    Copyright (c) 2019 University of Paderborn 
+//                         (Gavin Vaz <gavin.vaz@uni-paderborn.de>,
+//                          Heinrich Riebler <heinrich.riebler@uni-paderborn.de>)
+
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+
+//    The above copyright notice and this permission notice shall be included in
+//    all copies or substantial portions of the Software.
+
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//    THE SOFTWARE.
+
+#include "indexAnalysis.h"
+
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/DerivedTypes.h"
+
+#include <set>
+
+using namespace llvm;
+
+static bool dependsOn(Value * symbol, Value * value, std::set < Value * >&visited) {
+    if (symbol == value)
+        return true;
+    Instruction *inst = dyn_cast < Instruction > (symbol);
+    if (!inst || isa < PHINode > (inst) || !visited.insert(inst).second)
+        return false;
+    for (Use & U:inst->operands()) {
+        if (dependsOn(U.get(), value, visited))
+            return true;
+    }
+    return false;
+}
+
+int64_t AffineIndex::getCoefficient(llvm::Value * value) const {
+    auto coefficient = coefficients.find(value);
+    if (coefficient == coefficients.end())
+        return 0;
+    return coefficient->second;
+}
+
+bool AffineIndex::isUsedInSymbol(llvm::Value * value) const {
+    for (auto coefficient:coefficients) {
+        std::set < Value * >visited;
+        if (coefficient.first != value && dependsOn(coefficient.first, value, visited))
+            return true;
+    }
+    return false;
+}
+
+void getAffineValue(llvm::Value * value, int64_t scale, AffineIndex & index) {
+    if (scale == 0)
+        return;
+
+    if (auto constInt = dyn_cast < ConstantInt > (value)) {
+        index.constant += scale * constInt->getSExtValue();
+        return;
+    }
+
+    //The scop analysis guarantees that the index computations do not overflow
+    if (isa < SExtInst > (value) || isa < ZExtInst > (value) || isa < TruncInst > (value)) {
+        getAffineValue(cast < CastInst > (value)->getOperand(0), scale, index);
+        return;
+    }
+
+    if (auto binOp = dyn_cast < BinaryOperator > (value)) {
+        Value *a = binOp->getOperand(0);
+        Value *b = binOp->getOperand(1);
+        switch (binOp->getOpcode()) {
+        case Instruction::Add:
+            getAffineValue(a, scale, index);
+            getAffineValue(b, scale, index);
+            return;
+        case Instruction::Sub:
+            getAffineValue(a, scale, index);
+            getAffineValue(b, -scale, index);
+            return;
+        case Instruction::Mul:
+            if (auto constInt = dyn_cast < ConstantInt > (b)) {
+                getAffineValue(a, scale * constInt->getSExtValue(), index);
+                return;
+            }
+            if (auto constInt = dyn_cast < ConstantInt > (a)) {
+                getAffineValue(b, scale * constInt->getSExtValue(), index);
+                return;
+            }
+            break;
+        case Instruction::Shl:
+            if (auto constInt = dyn_cast < ConstantInt > (b)) {
+                getAffineValue(a, scale * ((int64_t) 1 << constInt->getZExtValue()), index);
+                return;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    index.coefficients[value] += scale;
+    if (index.coefficients[value] == 0)
+        index.coefficients.erase(value);
+}
+
+static bool getNumScalarElements(Type * type, int64_t & numElements) {
+    numElements = 1;
+    while (type->isArrayTy()) {
+        numElements *= type->getArrayNumElements();
+        type = type->getArrayElementType();
+    }
+    return type->isIntegerTy() || type->isFloatingPointTy();
+}
+
+bool getAffineIndex(llvm::Value * pointer, AffineIndex & index) {
+    if (isa < Argument > (pointer) || isa < AllocaInst > (pointer)) {
+        index.base = pointer;
+        return true;
+    }
+
+    if (auto castInst = dyn_cast < BitCastInst > (pointer))
+        return getAffineIndex(castInst->getOperand(0), index);
+
+    auto gepInst = dyn_cast < GetElementPtrInst > (pointer);
+    if (!gepInst)
+        return false;
+
+    Type *indexedType = gepInst->getPointerOperandType()->getPointerElementType();
+    for (unsigned int i = 1; i < gepInst->getNumOperands(); i++) {
+        if (i > 1) {
+            if (!indexedType->isArrayTy())
+                return false;
+            indexedType = indexedType->getArrayElementType();
+        }
+        int64_t numElements;
+        if (!getNumScalarElements(indexedType, numElements))
+            return false;
+        getAffineValue(gepInst->getOperand(i), numElements, index);
+    }
+
+    return getAffineIndex(gepInst->getPointerOperand(), index);
+}
+
+llvm::Value * getAccessPointer(llvm::Instruction * inst) {
+    if (auto loadInst = dyn_cast < LoadInst > (inst))
+        return loadInst->getPointerOperand();
+    if (auto storeInst = dyn_cast < StoreInst > (inst))
+        return storeInst->getPointerOperand();
+    return NULL;
+}
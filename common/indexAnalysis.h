@@ -0,0 +1,55 @@
+//    Copyright (c) 2019 University of Paderborn 
+//                         (Gavin Vaz <gavin.vaz@uni-paderborn.de>,
+//                          Heinrich Riebler <heinrich.riebler@uni-paderborn.de>)
+
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+
+//    The above copyright notice and this permission notice shall be included in
+//    all copies or substantial portions of the Software.
+
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//    THE SOFTWARE.
+
+#ifndef INDEXANALYSIS_H
+#define INDEXANALYSIS_H
+
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Value.h"
+
+#include <map>
+
+//Affine decomposition of the address of an array access, counted in scalar elements of the
+//base pointer (arrays are flattened): offset = constant + sum(coefficients[v] * v).
+//Values that are not affine in the supported operations (add, sub, mul/shl by constants, casts)
+//are kept as symbols, e.g. "i * n" is one symbol.
+struct AffineIndex {
+    llvm::Value * base = NULL;  //Kernel argument or alloca
+    int64_t constant = 0;
+     std::map < llvm::Value *, int64_t > coefficients;
+
+    //Coefficient of value, 0 if the access does not depend on it
+    int64_t getCoefficient(llvm::Value * value) const;
+    //True if value appears in a symbol, e.g. in "i * n", the stride is unknown then
+    bool isUsedInSymbol(llvm::Value * value) const;
+};
+
+//Decompose the pointer operand of a load or store, false for non-array pointers
+bool getAffineIndex(llvm::Value * pointer, AffineIndex & index);
+
+//Decompose an integer value: constant + sum(coefficients[v] * v), scaled by scale
+void getAffineValue(llvm::Value * value, int64_t scale, AffineIndex & index);
+
+//The address of a load or store, NULL for other instructions
+llvm::Value * getAccessPointer(llvm::Instruction * inst);
+
+#endif                          //INDEXANALYSIS_H
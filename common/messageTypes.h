@@ -39,6 +39,11 @@ enum msgType {
 
     BINARY_STREAM,              // the code stream returned by the client
 
+    RSP_CODE_GEN_FAILED,        // code gen failed, the client keeps the original code
+
+    REQ_SCOP_ANALYSIS,          //request scop analysis and code gen for a complete module
+    RSP_SCOP_ANALYSIS,          //analysis results and kernels
+
 };
 
 #endif                          //MESSAGE_TYPES_INCLUDED
@@ -91,6 +91,7 @@ void OpenCLDevice::importKernel(int libType) {
         exit(1);
     }
     fclose(fp);
+    programSource = std::string(fileContent, fileSize);
 
     cl_int ret;
     cl_uint numberOfDevices;
@@ -132,8 +133,8 @@ void OpenCLDevice::importKernel(int libType) {
         std::cout << "Error: Unable to ccreate the OCL context" << ret << std::endl;
     }
 
-    //Create the Command Queue
-    commandQueue = clCreateCommandQueue(context, oclDeviceId, 0, &ret);
+    //Create the Command Queue, the profiling times the kernel variants of the autotuning
+    commandQueue = clCreateCommandQueue(context, oclDeviceId, CL_QUEUE_PROFILING_ENABLE, &ret);
     if (ret != CL_SUCCESS) {
         std::cout << "Error: Unable to create the OCL command queue" << ret << std::endl;
     }
@@ -145,9 +146,45 @@ void OpenCLDevice::importKernel(int libType) {
         std::cout << "Error: Unable to create the OCL Program with Source" << ret << std::endl;
     }
 
-    const char *flags = "";
+    //Kernels may contain variants per device class
+    std::string flags = "";
+    switch (deviceType) {
+    case MCPU:
+        flags = "-D HTROP_DEVICE_MCPU";
+        break;
+    case GPU:
+        flags = "-D HTROP_DEVICE_GPU";
+        break;
+    case MIC:
+        flags = "-D HTROP_DEVICE_MIC";
+        break;
+    default:
+        break;
+    }
 
-    ret = clBuildProgram(program, 1, &oclDeviceId, flags, NULL, NULL);
+    //Read-only arrays use images and constant memory if the device provides them
+    cl_bool imageSupportValue = CL_FALSE;
+    clGetDeviceInfo(oclDeviceId, CL_DEVICE_IMAGE_SUPPORT, sizeof(cl_bool), &imageSupportValue, NULL);
+    if (imageSupportValue == CL_TRUE) {
+        clGetDeviceInfo(oclDeviceId, CL_DEVICE_IMAGE2D_MAX_WIDTH, sizeof(size_t), &imageMaxWidth, NULL);
+        clGetDeviceInfo(oclDeviceId, CL_DEVICE_IMAGE2D_MAX_HEIGHT, sizeof(size_t), &imageMaxHeight, NULL);
+        imageSupport = imageMaxWidth > 0 && imageMaxHeight > 0;
+    }
+    if (imageSupport)
+        flags += " -D HTROP_IMAGE_SUPPORT";
+
+    cl_ulong constantSize = 0;
+    clGetDeviceInfo(oclDeviceId, CL_DEVICE_MAX_CONSTANT_BUFFER_SIZE, sizeof(cl_ulong), &constantSize, NULL);
+    flags += " -D HTROP_CONSTANT_SIZE=" + std::to_string(constantSize);
+
+    //Pitched buffers start every row at the base address alignment
+    cl_uint baseAddrAlign = 0;
+    clGetDeviceInfo(oclDeviceId, CL_DEVICE_MEM_BASE_ADDR_ALIGN, sizeof(cl_uint), &baseAddrAlign, NULL);
+    rowAlignment = std::max < cl_uint > (baseAddrAlign / 8, 1);
+    flags += " -D HTROP_ROW_ALIGN=" + std::to_string(rowAlignment);
+
+    buildFlags = flags;
+    ret = clBuildProgram(program, 1, &oclDeviceId, flags.c_str(), NULL, NULL);
 
     if (ret != CL_SUCCESS) {
         std::cout << "Error: OpenCL" << ret << std::endl;
@@ -165,9 +202,13 @@ OpenCLDevice::~OpenCLDevice() {
     for (auto item:bufferList) {
         clReleaseMemObject(item.second->oclBuffer);
     }
+    for (auto item:imageList) {
+        clReleaseMemObject(item.second);
+    }
 
     clFinish(commandQueue);
     bufferList.clear();
+    imageList.clear();
 
     ret = clFlush(commandQueue);
     ret = clFinish(commandQueue);
@@ -175,8 +216,17 @@ OpenCLDevice::~OpenCLDevice() {
     for (auto item:kernelList) {
         ret = clReleaseKernel(item.second);
     }
+    for (auto kernel:specializedKernels) {
+        ret = clReleaseKernel(kernel);
+    }
 
     kernelList.clear();
+    specializedKernels.clear();
+
+    for (auto specializedProgram:specializedPrograms) {
+        ret = clReleaseProgram(specializedProgram);
+    }
+    specializedPrograms.clear();
 
     ret = clReleaseProgram(program);
     ret = clReleaseCommandQueue(commandQueue);
@@ -199,6 +249,47 @@ cl_int OpenCLDevice::addKernel(std::string kernelName) {
     return ret;
 }
 
+cl_kernel OpenCLDevice::createSpecializedKernel(std::string kernelName, std::string defines) {
+    cl_int ret;
+    cl_device_id deviceId;
+    clGetCommandQueueInfo(commandQueue, CL_QUEUE_DEVICE, sizeof(cl_device_id), &deviceId, NULL);
+
+    const char *source = programSource.c_str();
+    size_t sourceSize = programSource.size();
+    cl_program specializedProgram = clCreateProgramWithSource(context, 1, &source, &sourceSize, &ret);
+    if (ret != CL_SUCCESS) {
+        std::cout << "Error: Unable to create the specialized OCL Program " << ret << std::endl;
+        return NULL;
+    }
+    specializedPrograms.push_back(specializedProgram);
+
+    std::string flags = buildFlags + defines;
+    ret = clBuildProgram(specializedProgram, 1, &deviceId, flags.c_str(), NULL, NULL);
+    if (ret != CL_SUCCESS) {
+        std::cout << "Error: Unable to build the specialized kernel " << kernelName << " " << ret << std::endl;
+        return NULL;
+    }
+
+    cl_kernel ocl_kernel = clCreateKernel(specializedProgram, kernelName.c_str(), &ret);
+    if (ret != CL_SUCCESS) {
+        std::cout << "ERROR: Unable to add specialized kernel " << kernelName << std::endl;
+        return NULL;
+    }
+    specializedKernels.push_back(ocl_kernel);
+    return ocl_kernel;
+}
+
+bool OpenCLDevice::isSpecializableArg(std::string kernelName, int position) {
+    std::pair < std::string, int >arg(kernelName, position);
+    auto item = specializableArgs.find(arg);
+    if (item != specializableArgs.end())
+        return item->second;
+
+    bool isSpecializable = programSource.find("#ifdef HTROP_SPEC_" + kernelName + "_" + std::to_string(position) + "\n") != std::string::npos;
+    specializableArgs[arg] = isSpecializable;
+    return isSpecializable;
+}
+
 cl_int OpenCLDevice::removeKernel(std::string kernelName) {
     cl_int ret;
 
@@ -252,12 +343,162 @@ cl_mem OpenCLDevice::createAndPopulateBuffer(void *hostDataPointer, DataTransfer
 
     bufferList.emplace(hostDataPointer, buffer);
 
-    if (transferType != OUT)
+    //TMP arrays only live on the device, e.g. the intermediate of a fused kernel
+    if (transferType != OUT && transferType != TMP)
         ret = clEnqueueWriteBuffer(commandQueue, buffer->oclBuffer, CL_FALSE, 0, buffer->size * buffer->dataTypeSize, hostDataPointer, 0, NULL, NULL);
 
     return buffer->oclBuffer;
 }
 
+//Read-only array as a 2D image of one float or uchar channel, element i is at (i % width, i / width).
+//Rows of the given width keep the 2D neighbourhood of the array in the texture cache, a width of 0 uses full image rows.
+cl_mem OpenCLDevice::createAndPopulateImage(void *hostDataPointer, bool isFloat, long size, long width) {
+    auto item = imageList.find(hostDataPointer);
+    if (item != imageList.end())
+        return item->second;
+
+    if (width <= 0 || (size_t) width > imageMaxWidth)
+        width = std::min < long >(size, imageMaxWidth);
+    long height = (size + width - 1) / width;
+    if ((size_t) height > imageMaxHeight) {
+        std::cout << "ERROR: Array of " << size << " elements exceeds the image size of the device" << std::endl;
+        return NULL;
+    }
+
+    cl_int ret;
+    cl_image_format format;
+    format.image_channel_order = CL_R;
+    format.image_channel_data_type = isFloat ? CL_FLOAT : CL_UNSIGNED_INT8;
+    cl_mem image = clCreateImage2D(context, CL_MEM_READ_ONLY, &format, width, height, 0, NULL, &ret);
+    if (ret != CL_SUCCESS) {
+        std::cout << "ERROR: Unable to create image " << ret << std::endl;
+        return NULL;
+    }
+
+#ifdef HTROP_DEBUG
+    std::cout << "\nImage " << width << " x " << height << " for " << size << " elements";
+    std::cout.flush();
+#endif
+
+    //The full rows, then the rest of the last row
+    size_t elementSize = isFloat ? sizeof(float) : sizeof(cl_uchar);
+    size_t origin[3] = { 0, 0, 0 };
+    size_t region[3] = { (size_t) width, (size_t) (size / width), 1 };
+    if (region[1] > 0)
+        clEnqueueWriteImage(commandQueue, image, CL_FALSE, origin, region, width * elementSize, 0, hostDataPointer, 0, NULL, NULL);
+    if (size % width != 0) {
+        origin[1] = size / width;
+        region[0] = size % width;
+        region[1] = 1;
+        clEnqueueWriteImage(commandQueue, image, CL_FALSE, origin, region, 0, 0, (char *)hostDataPointer + origin[1] * width * elementSize, 0, NULL, NULL);
+    }
+
+    imageList.emplace(hostDataPointer, image);
+    return image;
+}
+
+bool OpenCLDevice::isImageSupported() {
+    return imageSupport;
+}
+
+size_t OpenCLDevice::getRowPitch(long width, int dataTypeSize) {
+    size_t rowBytes = width * dataTypeSize;
+    return (rowBytes + rowAlignment - 1) / rowAlignment * rowAlignment;
+}
+
+size_t OpenCLDevice::getBufferRowPitch(void *hostDataPointer) {
+    auto item = bufferList.find(hostDataPointer);
+    if (item != bufferList.end())
+        return item->second->rowPitch;
+    return 0;
+}
+
+//The full rows with clEnqueueWriteBufferRect, then the rest of the last row
+cl_mem OpenCLDevice::createAndPopulatePitchedBuffer(void *hostDataPointer, DataTransferType transferType, long size, int dataTypeSize, long width) {
+    cl_int ret;
+    OclBuffer *buffer = new OclBuffer();
+
+    buffer->transferType = transferType;
+    buffer->size = size;
+    buffer->dataTypeSize = dataTypeSize;
+    buffer->width = width;
+    buffer->rowPitch = getRowPitch(width, dataTypeSize);
+
+    long height = (size + width - 1) / width;
+    buffer->oclBuffer = clCreateBuffer(context, transferType == IN ? CL_MEM_READ_ONLY : CL_MEM_READ_WRITE, height * buffer->rowPitch, NULL, &ret);
+    if (ret != CL_SUCCESS) {
+        std::cout << "ERROR: Unable to create a pitched buffer " << ret << std::endl;
+        delete buffer;
+        return NULL;
+    }
+
+#ifdef HTROP_DEBUG
+    std::cout << "\nPitched buffer " << width << " x " << height << " elements, row pitch " << buffer->rowPitch << " bytes";
+    std::cout.flush();
+#endif
+
+    bufferList.emplace(hostDataPointer, buffer);
+
+    if (transferType != OUT && transferType != TMP) {
+        size_t rowBytes = width * dataTypeSize;
+        size_t origin[3] = { 0, 0, 0 };
+        size_t region[3] = { rowBytes, (size_t) (size / width), 1 };
+        if (region[1] > 0)
+            clEnqueueWriteBufferRect(commandQueue, buffer->oclBuffer, CL_FALSE, origin, origin, region, buffer->rowPitch, 0, rowBytes, 0, hostDataPointer, 0, NULL, NULL);
+        if (size % width != 0)
+            clEnqueueWriteBuffer(commandQueue, buffer->oclBuffer, CL_FALSE, (size / width) * buffer->rowPitch, (size % width) * dataTypeSize,
+                                 (char *)hostDataPointer + (size / width) * rowBytes, 0, NULL, NULL);
+    }
+
+    return buffer->oclBuffer;
+}
+
+void OpenCLDevice::transferToHost(void *hostDataPointer, OclBuffer * buffer) {
+    if (buffer->transferType == IN || buffer->transferType == TMP)
+        return;
+
+#ifdef HTROP_DEBUG
+    std::cout << "\nTransfer data from device (" << buffer->oclBuffer << ")" << " to host (" << hostDataPointer << ")";
+    std::cout.flush();
+#endif
+
+    if (buffer->rowPitch == 0) {
+        clEnqueueReadBuffer(commandQueue, buffer->oclBuffer, CL_FALSE, 0, buffer->size * buffer->dataTypeSize, hostDataPointer, 0, NULL, NULL);
+        return;
+    }
+
+    size_t rowBytes = buffer->width * buffer->dataTypeSize;
+    size_t origin[3] = { 0, 0, 0 };
+    size_t region[3] = { rowBytes, (size_t) (buffer->size / buffer->width), 1 };
+    if (region[1] > 0)
+        clEnqueueReadBufferRect(commandQueue, buffer->oclBuffer, CL_FALSE, origin, origin, region, buffer->rowPitch, 0, rowBytes, 0, hostDataPointer, 0, NULL, NULL);
+    if (buffer->size % buffer->width != 0)
+        clEnqueueReadBuffer(commandQueue, buffer->oclBuffer, CL_FALSE, (buffer->size / buffer->width) * buffer->rowPitch, (buffer->size % buffer->width) * buffer->dataTypeSize,
+                            (char *)hostDataPointer + (buffer->size / buffer->width) * rowBytes, 0, NULL, NULL);
+}
+
+//A kernel that needs the other row layout of the array, e.g. a packed buffer after a pitched one, or an image of it
+void OpenCLDevice::releaseBuffer(void *hostDataPointer) {
+    auto item = bufferList.find(hostDataPointer);
+    if (item == bufferList.end())
+        return;
+
+    transferToHost(item->first, item->second);
+    clFinish(commandQueue);
+    clReleaseMemObject(item->second->oclBuffer);
+    delete item->second;
+    bufferList.erase(item);
+}
+
+void OpenCLDevice::releaseImage(void *hostDataPointer) {
+    auto item = imageList.find(hostDataPointer);
+    if (item == imageList.end())
+        return;
+
+    clReleaseMemObject(item->second);
+    imageList.erase(item);
+}
+
 void OpenCLDevice::cleanUpBuffers() {
     cl_int ret;
 
@@ -271,14 +512,7 @@ void OpenCLDevice::cleanUpBuffers() {
     for (auto item:bufferList) {
 
         std::cout.flush();
-        if (item.second->transferType != IN) {
-#ifdef HTROP_DEBUG
-            std::cout << "\nTransfer data from device (" << item.second->oclBuffer << ")" << " to host (" << item.first << ")";
-            std::cout.flush();
-#endif
-            ret = clEnqueueReadBuffer(commandQueue, item.second->oclBuffer, CL_FALSE, 0, item.second->size * item.second->dataTypeSize, item.first, 0, NULL, NULL);
-
-        }
+        transferToHost(item.first, item.second);
 #ifdef HTROP_DEBUG
         std::cout << "\nclReleaseMemObject (" << item.second->oclBuffer << ")";
         std::cout.flush();
@@ -286,9 +520,13 @@ void OpenCLDevice::cleanUpBuffers() {
 
         clReleaseMemObject(item.second->oclBuffer);
     }
+    for (auto item:imageList) {
+        clReleaseMemObject(item.second);
+    }
 
     clFinish(commandQueue);
     bufferList.clear();
+    imageList.clear();
 }
 
 cl_kernel OpenCLDevice::getKernel(std::string kernelName) {
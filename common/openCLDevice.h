@@ -26,6 +26,7 @@
 #include <map>
 #include <algorithm>
 #include <string>
+#include <vector>
 
 #include "CL/cl.h"
 #include "../common/dataTransferType.h"
@@ -46,6 +47,8 @@ class OpenCLDevice {
         DataTransferType transferType;
         long size;
         int dataTypeSize;
+        long width;             //Elements per row of a pitched buffer
+        size_t rowPitch;        //Bytes per row on the device, 0 for a packed buffer
     };
 
     OpenCLDevice();
@@ -58,8 +61,22 @@ class OpenCLDevice {
     cl_int removeKernel(std::string kernelName);
 
     cl_kernel getKernel(std::string kernelName);
+    //Kernel of a program built with additional defines, NULL if the build fails. The device releases it.
+    cl_kernel createSpecializedKernel(std::string kernelName, std::string defines);
+    //The kernel reads the integer argument from HTROP_SPEC_<kernel>_<position> if it is defined
+    bool isSpecializableArg(std::string kernelName, int position);
     cl_mem getBuffer(void *hostDataPointer);
     cl_mem createAndPopulateBuffer(void *hostDataPointer, DataTransferType transferType, long size, int dataTypeSize);
+    cl_mem createAndPopulateImage(void *hostDataPointer, bool isFloat, long size, long width);
+    //Rows of width elements padded to getRowPitch bytes, the host array keeps its packed rows
+    cl_mem createAndPopulatePitchedBuffer(void *hostDataPointer, DataTransferType transferType, long size, int dataTypeSize, long width);
+    size_t getRowPitch(long width, int dataTypeSize);
+    size_t getBufferRowPitch(void *hostDataPointer);
+    //Transfer the buffer back to the host (unless it is IN or TMP) and release it
+    void releaseBuffer(void *hostDataPointer);
+    //Release the image of the array, e.g. after a kernel got it as a writable buffer
+    void releaseImage(void *hostDataPointer);
+    bool isImageSupported();
     void cleanUpBuffers();
     bool isAvailable();
     bool isCompiled();
@@ -74,6 +91,11 @@ class OpenCLDevice {
     cl_command_queue commandQueue = NULL;
     cl_context context = NULL;
     cl_program program = NULL;
+    std::string programSource;
+    std::string buildFlags;
+    std::vector < cl_program > specializedPrograms;
+    std::vector < cl_kernel > specializedKernels;
+    std::map < std::pair < std::string, int >, bool > specializableArgs;
     std::string platformName;
     std::string deviceName;
     bool isCompiledValue = false;
@@ -82,6 +104,12 @@ class OpenCLDevice {
     DeviceType deviceType;
     std::map < std::string, cl_kernel > kernelList;
     std::map < void *, OclBuffer * >bufferList;
+    std::map < void *, cl_mem >imageList;     //Read-only arrays bound as images
+    bool imageSupport = false;
+    size_t imageMaxWidth = 0;
+    size_t imageMaxHeight = 0;
+    cl_uint rowAlignment = 1;   //Bytes, CL_DEVICE_MEM_BASE_ADDR_ALIGN
+    void transferToHost(void *hostDataPointer, OclBuffer * buffer);
     cl_device_type clType;
 
 };
@@ -52,11 +52,34 @@ struct ScopLoopInfo {
     // Maximum value for the trip count. This is the upper bound
     //   from static SCoP analysis.
     unsigned long long maxValue = 0;
-    // Upper bound of the trip count. This is the string, still 
-    //   containing variables: i.e. "-2 + n"
+    // Largest value of the loop counter (starting at 0), the trip count is maxValueStr + 1.
+    //   This is the string, still containing variables: i.e. "-2 + n"
      std::string maxValueStr = "";
 };
 
+/**
+ * @brief A reduction acc[x] = acc[x] op value of the scop function. The address x does not change
+ *        in the loop at loopDepth, the iterations of this loop are combined by a parallel reduction.
+ */
+struct ScopReductionInfo {
+    // Position of the accumulator array in the scop function arguments, -1 if the scop has no reduction.
+    int argPosition = -1;
+    // Depth of the reduction loop (1 is the outermost loop).
+    unsigned int loopDepth = 0;
+    ReductionOperator reductionOperator = RED_ADD;
+};
+
+/**
+ * @brief A scatter update acc[x] = acc[x] op value of 32-bit integers whose address x depends on loaded data,
+ *        e.g. the bins of a histogram. Different iterations may update the same element.
+ */
+struct ScopScatterInfo {
+    // Position of the updated array in the scop function arguments, -1 if the scop has no scatter update.
+    int argPosition = -1;
+    // RED_ADD, RED_MIN or RED_MAX
+    ReductionOperator scatterOperator = RED_ADD;
+};
+
 // Argument of hotspot function.
 typedef struct {
 
@@ -257,6 +280,11 @@ typedef struct {
     std::vector < ScopLoopInfo * >scopLoopInfo; // SCop loop analysis
     std::map < DeviceType, ResourceInfo > resources;    // Resources and affinity
     int maxParalleizationDepth = 0;
+    ScopReductionInfo reduction;        // Reduction of the parallelized loops
+    unsigned int wavefrontSkew = 0;     // Skew of the parallel waves t = skew * i + j of a 2D nest with dependences in both loops, 0 if none
+    ScopScatterInfo scatter;    // Scatter update with a data-dependent address
+    std::vector < llvm::Function * >fusedFunctions;     // Fused scop: producer and consumer scop called by scopFunction
+    std::vector < unsigned int >fusedTmpArgs;   // Fused scop: intermediate arrays the host never reads
 } ScopDS;
 
 typedef struct {
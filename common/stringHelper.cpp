@@ -122,3 +122,12 @@ std::vector < std::string > explodeStr(const std::string &s, const std::string &
     ret.push_back(tmps);
     return ret;
 }
+
+uint64_t hashString(const std::string & s) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c:s) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
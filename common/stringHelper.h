@@ -23,6 +23,7 @@
 #ifndef STRINGHELPER_H
 #define STRINGHELPER_H
 
+#include <stdint.h>
 #include <string>
 #include <vector>
 
@@ -37,4 +38,7 @@ std::string ltrimmed(std::string s);
 std::string rtrimmed(std::string s);
 std::string trimmed(std::string s);
 
+//FNV-1a, stable across processes and server restarts
+uint64_t hashString(const std::string & s);
+
 #endif                          // STRINGHELPER_H
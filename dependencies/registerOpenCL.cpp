@@ -28,6 +28,9 @@
 #include <boost/concept_check.hpp>
 #include <assert.h>
 #include<thread>
+#include <vector>
+#include <fstream>
+#include <climits>
 
 #if MEASURE
 #include <chrono>
@@ -99,6 +102,7 @@ long callCount;
 bool switchOnFirst;
 
 std::vector < std::string > kernelNames;
+std::map < DeviceType, long >lastKernelTime;
 std::vector < std::thread > compilerThreads;
 
 extern "C" std::string resolveDataTransferTypeName(DataTransferType transferType) {
@@ -480,6 +484,71 @@ extern "C" void calculateBonusAndDecide() {
 }
 
 // Helper in C
+//Value specialization: the integer arguments of the direct emitter read HTROP_SPEC_<kernel>_<position> if it is defined.
+//A tuple of argument values that repeats in consecutive calls gets its own program with the values as defines,
+//the generic kernel stays for the other values. The arguments are recorded to set them on the specialized kernel.
+static const int SPECIALIZATION_MIN_CALLS = 3;
+static const unsigned int SPECIALIZATION_MAX_PROGRAMS = 4;    //Per kernel and device, failed builds count
+
+struct RecordedKernelArg {
+    std::vector < char >value;
+    bool isInteger = false;
+    long integerValue = 0;
+};
+
+struct KernelSpecialization {
+    std::map < int, RecordedKernelArg > args;
+    std::string lastDefines;
+    int repeatCount = 0;
+    std::map < std::string, cl_kernel > kernels;      //Defines -> specialized kernel, NULL if the build failed
+};
+static std::map < std::pair < DeviceType, std::string >, KernelSpecialization > kernelSpecializations;
+
+static cl_int setRecordedKernelArg(cl_kernel kernel, DeviceType deviceType, std::string kernelName, int position, size_t size, const void *value, bool isInteger, long integerValue) {
+    RecordedKernelArg & arg = kernelSpecializations[std::pair < DeviceType, std::string > (deviceType, kernelName)].args[position];
+    arg.value.assign((const char *)value, (const char *)value + size);
+    arg.isInteger = isInteger;
+    arg.integerValue = integerValue;
+
+    return clSetKernelArg(kernel, position, size, value);
+}
+
+//The specialized kernel for the current values of the integer arguments, the generic kernel until the values repeated
+static cl_kernel getSpecializedKernel(OpenCLDevice * device, DeviceType deviceType, std::string kernelName) {
+    cl_kernel genericKernel = device->getKernel(kernelName);
+    auto specialization = kernelSpecializations.find(std::pair < DeviceType, std::string > (deviceType, kernelName));
+    if (specialization == kernelSpecializations.end())
+        return genericKernel;
+
+    std::string defines = "";
+    for (auto & arg:specialization->second.args) {
+        if (arg.second.isInteger && device->isSpecializableArg(kernelName, arg.first))
+            defines += " -D HTROP_SPEC_" + kernelName + "_" + std::to_string(arg.first) + "=" + std::to_string(arg.second.integerValue);
+    }
+    if (defines.empty())
+        return genericKernel;
+
+    KernelSpecialization & kernelSpecialization = specialization->second;
+    auto specializedKernel = kernelSpecialization.kernels.find(defines);
+    if (specializedKernel == kernelSpecialization.kernels.end()) {
+        kernelSpecialization.repeatCount = defines == kernelSpecialization.lastDefines ? kernelSpecialization.repeatCount + 1 : 1;
+        kernelSpecialization.lastDefines = defines;
+        if (kernelSpecialization.repeatCount < SPECIALIZATION_MIN_CALLS || kernelSpecialization.kernels.size() >= SPECIALIZATION_MAX_PROGRAMS)
+            return genericKernel;
+
+        std::cout << "\nHTROP INFO : Specializing " << kernelName << " on " << resolveAcceleratorName(deviceType) << ":" << defines;
+        std::cout.flush();
+        specializedKernel = kernelSpecialization.kernels.emplace(defines, device->createSpecializedKernel(kernelName, defines)).first;
+    }
+
+    if (specializedKernel->second == NULL)
+        return genericKernel;
+
+    for (auto & arg:kernelSpecialization.args)
+        clSetKernelArg(specializedKernel->second, arg.first, arg.second.value.size(), arg.second.value.data());
+    return specializedKernel->second;
+}
+
 //Overloaded setKernelArg functions
 extern "C" cl_int setKernelArg_cl_mem(DeviceType deviceType, std::string kernelName, int position, cl_mem * clBuffer) {
 #ifdef HTROP_DEBUG
@@ -493,7 +562,7 @@ extern "C" cl_int setKernelArg_cl_mem(DeviceType deviceType, std::string kernelN
         cl_kernel kernel = device->getKernel(kernelName);
 
         assert(kernel != NULL);
-        return clSetKernelArg(kernel, position, sizeof(cl_mem), clBuffer);
+        return setRecordedKernelArg(kernel, deviceType, kernelName, position, sizeof(cl_mem), clBuffer, false, 0);
     }
 
     return -1;
@@ -509,7 +578,7 @@ extern "C" cl_int setKernelArg_char(DeviceType deviceType, std::string kernelNam
     if (device != NULL) {
         cl_kernel kernel = device->getKernel(kernelName);
 
-        return clSetKernelArg(kernel, position, sizeof(char), &clBuffer);
+        return setRecordedKernelArg(kernel, deviceType, kernelName, position, sizeof(char), &clBuffer, true, clBuffer);
     }
     return -1;
 }
@@ -524,7 +593,7 @@ extern "C" cl_int setKernelArg_int(DeviceType deviceType, std::string kernelName
     if (device != NULL) {
         cl_kernel kernel = device->getKernel(kernelName);
 
-        return clSetKernelArg(kernel, position, sizeof(int), &clBuffer);
+        return setRecordedKernelArg(kernel, deviceType, kernelName, position, sizeof(int), &clBuffer, true, clBuffer);
     }
     return -1;
 }
@@ -539,7 +608,7 @@ extern "C" cl_int setKernelArg_long(DeviceType deviceType, std::string kernelNam
     if (device != NULL) {
         cl_kernel kernel = device->getKernel(kernelName);
 
-        return clSetKernelArg(kernel, position, sizeof(long), &clBuffer);
+        return setRecordedKernelArg(kernel, deviceType, kernelName, position, sizeof(long), &clBuffer, true, clBuffer);
     }
     return -1;
 }
@@ -554,7 +623,7 @@ extern "C" cl_int setKernelArg_float(DeviceType deviceType, std::string kernelNa
     if (device != NULL) {
         cl_kernel kernel = device->getKernel(kernelName);
 
-        return clSetKernelArg(kernel, position, sizeof(float), &clBuffer);
+        return setRecordedKernelArg(kernel, deviceType, kernelName, position, sizeof(float), &clBuffer, false, 0);
     }
     return -1;
 }
@@ -569,7 +638,7 @@ extern "C" cl_int setKernelArg_double(DeviceType deviceType, std::string kernelN
     if (device != NULL) {
         cl_kernel kernel = device->getKernel(kernelName);
 
-        return clSetKernelArg(kernel, position, sizeof(double), &clBuffer);
+        return setRecordedKernelArg(kernel, deviceType, kernelName, position, sizeof(double), &clBuffer, false, 0);
     }
     return -1;
 }
@@ -588,6 +657,17 @@ extern "C" cl_mem transferToDevice(DeviceType deviceType, void *cpuDataPointer,
 
     if (device != NULL) {
         clBuffer = device->getBuffer(cpuDataPointer);
+
+        //The kernel may write the array, an image of it would be outdated
+        if (transferType != IN)
+            device->releaseImage(cpuDataPointer);
+
+        //An earlier kernel left the array in a pitched buffer
+        if (clBuffer != NULL && device->getBufferRowPitch(cpuDataPointer) != 0) {
+            device->releaseBuffer(cpuDataPointer);
+            clBuffer = NULL;
+        }
+
         if (clBuffer == NULL) {
             clBuffer = device->createAndPopulateBuffer(cpuDataPointer, transferType, dataTypeSize, size);
 
@@ -607,6 +687,53 @@ extern "C" cl_mem transferToDevice(DeviceType deviceType, void *cpuDataPointer,
     return clBuffer;
 }
 
+//Helper in C
+//Read-only array of a kernel with an image variant, the devices with image support (HTROP_IMAGE_SUPPORT) read it as image2d_t.
+//The width is the row length of the array, 0 if unknown.
+extern "C" cl_mem transferImageToDevice(DeviceType deviceType, void *cpuDataPointer, DataTransferType transferType, int dataTypeSize, long size, int isFloat, long width) {
+    OpenCLDevice *device = resolveDevice(deviceType);
+
+    if (device == NULL || !device->isImageSupported())
+        return transferToDevice(deviceType, cpuDataPointer, transferType, dataTypeSize, size);
+
+#ifdef HTROP_DEBUG
+    std::cout << "\nHTROP INFO : transferImageToDevice " << cpuDataPointer << " width " << width;
+    std::cout.flush();
+#endif
+
+    //An earlier kernel may have written the array in a buffer, the image is filled from the host copy
+    if (device->getBuffer(cpuDataPointer) != NULL)
+        device->releaseBuffer(cpuDataPointer);
+
+    return device->createAndPopulateImage(cpuDataPointer, isFloat, size, width);
+}
+
+//Helper in C
+//Array of rows with width elements, the kernel indexes the rows with the pitch of HTROP_ROW_ALIGN. Rows that are
+//already aligned keep the packed buffer.
+extern "C" cl_mem transferPitchedToDevice(DeviceType deviceType, void *cpuDataPointer, DataTransferType transferType, int dataTypeSize, long size, long width) {
+    OpenCLDevice *device = resolveDevice(deviceType);
+
+    if (device == NULL || width <= 0 || device->getRowPitch(width, dataTypeSize) == (size_t) (width * dataTypeSize))
+        return transferToDevice(deviceType, cpuDataPointer, transferType, dataTypeSize, size);
+
+#ifdef HTROP_DEBUG
+    std::cout << "\nHTROP INFO : transferPitchedToDevice " << cpuDataPointer << " width " << width;
+    std::cout.flush();
+#endif
+
+    if (transferType != IN)
+        device->releaseImage(cpuDataPointer);
+
+    cl_mem clBuffer = device->getBuffer(cpuDataPointer);
+    if (clBuffer != NULL && device->getBufferRowPitch(cpuDataPointer) == device->getRowPitch(width, dataTypeSize))
+        return clBuffer;
+    if (clBuffer != NULL)
+        device->releaseBuffer(cpuDataPointer);
+
+    return device->createAndPopulatePitchedBuffer(cpuDataPointer, transferType, size, dataTypeSize, width);
+}
+
 //Helper in C
 extern "C" void executeOCLKernel(DeviceType deviceType, std::string kernelName, int dimension, const size_t global_work_size[], const size_t local_work_size[]) {
 #ifdef HTROP_DEBUG
@@ -617,8 +744,508 @@ extern "C" void executeOCLKernel(DeviceType deviceType, std::string kernelName,
     OpenCLDevice *device = resolveDevice(deviceType);
 
     if (device != NULL) {
-        clEnqueueNDRangeKernel(device->getCommandQueue(), device->getKernel(kernelName), dimension, NULL, global_work_size, local_work_size, 0, NULL, NULL);
-        cl_int ret = clFinish(device->getCommandQueue());
+        cl_event kernelEvent = NULL;
+        cl_int ret = clEnqueueNDRangeKernel(device->getCommandQueue(), getSpecializedKernel(device, deviceType, kernelName), dimension, NULL, global_work_size, local_work_size, 0, NULL,
+                                            &kernelEvent);
+        if (ret != CL_SUCCESS) {
+            std::cerr << "\nHTROP ERROR : Cannot enqueue kernel " << kernelName << " (" << ret << ")";
+            //The variant that failed is never the fastest
+            lastKernelTime[deviceType] = LONG_MAX;
+            return;
+        }
+        ret = clFinish(device->getCommandQueue());
+
+        //Execution time on the device for the autotuning of kernel variants
+        cl_ulong startTime = 0, endTime = 0;
+        if (ret == CL_SUCCESS && clGetEventProfilingInfo(kernelEvent, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &startTime, NULL) == CL_SUCCESS
+            && clGetEventProfilingInfo(kernelEvent, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &endTime, NULL) == CL_SUCCESS) {
+            lastKernelTime[deviceType] = endTime - startTime;
+        }
+        clReleaseEvent(kernelEvent);
+    }
+}
+
+//Helper in C
+//Run a wavefront kernel once per wave t = skew * i + j of the iteration space size0 x size1. The waves go to the in-order
+//queue of the device without waiting in between, each one only starts the work-items (i, t) with 0 <= t - skew * i < size1.
+extern "C" void executeOCLWavefronts(DeviceType deviceType, std::string kernelName, int skew, long size0, long size1) {
+#ifdef HTROP_DEBUG
+    std::cout << "\nHTROP INFO : executeOCLWavefronts " << size0 << " x " << size1 << " skew " << skew;
+    std::cout.flush();
+#endif
+
+    OpenCLDevice *device = resolveDevice(deviceType);
+
+    if (device == NULL || size0 <= 0 || size1 <= 0 || skew <= 0)
+        return;
+
+    cl_kernel kernel = getSpecializedKernel(device, deviceType, kernelName);
+    cl_event firstEvent = NULL, lastEvent = NULL;
+    long numWaves = skew * (size0 - 1) + size1;
+
+    for (long wave = 0; wave < numWaves; wave++) {
+        long first = wave < size1 ? 0 : (wave - size1 + skew) / skew;
+        long last = std::min(size0 - 1, wave / skew);
+        if (last < first)
+            continue;
+
+        size_t global_work_offset[2] = { (size_t) first, (size_t) wave };
+        size_t global_work_size[2] = { (size_t) (last - first + 1), 1 };
+        cl_event waveEvent;
+        if (clEnqueueNDRangeKernel(device->getCommandQueue(), kernel, 2, global_work_offset, global_work_size, NULL, 0, NULL, &waveEvent) != CL_SUCCESS)
+            break;
+
+        if (firstEvent == NULL) {
+            firstEvent = waveEvent;
+        }
+        else {
+            if (lastEvent != NULL)
+                clReleaseEvent(lastEvent);
+            lastEvent = waveEvent;
+        }
+    }
+    cl_int ret = clFinish(device->getCommandQueue());
+
+    //Execution time of all waves on the device
+    cl_ulong startTime = 0, endTime = 0;
+    if (ret == CL_SUCCESS && firstEvent != NULL && clGetEventProfilingInfo(firstEvent, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &startTime, NULL) == CL_SUCCESS
+        && clGetEventProfilingInfo(lastEvent != NULL ? lastEvent : firstEvent, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &endTime, NULL) == CL_SUCCESS) {
+        lastKernelTime[deviceType] = endTime - startTime;
+    }
+    if (firstEvent != NULL)
+        clReleaseEvent(firstEvent);
+    if (lastEvent != NULL)
+        clReleaseEvent(lastEvent);
+}
+
+//Helper in C
+//Run the interior kernel on the work-items [borderLow, size - borderHigh) of each dimension and the border kernel on the
+//slabs around them: the slabs of dimension dim span the interior of the lower dimensions and all of the higher ones.
+//The launches have the exact sizes and go to the in-order queue without waiting in between.
+extern "C" void executeOCLSplitKernel(DeviceType deviceType, std::string kernelName, std::string interiorKernelName, int dimension, const long size[], const int borderLow[],
+                                      const int borderHigh[]) {
+#ifdef HTROP_DEBUG
+    std::cout << "\nHTROP INFO : executeOCLSplitKernel " << kernelName;
+    std::cout.flush();
+#endif
+
+    OpenCLDevice *device = resolveDevice(deviceType);
+
+    if (device == NULL || dimension <= 0 || dimension > 3)
+        return;
+
+    bool hasInterior = true;
+    size_t offset[3], count[3];
+    for (int dim = 0; dim < dimension; dim++) {
+        if (size[dim] <= 0)
+            return;
+        hasInterior = hasInterior && size[dim] > borderLow[dim] + borderHigh[dim];
+        offset[dim] = 0;
+        count[dim] = size[dim];
+    }
+
+    //Work-item ranges of the launches, a small iteration space runs the border kernel only
+    std::vector < std::pair < cl_kernel, std::vector < std::pair < size_t, size_t > > > >launches;
+    if (!hasInterior) {
+        launches.push_back(std::make_pair(getSpecializedKernel(device, deviceType, kernelName), std::vector < std::pair < size_t, size_t > >()));
+        for (int dim = 0; dim < dimension; dim++)
+            launches.back().second.push_back(std::make_pair(offset[dim], count[dim]));
+    }
+    else {
+        cl_kernel kernel = getSpecializedKernel(device, deviceType, kernelName);
+        for (int dim = 0; dim < dimension; dim++) {
+            size_t interiorEnd = size[dim] - borderHigh[dim];
+            std::pair < size_t, size_t > slabs[2] = { std::make_pair(0, borderLow[dim]), std::make_pair(interiorEnd, borderHigh[dim]) };
+            for (auto slab:slabs) {
+                if (slab.second == 0)
+                    continue;
+                launches.push_back(std::make_pair(kernel, std::vector < std::pair < size_t, size_t > >()));
+                for (int other = 0; other < dimension; other++)
+                    launches.back().second.push_back(other == dim ? slab : std::make_pair(offset[other], count[other]));
+            }
+            offset[dim] = borderLow[dim];
+            count[dim] = interiorEnd - borderLow[dim];
+        }
+        launches.push_back(std::make_pair(getSpecializedKernel(device, deviceType, interiorKernelName), std::vector < std::pair < size_t, size_t > >()));
+        for (int dim = 0; dim < dimension; dim++)
+            launches.back().second.push_back(std::make_pair(offset[dim], count[dim]));
+    }
+
+    cl_event firstEvent = NULL, lastEvent = NULL;
+    for (auto & launch:launches) {
+        size_t global_work_offset[3], global_work_size[3];
+        for (int dim = 0; dim < dimension; dim++) {
+            global_work_offset[dim] = launch.second[dim].first;
+            global_work_size[dim] = launch.second[dim].second;
+        }
+        cl_event launchEvent;
+        if (clEnqueueNDRangeKernel(device->getCommandQueue(), launch.first, dimension, global_work_offset, global_work_size, NULL, 0, NULL, &launchEvent) != CL_SUCCESS)
+            break;
+
+        if (firstEvent == NULL) {
+            firstEvent = launchEvent;
+        }
+        else {
+            if (lastEvent != NULL)
+                clReleaseEvent(lastEvent);
+            lastEvent = launchEvent;
+        }
+    }
+    cl_int ret = clFinish(device->getCommandQueue());
+
+    //Execution time of all launches on the device
+    cl_ulong startTime = 0, endTime = 0;
+    if (ret == CL_SUCCESS && firstEvent != NULL && clGetEventProfilingInfo(firstEvent, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &startTime, NULL) == CL_SUCCESS
+        && clGetEventProfilingInfo(lastEvent != NULL ? lastEvent : firstEvent, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &endTime, NULL) == CL_SUCCESS) {
+        lastKernelTime[deviceType] = endTime - startTime;
+    }
+    if (firstEvent != NULL)
+        clReleaseEvent(firstEvent);
+    if (lastEvent != NULL)
+        clReleaseEvent(lastEvent);
+}
+
+//Kernel variants of a scop on a device. Each variant runs once and is timed, then the fastest one is kept.
+//The tuning file holds the fastest variant per device and scop, later runs start with it.
+struct KernelTuning {
+    int numVariants = 0;
+    int fastest = -1;
+    std::vector < long >times; //Nanoseconds, -1 if the variant did not run yet
+};
+static std::map < std::pair < DeviceType, std::string >, KernelTuning > kernelTunings;
+static std::string kernelTuningFile;
+
+static void saveKernelTunings() {
+    if (kernelTuningFile.empty())
+        return;
+
+    std::ofstream tuningStream(kernelTuningFile.c_str(), std::ios::out);
+    for (auto & tuning:kernelTunings) {
+        if (tuning.second.fastest >= 0)
+            tuningStream << resolveAcceleratorName(tuning.first.first) << " " << tuning.first.second << " " << tuning.second.numVariants << " " << tuning.second.fastest << "\n";
+    }
+}
+
+//Helper in C
+//Load the fastest variants of earlier runs, lines "<device> <scop> <number of variants> <fastest variant>"
+extern "C" void initKernelTuning(const char *tuningFile) {
+    kernelTuningFile = tuningFile;
+
+    std::ifstream tuningStream(kernelTuningFile.c_str());
+    std::string deviceName, scopName;
+    int numVariants, fastest;
+    while (tuningStream >> deviceName >> scopName >> numVariants >> fastest) {
+        for (DeviceType deviceType:{
+             MCPU, GPU, MIC}) {
+            if (resolveAcceleratorName(deviceType) == deviceName && fastest >= 0 && fastest < numVariants) {
+                KernelTuning & tuning = kernelTunings[std::pair < DeviceType, std::string > (deviceType, scopName)];
+                tuning.numVariants = numVariants;
+                tuning.fastest = fastest;
+                tuning.times.assign(numVariants, -1);
+            }
+        }
+    }
+
+#ifdef HTROP_DEBUG
+    std::cout << "\nHTROP INFO : initKernelTuning " << kernelTuningFile << " (" << kernelTunings.size() << " tuned kernels)";
+    std::cout.flush();
+#endif
+}
+
+//Helper in C
+//Variant of the scop kernel to run on the device: the fastest one once all were timed, otherwise the next untimed one
+extern "C" int selectKernelVariant(DeviceType deviceType, std::string scopName, int numVariants) {
+    KernelTuning & tuning = kernelTunings[std::pair < DeviceType, std::string > (deviceType, scopName)];
+
+    //The server generated other variants than in the run that saved the tuning
+    if (tuning.numVariants != numVariants) {
+        tuning = KernelTuning();
+        tuning.numVariants = numVariants;
+        tuning.times.assign(numVariants, -1);
+    }
+
+    if (tuning.fastest >= 0)
+        return tuning.fastest;
+
+    for (int variant = 0; variant < numVariants; variant++) {
+        if (tuning.times[variant] < 0)
+            return variant;
+    }
+    return 0;
+}
+
+//Helper in C
+//Record the time of the variant that just ran, the fastest one is kept after the last variant
+extern "C" void timeKernelVariant(DeviceType deviceType, std::string scopName, int variant) {
+    auto tuning = kernelTunings.find(std::pair < DeviceType, std::string > (deviceType, scopName));
+    if (tuning == kernelTunings.end() || tuning->second.fastest >= 0 || variant < 0 || variant >= tuning->second.numVariants)
+        return;
+
+    tuning->second.times[variant] = lastKernelTime[deviceType];
+
+    int fastest = 0;
+    for (int other = 0; other < tuning->second.numVariants; other++) {
+        if (tuning->second.times[other] < 0)
+            return;
+        if (tuning->second.times[other] < tuning->second.times[fastest])
+            fastest = other;
+    }
+    tuning->second.fastest = fastest;
+
+    std::cout << "\nHTROP INFO : Kernel variant " << fastest << " of " << scopName << " is the fastest on " << resolveAcceleratorName(deviceType) << " (" << tuning->second.times[fastest] << " ns)";
+    std::cout.flush();
+
+    saveKernelTunings();
+}
+
+//Helper in C
+//Global work size of a dimension in which each work-item handles several iterations, the factor depends on the device class
+extern "C" long scaleWorkSize(DeviceType deviceType, long size, int factorMCPU, int factorGPU, int factorMIC) {
+    int factor = 1;
+
+    switch (deviceType) {
+    case MCPU:
+        factor = factorMCPU;
+        break;
+    case GPU:
+        factor = factorGPU;
+        break;
+    case MIC:
+        factor = factorMIC;
+        break;
+    default:
+        break;
+    }
+
+    if (factor <= 1)
+        return size;
+
+#ifdef HTROP_DEBUG
+    std::cout << "\nHTROP INFO : scaleWorkSize " << size << " / " << factor;
+    std::cout.flush();
+#endif
+
+    return (size + factor - 1) / factor;
+}
+
+//Work-group limits of a kernel on a device
+struct WorkGroupLimits {
+    size_t maxSize = 1;
+    size_t preferredMultiple = 1;
+    std::vector < size_t > maxItemSizes;
+};
+static std::map < std::pair < DeviceType, std::string >, WorkGroupLimits > workGroupLimits;
+
+static WorkGroupLimits & getWorkGroupLimits(OpenCLDevice * device, DeviceType deviceType, std::string kernelName) {
+    auto limits = workGroupLimits.find(std::pair < DeviceType, std::string > (deviceType, kernelName));
+    if (limits != workGroupLimits.end())
+        return limits->second;
+
+    WorkGroupLimits & newLimits = workGroupLimits[std::pair < DeviceType, std::string > (deviceType, kernelName)];
+    cl_device_id deviceId;
+    clGetCommandQueueInfo(device->getCommandQueue(), CL_QUEUE_DEVICE, sizeof(cl_device_id), &deviceId, NULL);
+
+    cl_kernel kernel = device->getKernel(kernelName);
+    clGetKernelWorkGroupInfo(kernel, deviceId, CL_KERNEL_WORK_GROUP_SIZE, sizeof(size_t), &newLimits.maxSize, NULL);
+    clGetKernelWorkGroupInfo(kernel, deviceId, CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE, sizeof(size_t), &newLimits.preferredMultiple, NULL);
+
+    cl_uint maxDimensions = 0;
+    clGetDeviceInfo(deviceId, CL_DEVICE_MAX_WORK_ITEM_DIMENSIONS, sizeof(cl_uint), &maxDimensions, NULL);
+    newLimits.maxItemSizes.resize(maxDimensions);
+    if (maxDimensions > 0)
+        clGetDeviceInfo(deviceId, CL_DEVICE_MAX_WORK_ITEM_SIZES, maxDimensions * sizeof(size_t), newLimits.maxItemSizes.data(), NULL);
+
+    newLimits.maxSize = std::max < size_t > (newLimits.maxSize, 1);
+    newLimits.preferredMultiple = std::max < size_t > (newLimits.preferredMultiple, 1);
+    return newLimits;
+}
+
+//Helper in C
+//Pick the local sizes that are 0 for the kernel on the device, then round the global sizes up to whole work-groups.
+//The kernels skip the work-items beyond the iteration space.
+extern "C" void fitWorkGroupSize(DeviceType deviceType, std::string kernelName, int dimension, size_t global_work_size[], size_t local_work_size[]) {
+    OpenCLDevice *device = resolveDevice(deviceType);
+
+    if (device == NULL)
+        return;
+
+    WorkGroupLimits & limits = getWorkGroupLimits(device, deviceType, kernelName);
+
+    //The fixed sizes (required by the kernel or given by the user) take their share of the work-group first
+    size_t budget = std::min < size_t > (limits.maxSize, 256);
+    for (int dim = 0; dim < dimension; dim++) {
+        if (local_work_size[dim] > 0)
+            budget = std::max < size_t > (budget / local_work_size[dim], 1);
+    }
+
+    for (int dim = 0; dim < dimension; dim++) {
+        if (local_work_size[dim] > 0)
+            continue;
+
+        size_t limit = budget;
+        if (dim < (int)limits.maxItemSizes.size() && limits.maxItemSizes[dim] > 0)
+            limit = std::min(limit, limits.maxItemSizes[dim]);
+        //Leave room for the other dimensions, dimension 0 gets at least the preferred multiple
+        if (dim == 0 && dimension > 1)
+            limit = std::min(limit, std::max < size_t > (limits.preferredMultiple, 64));
+
+        size_t size = 1;
+        while (size * 2 <= limit && size < global_work_size[dim])
+            size *= 2;
+        if (dim == 0 && size >= limits.preferredMultiple)
+            size -= size % limits.preferredMultiple;
+
+        local_work_size[dim] = size;
+        budget = std::max < size_t > (budget / size, 1);
+    }
+
+    for (int dim = 0; dim < dimension; dim++)
+        global_work_size[dim] = (global_work_size[dim] + local_work_size[dim] - 1) / local_work_size[dim] * local_work_size[dim];
+
+#ifdef HTROP_DEBUG
+    std::cout << "\nHTROP INFO : fitWorkGroupSize " << kernelName << " (max " << limits.maxSize << ", multiple " << limits.preferredMultiple << ")";
+    for (int dim = 0; dim < dimension; dim++)
+        std::cout << "\nHTROP INFO :   dim " << dim << " global " << global_work_size[dim] << " local " << local_work_size[dim];
+    std::cout.flush();
+#endif
+}
+
+//Partial results of the work-groups of a reduction kernel, per device and kernel
+struct ReductionBuffers {
+    cl_mem partial = NULL;
+    cl_mem partialIndex = NULL;
+    long numGroups = 0;
+    int dataTypeSize = 0;
+};
+static std::map < std::pair < DeviceType, std::string >, ReductionBuffers > reductionBuffers;
+
+//Helper in C
+//Pass the buffers for the partial results and their accumulator indices after the kernel arguments
+extern "C" void prepareReduction(DeviceType deviceType, std::string kernelName, int position, int dataTypeSize, int dimension, const size_t global_work_size[], const size_t local_work_size[]) {
+#ifdef HTROP_DEBUG
+    std::cout << "\nHTROP INFO : prepareReduction";
+    std::cout.flush();
+#endif
+
+    OpenCLDevice *device = resolveDevice(deviceType);
+
+    if (device == NULL)
+        return;
+
+    long numGroups = 1;
+    for (int dim = 0; dim < dimension; dim++)
+        numGroups *= global_work_size[dim] / local_work_size[dim];
+
+    ReductionBuffers & buffers = reductionBuffers[std::pair < DeviceType, std::string > (deviceType, kernelName)];
+    if (buffers.numGroups != numGroups || buffers.dataTypeSize != dataTypeSize) {
+        if (buffers.partial != NULL) {
+            clReleaseMemObject(buffers.partial);
+            clReleaseMemObject(buffers.partialIndex);
+        }
+        cl_int ret;
+        buffers.partial = clCreateBuffer(device->getContext(), CL_MEM_WRITE_ONLY, numGroups * dataTypeSize, NULL, &ret);
+        buffers.partialIndex = clCreateBuffer(device->getContext(), CL_MEM_WRITE_ONLY, numGroups * sizeof(cl_long), NULL, &ret);
+        buffers.numGroups = numGroups;
+        buffers.dataTypeSize = dataTypeSize;
+    }
+
+    cl_kernel kernel = device->getKernel(kernelName);
+    assert(kernel != NULL);
+    setRecordedKernelArg(kernel, deviceType, kernelName, position, sizeof(cl_mem), &buffers.partial, false, 0);
+    setRecordedKernelArg(kernel, deviceType, kernelName, position + 1, sizeof(cl_mem), &buffers.partialIndex, false, 0);
+}
+
+template < typename T > static T combineArithmetic(T a, T b, int reductionOperator) {
+    return reductionOperator == RED_MUL ? a * b : a + b;
+}
+
+template < typename T > static T combineInteger(T a, T b, int reductionOperator) {
+    switch (reductionOperator) {
+    case RED_MUL:
+        return a * b;
+    case RED_AND:
+        return a & b;
+    case RED_OR:
+        return a | b;
+    case RED_XOR:
+        return a ^ b;
+    default:
+        return a + b;
+    }
+}
+
+//Combine the partial results per accumulator element, then update the touched range of the accumulator once
+template < typename T > static void combinePartialResults(OpenCLDevice * device, cl_mem accumulator, ReductionBuffers & buffers, T(*combine) (T, T, int), int reductionOperator) {
+    cl_command_queue commandQueue = device->getCommandQueue();
+    std::vector < T > partial(buffers.numGroups);
+    std::vector < cl_long > partialIndex(buffers.numGroups);
+    clEnqueueReadBuffer(commandQueue, buffers.partial, CL_TRUE, 0, buffers.numGroups * sizeof(T), partial.data(), 0, NULL, NULL);
+    clEnqueueReadBuffer(commandQueue, buffers.partialIndex, CL_TRUE, 0, buffers.numGroups * sizeof(cl_long), partialIndex.data(), 0, NULL, NULL);
+
+    std::map < cl_long, T > results;
+    for (long group = 0; group < buffers.numGroups; group++) {
+        if (partialIndex[group] < 0)
+            continue;
+        auto result = results.find(partialIndex[group]);
+        if (result == results.end())
+            results[partialIndex[group]] = partial[group];
+        else
+            result->second = combine(result->second, partial[group], reductionOperator);
+    }
+    if (results.empty())
+        return;
+
+    cl_long first = results.begin()->first;
+    cl_long last = results.rbegin()->first;
+    std::vector < T > values(last - first + 1);
+    clEnqueueReadBuffer(commandQueue, accumulator, CL_TRUE, first * sizeof(T), values.size() * sizeof(T), values.data(), 0, NULL, NULL);
+    for (auto result:results) {
+        values[result.first - first] = combine(values[result.first - first], result.second, reductionOperator);
+    }
+    clEnqueueWriteBuffer(commandQueue, accumulator, CL_TRUE, first * sizeof(T), values.size() * sizeof(T), values.data(), 0, NULL, NULL);
+}
+
+//Helper in C
+//Final step of a reduction kernel, the partial results of the work-groups are combined into the accumulator on the device
+extern "C" void finishReduction(DeviceType deviceType, std::string kernelName, void *accumulatorDataPointer, int reductionOperator, int isFloat, int dataTypeSize) {
+#ifdef HTROP_DEBUG
+    std::cout << "\nHTROP INFO : finishReduction";
+    std::cout.flush();
+#endif
+
+    OpenCLDevice *device = resolveDevice(deviceType);
+    auto buffers = reductionBuffers.find(std::pair < DeviceType, std::string > (deviceType, kernelName));
+
+    if (device == NULL || buffers == reductionBuffers.end())
+        return;
+
+    cl_mem accumulator = device->getBuffer(accumulatorDataPointer);
+    if (accumulator == NULL) {
+        std::cerr << "\nHTROP ERROR : accumulator of " << kernelName << " is not on the device";
+        return;
+    }
+
+    if (isFloat) {
+        if (dataTypeSize == sizeof(cl_double))
+            combinePartialResults < cl_double > (device, accumulator, buffers->second, combineArithmetic < cl_double >, reductionOperator);
+        else
+            combinePartialResults < cl_float > (device, accumulator, buffers->second, combineArithmetic < cl_float >, reductionOperator);
+        return;
+    }
+
+    switch (dataTypeSize) {
+    case sizeof(cl_char):
+        combinePartialResults < cl_char > (device, accumulator, buffers->second, combineInteger < cl_char >, reductionOperator);
+        break;
+    case sizeof(cl_short):
+        combinePartialResults < cl_short > (device, accumulator, buffers->second, combineInteger < cl_short >, reductionOperator);
+        break;
+    case sizeof(cl_int):
+        combinePartialResults < cl_int > (device, accumulator, buffers->second, combineInteger < cl_int >, reductionOperator);
+        break;
+    default:
+        combinePartialResults < cl_long > (device, accumulator, buffers->second, combineInteger < cl_long >, reductionOperator);
+        break;
     }
 }
 
@@ -648,6 +1275,17 @@ extern "C" void cleanUpBuffers_Device(DeviceType deviceType) {
     if (device != NULL) {
         device->cleanUpBuffers();
     }
+
+    for (auto buffers = reductionBuffers.begin(); buffers != reductionBuffers.end();) {
+        if (buffers->first.first == deviceType) {
+            clReleaseMemObject(buffers->second.partial);
+            clReleaseMemObject(buffers->second.partialIndex);
+            buffers = reductionBuffers.erase(buffers);
+        }
+        else {
+            buffers++;
+        }
+    }
 }
 
 //Helper in C
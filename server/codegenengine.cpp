@@ -0,0 +1,487 @@
+//    Copyright (c) 2019 University of Paderborn 
+//                         (Marvin Damschen <marvin.damschen@gullz.de>,
+//                          Gavin Vaz <gavin.vaz@uni-paderborn.de>,
+//                          Heinrich Riebler <heinrich.riebler@uni-paderborn.de>)
+
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+
+//    The above copyright notice and this permission notice shall be included in
+//    all copies or substantial portions of the Software.
+
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//    THE SOFTWARE.
+
+#include "codegenengine.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <signal.h>
+#include <cerrno>
+#include <chrono>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <vector>
+#include <string>
+
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IRReader/IRReader.h"
+#include "llvm/IR/Module.h"
+
+#if LLVM_VERSION == 3 && LLVM_MINOR_VERSION < 5
+#include "llvm/Analysis/Verifier.h"
+#else
+#include "llvm/IR/Verifier.h"
+#endif
+#include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/MemoryBuffer.h"
+
+#include "openCLCbackend.h"
+#include "../client/pass/scopanalysis.h"
+#include "../common/llvmHelper.h"
+#include "../common/stringHelper.h"
+
+
+CodeGenEngine::CodeGenEngine(bool isCacheEnabled, bool isolateCodeGen, unsigned int codeGenTimeout, std::string cacheDir, std::string requestLogPath, CodeGenOptions codeGenOptions) {
+    CodeGenEngine::isCacheEnabled = isCacheEnabled;
+    CodeGenEngine::isolateCodeGen = isolateCodeGen;
+    CodeGenEngine::codeGenTimeout = codeGenTimeout;
+    CodeGenEngine::cacheDir = cacheDir;
+    CodeGenEngine::requestLogPath = requestLogPath;
+    CodeGenEngine::codeGenOptions = codeGenOptions;
+}
+
+//Check if the code is already present
+HTROP_PB::Message_RSRC * CodeGenEngine::isCodeCached(std::string key) {
+    if (!isCacheEnabled)
+        return NULL;
+
+    std::lock_guard < std::mutex > lock(cacheMutex);
+    if (cacheList.count(key)) {
+        return cacheList[key];
+    }
+    if (!cacheDir.empty()) {
+        HTROP_PB::Message_RSRC * codeGenMsgFromServer = loadFromDiskCache(key);
+        if (codeGenMsgFromServer != NULL) {
+            cacheList.insert(std::pair < std::string, HTROP_PB::Message_RSRC * >(key, codeGenMsgFromServer));
+            return codeGenMsgFromServer;
+        }
+    }
+    return NULL;
+}
+
+//Two threads can generate the same request, the cache keeps the first response
+HTROP_PB::Message_RSRC * CodeGenEngine::addToCache(std::string key, HTROP_PB::Message_RSRC * codeGenMsgFromServer) {
+    if (!isCacheEnabled)
+        return codeGenMsgFromServer;
+
+    std::lock_guard < std::mutex > lock(cacheMutex);
+    auto cacheEntry = cacheList.insert(std::pair < std::string, HTROP_PB::Message_RSRC * >(key, codeGenMsgFromServer));
+    if (!cacheEntry.second) {
+        delete codeGenMsgFromServer;
+        return cacheEntry.first->second;
+    }
+    if (!cacheDir.empty()) {
+        storeToDiskCache(key, codeGenMsgFromServer);
+    }
+    return codeGenMsgFromServer;
+}
+
+void CodeGenEngine::releaseCode(HTROP_PB::Message_RSRC * codeGenMsgFromServer) {
+    if (!isCacheEnabled)
+        delete codeGenMsgFromServer;
+}
+
+//The key covers the parent function, the requested scops and the hash of their module, so that different clients
+//and different builds of a client do not share entries in the persistent cache.
+std::string CodeGenEngine::getCacheKey(HTROP_PB::Message_RCRS * codeGenMsgFromClient) {
+    uint64_t hash = hashString(codeGenMsgFromClient->SerializeAsString() + codeGenOptions.getFingerprint());
+
+    std::stringstream key;
+    key << "ocl_" << codeGenMsgFromClient->scopfunctionparentname() << "_" << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return key.str();
+}
+
+HTROP_PB::Message_RSRC * CodeGenEngine::loadFromDiskCache(std::string key) {
+    std::ifstream rsrcFile(cacheDir + "/" + key + ".rsrc", std::ios::binary);
+    if (!rsrcFile.good())
+        return NULL;
+
+    std::stringstream content;
+    content << rsrcFile.rdbuf();
+
+    HTROP_PB::Message_RSRC * codeGenMsgFromServer = new HTROP_PB::Message_RSRC();
+    if (!codeGenMsgFromServer->ParseFromString(content.str()) || access(codeGenMsgFromServer->oclkernelfilename().c_str(), R_OK) != 0) {
+        delete codeGenMsgFromServer;
+        return NULL;
+    }
+
+#ifdef HTROP_DEBUG
+    std::cout << "\n Loaded " << key << " from persistent cache";
+    std::cout.flush();
+#endif
+    return codeGenMsgFromServer;
+}
+
+//Write to a temporary file first and rename it, other workers never see partially written entries.
+void CodeGenEngine::storeToDiskCache(std::string key, HTROP_PB::Message_RSRC * codeGenMsgFromServer) {
+    std::string rsrcFilePath = cacheDir + "/" + key + ".rsrc";
+    std::string tmpFilePath = rsrcFilePath + "." + std::to_string(getpid());
+
+    std::ofstream rsrcFile(tmpFilePath, std::ios::binary);
+    if (!rsrcFile.good() || !codeGenMsgFromServer->SerializeToOstream(&rsrcFile)) {
+        std::cerr << "Could not write persistent cache entry " << rsrcFilePath;
+        return;
+    }
+    rsrcFile.close();
+    rename(tmpFilePath.c_str(), rsrcFilePath.c_str());
+}
+
+void CodeGenEngine::codeGen_OCL(llvm::Module * &Mod, HTROP_PB::Message_RCRS * codeGenMsgFromClient, HTROP_PB::Message_RSRC * codeGenMsgFromServer, std::string key) {
+    std::string oclKernelFilePath = codeGenMsgFromClient->scopfunctionparentname() + "_server.cl";
+    if (!cacheDir.empty()) {
+        oclKernelFilePath = cacheDir + "/" + key + ".cl";
+    }
+    std::string tmpKernelFilePath = oclKernelFilePath + "." + std::to_string(getpid());
+
+    OpenCLCBackend openCLCBackend(Mod, codeGenMsgFromClient, codeGenMsgFromServer, tmpKernelFilePath, codeGenOptions);
+
+    rename(tmpKernelFilePath.c_str(), oclKernelFilePath.c_str());
+    if (codeGenOptions.oclEmitter == "compare") {
+        rename((tmpKernelFilePath + ".direct.cl").c_str(), (oclKernelFilePath + ".direct.cl").c_str());
+    }
+    codeGenMsgFromServer->set_oclkernelfilename(oclKernelFilePath);
+}
+
+//Fork a child for the backend. If it asserts or crashes only this request fails, the server and its cache survive.
+bool CodeGenEngine::codeGen_OCL_Isolated(llvm::Module * &Mod, HTROP_PB::Message_RCRS * codeGenMsgFromClient, HTROP_PB::Message_RSRC * codeGenMsgFromServer, std::string key) {
+    int pipefd[2];
+    if (pipe(pipefd) < 0) {
+        std::cerr << "Could not create pipe for isolated code generation";
+        return false;
+    }
+
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid < 0) {
+        std::cerr << "Could not fork code generation process";
+        close(pipefd[0]);
+        close(pipefd[1]);
+        return false;
+    }
+
+    if (pid == 0) {
+        close(pipefd[0]);
+        codeGen_OCL(Mod, codeGenMsgFromClient, codeGenMsgFromServer, key);
+
+        std::string codeGenMsg = codeGenMsgFromServer->SerializeAsString();
+        const char *data = codeGenMsg.c_str();
+        size_t remaining = codeGenMsg.size();
+        while (remaining > 0) {
+            ssize_t written = write(pipefd[1], data, remaining);
+            if (written <= 0)
+                _exit(1);
+            data += written;
+            remaining -= written;
+        }
+        close(pipefd[1]);
+        std::cout.flush();
+        _exit(0);
+    }
+
+    close(pipefd[1]);
+    std::string codeGenMsg;
+    char buffer[4096];
+    ssize_t bytesRead;
+
+    //Read the response until the child exits, a child that is still running at the deadline is killed
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(codeGenTimeout);
+    bool timedOut = false;
+    while (true) {
+        long long remaining = std::chrono::duration_cast < std::chrono::milliseconds > (deadline - std::chrono::steady_clock::now()).count();
+        struct pollfd pipePoll = { pipefd[0], POLLIN, 0 };
+        int ready = remaining > 0 ? poll(&pipePoll, 1, (int)std::min(remaining, 60000LL)) : 0;
+        if (ready < 0 && errno == EINTR)
+            continue;
+        if (ready == 0 && remaining > 0)
+            continue;
+        if (ready == 0) {
+            timedOut = true;
+            break;
+        }
+        if (ready < 0 || (bytesRead = read(pipefd[0], buffer, sizeof(buffer))) <= 0)
+            break;
+        codeGenMsg.append(buffer, bytesRead);
+    }
+    close(pipefd[0]);
+
+    int status = -1;
+    while (!timedOut && waitpid(pid, &status, WNOHANG) == 0) {
+        if (std::chrono::steady_clock::now() >= deadline)
+            timedOut = true;
+        else
+            usleep(1000);
+    }
+    if (timedOut) {
+        kill(pid, SIGKILL);
+        waitpid(pid, &status, 0);
+        std::cerr << "\nCode generation for " << codeGenMsgFromClient->scopfunctionparentname() << " timed out after " << codeGenTimeout << " s";
+        return false;
+    }
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        std::cerr << "\nCode generation for " << codeGenMsgFromClient->scopfunctionparentname() << " failed";
+        if (WIFSIGNALED(status))
+            std::cerr << " (signal " << WTERMSIG(status) << ")";
+        return false;
+    }
+
+    return codeGenMsgFromServer->ParseFromString(codeGenMsg);
+}
+
+//Parse the module received from the client, generate the kernels and add them to the cache
+HTROP_PB::Message_RSRC * CodeGenEngine::generateCode(HTROP_PB::Message_RCRS * codeGenMsgFromClient, std::string key, const char *moduleIR, size_t moduleIRSize) {
+
+    //LLVM and the backend share global state, generate one module at a time
+    std::lock_guard < std::mutex > codeGenLock(codeGenMutex);
+
+    llvm::SMDiagnostic Err;
+    auto moduleMemBuffer = llvm::MemoryBuffer::getMemBuffer(llvm::StringRef(moduleIR, moduleIRSize), "", false);
+
+    std::unique_ptr < llvm::Module > module_Ptr = llvm::parseIR(moduleMemBuffer->getMemBufferRef(), Err, llvm::getGlobalContext());
+    llvm::Module * Mod = module_Ptr.get();
+    if (!Mod) {
+        Err.print("htropserver", llvm::errs());
+        return NULL;
+    }
+
+#ifdef HTROP_DEBUG
+    std::cout << "\n -- Verifying LLVM IR Module ....  ";
+    std::cout.flush();
+#endif
+    llvm::verifyModule(*Mod);
+
+    HTROP_PB::Message_RSRC * codeGenMsgFromServer = new HTROP_PB::Message_RSRC();
+    if (isolateCodeGen) {
+        if (!codeGen_OCL_Isolated(Mod, codeGenMsgFromClient, codeGenMsgFromServer, key)) {
+            delete codeGenMsgFromServer;
+            return NULL;
+        }
+    }
+    else {
+        codeGen_OCL(Mod, codeGenMsgFromClient, codeGenMsgFromServer, key);
+    }
+
+    //Update the cache
+    return addToCache(key, codeGenMsgFromServer);
+}
+
+//Same steps as the client: prepare for Polly, detect the scops and build the code gen request.
+//The request is then handled like one sent by a client, including cache and request log.
+HTROP_PB::Message_RSRC * CodeGenEngine::analyseAndGenerate(HTROP_PB::Message_RCRS_Analysis * analysisMsgFromClient, const char *moduleIR, size_t moduleIRSize, HTROP_PB::ScopAnalysisResult * analysisResult) {
+
+#if MEASURE
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+#endif
+
+    HTROP_PB::Message_RCRS codeGenMsgFromClient;
+    std::string scopIR;
+    {
+        std::lock_guard < std::mutex > codeGenLock(codeGenMutex);
+
+        llvm::SMDiagnostic Err;
+        auto moduleMemBuffer = llvm::MemoryBuffer::getMemBuffer(llvm::StringRef(moduleIR, moduleIRSize), "", false);
+
+        std::unique_ptr < llvm::Module > module_Ptr = llvm::parseIR(moduleMemBuffer->getMemBufferRef(), Err, llvm::getGlobalContext());
+        llvm::Module * Mod = module_Ptr.get();
+        if (!Mod) {
+            Err.print("htropserver", llvm::errs());
+            return NULL;
+        }
+        llvm::verifyModule(*Mod);
+
+        std::vector < int >maxScopLoopDepth(analysisMsgFromClient->max_scop_loop_depth().begin(), analysisMsgFromClient->max_scop_loop_depth().end());
+        std::vector < int >maxCogeGenLoopDepth(analysisMsgFromClient->max_codegen_loop_depth().begin(), analysisMsgFromClient->max_codegen_loop_depth().end());
+
+        htrop::ScopDSMap scopList;
+        htrop::prepareModuleForPolly(Mod, analysisMsgFromClient->optimize_schedule());
+        llvm::Function * scopFunctionParent = htrop::detectScops(Mod, maxScopLoopDepth, scopList);
+
+        if (scopFunctionParent == NULL || scopList.empty()) {
+            std::cout << "\nSERVER INFO: No scops found in module";
+            std::cout.flush();
+            return NULL;
+        }
+
+        std::vector < llvm::Function * >functionsToExport;
+        for (auto scop:scopList) {
+            htrop::scopDSToProto(scop.second, analysisResult->add_scops());
+            functionsToExport.push_back(scop.second->scopFunction);
+        }
+        htrop::addScopsToCodeGenReq(&codeGenMsgFromClient, scopList, scopFunctionParent, maxCogeGenLoopDepth);
+
+        std::vector < llvm::GlobalVariable * >globalsToExport;
+        scopIR = exportFunctionIntoBitcode(Mod, functionsToExport, globalsToExport);
+        codeGenMsgFromClient.set_module_hash(hashString(scopIR));
+
+        for (auto scop:scopList) {
+            delete scop.second;
+        }
+    }
+
+#if MEASURE
+    std::cout << "\nMEASURE-TIME: -> Scop Analysis : " << (std::chrono::duration_cast < std::chrono::microseconds > (std::chrono::steady_clock::now() - startTime).count());
+#endif
+
+    std::string key = getCacheKey(&codeGenMsgFromClient);
+    HTROP_PB::Message_RSRC * codeGenMsgFromServer = isCodeCached(key);
+    if (codeGenMsgFromServer != NULL) {
+        logRequest(key, &codeGenMsgFromClient, NULL, 0);
+        return codeGenMsgFromServer;
+    }
+
+    codeGenMsgFromServer = generateCode(&codeGenMsgFromClient, key, scopIR.c_str(), scopIR.size());
+    if (codeGenMsgFromServer != NULL)
+        logRequest(key, &codeGenMsgFromClient, scopIR.c_str(), scopIR.size());
+    return codeGenMsgFromServer;
+}
+
+//BEGIN REQUEST LOG
+
+//Append one record per request with generated or cached code: key, serialized request and module (empty for cache hits).
+//The record is written with a single write() on an O_APPEND descriptor, so workers can share the log.
+void CodeGenEngine::logRequest(std::string key, HTROP_PB::Message_RCRS * codeGenMsgFromClient, const char *moduleIR, size_t moduleIRSize) {
+    if (requestLogPath.empty())
+        return;
+
+    std::string request = codeGenMsgFromClient->SerializeAsString();
+
+    std::string record;
+    uint32_t fieldSize = key.size();
+    record.append((const char *)&fieldSize, sizeof(fieldSize));
+    record.append(key);
+    fieldSize = request.size();
+    record.append((const char *)&fieldSize, sizeof(fieldSize));
+    record.append(request);
+    fieldSize = moduleIRSize;
+    record.append((const char *)&fieldSize, sizeof(fieldSize));
+    if (moduleIRSize > 0)
+        record.append(moduleIR, moduleIRSize);
+
+    int logfd = open(requestLogPath.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
+    if (logfd < 0) {
+        std::cerr << "Could not open request log " << requestLogPath;
+        return;
+    }
+    if (write(logfd, record.c_str(), record.size()) != (ssize_t) record.size()) {
+        std::cerr << "Could not write request log " << requestLogPath;
+    }
+    close(logfd);
+}
+
+//A field larger than the rest of the log is a truncated or corrupt record, it ends the log
+static bool readLogField(std::ifstream & logFile, uint64_t logSize, std::string & field) {
+    uint32_t fieldSize;
+    if (!logFile.read((char *)&fieldSize, sizeof(fieldSize)))
+        return false;
+    std::streamoff position = logFile.tellg();
+    if (position < 0 || fieldSize > logSize - (uint64_t) position)
+        return false;
+    field.resize(fieldSize);
+    if (fieldSize > 0 && !logFile.read(&field[0], fieldSize))
+        return false;
+    return true;
+}
+
+//Replay the most frequent requests of a log through the code generation, so that the cache is warm after a restart
+int CodeGenEngine::prewarmFromLog(std::string prewarmLogPath, int prewarmCount) {
+
+#if MEASURE
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+#endif
+
+    std::ifstream logFile(prewarmLogPath, std::ios::binary);
+    if (!logFile.good()) {
+        std::cerr << "Could not open prewarm log " << prewarmLogPath;
+        return -1;
+    }
+
+    logFile.seekg(0, std::ios::end);
+    uint64_t logSize = logFile.tellg();
+    logFile.seekg(0, std::ios::beg);
+
+    struct LogEntry {
+        unsigned int frequency = 0;
+        std::string request;
+        std::string moduleIR;
+    };
+    std::map < std::string, LogEntry > entries;
+
+    std::string key, request, moduleIR;
+    while (readLogField(logFile, logSize, key) && readLogField(logFile, logSize, request) && readLogField(logFile, logSize, moduleIR)) {
+        LogEntry & entry = entries[key];
+        entry.frequency++;
+        entry.request = request;
+        if (!moduleIR.empty())
+            entry.moduleIR.swap(moduleIR);
+    }
+
+    std::vector < std::pair < unsigned int, std::string > >byFrequency;
+    for (auto & entry:entries) {
+        if (!entry.second.moduleIR.empty())
+            byFrequency.push_back(std::make_pair(entry.second.frequency, entry.first));
+    }
+    std::sort(byFrequency.begin(), byFrequency.end(), [](const std::pair < unsigned int, std::string > &a, const std::pair < unsigned int, std::string > &b) {
+              return a.first > b.first;
+              });
+
+    int warmed = 0;
+    for (auto & candidate:byFrequency) {
+        if (warmed >= prewarmCount)
+            break;
+
+        LogEntry & entry = entries[candidate.second];
+        HTROP_PB::Message_RCRS codeGenMsgFromClient;
+        if (!codeGenMsgFromClient.ParseFromString(entry.request))
+            continue;
+
+        //The logged key may belong to other code generation options
+        std::string key = getCacheKey(&codeGenMsgFromClient);
+        if (isCodeCached(key) == NULL) {
+#ifdef HTROP_DEBUG
+            std::cout << "\n Prewarming " << key << " (" << candidate.first << " requests)";
+            std::cout.flush();
+#endif
+            if (generateCode(&codeGenMsgFromClient, key, entry.moduleIR.c_str(), entry.moduleIR.size()) == NULL)
+                continue;
+        }
+        warmed++;
+    }
+
+    std::cout << "\nINFO: Prewarmed " << warmed << " cache entries";
+#if MEASURE
+    std::cout << "\nMEASURE-TIME: Prewarm : " << (std::chrono::duration_cast < std::chrono::microseconds > (std::chrono::steady_clock::now() - startTime).count());
+#endif
+    std::cout.flush();
+    return warmed;
+}
+
+//END REQUEST LOG
@@ -0,0 +1,87 @@
+//    Copyright (c) 2019 University of Paderborn 
+//                         (Marvin Damschen <marvin.damschen@gullz.de>,
+//                          Gavin Vaz <gavin.vaz@uni-paderborn.de>,
+//                          Heinrich Riebler <heinrich.riebler@uni-paderborn.de>)
+
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+
+//    The above copyright notice and this permission notice shall be included in
+//    all copies or substantial portions of the Software.
+
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//    THE SOFTWARE.
+
+#ifndef CODEGENENGINE_H
+#define CODEGENENGINE_H
+
+#include "llvm/IR/Module.h"
+#include "../common/hds.pb.h"
+#include "openCLCbackend.h"
+
+#include<map>
+#include<mutex>
+#include<string>
+
+//Code generation pipeline of the HTROP Server: cache lookup, module parsing and the OpenCL backend.
+//Used by the HTROPServer and linked into the client for the in-process mode.
+class CodeGenEngine {
+
+    bool isCacheEnabled = true;
+    //Functin Name is the key
+     std::map < std::string, HTROP_PB::Message_RSRC * >cacheList;
+     std::mutex cacheMutex;
+    //The response that stays in the cache for key, a second response for the key is deleted. Without the cache the
+    //response is returned as is.
+     HTROP_PB::Message_RSRC * addToCache(std::string key, HTROP_PB::Message_RSRC * codeGenMsgFromServer);
+
+    //Persistent cache shared by all processes (disabled if empty)
+     std::string cacheDir;
+     HTROP_PB::Message_RSRC * loadFromDiskCache(std::string key);
+    void storeToDiskCache(std::string key, HTROP_PB::Message_RSRC * codeGenMsgFromServer);
+
+    //Run the code generation in a forked child so that a crashing backend only fails its own request
+    bool isolateCodeGen = false;
+    //Seconds until a hanging child is killed, the child of a multithreaded worker can block on a lock held at the fork
+    unsigned int codeGenTimeout = 0;
+     std::mutex codeGenMutex;
+    bool codeGen_OCL_Isolated(llvm::Module * &Mod, HTROP_PB::Message_RCRS * codeGenMsgFromClient, HTROP_PB::Message_RSRC * codeGenMsgFromServer, std::string key);
+
+    //Generate OCL code
+    void codeGen_OCL(llvm::Module * &Mod, HTROP_PB::Message_RCRS * codeGenMsgFromClient, HTROP_PB::Message_RSRC * codeGenMsgFromServer, std::string key);
+
+     std::string requestLogPath;
+
+     CodeGenOptions codeGenOptions;
+
+ public:
+     CodeGenEngine(bool isCacheEnabled, bool isolateCodeGen, unsigned int codeGenTimeout, std::string cacheDir, std::string requestLogPath, CodeGenOptions codeGenOptions);
+
+     std::string getCacheKey(HTROP_PB::Message_RCRS * codeGenMsgFromClient);
+    //Check if the Code for the function and resource is available
+     HTROP_PB::Message_RSRC * isCodeCached(std::string key);
+    //Returns NULL if the module could not be parsed or the backend failed. The response is owned by the cache, without
+    //the cache the caller hands it to releaseCode.
+     HTROP_PB::Message_RSRC * generateCode(HTROP_PB::Message_RCRS * codeGenMsgFromClient, std::string key, const char *moduleIR, size_t moduleIRSize);
+
+    //Run the scop analysis of the client on the complete module, then generate the kernels for the detected scops.
+    //Returns NULL if no scop was found or the backend failed, the analysis results are set in any case.
+     HTROP_PB::Message_RSRC * analyseAndGenerate(HTROP_PB::Message_RCRS_Analysis * analysisMsgFromClient, const char *moduleIR, size_t moduleIRSize, HTROP_PB::ScopAnalysisResult * analysisResult);
+    //Delete a response of generateCode or analyseAndGenerate that is not in the cache
+    void releaseCode(HTROP_PB::Message_RSRC * codeGenMsgFromServer);
+
+    //Request log and cache pre-warming
+    void logRequest(std::string key, HTROP_PB::Message_RCRS * codeGenMsgFromClient, const char *moduleIR, size_t moduleIRSize);
+    int prewarmFromLog(std::string prewarmLogPath, int prewarmCount);
+};
+
+#endif                          // CODEGENENGINE_H
@@ -32,12 +32,14 @@
 #include <signal.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/wait.h>
 #include <netinet/in.h>
 #include <limits.h>
 #include <iostream>
 #include <unordered_map>
 #include <vector>
 #include <string>
+#include <algorithm>
 
 #include "llvm/IR/Function.h"
 #include "llvm/ExecutionEngine/GenericValue.h"
@@ -62,24 +64,29 @@
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/MemoryBuffer.h"
 
-#include "openCLCbackend.h"
 #include "../common/llvmHelper.h"
 #include "../common/sharedStructCompileRuntime.h"
 
 #include "llvm/IR/LegacyPassManager.h"
 
-HTROPServer::HTROPServer(bool isCacheEnabled, int portNumber) {
+HTROPServer::HTROPServer(bool isCacheEnabled, int portNumber, int numWorkers, bool isolateCodeGen, unsigned int codeGenTimeout, std::string cacheDir, std::string requestLogPath, std::string prewarmLogPath, int prewarmCount, CodeGenOptions codeGenOptions) {
     // Verify that the version of the library that we linked against is
     // compatible with the version of the headers we compiled against.
     GOOGLE_PROTOBUF_VERIFY_VERSION;
     portno = portNumber;
     sockfd = -1;
     HTROPServer::isCacheEnabled = isCacheEnabled;
+    HTROPServer::numWorkers = numWorkers;
+    HTROPServer::cacheDir = cacheDir;
+    HTROPServer::prewarmLogPath = prewarmLogPath;
+    HTROPServer::prewarmCount = prewarmCount;
+    codeGenEngine = new CodeGenEngine(isCacheEnabled, isolateCodeGen, codeGenTimeout, cacheDir, requestLogPath, codeGenOptions);
 }
 
 HTROPServer::~HTROPServer() {
     //Close the sockets
     shutdown(sockfd, 2);
+    delete codeGenEngine;
     //Delete all global objects allocated by libprotobuf.
     google::protobuf::ShutdownProtobufLibrary();
 }
@@ -91,9 +98,117 @@ int
         return -1;
     }
 
+    if (numWorkers > 0)
+        return superviseWorkers();
+
+    return startWorker();
+}
+
+int HTROPServer::startWorker() {
     if (createSocket() < 0)
         return -1;
-    handleIncommingConnections();
+
+    return serveWorker();
+}
+
+int HTROPServer::serveWorker() {
+    //Warm the cache in the background while already accepting connections.
+    //With a persistent cache, the prefork supervisor warms the shared cache once instead.
+    if (isCacheEnabled && !prewarmLogPath.empty() && !(numWorkers > 0 && !cacheDir.empty())) {
+        std::thread(&CodeGenEngine::prewarmFromLog, codeGenEngine, prewarmLogPath, prewarmCount).detach();
+    }
+
+    return handleIncommingConnections();
+}
+
+//Exit status of a worker that could not create its socket, e.g. because the port is in use
+static const int workerStartupFailed = 3;
+
+pid_t HTROPServer::forkWorker() {
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid == 0) {
+        std::cout << "\nSERVER INFO: Worker " << getpid() << " started";
+        std::cout.flush();
+        if (createSocket() < 0)
+            _exit(workerStartupFailed);
+        exit(serveWorker());
+    }
+    if (pid > 0)
+        workerStartTimes[pid] = time(NULL);
+    return pid;
+}
+
+void HTROPServer::stopWorkers() {
+    for (auto worker:workerStartTimes) {
+        kill(worker.first, SIGTERM);
+        waitpid(worker.first, NULL, 0);
+    }
+    workerStartTimes.clear();
+}
+
+//Fork the worker processes and restart the ones that crash after their start, with a growing delay if they crash right away.
+//A worker that cannot start stops the server, the others would fail the same way.
+//Every worker binds its own socket to the shared port (SO_REUSEPORT) so the kernel balances the connections.
+int HTROPServer::superviseWorkers() {
+
+    if (isCacheEnabled && !prewarmLogPath.empty() && !cacheDir.empty()) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            codeGenEngine->prewarmFromLog(prewarmLogPath, prewarmCount);
+            _exit(0);
+        }
+    }
+
+    for (int worker = 0; worker < numWorkers; worker++) {
+        if (forkWorker() < 0) {
+            std::cerr << "Could not fork worker process";
+            stopWorkers();
+            return -1;
+        }
+    }
+
+    unsigned int restartDelay = 1;
+    while (!workerStartTimes.empty()) {
+        int status;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0)
+            return -1;
+        auto worker = workerStartTimes.find(pid);
+        if (worker == workerStartTimes.end())
+            continue;           //prewarm process
+        time_t lifetime = time(NULL) - worker->second;
+        workerStartTimes.erase(worker);
+
+        if (WIFEXITED(status) && WEXITSTATUS(status) == workerStartupFailed) {
+            std::cerr << "\nWorker " << pid << " could not start, stopping the server";
+            stopWorkers();
+            return -1;
+        }
+        if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+            std::cout << "\nSERVER INFO: Worker " << pid << " exited";
+            std::cout.flush();
+            continue;
+        }
+
+        //Workers crashing within seconds of their start wait up to a minute before the next attempt
+        restartDelay = lifetime < 10 ? std::min(restartDelay * 2, 64u) : 1;
+        if (WIFSIGNALED(status)) {
+            std::cout << "\nSERVER INFO: Worker " << pid << " terminated by signal " << WTERMSIG(status) << ", restarting in " << restartDelay << " s";
+        }
+        else {
+            std::cout << "\nSERVER INFO: Worker " << pid << " exited with status " << WEXITSTATUS(status) << ", restarting in " << restartDelay << " s";
+        }
+        std::cout.flush();
+        sleep(restartDelay);
+
+        if (forkWorker() < 0) {
+            std::cerr << "Could not fork worker process";
+            stopWorkers();
+            return -1;
+        }
+    }
+    return 0;
 }
 
 int HTROPServer::createSocket() {
@@ -104,6 +219,15 @@ int HTROPServer::createSocket() {
         return -1;
     }
 
+    int enable = 1;
+    setsockopt(sockfd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+#ifdef SO_REUSEPORT
+    if (numWorkers > 0 && setsockopt(sockfd, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) < 0) {
+        std::cerr << "Could not enable SO_REUSEPORT";
+        return -1;
+    }
+#endif
+
 #ifdef HTROP_DEBUG
     std::cout << "\nSocket created";
     std::cout.flush();
@@ -198,6 +322,10 @@ void *HTROPServer::connection_handler(void *object, int client_sockfd) {
             active = serverObject->handleCodeGenReq(client_sockfd, handleReqMessage->getMessageBuffer(), handleReqMessage->getSize());
             break;
 
+        case REQ_SCOP_ANALYSIS:
+            active = serverObject->handleScopAnalysisReq(client_sockfd, handleReqMessage->getMessageBuffer(), handleReqMessage->getSize());
+            break;
+
         case -1:               // Disconnection / error
 
             if (handleReqMessage->getSize() == 0) {
@@ -224,23 +352,17 @@ void *HTROPServer::connection_handler(void *object, int client_sockfd) {
     return 0;
 }
 
-//Check if the code is already present
-HTROP_PB::Message_RSRC * HTROPServer::isCodeCached(std::string key) {
-    if (cacheList.count(key)) {
-        return cacheList[key];
-    }
-    return NULL;
-}
-
-//returns the index of the newly created hotspot
-void HTROPServer::addToCache(std::string key, HTROP_PB::Message_RSRC * codeGenMsgFromServer) {
-    cacheList.insert(std::pair < std::string, HTROP_PB::Message_RSRC * >(key, codeGenMsgFromServer));
-}
+//Tell the client that no code is available, it keeps executing the original functions
+int HTROPServer::sendCodeGenFailed(int sockfd) {
+    Message *codeGenFailedMessage = new Message();
+    int status = codeGenFailedMessage->send(sockfd, RSP_CODE_GEN_FAILED, "", 0, 0);
+    delete codeGenFailedMessage;
 
-void HTROPServer::codeGen_OCL(llvm::Module * &Mod, HTROP_PB::Message_RCRS * codeGenMsgFromClient, HTROP_PB::Message_RSRC * codeGenMsgFromServer) {
-    std::string oclKernelFilePath = codeGenMsgFromClient->scopfunctionparentname() + "_server.cl";
-    codeGenMsgFromServer->set_oclkernelfilename(oclKernelFilePath);
-    auto *openCLCBackend = new OpenCLCBackend(Mod, codeGenMsgFromClient, codeGenMsgFromServer, oclKernelFilePath);
+    if (status < 0) {
+        std::cerr << sockfd << ": Error: Failed to send code gen failure";
+        return 0;
+    }
+    return 1;
 }
 
 // Code Generation
@@ -265,7 +387,7 @@ int HTROPServer::handleCodeGenReq(int sockfd, char *recvMessageBuffer, int messa
         return 0;
     }
 
-    std::string scopFunctionParentName = "ocl_" + codeGenMsgFromClient.scopfunctionparentname();
+    std::string scopFunctionParentName = codeGenEngine->getCacheKey(&codeGenMsgFromClient);
 
 #if MEASURE
     std::cout << "\nMEASURE-TIME: Preprocessing : " << (std::chrono::duration_cast < std::chrono::microseconds > (std::chrono::steady_clock::now() - startTime).count());
@@ -274,18 +396,15 @@ int HTROPServer::handleCodeGenReq(int sockfd, char *recvMessageBuffer, int messa
 #endif
 
     //PHASE I: CHECK IF THE CODE IS CACHED
-    codegenMessageFromServer = isCodeCached(scopFunctionParentName);
+    codegenMessageFromServer = codeGenEngine->isCodeCached(scopFunctionParentName);
 
-    if (!(isCacheEnabled && codegenMessageFromServer != NULL)) {
+    if (codegenMessageFromServer == NULL) {
 #ifdef HTROP_DEBUG
         std::cout << "\n" << sockfd << ": Request for LLVM IR ...";
         std::cout.flush();
 #endif
 
         //PHASE II: Check if the LLVM code for the function is cached
-        std::unique_ptr < llvm::Module > module_Ptr;
-        llvm::Module * Mod = NULL;
-
         HTROP_PB::LLVM_IR_Req llvmReqFromServer;
         std::string msgRequest = llvmReqFromServer.SerializeAsString();
 
@@ -316,26 +435,6 @@ int HTROPServer::handleCodeGenReq(int sockfd, char *recvMessageBuffer, int messa
         std::cout.flush();
 #endif
 
-        llvm::SMDiagnostic Err;
-        auto moduleMemBufferPtr = llvm::MemoryBuffer::getMemBuffer(llvm::StringRef(llvmModuleMsg->getMessageBuffer(), llvmModuleMsg->getSize()));
-        auto moduleMemBuffer = moduleMemBufferPtr.get();
-
-        module_Ptr = llvm::parseIR(moduleMemBuffer->getMemBufferRef(), Err, llvm::getGlobalContext());
-        Mod = module_Ptr.get();
-        if (!Mod) {
-            Err.print("htropserver", llvm::errs());
-            return 0;
-        }
-
-#ifdef HTROP_DEBUG
-        std::cout << "\n" << sockfd << ": -- Verifying LLVM IR Module ....  ";
-        std::cout.flush();
-#endif
-        llvm::verifyModule(*Mod);
-
-        delete llvmModuleMsg;
-
-        free(function_ir_buffer);
 
 #if MEASURE
         std::cout << "\nMEASURE-TIME: -> Get LLVM IR from Client : " << (std::chrono::duration_cast < std::chrono::microseconds > (std::chrono::steady_clock::now() - startTime).count());
@@ -349,23 +448,31 @@ int HTROPServer::handleCodeGenReq(int sockfd, char *recvMessageBuffer, int messa
         std::cout.flush();
 #endif
 
-        codegenMessageFromServer = new HTROP_PB::Message_RSRC();
-        codeGen_OCL(Mod, &codeGenMsgFromClient, codegenMessageFromServer);
+        codegenMessageFromServer = codeGenEngine->generateCode(&codeGenMsgFromClient, scopFunctionParentName, llvmModuleMsg->getMessageBuffer(), llvmModuleMsg->getSize());
 
-        //Update the cache
-        addToCache(scopFunctionParentName, codegenMessageFromServer);
+        //Only requests the backend handled are recorded, a prewarm must not replay the crash of the last server
+        if (codegenMessageFromServer != NULL)
+            codeGenEngine->logRequest(scopFunctionParentName, &codeGenMsgFromClient, llvmModuleMsg->getMessageBuffer(), llvmModuleMsg->getSize());
+
+        delete llvmModuleMsg;
+
+        free(function_ir_buffer);
+
+        if (codegenMessageFromServer == NULL)
+            return sendCodeGenFailed(sockfd);
 
 #if MEASURE
         std::cout << "\nMEASURE-TIME: -> Code Generation : " << (std::chrono::duration_cast < std::chrono::microseconds > (std::chrono::steady_clock::now() - startTime).count());
 #endif
 
     }
-#ifdef HTROP_DEBUG
     else {
+        codeGenEngine->logRequest(scopFunctionParentName, &codeGenMsgFromClient, NULL, 0);
+#ifdef HTROP_DEBUG
         std::cout << "\n Cached Code found";
         std::cout.flush();
-    }
 #endif
+    }
 
 #if MEASURE
     std::cout << "\nMEASURE-TIME: Generate Accelereated Code : " << (std::chrono::duration_cast < std::chrono::microseconds > (std::chrono::steady_clock::now() - acc_startTime).count());
@@ -386,6 +493,7 @@ int HTROPServer::handleCodeGenReq(int sockfd, char *recvMessageBuffer, int messa
 #endif
 
     std::string codeGenMsg = codegenMessageFromServer->SerializeAsString();
+    codeGenEngine->releaseCode(codegenMessageFromServer);
 
 #ifdef HTROP_DEBUG
     std::cout << "\n" << sockfd << ": -- code ready message with function name and code size";
@@ -435,3 +543,73 @@ int HTROPServer::handleCodeGenReq(int sockfd, char *recvMessageBuffer, int messa
 #endif
     return 1;
 }
+
+// Scop analysis and code generation for a complete module
+//   The client continues its own analysis meanwhile and may use the returned analysis instead.
+int HTROPServer::handleScopAnalysisReq(int sockfd, char *recvMessageBuffer, int messageSize) {
+
+#ifdef HTROP_DEBUG
+    std::cout << "\n" << sockfd << ": Recieved scop analysis request ...";
+    std::cout.flush();
+#endif
+
+#if MEASURE
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+#endif
+
+    HTROP_PB::Message_RCRS_Analysis analysisMsgFromClient;
+    if (!analysisMsgFromClient.ParseFromArray(recvMessageBuffer, messageSize)) {
+        std::cerr << ": Failed to parse message" << std::endl;
+        return 0;
+    }
+
+    //PHASE I: Get the module
+    char *module_buffer = (char *)calloc(analysisMsgFromClient.modulesize(), sizeof(char));
+    Message *moduleMsg = new Message(module_buffer);
+    moduleMsg->recv(sockfd, 0);
+    if (moduleMsg->getType() != BINARY_STREAM) {
+        std::cerr << sockfd << ": Error: Failed to recieve the module";
+        delete moduleMsg;
+        free(module_buffer);
+        return 0;
+    }
+
+    //PHASE II: Analyse and generate code
+    HTROP_PB::ScopAnalysisResult analysisResult;
+    HTROP_PB::Message_RSRC * codegenMessageFromServer = codeGenEngine->analyseAndGenerate(&analysisMsgFromClient, moduleMsg->getMessageBuffer(), moduleMsg->getSize(), &analysisResult);
+    delete moduleMsg;
+    free(module_buffer);
+
+    char *binaryCodeBuffer = NULL;
+    uint32_t binaryCodeSize = 0;
+    if (codegenMessageFromServer != NULL) {
+        binaryCodeSize = fileToBuffer(codegenMessageFromServer->oclkernelfilename(), binaryCodeBuffer);
+        codegenMessageFromServer->set_binarysize(binaryCodeSize);
+        analysisResult.mutable_codegen()->CopyFrom(*codegenMessageFromServer);
+        codeGenEngine->releaseCode(codegenMessageFromServer);
+    }
+
+    //PHASE III: Transfer the analysis and the generated code to the client
+    std::string analysisResultMsg = analysisResult.SerializeAsString();
+    HTROP_PB::Message_RSRC_Analysis analysisMsgFromServer;
+    analysisMsgFromServer.set_resultsize(analysisResultMsg.size());
+    std::string analysisMsg = analysisMsgFromServer.SerializeAsString();
+
+    Message *analysisReadyMessage = new Message();
+    if (analysisReadyMessage->send(sockfd, RSP_SCOP_ANALYSIS, analysisMsg.c_str(), analysisMsg.size(), 0) < 0
+        || analysisReadyMessage->send(sockfd, BINARY_STREAM, analysisResultMsg.c_str(), analysisResultMsg.size(), 0) < 0
+        || (binaryCodeBuffer != NULL && analysisReadyMessage->send(sockfd, BINARY_STREAM, binaryCodeBuffer, binaryCodeSize, 0) < 0)) {
+        std::cerr << sockfd << ": Error: Failed to send the scop analysis to the HTROP Client";
+        delete analysisReadyMessage;
+        free(binaryCodeBuffer);
+        return 0;
+    }
+    delete analysisReadyMessage;
+    free(binaryCodeBuffer);
+
+#if MEASURE
+    std::cout << "\nMEASURE-TIME: Total Scop Analysis and Code Gen Time : " << (std::chrono::duration_cast < std::chrono::microseconds > (std::chrono::steady_clock::now() - time_start).count());
+#endif
+
+    return 1;
+}
@@ -30,9 +30,13 @@
 
 #include<netdb.h>
 #include<vector>
+#include<map>
+#include<ctime>
 #include<thread>
+#include<mutex>
 
 #include "../common/sharedStructCompileRuntime.h"
+#include "codegenengine.h"
 
 #define MAX_NO_OF_QUED_CONNECTIONS 15
 
@@ -44,26 +48,35 @@ class HTROPServer {
     int handleIncommingConnections();
     int createSocket();
     int handleCodeGenReq(int sockfd, char *recvMessageBuffer, int messageSize);
+    int sendCodeGenFailed(int sockfd);
+    int handleScopAnalysisReq(int sockfd, char *recvMessageBuffer, int messageSize);
+
+    //Prefork mode: worker processes share the listening port via SO_REUSEPORT
+    int numWorkers = 0;
+     std::map < pid_t, time_t > workerStartTimes;
+    int startWorker();
+    int serveWorker();
+    pid_t forkWorker();
+    void stopWorkers();
+    int superviseWorkers();
 
     static void *connection_handler(void *object, int client_sockfd);
 
     //Cache
 
     bool isCacheEnabled = true;
-    //Check if the Code for the function and resource is available
-     HTROP_PB::Message_RSRC * isCodeCached(std::string key);
-    //Functin Name is the key
-     std::map < std::string, HTROP_PB::Message_RSRC * >cacheList;
-    void addToCache(std::string key, HTROP_PB::Message_RSRC * codeGenMsgFromServer);
+     std::string cacheDir;
+     std::string prewarmLogPath;
+    int prewarmCount = 16;
 
-    char recvMessageBuffer[2000];
+    //Cache, request log and backend invocation, shared with the in-process mode of the client
+     CodeGenEngine * codeGenEngine;
 
-    //Generate OCL code
-    void codeGen_OCL(llvm::Module * &Mod, HTROP_PB::Message_RCRS * codeGenMsgFromClient, HTROP_PB::Message_RSRC * codeGenMsgFromServer);
+    char recvMessageBuffer[2000];
 
  public:
     int start();
-     HTROPServer(bool isCacheEnabled, int portNumber);
+     HTROPServer(bool isCacheEnabled, int portNumber, int numWorkers, bool isolateCodeGen, unsigned int codeGenTimeout, std::string cacheDir, std::string requestLogPath, std::string prewarmLogPath, int prewarmCount, CodeGenOptions codeGenOptions);
     ~HTROPServer();
 };
 
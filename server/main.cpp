@@ -29,11 +29,67 @@
 
 #include <signal.h>
 #include <iostream>
+#include <algorithm>
+#include <utility>
 
 using namespace std;
 
 llvm::cl::opt < bool > EnableCaching("enable-cache", llvm::cl::desc("Enable server caching"), llvm::cl::init(false));
 llvm::cl::opt < int >HTROPHostPort("htrop-port", llvm::cl::desc("HTROP Server port, defaults to '55066'"), llvm::cl::init(55066));
+llvm::cl::opt < int >NumWorkers("workers", llvm::cl::desc("Number of prefork worker processes sharing the port (0: single process)"), llvm::cl::init(0));
+llvm::cl::opt < bool > IsolateCodeGen("isolate-codegen", llvm::cl::desc("Run each code generation in a separate process"), llvm::cl::init(false));
+llvm::cl::opt < unsigned int >CodeGenTimeout("codegen-timeout", llvm::cl::desc("Seconds after which an isolated code generation process is killed (requires -isolate-codegen), defaults to 300"),
+                                            llvm::cl::init(300));
+llvm::cl::opt < std::string > RequestLog("request-log", llvm::cl::desc("Append all code gen requests (fingerprint, options and IR) to this file"), llvm::cl::init(""));
+llvm::cl::opt < std::string > PrewarmLog("prewarm", llvm::cl::desc("Replay the most frequent requests of a request log at startup (requires -enable-cache)"), llvm::cl::init(""));
+llvm::cl::opt < int >PrewarmCount("prewarm-count", llvm::cl::desc("Number of request log entries replayed by -prewarm"), llvm::cl::init(16));
+llvm::cl::opt < std::string > CacheDir("cache-dir", llvm::cl::desc("Directory of the persistent cache shared by all workers (requires -enable-cache)"), llvm::cl::init(""));
+llvm::cl::opt < std::string > OCLEmitter("ocl-emitter", llvm::cl::desc("OpenCL C generation: 'axtor', 'direct' or 'compare' (Axtor kernels, direct kernels written to <kernel file>.direct.cl), defaults to 'axtor'"), llvm::cl::init("axtor"));
+llvm::cl::list < unsigned int >RegisterBlock("register-block", llvm::cl::CommaSeparated,
+                                            llvm::cl::desc("Register blocking factors of gemm-like nests for MCPU,GPU,MIC, e.g. '2,4,2' (requires -ocl-emitter=direct), defaults to off"));
+llvm::cl::list < unsigned int >VectorWidth("vector-width", llvm::cl::CommaSeparated,
+                                          llvm::cl::desc("vloadN/vstoreN width of unit-stride accesses for MCPU,GPU,MIC, e.g. '16,4,16' (requires -ocl-emitter=direct), defaults to off"));
+llvm::cl::list < unsigned int >Coarsening("coarsening", llvm::cl::CommaSeparated,
+                                         llvm::cl::desc("Iterations of the outermost parallel loop per work-item for MCPU,GPU,MIC, e.g. '8,2,8' (requires -ocl-emitter=direct), defaults to off"));
+llvm::cl::opt < unsigned int >ReductionGroupSize("reduction-group-size",
+                                                llvm::cl::desc("Work-group size of parallel reductions found by the client, a power of two (requires -ocl-emitter=direct), defaults to 0 (off)"),
+                                                llvm::cl::init(0));
+llvm::cl::opt < bool > ReadOnlyMemory("read-only-memory",
+                                      llvm::cl::desc("Small IN arrays in __constant memory, float and char IN arrays as images on devices with image support (requires -ocl-emitter=direct), defaults to off"),
+                                      llvm::cl::init(false));
+llvm::cl::opt < bool > KernelVariants("kernel-variants",
+                                      llvm::cl::desc("Generate alternative kernels per scop (parallel depth, coarsening, tiling), the runtime times them and keeps the fastest per device"),
+                                      llvm::cl::init(false));
+llvm::cl::list < unsigned int >VariantCoarsening("variant-coarsening", llvm::cl::CommaSeparated,
+                                                llvm::cl::desc("Coarsening factors for MCPU,GPU,MIC of the kernel variants of scops without -coarsening (requires -kernel-variants and -ocl-emitter=direct), defaults to '8,2,8'"));
+llvm::cl::opt < unsigned int >VariantTileSize("variant-tile-size",
+                                             llvm::cl::desc("Tile edge of the kernel variants of scops without -local-tile-size, 0 for no tiled variant (requires -kernel-variants and -ocl-emitter=direct), defaults to 16"),
+                                             llvm::cl::init(16));
+llvm::cl::opt < unsigned int >SmallSizeThreshold("small-size-threshold",
+                                                llvm::cl::desc("Add a kernel version without coarsening, vectors, register blocks and tiles for calls with fewer work-items (requires -ocl-emitter=direct), defaults to 0 (off)"),
+                                                llvm::cl::init(0));
+llvm::cl::opt < bool > SpecializeArgs("specialize-args",
+                                      llvm::cl::desc("Let the runtime build programs with the values of repeated integer arguments as constants (requires -ocl-emitter=direct), defaults to off"),
+                                      llvm::cl::init(false));
+llvm::cl::opt < bool > Index32Versions("index32-versions",
+                                       llvm::cl::desc("Add a kernel version with 32-bit index arithmetic for calls whose array sizes and long arguments fit (requires -ocl-emitter=direct), defaults to off"),
+                                       llvm::cl::init(false));
+llvm::cl::opt < bool > Wavefront("wavefront",
+                                 llvm::cl::desc("Run 2D nests with dependences in both loops (in-place stencils) as a sequence of parallel wavefronts, defaults to off"),
+                                 llvm::cl::init(false));
+llvm::cl::opt < bool > LoopDistribution("loop-distribution",
+                                        llvm::cl::desc("Split imperfect nests with sibling loops into a sequence of kernels, one per loop chain, defaults to off"),
+                                        llvm::cl::init(false));
+llvm::cl::opt < bool > IndexSetSplitting("index-set-splitting",
+                                         llvm::cl::desc("Run the work-items away from the border tests of a kernel (e.g. x > 0 && x < n - 1) in an interior kernel without them, defaults to off"),
+                                         llvm::cl::init(false));
+llvm::cl::opt < unsigned int >ScatterLocalBins("scatter-local-bins",
+                                               llvm::cl::desc("Update the scatter arrays (histograms, always atomic, found in scops of -polly-allow-nonaffine) of up to this many elements in a local-memory copy per work-group, defaults to 0 (global atomics)"),
+                                               llvm::cl::init(0));
+llvm::cl::opt < bool > PitchedBuffers("pitched-buffers",
+                                      llvm::cl::desc("Pad the rows of 2D arrays on the device to the base address alignment of the device (requires -ocl-emitter=direct), defaults to off"),
+                                      llvm::cl::init(false));
+llvm::cl::opt < unsigned int >LocalTileSize("local-tile-size", llvm::cl::desc("Load the neighbourhood of 2D stencils through local-memory tiles of this work-group edge (requires -ocl-emitter=direct), defaults to 0 (off)"), llvm::cl::init(0));
 
 void handleSignal(int) {
     exit(0);
@@ -63,8 +119,126 @@ int main(int argc, char *argv[]) {
 
     std::cout << "\nSERVER INFO: Cache Enabled = " << EnableCaching;
     std::cout << "\nSERVER INFO: Listening on port : " << HTROPHostPort;
-
-    HTROPServer *server = new HTROPServer(EnableCaching, HTROPHostPort);
+    std::cout << "\nSERVER INFO: Worker processes : " << NumWorkers;
+    std::cout << "\nSERVER INFO: Isolated code generation = " << IsolateCodeGen;
+    if (CodeGenTimeout == 0) {
+        std::cerr << "-codegen-timeout expects a number of seconds greater than zero";
+        return -1;
+    }
+    if (IsolateCodeGen) {
+        std::cout << "\nSERVER INFO: Code generation timeout : " << CodeGenTimeout << " s";
+    }
+    if (!CacheDir.empty()) {
+        std::cout << "\nSERVER INFO: Persistent cache : " << CacheDir;
+    }
+    if (!RequestLog.empty()) {
+        std::cout << "\nSERVER INFO: Request log : " << RequestLog;
+    }
+    if (!PrewarmLog.empty()) {
+        std::cout << "\nSERVER INFO: Prewarm from : " << PrewarmLog << " (" << PrewarmCount << " entries)";
+    }
+
+    if (OCLEmitter != "axtor" && OCLEmitter != "direct" && OCLEmitter != "compare") {
+        std::cerr << "Unknown -ocl-emitter " << OCLEmitter;
+        return -1;
+    }
+    std::cout << "\nSERVER INFO: OpenCL emitter : " << OCLEmitter;
+
+    //The Axtor kernels would silently ignore the options of the direct emitter
+    const std::pair < bool, const char * >directOptions[] = {
+        { LocalTileSize > 0, "-local-tile-size" }, { !RegisterBlock.empty(), "-register-block" }, { !VectorWidth.empty(), "-vector-width" },
+        { !Coarsening.empty(), "-coarsening" }, { ReductionGroupSize > 0, "-reduction-group-size" }, { ReadOnlyMemory, "-read-only-memory" },
+        { !VariantCoarsening.empty(), "-variant-coarsening" }, { VariantTileSize.getNumOccurrences() > 0, "-variant-tile-size" },
+        { SmallSizeThreshold > 0, "-small-size-threshold" }, { SpecializeArgs, "-specialize-args" }, { Index32Versions, "-index32-versions" },
+        { PitchedBuffers, "-pitched-buffers" }
+    };
+    for (auto & option:directOptions) {
+        if (option.first && OCLEmitter == "axtor") {
+            std::cerr << option.second << " requires -ocl-emitter=direct";
+            return -1;
+        }
+    }
+    if (LocalTileSize > 0) {
+        std::cout << "\nSERVER INFO: Local stencil tiles : " << LocalTileSize << "x" << LocalTileSize;
+    }
+
+    if (!RegisterBlock.empty()) {
+        if (RegisterBlock.size() != 3 || std::find(RegisterBlock.begin(), RegisterBlock.end(), 0) != RegisterBlock.end()) {
+            std::cerr << "-register-block expects three factors (MCPU,GPU,MIC) greater than zero";
+            return -1;
+        }
+        std::cout << "\nSERVER INFO: Register blocking : MCPU " << RegisterBlock[0] << ", GPU " << RegisterBlock[1] << ", MIC " << RegisterBlock[2];
+    }
+
+    if (!VectorWidth.empty()) {
+        for (unsigned int width:VectorWidth) {
+            if (VectorWidth.size() != 3 || (width != 1 && width != 2 && width != 4 && width != 8 && width != 16)) {
+                std::cerr << "-vector-width expects three widths (MCPU,GPU,MIC) of 1, 2, 4, 8 or 16";
+                return -1;
+            }
+        }
+        std::cout << "\nSERVER INFO: Vector width : MCPU " << VectorWidth[0] << ", GPU " << VectorWidth[1] << ", MIC " << VectorWidth[2];
+    }
+
+    if (!Coarsening.empty()) {
+        if (Coarsening.size() != 3 || std::find(Coarsening.begin(), Coarsening.end(), 0) != Coarsening.end()) {
+            std::cerr << "-coarsening expects three factors (MCPU,GPU,MIC) greater than zero";
+            return -1;
+        }
+        std::cout << "\nSERVER INFO: Thread coarsening : MCPU " << Coarsening[0] << ", GPU " << Coarsening[1] << ", MIC " << Coarsening[2];
+    }
+
+    if (ReductionGroupSize > 0) {
+        if ((ReductionGroupSize & (ReductionGroupSize - 1)) != 0) {
+            std::cerr << "-reduction-group-size expects a power of two";
+            return -1;
+        }
+        std::cout << "\nSERVER INFO: Reduction work-group size : " << ReductionGroupSize;
+    }
+
+    if (ReadOnlyMemory) {
+        std::cout << "\nSERVER INFO: Read-only arrays in constant and image memory";
+    }
+
+    if (KernelVariants) {
+        std::cout << "\nSERVER INFO: Kernel variants for runtime autotuning";
+    }
+
+    if (!VariantCoarsening.empty() && (VariantCoarsening.size() != 3 || std::find(VariantCoarsening.begin(), VariantCoarsening.end(), 0) != VariantCoarsening.end())) {
+        std::cerr << "-variant-coarsening expects three factors (MCPU,GPU,MIC) greater than zero";
+        return -1;
+    }
+
+    if (SpecializeArgs) {
+        std::cout << "\nSERVER INFO: Value specialization of integer arguments";
+    }
+
+    if (SmallSizeThreshold > 0) {
+        std::cout << "\nSERVER INFO: Small size kernel versions below " << SmallSizeThreshold << " work-items";
+    }
+
+    CodeGenOptions codeGenOptions;
+    codeGenOptions.oclEmitter = OCLEmitter;
+    codeGenOptions.localTileSize = LocalTileSize;
+    codeGenOptions.registerBlock.assign(RegisterBlock.begin(), RegisterBlock.end());
+    codeGenOptions.vectorWidth.assign(VectorWidth.begin(), VectorWidth.end());
+    codeGenOptions.coarsening.assign(Coarsening.begin(), Coarsening.end());
+    codeGenOptions.reductionGroupSize = ReductionGroupSize;
+    codeGenOptions.readOnlyMemory = ReadOnlyMemory;
+    codeGenOptions.kernelVariants = KernelVariants;
+    if (!VariantCoarsening.empty())
+        codeGenOptions.variantCoarsening.assign(VariantCoarsening.begin(), VariantCoarsening.end());
+    codeGenOptions.variantTileSize = VariantTileSize;
+    codeGenOptions.smallSizeThreshold = SmallSizeThreshold;
+    codeGenOptions.specializeArgs = SpecializeArgs;
+    codeGenOptions.pitchedBuffers = PitchedBuffers;
+    codeGenOptions.index32Versions = Index32Versions;
+    codeGenOptions.wavefront = Wavefront;
+    codeGenOptions.loopDistribution = LoopDistribution;
+    codeGenOptions.indexSetSplitting = IndexSetSplitting;
+    codeGenOptions.scatterLocalBins = ScatterLocalBins;
+
+    HTROPServer *server = new HTROPServer(EnableCaching, HTROPHostPort, NumWorkers, IsolateCodeGen, CodeGenTimeout, CacheDir, RequestLog, PrewarmLog, PrewarmCount, codeGenOptions);
 
     server->start();
 
@@ -37,15 +37,19 @@
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Transforms/Utils/Cloning.h"
+#include "llvm/Transforms/Utils/SSAUpdater.h"
+#include "llvm/Transforms/Utils/Local.h"
 #include "llvm/Analysis/ScalarEvolution.h"
 
 #include "llvm/Analysis/LoopInfo.h"
 #include "llvm/IR/Dominators.h"
+#include "llvm/Analysis/CFG.h"
 
 #include "llvm/Transforms/Scalar.h"
 #include "llvm/IR/Verifier.h"
 #include "llvm/IR/Type.h"
 #include "llvm/IR/DerivedTypes.h"
+#include "llvm/IR/IntrinsicInst.h"
 
 #if LLVM_VERSION == 3 && LLVM_MINOR_VERSION < 5
 #include "llvm/Support/InstIterator.h"
@@ -54,17 +58,42 @@
 #endif
 
 #include "cl_replace.h"
+#include "openCLCemitter.h"
 #include <assert.h>
 #include <boost/concept_check.hpp>
 
 #include "../../common/stringHelper.h"
+#include "../common/indexAnalysis.h"
 
-#if MEASURE
 #include <chrono>
-#endif
+#include <set>
+#include <map>
+#include <algorithm>
+#include <cstdlib>
 
 using namespace llvm;
 
+//Number of outer loops that all loop chains share
+static unsigned int getSharedLoops(const std::vector < std::vector < llvm::Loop * > >&chains) {
+    unsigned int sharedLoops = 0;
+    while (sharedLoops < chains[0].size()) {
+        for (auto & chain:chains) {
+            if (sharedLoops >= chain.size() || chain[sharedLoops] != chains[0][sharedLoops])
+                return sharedLoops;
+        }
+        sharedLoops++;
+    }
+    return sharedLoops;
+}
+
+//Kernel argument at position argPos
+static llvm::Argument * getArgByPos(llvm::Function * kernel, unsigned int argPos) {
+    llvm::Function::arg_iterator arg_I = kernel->arg_begin();
+    for (unsigned int pos = 0; pos < argPos; pos++)
+        arg_I++;
+    return &*arg_I;
+}
+
 //Adds the OpenCL function definition to the module
 void OpenCLCBackend::addOCLFunctions(llvm::Module * &oclModArg) {
 
@@ -104,8 +133,9 @@ void OpenCLCBackend::addOCLFunctions(llvm::Module * &oclModArg) {
     func_get_global_id->setAttributes(func_get_global_id_PAL);
 }
 
-OpenCLCBackend::OpenCLCBackend(llvm::Module * &oclModArg, HTROP_PB::Message_RCRS * codeGenMsgFromClient, HTROP_PB::Message_RSRC * codeGenMsgFromServer, std::string oclFileOnDisk) {
+OpenCLCBackend::OpenCLCBackend(llvm::Module * &oclModArg, HTROP_PB::Message_RCRS * codeGenMsgFromClient, HTROP_PB::Message_RSRC * codeGenMsgFromServer, std::string oclFileOnDisk, CodeGenOptions codeGenOptions) {
     originalOclMod = oclModArg;
+    OpenCLCBackend::codeGenOptions = codeGenOptions;
     OpenCLCBackend::codeGenMsgFromClient = codeGenMsgFromClient;
     OpenCLCBackend::codeGenMsgFromServer = codeGenMsgFromServer;
     OpenCLCBackend::oclFileOnDisk = oclFileOnDisk;
@@ -122,11 +152,20 @@ void OpenCLCBackend::generateOpenCLCode() {
     logOut = new llvm::raw_fd_ostream(logFile.c_str(), EC, llvm::sys::fs::F_None);
     axtor::Log::init(*logOut);
 
+    //A/B comparison, the kernels of the direct emitter are written next to the Axtor kernels
+    std::ofstream directOutStream;
+    if (codeGenOptions.oclEmitter == "compare") {
+        directOutStream.open((oclFileOnDisk + ".direct.cl").c_str(), std::ios::out);
+    }
+
 #ifdef HTROP_DEBUG
     std::cout << "\n OCL File : " << oclFileOnDisk;
     std::cout.flush();
 #endif
 
+    //Scatter updates need the atomics of the direct emitter
+    std::string oclEmitter = codeGenOptions.oclEmitter;
+
     //Process each kernel independently
     for (int scopFunctionIter = 0; scopFunctionIter < codeGenMsgFromClient->scoplist_size(); scopFunctionIter++) {
 
@@ -136,200 +175,1911 @@ void OpenCLCBackend::generateOpenCLCode() {
         std::cout.flush();
 #endif
 
-        //We do this for every kernel because Axtor changes the Source
-        //clone the original module
-        oclModPtr = llvm::CloneModule(originalOclMod);
-        if (!oclModPtr) {
-            std::cout << "\nError: Cannot clone OpenCL module";
-            exit(1);
-        }
-        oclMod = oclModPtr.get();
-        if (!oclMod) {
-            std::cout << "\nError: Cannot clone OpenCL module";
-            exit(1);
-        }
-        addOCLFunctions(oclMod);
-
         HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo = codeGenMsgFromServer->add_scopfunctions();
         auto clientKernelInfo = codeGenMsgFromClient->scoplist(scopFunctionIter);
+        codeGenOptions.oclEmitter = clientKernelInfo.has_scatter()? "direct" : oclEmitter;
 
         //Save scopFunctionInfo for simplicity
         std::string kernelName = clientKernelInfo.scopfunctionname();
         scopFunctionInfo->set_scopfunctionname(kernelName);
         scopFunctionInfo->set_scopoclkernelname(kernelName);
 
-        unsigned int max_codegen_loop_depth = clientKernelInfo.max_codegen_loop_depth();
+        //A fused scop of the client calls a producer and a consumer scop, they become one kernel on a shared NDRange.
+        //The client keeps the separate kernels of the scops without a fused kernel in the response.
+        if (clientKernelInfo.fused_functions_size() == 2) {
+            cloneOriginalModule();
+            llvm::Function * kernelFunction = oclMod->getFunction(kernelName);
+            std::vector < std::pair < int, int > >workgroupArgs;
+            std::vector < int >workgroupLoops;
+            if (!fuseKernels(kernelFunction, clientKernelInfo, workgroupArgs, workgroupLoops)) {
+                std::cout << "\nSERVER INFO: Cannot fuse " << clientKernelInfo.fused_functions(0) << " and " << clientKernelInfo.fused_functions(1) << ", keeping separate kernels";
+                std::cout.flush();
+                codeGenMsgFromServer->mutable_scopfunctions()->RemoveLast();
+                continue;
+            }
+
+            for (unsigned int dim = 0; dim < workgroupArgs.size(); dim++) {
+                scopFunctionInfo->add_workgroup_arg_index(workgroupArgs[dim].first);
+                scopFunctionInfo->add_workgroup_arg_index_offset(workgroupArgs[dim].second);
+                scopFunctionInfo->add_workgroup_loop_index(workgroupLoops[dim]);
+            }
 
-        //get the kernel
-        llvm::Function * kernelFunction = oclMod->getFunction(kernelName);
+            LocalTiling tiling;
+            Reduction reduction;
+            ReadOnlyArgs readOnlyArgs;
+            std::set < unsigned int >pitchedArgs;
+            HTROP_PB::Message_RSRC::WorkItemFactor workItemFactor;
+            outStream << "\n\n" << generateKernelCode(kernelFunction, kernelName, directOutStream, tiling, reduction, readOnlyArgs, pitchedArgs, &workItemFactor, NO_WORK_ITEM_FACTOR,
+                                                      0);
+            continue;
+        }
 
-        //Get the loop analysis
-        llvm::DominatorTree * DT = new llvm::DominatorTree();
-        DT->recalculate(*kernelFunction);
+        //Dependences in both loops of a 2D nest, the runtime launches one wave after the other
+        if (codeGenOptions.wavefront && clientKernelInfo.wavefront_skew() > 0 && !clientKernelInfo.has_scatter()) {
+            std::string kernelCode = generateWavefrontKernel(clientKernelInfo, kernelName, scopFunctionInfo, directOutStream);
+            if (!kernelCode.empty()) {
+                outStream << "\n\n" << kernelCode;
+                continue;
+            }
+            std::cout << "\nSERVER INFO: Cannot map the wavefronts of " << kernelName << ", keeping the parallel kernel";
+            std::cout.flush();
+        }
 
-        //generate the LoopInfoBase for the current function
-        llvm::LoopInfoBase < llvm::BasicBlock, llvm::Loop > *KLoop = new llvm::LoopInfoBase < llvm::BasicBlock, llvm::Loop > ();
-        KLoop->releaseMemory();
-        KLoop->analyze(*DT);
+        //Sibling loops of an imperfect nest, each loop chain becomes a kernel if its outermost loop can be mapped
+        if (codeGenOptions.loopDistribution) {
+            llvm::Function * scopFunction = originalOclMod->getFunction(clientKernelInfo.scopfunctionname());
+            llvm::DominatorTree DT;
+            DT.recalculate(*scopFunction);
+            llvm::LoopInfoBase < llvm::BasicBlock, llvm::Loop > KLoop;
+            KLoop.analyze(DT);
+
+            std::vector < std::vector < llvm::Loop * > >chains;
+            bool isDistributed = getLoopChains(scopFunction, DT, KLoop, clientKernelInfo.max_codegen_loop_depth(), chains) && chains.size() > 1;
+            unsigned int numLoopTripCounts = isDistributed ? std::min(clientKernelInfo.num_loop_trip_counts(), getSharedLoops(chains)) : 0;
+            for (unsigned int chain = 0; chain < chains.size() && isDistributed; chain++) {
+                LoopMapping mapping;
+                isDistributed = getLoopMapping(chains[chain][0], numLoopTripCounts > 0, mapping);
+            }
 
-        LoopInfo::iterator l = KLoop->begin();
-        assert(l != KLoop->end());
+            if (isDistributed) {
+                std::string kernelsCode = generateDistributedKernels(clientKernelInfo, kernelName, chains.size(), scopFunctionInfo, directOutStream);
+                if (kernelsCode.empty())
+                    codeGenMsgFromServer->mutable_scopfunctions()->RemoveLast();
+                outStream << kernelsCode;
+                continue;
+            }
+        }
 
-        llvm::Loop * outerLoop = *l;
-        // The loops are stored in this list.
-        std::vector < Loop * >loopList;
-        loopList.push_back(outerLoop);
+        //Border tests of the work-item position, most work-items run an interior kernel without them
+        if (codeGenOptions.indexSetSplitting) {
+            std::string kernelsCode = generateSplitKernels(clientKernelInfo, kernelName, scopFunctionInfo, directOutStream);
+            if (!kernelsCode.empty()) {
+                outStream << kernelsCode;
+                continue;
+            }
+        }
+
+        //The client keeps the host code of a scop without a kernel
+        std::string kernelCode = generateScopKernel(clientKernelInfo, kernelName, clientKernelInfo.max_codegen_loop_depth(), scopFunctionInfo, directOutStream);
+        if (kernelCode.empty()) {
+            codeGenMsgFromServer->mutable_scopfunctions()->RemoveLast();
+            continue;
+        }
+        outStream << "\n\n" << kernelCode;
 
-        // Create the loop list
-        auto subLoops = outerLoop->getSubLoops();
+        //Alternative kernels for the autotuning of the runtime, a reduction keeps its kernel
+        if (codeGenOptions.kernelVariants && !scopFunctionInfo->has_reduction()) {
+            outStream << generateKernelVariants(clientKernelInfo, kernelCode, scopFunctionInfo, directOutStream);
+        }
 
-        while (subLoops.size() > 0 && loopList.size() < max_codegen_loop_depth) {
-            loopList.push_back(subLoops[0]);
-            subLoops = subLoops[0]->getSubLoops();
+        if (codeGenOptions.smallSizeThreshold > 0 && codeGenOptions.oclEmitter != "axtor" && !scopFunctionInfo->has_reduction()) {
+            outStream << generateSizeVersions(clientKernelInfo, kernelCode, scopFunctionInfo, directOutStream);
         }
 
-        //Get the last block / exit block
-        llvm::BasicBlock * last_block = NULL;
-        for (Function::iterator i = outerLoop->getHeader()->getParent()->begin(), e = outerLoop->getHeader()->getParent()->end(); i != e; ++i) {
-            last_block = (&*i);
+        if (codeGenOptions.index32Versions && codeGenOptions.oclEmitter != "axtor" && !scopFunctionInfo->has_reduction()) {
+            outStream << generateIndex32Version(clientKernelInfo, kernelCode, scopFunctionInfo, directOutStream);
         }
+    }
+
+    codeGenOptions.oclEmitter = oclEmitter;
+
+    //Save the code to file 
+    outStream.close();
+    if (directOutStream.is_open())
+        directOutStream.close();
+
+    delete logOut;
+}
+
+//We do this for every kernel because Axtor changes the Source
+void OpenCLCBackend::cloneOriginalModule() {
+    //clone the original module
+    oclModPtr = llvm::CloneModule(originalOclMod);
+    if (!oclModPtr) {
+        std::cout << "\nError: Cannot clone OpenCL module";
+        exit(1);
+    }
+    oclMod = oclModPtr.get();
+    if (!oclMod) {
+        std::cout << "\nError: Cannot clone OpenCL module";
+        exit(1);
+    }
+    addOCLFunctions(oclMod);
+}
+
+//Map the loops of the scop up to maxDepth to get_global_id and emit the kernel kernelName with the current code generation options.
+//scopFunctionInfo gets the work sizes and the features of the emitted kernel.
+std::string OpenCLCBackend::generateScopKernel(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelName, unsigned int max_codegen_loop_depth,
+                                               HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream) {
+    cloneOriginalModule();
 
-        assert(last_block != NULL);
+    //get the kernel
+    llvm::Function * kernelFunction = oclMod->getFunction(clientKernelInfo.scopfunctionname());
+    kernelFunction->setName(kernelName);
 
-        //Go over each of the two loops.
-        for (unsigned int loopIte = 0; loopIte < loopList.size() && loopIte < max_codegen_loop_depth; loopIte++) {
+    //One loop chain of a distributed nest, the trip counts of the client only hold for the loops of all chains
+    unsigned int numLoopTripCounts = clientKernelInfo.num_loop_trip_counts();
+    if (distributedChain >= 0) {
+        numLoopTripCounts = std::min(numLoopTripCounts, keepLoopChain(kernelFunction, max_codegen_loop_depth, distributedChain));
+    }
 
-            llvm::Loop * loop = loopList[loopIte];
-            llvm::PHINode * phi = dyn_cast < llvm::PHINode > (loop->getHeader()->begin());
+    //Get the loop analysis
+    llvm::DominatorTree DT;
+    DT.recalculate(*kernelFunction);
 
-            int numIncommigVals = phi->getNumIncomingValues();
+    //generate the LoopInfoBase for the current function
+    llvm::LoopInfoBase < llvm::BasicBlock, llvm::Loop > KLoop;
+    KLoop.analyze(DT);
 
-            assert(numIncommigVals == 2);
+    //Get the last block / exit block
+    llvm::BasicBlock * last_block = &kernelFunction->back();
 
-            //find the coresponding compare instructions
-            llvm::Instruction * inst = dyn_cast < llvm::Instruction > (phi->getIncomingBlock(numIncommigVals - 1)->begin());
+    // The loops are stored in this list.
+    std::vector < Loop * >loopList;
+    std::vector < std::pair < int, int > >loopBounds;
+    if (!getParallelLoops(&KLoop, max_codegen_loop_depth, numLoopTripCounts, loopList, loopBounds)) {
+        std::cout << "\nSERVER INFO: Cannot map the outermost loop of " << kernelName << " to get_global_id";
+        std::cout.flush();
+        return "";
+    }
 
-            while (!isa < ICmpInst > (inst))
-                inst = inst->getNextNode();
+    //Map the loops to the NDRange dimensions before the induction variables are replaced
+    std::vector < unsigned int >loopDimension = getLoopDimensions(kernelFunction, loopList);
+    std::vector < std::vector < std::pair < int, int > > >workgroupArgs(loopList.size());
+    std::vector < int >workgroupLoops(loopList.size());
+    for (unsigned int loopIte = 0; loopIte < loopList.size(); loopIte++) {
+        workgroupArgs[loopDimension[loopIte]].push_back(loopBounds[loopIte]);
+        workgroupLoops[loopDimension[loopIte]] = loopIte;
+    }
 
-            llvm::ICmpInst * cmpInst = dyn_cast < ICmpInst > (inst);
+    //Parallel reduction found by the client, the direct emitter combines it per work-group
+    Reduction reduction;
+    if (clientKernelInfo.has_reduction() && codeGenOptions.reductionGroupSize > 0 && codeGenOptions.oclEmitter != "axtor") {
+        getReduction(kernelFunction, loopList, loopDimension, clientKernelInfo.reduction(), reduction);
+    }
 
-            while (!isa < BranchInst > (inst))
-                inst = inst->getNextNode();
+    //Scatter updates found by the client are atomic, small arrays get a copy per work-group without a reduction
+    if (clientKernelInfo.has_scatter()) {
+        scatter.array = getArgByPos(kernelFunction, clientKernelInfo.scatter().arg_position());
+        scatter.scatterOperator = (ReductionOperator) clientKernelInfo.scatter().scatter_operator();
+        uint64_t numElements = clientKernelInfo.scatter().num_elements();
+        if (numElements > 0 && numElements <= codeGenOptions.scatterLocalBins && !reduction.isEnabled())
+            scatter.localSize = numElements;
+    }
 
-            llvm::BranchInst * branchInst = dyn_cast < BranchInst > (inst);
+    //Local-memory tiling of 2D stencils, the direct emitter generates the tile loads
+    LocalTiling tiling;
+    if (!reduction.isEnabled() && !scatter.isEnabled() && codeGenOptions.localTileSize > 0 && codeGenOptions.oclEmitter != "axtor") {
+        getLocalTiling(kernelFunction, loopList, loopDimension, &DT, tiling);
+    }
+
+    //Several iterations per work-item, one kernel variant per device class. Register blocking of gemm-like nests,
+    //otherwise vector loads and stores for the unit-stride accesses of dimension 0, otherwise plain coarsening.
+    WorkItemFactorKind workItemFactorKind = NO_WORK_ITEM_FACTOR;
+    unsigned int factorDimension = 0;
+    if (!tiling.isEnabled() && !reduction.isEnabled() && !scatter.isEnabled() && codeGenOptions.oclEmitter != "axtor") {
+        if (codeGenOptions.registerBlock.size() == 3 && isRegisterBlockCandidate(kernelFunction, loopList, loopDimension)) {
+            workItemFactorKind = REGISTER_BLOCK;
+            factorDimension = 1;
+        }
+        else if (codeGenOptions.vectorWidth.size() == 3 && isVectorCandidate(kernelFunction, loopList, loopDimension)) {
+            workItemFactorKind = VECTOR_WIDTH;
+        }
+        else if (codeGenOptions.coarsening.size() == 3) {
+            //The highest NDRange dimension, dimension 0 keeps the contiguous accesses of neighbouring work-items
+            workItemFactorKind = COARSENING;
+            factorDimension = loopList.size() - 1;
+        }
+    }
+
+    //Read-only arrays of the client in constant or image memory, the vectorized accesses need plain pointers
+    ReadOnlyArgs readOnlyArgs;
+    if (codeGenOptions.readOnlyMemory && codeGenOptions.oclEmitter != "axtor") {
+        getReadOnlyArgs(kernelFunction, clientKernelInfo, tiling, readOnlyArgs);
+        if (workItemFactorKind == VECTOR_WIDTH)
+            readOnlyArgs.imageArgs.clear();
+    }
+
+    //The global work size follows the dimensions, an argument index of -1 takes the trip count of the loop
+    for (unsigned int dim = 0; dim < workgroupArgs.size(); dim++) {
+        for (auto workgroupArg:workgroupArgs[dim]) {
+            scopFunctionInfo->add_workgroup_arg_index(workgroupArg.first);
+            scopFunctionInfo->add_workgroup_arg_index_offset(workgroupArg.second);
+            scopFunctionInfo->add_workgroup_loop_index(workgroupLoops[dim]);
+        }
+    }
+
+    if (tiling.isEnabled()) {
+        for (int dim = 0; dim < 2; dim++) {
+            tiling.boundArg[dim] = workgroupArgs[dim][0].first;
+            tiling.start[dim] = workgroupArgs[dim][0].second;
+            if (tiling.start[dim] < 0 || tiling.boundArg[dim] < 0)
+                tiling.tiles.clear();
+        }
+    }
+
+    if (reduction.isEnabled()) {
+        reduction.boundArg = workgroupArgs[reduction.dimension][0].first;
+    }
+
+    //2D arrays with padded rows, the runtime allocates and transfers them with the pitch of the device
+    std::set < unsigned int >pitchedArgs;
+    if (codeGenOptions.pitchedBuffers && codeGenOptions.oclEmitter != "axtor") {
+        getPitchedArgs(kernelFunction, tiling, reduction, readOnlyArgs, pitchedArgs);
+    }
+
+    //The copies of a register block or vector start at get_global_id(dimension) * factor, a guard for a lower bound is not supported.
+    //Coarsening does not need the bound argument, the loop mapping already skips the iterations beyond the trip count.
+    HTROP_PB::Message_RSRC::WorkItemFactor workItemFactor;
+    if (workItemFactorKind != NO_WORK_ITEM_FACTOR
+        && (workItemFactorKind == COARSENING || (workgroupArgs[factorDimension][0].first >= 0 && workgroupArgs[factorDimension][0].second == 0))) {
+        std::vector < unsigned int >&factors = workItemFactorKind == REGISTER_BLOCK ? codeGenOptions.registerBlock :
+            workItemFactorKind == VECTOR_WIDTH ? codeGenOptions.vectorWidth : codeGenOptions.coarsening;
+        workItemFactor.set_dimension(factorDimension);
+        workItemFactor.set_factor_mcpu(factors[0]);
+        workItemFactor.set_factor_gpu(factors[1]);
+        workItemFactor.set_factor_mic(factors[2]);
+    }
+
+    if (!mapLoops(loopList, loopDimension, numLoopTripCounts, last_block)) {
+        std::cout << "\nSERVER INFO: Cannot map the loops of " << kernelName << " to get_global_id";
+        std::cout.flush();
+        scatter = Scatter();
+        return "";
+    }
+
+    //The interior kernel of an index-set split, the work-items between the borders are known
+    if (splitInterior) {
+        std::vector < int >boundArgs;
+        for (unsigned int dim = 0; dim < workgroupArgs.size(); dim++)
+            boundArgs.push_back(workgroupArgs[dim].size() == 1 ? workgroupArgs[dim][0].first : -1);
+        std::vector < unsigned int >borderLow, borderHigh;
+        if (!foldBorderConditions(kernelFunction, boundArgs, borderLow, borderHigh)) {
+            scatter = Scatter();
+            return "";
+        }
+        for (unsigned int dim = 0; dim < boundArgs.size(); dim++) {
+            scopFunctionInfo->add_border_low(borderLow[dim]);
+            scopFunctionInfo->add_border_high(borderHigh[dim]);
+        }
+    }
+
+    std::string kernelCode = generateKernelCode(kernelFunction, kernelName, directOutStream, tiling, reduction, readOnlyArgs, pitchedArgs, &workItemFactor, workItemFactorKind,
+                                                workItemFactor.has_dimension()? workgroupArgs[factorDimension][0].first : 0);
+    scatter = Scatter();
+    if (kernelCode.empty())
+        return "";
+
+    //The runtime creates the images on devices with image support, the kernel variant for them reads image2d_t
+    for (auto imageArg:readOnlyArgs.imageArgs) {
+        llvm::Type * elementType = getArgByPos(kernelFunction, imageArg.first)->getType()->getPointerElementType();
+        while (elementType->isArrayTy())
+            elementType = elementType->getArrayElementType();
+
+        HTROP_PB::Message_RSRC::ImageArg * imageArgInfo = scopFunctionInfo->add_image_args();
+        imageArgInfo->set_arg_position(imageArg.first);
+        imageArgInfo->set_row_width_arg(imageArg.second);
+        imageArgInfo->set_is_float(elementType->isFloatTy());
+    }
+
+    for (auto pitchedArg:pitchedArgs) {
+        llvm::Type * rowType = getArgByPos(kernelFunction, pitchedArg)->getType()->getPointerElementType();
+
+        HTROP_PB::Message_RSRC::PitchedArg * pitchedArgInfo = scopFunctionInfo->add_pitched_args();
+        pitchedArgInfo->set_arg_position(pitchedArg);
+        pitchedArgInfo->set_row_width(rowType->getArrayNumElements());
+        pitchedArgInfo->set_data_type_size(oclMod->getDataLayout().getTypeAllocSize(rowType->getArrayElementType()));
+    }
+
+    if (workItemFactor.has_dimension()) {
+        if (workItemFactorKind == REGISTER_BLOCK)
+            scopFunctionInfo->add_register_block()->CopyFrom(workItemFactor);
+        else if (workItemFactorKind == VECTOR_WIDTH)
+            scopFunctionInfo->add_vector_width()->CopyFrom(workItemFactor);
+        else
+            scopFunctionInfo->add_coarsening()->CopyFrom(workItemFactor);
+    }
+
+    //The tiled kernel requires its work-group size, the runtime rounds the global size up to it
+    if (tiling.isEnabled()) {
+        scopFunctionInfo->add_local_work_size(tiling.tileSize);
+        scopFunctionInfo->add_local_work_size(tiling.tileSize);
+    }
+
+    //The partial results of the work-groups follow the kernel arguments, the runtime combines them into the accumulator
+    if (reduction.isEnabled()) {
+        llvm::Type * elementType = reduction.accumulator->getType()->getPointerElementType();
+        while (elementType->isArrayTy())
+            elementType = elementType->getArrayElementType();
+
+        HTROP_PB::Message_RSRC::Reduction * reductionInfo = scopFunctionInfo->mutable_reduction();
+        reductionInfo->set_arg_position(reduction.accumulator->getArgNo());
+        reductionInfo->set_reduction_operator(reduction.reductionOperator);
+        reductionInfo->set_is_float(elementType->isFloatingPointTy());
+        reductionInfo->set_data_type_size(oclMod->getDataLayout().getTypeAllocSize(elementType));
+        reductionInfo->set_partial_arg_position(kernelFunction->arg_size());
+
+        for (unsigned int dim = 0; dim < loopList.size(); dim++) {
+            scopFunctionInfo->add_local_work_size(dim == reduction.dimension ? reduction.groupSize : 1);
+        }
+    }
+
+    return kernelCode;
+}
+
+//The client transfers the arrays once for all kernels of a scop, they need the same images and pitched buffers
+static bool hasSameBufferArgs(const HTROP_PB::Message_RSRC::ScopFunctionOCLInfo & a, const HTROP_PB::Message_RSRC::ScopFunctionOCLInfo & b) {
+    if (a.image_args_size() != b.image_args_size() || a.pitched_args_size() != b.pitched_args_size())
+        return false;
+    for (int imageArg = 0; imageArg < a.image_args_size(); imageArg++) {
+        if (a.image_args(imageArg).SerializeAsString() != b.image_args(imageArg).SerializeAsString())
+            return false;
+    }
+    for (int pitchedArg = 0; pitchedArg < a.pitched_args_size(); pitchedArg++) {
+        if (a.pitched_args(pitchedArg).SerializeAsString() != b.pitched_args(pitchedArg).SerializeAsString())
+            return false;
+    }
+    return true;
+}
+
+//The variants parallelize one loop less, switch the thread coarsening and switch the local-memory tiling.
+//A variant is dropped if it emits the same kernel as an earlier one or if it reads other arrays from images
+//or pitched buffers, the client transfers the arrays once for all variants.
+std::string OpenCLCBackend::generateKernelVariants(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelCode,
+                                                   HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream) {
+    CodeGenOptions baseOptions = codeGenOptions;
+    unsigned int max_codegen_loop_depth = clientKernelInfo.max_codegen_loop_depth();
+
+    //Loop depth and options per variant
+    std::vector < std::pair < unsigned int, CodeGenOptions > >candidates;
+    if (max_codegen_loop_depth > 1)
+        candidates.push_back(std::make_pair(max_codegen_loop_depth - 1, baseOptions));
+
+    if (baseOptions.oclEmitter != "axtor") {
+        CodeGenOptions coarsening = baseOptions;
+        coarsening.registerBlock.clear();
+        coarsening.vectorWidth.clear();
+        if (baseOptions.coarsening.empty())
+            coarsening.coarsening = baseOptions.variantCoarsening;
+        else
+            coarsening.coarsening.clear();
+        candidates.push_back(std::make_pair(max_codegen_loop_depth, coarsening));
+
+        CodeGenOptions tiling = baseOptions;
+        tiling.localTileSize = baseOptions.localTileSize > 0 ? 0 : baseOptions.variantTileSize;
+        candidates.push_back(std::make_pair(max_codegen_loop_depth, tiling));
+    }
 
-            int phi_offset = 0;
-            ConstantInt *constInt = NULL;
-            Value *phi_offsetValue = phi->getIncomingValue(0);
+    std::string kernelName = scopFunctionInfo->scopoclkernelname();
+    std::set < std::string > variantCodes;
+    variantCodes.insert(kernelCode);
 
-            if (isa < llvm::ConstantInt > (phi_offsetValue)) {
-                constInt = dyn_cast < llvm::ConstantInt > (phi_offsetValue);
-                phi_offset = constInt->getSExtValue();
+    std::string variantsCode = "";
+    for (auto & candidate:candidates) {
+        HTROP_PB::Message_RSRC::ScopFunctionOCLInfo variantInfo;
+        std::string variantName = kernelName + "_v" + std::to_string(scopFunctionInfo->variants_size() + 1);
+        variantInfo.set_scopfunctionname(scopFunctionInfo->scopfunctionname());
+        variantInfo.set_scopoclkernelname(variantName);
+
+        codeGenOptions = candidate.second;
+        std::string variantCode = generateScopKernel(clientKernelInfo, variantName, candidate.first, &variantInfo, directOutStream);
+        codeGenOptions = baseOptions;
+
+        //Compare the kernels without their names
+        std::string comparableCode = variantCode;
+        for (size_t pos = comparableCode.find(variantName); pos != std::string::npos; pos = comparableCode.find(variantName, pos + kernelName.size()))
+            comparableCode.replace(pos, variantName.size(), kernelName);
+
+        if (variantCode.empty() || !hasSameBufferArgs(variantInfo, *scopFunctionInfo) || variantInfo.has_reduction() || !variantCodes.insert(comparableCode).second)
+            continue;
+
+#ifdef HTROP_DEBUG
+        std::cout << "\n Kernel variant " << variantName << " - codegen depth " << candidate.first << " - " << candidate.second.getFingerprint();
+        std::cout.flush();
+#endif
+
+        scopFunctionInfo->add_variants()->CopyFrom(variantInfo);
+        variantsCode += "\n\n" + variantCode;
+    }
+
+    return variantsCode;
+}
+
+//Small inputs need every work-item: the version for them runs one iteration per work-item and does not use
+//local-memory tiles that can be larger than the iteration space. It is dropped if the kernel does not use them anyway.
+//It runs for calls with fewer work-items than the threshold and for calls in which the trip count of a loop is below
+//the tile edge or the iterations per work-item of its dimension (e.g. narrow images), one size range each.
+std::string OpenCLCBackend::generateSizeVersions(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelCode,
+                                                 HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream) {
+    if (scopFunctionInfo->register_block_size() == 0 && scopFunctionInfo->vector_width_size() == 0 && scopFunctionInfo->coarsening_size() == 0
+        && scopFunctionInfo->local_work_size_size() == 0)
+        return "";
+
+    CodeGenOptions baseOptions = codeGenOptions;
+    codeGenOptions.registerBlock.clear();
+    codeGenOptions.vectorWidth.clear();
+    codeGenOptions.coarsening.clear();
+    codeGenOptions.localTileSize = 0;
+
+    HTROP_PB::Message_RSRC::ScopFunctionOCLInfo versionInfo;
+    std::string versionName = scopFunctionInfo->scopoclkernelname() + "_small";
+    versionInfo.set_scopfunctionname(scopFunctionInfo->scopfunctionname());
+    versionInfo.set_scopoclkernelname(versionName);
+    std::string versionCode = generateScopKernel(clientKernelInfo, versionName, clientKernelInfo.max_codegen_loop_depth(), &versionInfo, directOutStream);
+    codeGenOptions = baseOptions;
+
+    //The client transfers the arrays of the scop kernel, an image of the version would be a buffer
+    if (versionCode.empty() || !hasSameBufferArgs(versionInfo, *scopFunctionInfo))
+        return "";
+
+    versionInfo.set_min_work_items(0);
+    versionInfo.set_max_work_items(codeGenOptions.smallSizeThreshold);
+    scopFunctionInfo->add_size_versions()->CopyFrom(versionInfo);
+
+#ifdef HTROP_DEBUG
+    std::cout << "\n Size version " << versionName << " - below " << codeGenOptions.smallSizeThreshold << " work-items";
+    std::cout.flush();
+#endif
+
+    //Smallest trip count per dimension that fills a tile and the iterations of a work-item on every device
+    std::vector < uint64_t >minTripCounts(scopFunctionInfo->workgroup_arg_index_size(), 1);
+    for (int dim = 0; dim < scopFunctionInfo->local_work_size_size() && dim < (int)minTripCounts.size(); dim++)
+        minTripCounts[dim] = std::max < uint64_t > (minTripCounts[dim], scopFunctionInfo->local_work_size(dim));
+    auto addFactors = [&minTripCounts] (const google::protobuf::RepeatedPtrField < HTROP_PB::Message_RSRC::WorkItemFactor > &workItemFactors) {
+        for (auto & workItemFactor:workItemFactors) {
+            if (workItemFactor.dimension() < minTripCounts.size())
+                minTripCounts[workItemFactor.dimension()] = std::max < uint64_t > ({ minTripCounts[workItemFactor.dimension()], workItemFactor.factor_mcpu(),
+                                                                                  workItemFactor.factor_gpu(), workItemFactor.factor_mic() });
+        }
+    };
+    addFactors(scopFunctionInfo->register_block());
+    addFactors(scopFunctionInfo->vector_width());
+    addFactors(scopFunctionInfo->coarsening());
+
+    for (unsigned int dim = 0; dim < minTripCounts.size(); dim++) {
+        if (minTripCounts[dim] <= 1)
+            continue;
+        HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * dimensionVersion = scopFunctionInfo->add_size_versions();
+        dimensionVersion->CopyFrom(versionInfo);
+        dimensionVersion->set_max_work_items(0);
+        for (unsigned int rangeDim = 0; rangeDim < minTripCounts.size(); rangeDim++) {
+            dimensionVersion->add_min_global_size(0);
+            dimensionVersion->add_max_global_size(rangeDim == dim ? minTripCounts[dim] : 0);
+        }
+
+#ifdef HTROP_DEBUG
+        std::cout << "\n Size version " << versionName << " - dimension " << dim << " below " << minTripCounts[dim];
+        std::cout.flush();
+#endif
+    }
+
+    return "\n\n" + versionCode;
+}
+
+//The long loop counters and indices of the scop kernel as int. Its guard leaves headroom for the intermediate
+//values of the address computations, e.g. (i + 1) * cols.
+std::string OpenCLCBackend::generateIndex32Version(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelCode,
+                                                   HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream) {
+    const uint64_t maxIndex = 1 << 30;
+
+    if (!isIndex32Candidate(originalOclMod->getFunction(clientKernelInfo.scopfunctionname())))
+        return "";
+
+    HTROP_PB::Message_RSRC::ScopFunctionOCLInfo versionInfo;
+    std::string kernelName = scopFunctionInfo->scopoclkernelname();
+    std::string versionName = kernelName + "_i32";
+    versionInfo.set_scopfunctionname(scopFunctionInfo->scopfunctionname());
+    versionInfo.set_scopoclkernelname(versionName);
+    narrowIndices = true;
+    std::string versionCode = generateScopKernel(clientKernelInfo, versionName, clientKernelInfo.max_codegen_loop_depth(), &versionInfo, directOutStream);
+    narrowIndices = false;
+
+    //Dropped if the kernel has no long values or the emitter fell back to Axtor
+    std::string comparableCode = versionCode;
+    for (size_t pos = comparableCode.find(versionName); pos != std::string::npos; pos = comparableCode.find(versionName, pos + kernelName.size()))
+        comparableCode.replace(pos, versionName.size(), kernelName);
+    if (versionCode.empty() || comparableCode == kernelCode || !hasSameBufferArgs(versionInfo, *scopFunctionInfo) || versionInfo.has_reduction())
+        return "";
+
+    versionInfo.set_min_work_items(0);
+    versionInfo.set_max_work_items(0);
+    versionInfo.set_max_index(maxIndex);
+    scopFunctionInfo->add_size_versions()->CopyFrom(versionInfo);
+
+#ifdef HTROP_DEBUG
+    std::cout << "\n Size version " << versionName << " - indices below " << maxIndex;
+    std::cout.flush();
+#endif
+
+    return "\n\n" + versionCode;
+}
+
+bool OpenCLCBackend::isIndex32Candidate(llvm::Function * kernel) {
+    const int64_t maxConstant = 1 << 30;
+
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        llvm::Instruction * inst = &*I;
+        if (auto loadInst = dyn_cast < LoadInst > (inst)) {
+            if (loadInst->getType()->isIntegerTy(64))
+                return false;
+            continue;
+        }
+        if (auto storeInst = dyn_cast < StoreInst > (inst)) {
+            if (storeInst->getValueOperand()->getType()->isIntegerTy(64))
+                return false;
+            continue;
+        }
+        if (auto callInst = dyn_cast < CallInst > (inst)) {
+            std::string name = callInst->getCalledFunction() != NULL ? callInst->getCalledFunction()->getName().str() : "";
+            if (isa < DbgInfoIntrinsic > (callInst) || name.find("llvm.lifetime.") == 0 || name.find("llvm.invariant.") == 0 || name == "llvm.assume")
+                continue;
+            if (callInst->getType()->isIntegerTy(64))
+                return false;
+            for (unsigned int i = 0; i < callInst->getNumArgOperands(); i++) {
+                if (callInst->getArgOperand(i)->getType()->isIntegerTy(64))
+                    return false;
+            }
+            continue;
+        }
+        if (isa < PtrToIntInst > (inst) || isa < IntToPtrInst > (inst) || (inst->getOpcode() == Instruction::LShr && inst->getType()->isIntegerTy(64)))
+            return false;
+        if (isa < GetElementPtrInst > (inst))
+            continue;
+
+        for (unsigned int i = 0; i < inst->getNumOperands(); i++) {
+            auto constInt = dyn_cast < ConstantInt > (inst->getOperand(i));
+            if (constInt != NULL && constInt->getBitWidth() == 64 && (constInt->getSExtValue() <= -maxConstant || constInt->getSExtValue() >= maxConstant))
+                return false;
+        }
+    }
+    return true;
+}
+
+//The parallelized loops have independent iterations, so the sibling loops below them can run one after the other over
+//the whole iteration space. The kernels keep plain buffers and no reduction, the client transfers the arrays once for all.
+std::string OpenCLCBackend::generateDistributedKernels(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelName, unsigned int numLoopChains,
+                                                       HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream) {
+    CodeGenOptions baseOptions = codeGenOptions;
+    codeGenOptions.readOnlyMemory = false;
+    codeGenOptions.pitchedBuffers = false;
+    codeGenOptions.reductionGroupSize = 0;
+
+    std::string kernelsCode = "";
+    for (unsigned int chain = 0; chain < numLoopChains; chain++) {
+        HTROP_PB::Message_RSRC::ScopFunctionOCLInfo chainInfo;
+        HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * kernelInfo = chain == 0 ? scopFunctionInfo : &chainInfo;
+        std::string chainName = chain == 0 ? kernelName : kernelName + "_d" + std::to_string(chain);
+        kernelInfo->set_scopfunctionname(scopFunctionInfo->scopfunctionname());
+        kernelInfo->set_scopoclkernelname(chainName);
+
+        distributedChain = chain;
+        std::string chainCode = generateScopKernel(clientKernelInfo, chainName, clientKernelInfo.max_codegen_loop_depth(), kernelInfo, directOutStream);
+        distributedChain = -1;
+        if (chainCode.empty()) {
+            codeGenOptions = baseOptions;
+            return "";
+        }
+        kernelsCode += "\n\n" + chainCode;
+
+        if (chain > 0)
+            scopFunctionInfo->add_distributed_kernels()->CopyFrom(chainInfo);
+
+#ifdef HTROP_DEBUG
+        std::cout << "\n Distributed kernel " << chainName << " - " << kernelInfo->workgroup_arg_index_size() << " parallel loops";
+        std::cout.flush();
+#endif
+    }
+    codeGenOptions = baseOptions;
+
+    return kernelsCode;
+}
+
+//Sibling loops ordered by the dominance of their headers, false if they are not on one path
+static bool orderLoops(std::vector < llvm::Loop * >loops, llvm::DominatorTree & DT, std::vector < llvm::Loop * >&ordered) {
+    while (!loops.empty()) {
+        auto first = loops.begin();
+        for (auto loop = loops.begin(); loop != loops.end(); loop++) {
+            if (DT.dominates((*loop)->getHeader(), (*first)->getHeader()))
+                first = loop;
+        }
+        for (auto loop:loops) {
+            if (!DT.dominates((*first)->getHeader(), loop->getHeader()))
+                return false;
+        }
+        ordered.push_back(*first);
+        loops.erase(first);
+    }
+    return true;
+}
+
+//The preheader jumps to the only exit block instead, the exit has no values of the loop
+static bool canSkipLoop(llvm::Loop * loop) {
+    llvm::BasicBlock * preheader = loop->getLoopPreheader();
+    llvm::BasicBlock * exitBlock = loop->getUniqueExitBlock();
+    if (preheader == NULL || exitBlock == NULL || isa < PHINode > (exitBlock->begin()))
+        return false;
+    llvm::BranchInst * entryBranch = dyn_cast < BranchInst > (preheader->getTerminator());
+    return entryBranch != NULL && entryBranch->isUnconditional();
+}
+
+//Memory writes in the blocks of loop that are not part of a sub loop, loop NULL for the blocks outside all loops
+static bool writesOutsideSubLoops(llvm::Function * kernel, llvm::LoopInfoBase < llvm::BasicBlock, llvm::Loop > &KLoop, llvm::Loop * loop) {
+    for (auto & block:*kernel) {
+        if (KLoop.getLoopFor(&block) != loop)
+            continue;
+        for (auto & inst:block) {
+            if (inst.mayWriteToMemory())
+                return true;
+        }
+    }
+    return false;
+}
+
+static bool collectLoopChains(const std::vector < llvm::Loop * >&siblings, llvm::DominatorTree & DT, unsigned int maxDepth, std::vector < llvm::Loop * >&chain,
+                              std::vector < std::vector < llvm::Loop * > >&chains) {
+    std::vector < llvm::Loop * >ordered;
+    if (!orderLoops(siblings, DT, ordered))
+        return false;
+
+    for (auto loop:ordered) {
+        if (ordered.size() > 1 && !canSkipLoop(loop))
+            return false;
+
+        chain.push_back(loop);
+        if (chain.size() >= maxDepth || loop->getSubLoops().empty())
+            chains.push_back(chain);
+        else if (!collectLoopChains(loop->getSubLoops(), DT, maxDepth, chain, chains))
+            return false;
+        chain.pop_back();
+    }
+    return true;
+}
+
+bool OpenCLCBackend::getLoopChains(llvm::Function * kernel, llvm::DominatorTree & DT, llvm::LoopInfoBase < llvm::BasicBlock, llvm::Loop > &KLoop, unsigned int maxDepth,
+                                   std::vector < std::vector < llvm::Loop * > >&chains) {
+    std::vector < llvm::Loop * >topLevelLoops(KLoop.begin(), KLoop.end());
+    std::vector < llvm::Loop * >chain;
+    if (!collectLoopChains(topLevelLoops, DT, maxDepth, chain, chains) || chains.empty())
+        return false;
+
+    //Every chain runs the code around its loops again, it may not write memory
+    if (chains.size() > 1) {
+        if (writesOutsideSubLoops(kernel, KLoop, NULL))
+            return false;
+        std::map < llvm::Loop *, unsigned int >numChains;
+        for (auto & loopChain:chains) {
+            for (auto loop:loopChain) {
+                if (++numChains[loop] == 2 && writesOutsideSubLoops(kernel, KLoop, loop))
+                    return false;
             }
+        }
+    }
+    return true;
+}
 
-            //find the position of the iterator limit
-            bool foundArg = false;
+unsigned int OpenCLCBackend::keepLoopChain(llvm::Function * kernel, unsigned int maxDepth, unsigned int chain) {
+    unsigned int sharedLoops;
+    {
+        llvm::DominatorTree DT;
+        DT.recalculate(*kernel);
+        llvm::LoopInfoBase < llvm::BasicBlock, llvm::Loop > KLoop;
+        KLoop.analyze(DT);
+
+        std::vector < std::vector < llvm::Loop * > >chains;
+        bool hasChains = getLoopChains(kernel, DT, KLoop, maxDepth, chains);
+        assert(hasChains && chain < chains.size());
+        sharedLoops = getSharedLoops(chains);
+
+        //The siblings of the chain on each level are skipped, the loops below the last one stay in the work-item
+        std::vector < llvm::Loop * >siblings(KLoop.begin(), KLoop.end());
+        for (unsigned int depth = 0; depth + 1 < chains[chain].size(); depth++)
+            siblings.insert(siblings.end(), chains[chain][depth]->getSubLoops().begin(), chains[chain][depth]->getSubLoops().end());
+
+        for (auto loop:siblings) {
+            if (std::find(chains[chain].begin(), chains[chain].end(), loop) != chains[chain].end())
+                continue;
+            dyn_cast < BranchInst > (loop->getLoopPreheader()->getTerminator())->setSuccessor(0, loop->getUniqueExitBlock());
+        }
+    }
+    removeUnreachableBlocks(*kernel);
+
+    return sharedLoops;
+}
 
-            for (unsigned int oper_iter = 0; oper_iter < cmpInst->getNumOperands(); oper_iter++) {
-                unsigned int pos = 0;
+//The interior kernel is the scop kernel with the border tests folded, the scop kernel keeps them for the border work-items.
+//The runtime launches both with global offsets, so neither may scale the work-items or rely on whole work-groups.
+std::string OpenCLCBackend::generateSplitKernels(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelName,
+                                                 HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream) {
+    CodeGenOptions baseOptions = codeGenOptions;
+    codeGenOptions.localTileSize = 0;
+    codeGenOptions.registerBlock.clear();
+    codeGenOptions.vectorWidth.clear();
+    codeGenOptions.coarsening.clear();
+    codeGenOptions.reductionGroupSize = 0;
+    codeGenOptions.readOnlyMemory = false;
+    codeGenOptions.pitchedBuffers = false;
+
+    HTROP_PB::Message_RSRC::ScopFunctionOCLInfo interiorInfo;
+    std::string interiorName = kernelName + "_interior";
+    interiorInfo.set_scopfunctionname(scopFunctionInfo->scopfunctionname());
+    interiorInfo.set_scopoclkernelname(interiorName);
+
+    splitInterior = true;
+    std::string interiorCode = generateScopKernel(clientKernelInfo, interiorName, clientKernelInfo.max_codegen_loop_depth(), &interiorInfo, directOutStream);
+    splitInterior = false;
+
+    std::string kernelsCode = "";
+    std::string borderCode = interiorCode.empty()? "" : generateScopKernel(clientKernelInfo, kernelName, clientKernelInfo.max_codegen_loop_depth(), scopFunctionInfo, directOutStream);
+    if (!borderCode.empty()) {
+        kernelsCode = "\n\n" + borderCode + "\n\n" + interiorCode;
+        scopFunctionInfo->mutable_interior_kernel()->CopyFrom(interiorInfo);
 
-                for (llvm::Function::arg_iterator arg_I = kernelFunction->arg_begin(); arg_I != kernelFunction->arg_end(); arg_I++) {
+#ifdef HTROP_DEBUG
+        std::cout << "\n Interior kernel " << interiorName << " - borders";
+        for (int dim = 0; dim < interiorInfo.border_low_size(); dim++)
+            std::cout << " " << interiorInfo.border_low(dim) << "/" << interiorInfo.border_high(dim);
+        std::cout.flush();
+#endif
+    }
+    codeGenOptions = baseOptions;
 
-                    Value *instCmp = cmpInst->getOperand(oper_iter);
+    return kernelsCode;
+}
 
-                    if (llvm::SExtInst * sextInst = dyn_cast < SExtInst > (instCmp)) {
-                        instCmp = sextInst->getOperand(0);
-                    }
+bool OpenCLCBackend::foldBorderConditions(llvm::Function * kernel, const std::vector < int >&boundArgs, std::vector < unsigned int >&borderLow, std::vector < unsigned int >&borderHigh) {
+    //Wider borders are not worth a separate launch
+    const int64_t maxBorder = 16;
+
+    //The work-item position of the dimensions bounded by an argument
+    std::map < llvm::Value *, unsigned int >globalIds;
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        llvm::CallInst * callInst = dyn_cast < CallInst > (&*I);
+        if (callInst == NULL || callInst->getCalledFunction() != func_get_global_id)
+            continue;
+        unsigned int dim = dyn_cast < ConstantInt > (callInst->getArgOperand(0))->getZExtValue();
+        if (dim < boundArgs.size() && boundArgs[dim] >= 0)
+            globalIds[callInst] = dim;
+    }
 
-                    if (instCmp == dyn_cast < Value > (arg_I)) {
-                        scopFunctionInfo->add_workgroup_arg_index(pos);
-                        scopFunctionInfo->add_workgroup_arg_index_offset(phi_offset);
-                        foundArg = true;
-                        break;
-                    }
-                    pos++;
-                }
+    //The guards of the loop mapping keep the rounded up work-items out, they are no border tests
+    std::set < llvm::Value * >guardCmps;
+    for (auto & block:*kernel) {
+        llvm::BranchInst * branchInst = dyn_cast < BranchInst > (block.getTerminator());
+        if (branchInst == NULL || !branchInst->isConditional() || branchInst->getMetadata("htrop.bound_guard") == NULL)
+            continue;
+        llvm::Value * condition = branchInst->getCondition();
+        guardCmps.insert(condition);
+        //[start, n) joins the lower and the upper compare
+        llvm::BinaryOperator * guardAnd = dyn_cast < BinaryOperator > (condition);
+        if (guardAnd != NULL && guardAnd->getOpcode() == Instruction::And) {
+            guardCmps.insert(guardAnd->getOperand(0));
+            guardCmps.insert(guardAnd->getOperand(1));
+        }
+    }
+
+    borderLow.assign(boundArgs.size(), 0);
+    borderHigh.assign(boundArgs.size(), 0);
+    std::vector < std::pair < llvm::ICmpInst *, bool > >borderCmps;
+
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        llvm::ICmpInst * cmpInst = dyn_cast < ICmpInst > (&*I);
+        if (cmpInst == NULL || guardCmps.count(cmpInst) > 0 || !cmpInst->getOperand(0)->getType()->isIntegerTy() || cmpInst->isUnsigned())
+            continue;
+
+        //lhs - rhs = scale * id + boundScale * n + constant
+        AffineIndex difference;
+        getAffineValue(cmpInst->getOperand(0), 1, difference);
+        getAffineValue(cmpInst->getOperand(1), -1, difference);
+        llvm::Value * globalId = NULL;
+        int64_t scale = 0;
+        for (auto coefficient:difference.coefficients) {
+            if (globalIds.count(coefficient.first) > 0) {
+                globalId = coefficient.first;
+                scale = coefficient.second;
             }
+        }
+        if (globalId == NULL || (scale != 1 && scale != -1))
+            continue;
+        int64_t boundScale = difference.getCoefficient(getArgByPos(kernel, boundArgs[globalIds[globalId]]));
+        if ((boundScale != 0 && boundScale != -scale) || difference.coefficients.size() != (boundScale != 0 ? 2u : 1u))
+            continue;
+
+        //id + constant pred 0, or id - n + constant pred 0
+        ICmpInst::Predicate predicate = cmpInst->getPredicate();
+        int64_t constant = difference.constant;
+        if (scale < 0) {
+            predicate = ICmpInst::getSwappedPredicate(predicate);
+            constant = -constant;
+        }
+
+        //The compare is constant for the work-items id >= width (lower border) or id < n - width (upper border)
+        int64_t width;
+        bool value;
+        switch (predicate) {
+        case ICmpInst::ICMP_SLT:
+        case ICmpInst::ICMP_SGE:
+            width = boundScale == 0 ? -constant : constant;
+            value = (predicate == ICmpInst::ICMP_SGE) == (boundScale == 0);
+            break;
+        case ICmpInst::ICMP_SLE:
+        case ICmpInst::ICMP_SGT:
+            width = boundScale == 0 ? 1 - constant : constant - 1;
+            value = (predicate == ICmpInst::ICMP_SGT) == (boundScale == 0);
+            break;
+        case ICmpInst::ICMP_EQ:
+        case ICmpInst::ICMP_NE:
+            width = boundScale == 0 ? 1 - constant : constant;
+            value = predicate == ICmpInst::ICMP_NE;
+            break;
+        default:
+            continue;
+        }
+        if (width > maxBorder)
+            continue;
+
+        unsigned int dim = globalIds[globalId];
+        if (boundScale == 0)
+            borderLow[dim] = std::max < int64_t > (borderLow[dim], width);
+        else
+            borderHigh[dim] = std::max < int64_t > (borderHigh[dim], width);
+        borderCmps.push_back(std::pair < llvm::ICmpInst *, bool >(cmpInst, value));
+    }
+
+    if (borderCmps.empty())
+        return false;
+
+    for (auto borderCmp:borderCmps) {
+        borderCmp.first->replaceAllUsesWith(ConstantInt::get(borderCmp.first->getType(), borderCmp.second));
+        borderCmp.first->eraseFromParent();
+    }
+
+    //Drop the branches of the border, the && and || of the tests leave constant conditions
+    for (auto & block:*kernel)
+        SimplifyInstructionsInBlock(&block);
+    for (auto & block:*kernel)
+        ConstantFoldTerminator(&block, true);
+    removeUnreachableBlocks(*kernel);
 
-            //If not found in the argument list then we have a problem
-            assert(foundArg);
+    return true;
+}
+
+//Both loops of the nest are mapped like in generateScopKernel, then the inner one is skewed. The work-item (i, t) runs
+//the iteration (i, t - skew * i), the runtime only starts the work-items of the outer iterations that take part in wave t.
+std::string OpenCLCBackend::generateWavefrontKernel(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelName,
+                                                    HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream) {
+    cloneOriginalModule();
+
+    llvm::Function * kernelFunction = oclMod->getFunction(clientKernelInfo.scopfunctionname());
+    kernelFunction->setName(kernelName);
+
+    llvm::DominatorTree DT;
+    DT.recalculate(*kernelFunction);
+    llvm::LoopInfoBase < llvm::BasicBlock, llvm::Loop > KLoop;
+    KLoop.analyze(DT);
+
+    llvm::BasicBlock * last_block = &kernelFunction->back();
+
+    std::vector < Loop * >loopList;
+    std::vector < std::pair < int, int > >loopBounds;
+    std::vector < unsigned int >loopDimension = { 0, 1 };
+    if (!getParallelLoops(&KLoop, 2, clientKernelInfo.num_loop_trip_counts(), loopList, loopBounds) || loopList.size() != 2
+        || !mapLoops(loopList, loopDimension, clientKernelInfo.num_loop_trip_counts(), last_block))
+        return "";
+
+    //The global size of dimension 1 is the trip count of the inner loop, the runtime derives the number of waves
+    for (unsigned int loopIte = 0; loopIte < loopList.size(); loopIte++) {
+        scopFunctionInfo->add_workgroup_arg_index(loopBounds[loopIte].first);
+        scopFunctionInfo->add_workgroup_arg_index_offset(loopBounds[loopIte].second);
+        scopFunctionInfo->add_workgroup_loop_index(loopIte);
+    }
+    scopFunctionInfo->set_wavefront_skew(clientKernelInfo.wavefront_skew());
+
+    skewWavefront(kernelFunction, clientKernelInfo.wavefront_skew(), last_block);
+
+    //The waves are small, the kernel uses no work-item factors, tiles or special memory
+    LocalTiling tiling;
+    Reduction reduction;
+    ReadOnlyArgs readOnlyArgs;
+    std::set < unsigned int >pitchedArgs;
+    HTROP_PB::Message_RSRC::WorkItemFactor workItemFactor;
+    return generateKernelCode(kernelFunction, kernelName, directOutStream, tiling, reduction, readOnlyArgs, pitchedArgs, &workItemFactor, NO_WORK_ITEM_FACTOR, 0);
+}
+
+void OpenCLCBackend::skewWavefront(llvm::Function * kernel, unsigned int skew, llvm::BasicBlock * lastBlock) {
+    llvm::CallInst * waveCall = NULL;
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        llvm::CallInst * callInst = dyn_cast < CallInst > (&*I);
+        if (callInst != NULL && callInst->getCalledFunction() == func_get_global_id && dyn_cast < ConstantInt > (callInst->getArgOperand(0))->equalsInt(1))
+            waveCall = callInst;
+    }
+    assert(waveCall != NULL);
+
+    llvm::Instruction * insertBefore = waveCall->getNextNode();
+    ConstantInt *const_int32_dim = ConstantInt::get(oclMod->getContext(), APInt(32, 0));
+    llvm::CallInst * outerCall = llvm::CallInst::Create(func_get_global_id, const_int32_dim, "call_ggi", insertBefore);
+    llvm::Instruction * skewed = BinaryOperator::Create(Instruction::Mul, outerCall, ConstantInt::get(outerCall->getType(), skew), "wave_skew", insertBefore);
+    llvm::Instruction * innerIndex = BinaryOperator::Create(Instruction::Sub, UndefValue::get(waveCall->getType()), skewed, "wave_index", insertBefore);
+    waveCall->replaceAllUsesWith(innerIndex);
+    innerIndex->setOperand(0, waveCall);
+
+    //The bound guard of the inner loop only checks the upper end, the first waves reach the later outer iterations before their first inner one
+    llvm::Instruction * guardCmp = new llvm::ICmpInst(insertBefore, llvm::ICmpInst::ICMP_SGE, innerIndex, ConstantInt::get(innerIndex->getType(), 0), "wave_guard");
+    llvm::BasicBlock * waveBlock = waveCall->getParent();
+    llvm::BasicBlock * bodyBlock = waveBlock->splitBasicBlock(insertBefore, "wave_cmp");
+    waveBlock->getTerminator()->eraseFromParent();
+    llvm::BranchInst::Create(bodyBlock, lastBlock, guardCmp, waveBlock);
+}
+
+bool OpenCLCBackend::getLoopMapping(llvm::Loop * loop, bool tripCountKnown, LoopMapping & mapping) {
+    mapping = LoopMapping();
+
+    //The induction variable has to be the only phi of the header, the others would lose their loop-carried value
+    llvm::BasicBlock * latch = loop->getLoopLatch();
+    mapping.phi = dyn_cast < PHINode > (loop->getHeader()->begin());
+    if (latch == NULL || mapping.phi == NULL || mapping.phi->getNumIncomingValues() != 2 || !mapping.phi->getType()->isIntegerTy() || isa < PHINode > (mapping.phi->getNextNode()))
+        return false;
+
+    //i += step with a positive constant step
+    mapping.increment = dyn_cast < BinaryOperator > (mapping.phi->getIncomingValueForBlock(latch));
+    if (mapping.increment == NULL || mapping.increment->getOpcode() != Instruction::Add)
+        return false;
+    unsigned int phiOperand = mapping.increment->getOperand(0) == mapping.phi ? 0 : 1;
+    ConstantInt *step = dyn_cast < ConstantInt > (mapping.increment->getOperand(1 - phiOperand));
+    if (mapping.increment->getOperand(phiOperand) != mapping.phi || step == NULL || step->getSExtValue() <= 0)
+        return false;
+    mapping.step = step->getSExtValue();
+    mapping.start = mapping.phi->getIncomingValue(1 - mapping.phi->getBasicBlockIndex(latch));
+
+    //The latch compares the increment with a loop invariant bound
+    mapping.latchBranch = dyn_cast < BranchInst > (latch->getTerminator());
+    if (mapping.latchBranch == NULL || !mapping.latchBranch->isConditional())
+        return false;
+    mapping.exitCmp = dyn_cast < ICmpInst > (mapping.latchBranch->getCondition());
+    if (mapping.exitCmp == NULL || !mapping.exitCmp->hasOneUse())
+        return false;
+
+    bool foundIncrement = false;
+    for (unsigned int oper_iter = 0; oper_iter < 2; oper_iter++) {
+        llvm::Value * operand = mapping.exitCmp->getOperand(oper_iter);
+        if (llvm::CastInst * castInst = dyn_cast < CastInst > (operand)) {
+            if (castInst->hasOneUse())
+                operand = castInst->getOperand(0);
+        }
+        if (operand == mapping.increment) {
+            mapping.incrementOperand = oper_iter;
+            foundIncrement = true;
+        }
+    }
+    llvm::Value * bound = mapping.exitCmp->getOperand(1 - mapping.incrementOperand);
+    if (!foundIncrement || !loop->isLoopInvariant(bound))
+        return false;
+
+    //i < n with an argument n: the global size is n and the iteration variable is get_global_id
+    ICmpInst::Predicate predicate = mapping.incrementOperand == 0 ? mapping.exitCmp->getPredicate() : mapping.exitCmp->getSwappedPredicate();
+    if (mapping.latchBranch->getSuccessor(0) != loop->getHeader())
+        predicate = ICmpInst::getInversePredicate(predicate);
+
+    if (llvm::SExtInst * sextInst = dyn_cast < SExtInst > (bound)) {
+        bound = sextInst->getOperand(0);
+    }
+    ConstantInt *constStart = dyn_cast < ConstantInt > (mapping.start);
+
+    if (isa < Argument > (bound) && constStart != NULL && constStart->getSExtValue() >= 0 && mapping.step == 1
+        && (predicate == ICmpInst::ICMP_SLT || predicate == ICmpInst::ICMP_ULT || predicate == ICmpInst::ICMP_NE)) {
+        mapping.boundArg = dyn_cast < Argument > (bound)->getArgNo();
+        return true;
+    }
+
+    //Otherwise the iteration count comes from the loop bounds of the client. The work-items beyond it need an ordered compare
+    //with the bound: the step is positive, so i != n becomes i < n, and a loop that runs while i == n or i > n is not mapped.
+    if (predicate == ICmpInst::ICMP_NE)
+        mapping.guardPredicate = ICmpInst::ICMP_SLT;
+    else if (predicate == ICmpInst::ICMP_SLT || predicate == ICmpInst::ICMP_SLE || predicate == ICmpInst::ICMP_ULT || predicate == ICmpInst::ICMP_ULE)
+        mapping.guardPredicate = predicate;
+    else
+        return false;
+    return tripCountKnown;
+}
+
+void OpenCLCBackend::mapLoopToDimension(LoopMapping & mapping, unsigned int dimension, llvm::BasicBlock * lastBlock) {
+    llvm::PHINode * phi = mapping.phi;
+    llvm::BasicBlock * header = phi->getParent();
+    llvm::BasicBlock * latch = mapping.latchBranch->getParent();
+    bool continueOnTrue = mapping.latchBranch->getSuccessor(0) == header;
+    llvm::BasicBlock * exitBlock = mapping.latchBranch->getSuccessor(continueOnTrue ? 1 : 0);
+
+    //insert the call to get_global_id
+    ConstantInt *const_int32_dim = ConstantInt::get(oclMod->getContext(), APInt(32, StringRef(std::to_string(dimension)), 10));
+
+    llvm::CallInst * callInst = llvm::CallInst::Create(func_get_global_id, const_int32_dim, "call_ggi", phi);
+
+    //check the data-type size
+    llvm::Instruction * expandednCallInst = callInst;
+    if (phi->getType() == llvm::Type::getInt64Ty(oclMod->getContext())) {
+        //Upgrade to 64 bit
+        expandednCallInst = new llvm::SExtInst(callInst, llvm::Type::getInt64Ty(oclMod->getContext()), "scale", phi);
+    }
+
+    //start + get_global_id * step unless the iteration variable is get_global_id
+    llvm::Value * inductionValue = expandednCallInst;
+    if (mapping.boundArg < 0) {
+        if (mapping.step != 1)
+            inductionValue = BinaryOperator::Create(Instruction::Mul, inductionValue, ConstantInt::get(phi->getType(), mapping.step), "iv_scaled", phi);
+        inductionValue = BinaryOperator::Create(Instruction::Add, mapping.start, inductionValue, "iv", phi);
+    }
+
+    //The compare of the latch may use a cast of the increment
+    llvm::Value * cmpValue = inductionValue;
+    if (llvm::CastInst * castInst = dyn_cast < CastInst > (mapping.exitCmp->getOperand(mapping.incrementOperand))) {
+        cmpValue = CastInst::Create(castInst->getOpcode(), inductionValue, castInst->getDestTy(), "iv_cast", phi);
+    }
+
+    //The runtime rounds the global size up to whole work-groups, the work-items outside the iteration space skip the body
+    llvm::Instruction * guardCmp;
+
+    if (mapping.boundArg >= 0) {
+        //get_global_id in [start, n)
+        llvm::Value * bound = mapping.exitCmp->getOperand(1 - mapping.incrementOperand);
+        guardCmp = new llvm::ICmpInst(phi, mapping.exitCmp->isUnsigned()? llvm::ICmpInst::ICMP_ULT : llvm::ICmpInst::ICMP_SLT, cmpValue, bound, "icmpInst");
+        if (!dyn_cast < ConstantInt > (mapping.start)->isZero()) {
+            llvm::Instruction * lowerCmp = new llvm::ICmpInst(phi, llvm::ICmpInst::ICMP_SGE, expandednCallInst, mapping.start, "icmpInst");
+            guardCmp = BinaryOperator::Create(Instruction::And, guardCmp, lowerCmp, "guard", phi);
+        }
+    }
+    else {
+        //The work-items beyond the trip count fail the ordered compare with the bound of the loop
+        llvm::Value * bound = mapping.exitCmp->getOperand(1 - mapping.incrementOperand);
+        guardCmp = new llvm::ICmpInst(phi, mapping.guardPredicate, cmpValue, bound, "icmpInst");
+    }
+
+    //replace all instance of the phi with the call (NOTE: unsafe replace)
+    phi->replaceAllUsesWith(inductionValue);
+    phi->eraseFromParent();
+
+    //The latch leaves the loop after a single iteration
+    llvm::Instruction * cmpOperand = dyn_cast < Instruction > (mapping.exitCmp->getOperand(mapping.incrementOperand));
+    mapping.latchBranch->eraseFromParent();
+    mapping.exitCmp->eraseFromParent();
+    if (cmpOperand != mapping.increment && cmpOperand->use_empty())
+        cmpOperand->eraseFromParent();
+    if (mapping.increment->use_empty())
+        mapping.increment->eraseFromParent();
+    llvm::BranchInst::Create(exitBlock, latch);
+
+    //insert compare and jump. The guard of an argument bound is marked, the emitter replaces it by its own checks
+    //in register blocked and vectorized kernels.
+    llvm::BasicBlock * bodyBlock = header->splitBasicBlock(guardCmp->getNextNode(), "branch_cmp");
+    header->getTerminator()->eraseFromParent();
+    llvm::BranchInst * guardBranch = llvm::BranchInst::Create(bodyBlock, lastBlock, guardCmp, header);
+    if (mapping.boundArg >= 0)
+        guardBranch->setMetadata("htrop.bound_guard", llvm::MDNode::get(oclMod->getContext(), None));
+}
 
-            //remove unnecesary instructions from the header
-            llvm::BasicBlock * bb = phi->getParent();
+bool OpenCLCBackend::getParallelLoops(llvm::LoopInfoBase < llvm::BasicBlock, llvm::Loop > *KLoop, unsigned int maxDepth, unsigned int numLoopTripCounts,
+                                      std::vector < llvm::Loop * >&loopList, std::vector < std::pair < int, int > >&loopBounds) {
+    if (KLoop->begin() == KLoop->end())
+        return false;
 
-            //insert the call to get_global_id
-            ConstantInt *const_int32_14 = ConstantInt::get(oclMod->getContext(), APInt(32, StringRef(std::to_string(loopIte)), 10));
+    // Create the loop list
+    llvm::Loop * outerLoop = *KLoop->begin();
+    loopList.push_back(outerLoop);
 
-            llvm::CallInst * callInst = llvm::CallInst::Create(func_get_global_id, const_int32_14, "call_ggi", phi);
+    auto subLoops = outerLoop->getSubLoops();
 
-            //check the data-type size
-            llvm::Instruction * expandednCallInst = callInst;
-            if (phi->getType() == llvm::Type::getInt64Ty(oclMod->getContext())) {
-                //Upgrade to 64 bit
-                expandednCallInst = new llvm::SExtInst(callInst, llvm::Type::getInt64Ty(oclMod->getContext()), "scale", phi);
+    while (subLoops.size() > 0 && loopList.size() < maxDepth) {
+        loopList.push_back(subLoops[0]);
+        subLoops = subLoops[0]->getSubLoops();
+    }
+
+    for (unsigned int loopIte = 0; loopIte < loopList.size(); loopIte++) {
+        LoopMapping mapping;
+        if (!getLoopMapping(loopList[loopIte], loopIte < numLoopTripCounts, mapping)) {
+#ifdef HTROP_DEBUG
+            std::cout << "\n Loop " << loopIte << " cannot be mapped to get_global_id";
+            std::cout.flush();
+#endif
+            loopList.resize(loopIte);
+            break;
+        }
+        int phi_offset = 0;
+        if (mapping.boundArg >= 0)
+            phi_offset = dyn_cast < ConstantInt > (mapping.start)->getSExtValue();
+        loopBounds.push_back(std::pair < int, int >(mapping.boundArg, phi_offset));
+    }
+
+    return !loopList.empty();
+}
+
+bool OpenCLCBackend::mapLoops(std::vector < llvm::Loop * >&loopList, std::vector < unsigned int >&loopDimension, unsigned int numLoopTripCounts, llvm::BasicBlock * lastBlock) {
+    //Go over each of the loops, outermost first. The mapping is taken again because the rewrite of an outer loop
+    //replaces the values that start or bound the inner loops.
+    for (unsigned int loopIte = 0; loopIte < loopList.size(); loopIte++) {
+        LoopMapping mapping;
+        if (!getLoopMapping(loopList[loopIte], loopIte < numLoopTripCounts, mapping))
+            return false;
+
+        mapLoopToDimension(mapping, loopDimension[loopIte], lastBlock);
+    }
+    return true;
+}
+
+//Rank the loops by the number of unit-stride accesses (adjacent work-items touch adjacent addresses).
+//The best loop goes to dimension 0, the others keep their nesting order.
+std::vector < unsigned int >OpenCLCBackend::getLoopDimensions(llvm::Function * kernel, std::vector < llvm::Loop * >&loopList) {
+    std::vector < unsigned int >loopDimension;
+    std::vector < int >unitStrideAccesses(loopList.size(), 0);
+
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        llvm::Value * pointer = getAccessPointer(&*I);
+        AffineIndex index;
+        if (pointer == NULL || !getAffineIndex(pointer, index))
+            continue;
+
+        for (unsigned int loopIte = 0; loopIte < loopList.size(); loopIte++) {
+            llvm::Value * phi = &*loopList[loopIte]->getHeader()->begin();
+            int64_t stride = index.getCoefficient(phi);
+            if ((stride == 1 || stride == -1) && !index.isUsedInSymbol(phi))
+                unitStrideAccesses[loopIte]++;
+        }
+    }
+
+    unsigned int contiguousLoop = 0;
+    for (unsigned int loopIte = 1; loopIte < loopList.size(); loopIte++) {
+        if (unitStrideAccesses[loopIte] > unitStrideAccesses[contiguousLoop])
+            contiguousLoop = loopIte;
+    }
+
+    unsigned int nextDimension = 1;
+    for (unsigned int loopIte = 0; loopIte < loopList.size(); loopIte++) {
+        loopDimension.push_back(loopIte == contiguousLoop ? 0 : nextDimension++);
+    }
+
+#ifdef HTROP_DEBUG
+    std::cout << "\n Loop to dimension mapping:";
+    for (unsigned int loopIte = 0; loopIte < loopList.size(); loopIte++) {
+        std::cout << " loop " << loopIte << " -> " << loopDimension[loopIte] << " (" << unitStrideAccesses[loopIte] << " unit-stride accesses)";
+    }
+    std::cout.flush();
+#endif
+
+    return loopDimension;
+}
+
+bool OpenCLCBackend::isRegisterBlockCandidate(llvm::Function * kernel, std::vector < llvm::Loop * >&loopList, std::vector < unsigned int >&loopDimension) {
+    if (loopList.size() != 2 || loopList.back()->getSubLoops().empty())
+        return false;
+
+    llvm::Value * gid = NULL;
+    for (unsigned int loopIte = 0; loopIte < loopList.size(); loopIte++) {
+        if (loopDimension[loopIte] == 1)
+            gid = &*loopList[loopIte]->getHeader()->begin();
+    }
+
+    for (llvm::Loop * subLoop:loopList.back()->getSubLoops()) {
+        for (llvm::BasicBlock * block:subLoop->getBlocks()) {
+            for (BasicBlock::iterator I = block->begin(); I != block->end(); I++) {
+                AffineIndex index;
+                if (!isa < LoadInst > (&*I) || !getAffineIndex(getAccessPointer(&*I), index))
+                    continue;
+                if (index.getCoefficient(gid) == 0 && !index.isUsedInSymbol(gid))
+                    return true;
             }
+        }
+    }
+    return false;
+}
+
+bool OpenCLCBackend::isVectorCandidate(llvm::Function * kernel, std::vector < llvm::Loop * >&loopList, std::vector < unsigned int >&loopDimension) {
+    llvm::Value * gid = NULL;
+    for (unsigned int loopIte = 0; loopIte < loopList.size(); loopIte++) {
+        if (loopDimension[loopIte] == 0)
+            gid = &*loopList[loopIte]->getHeader()->begin();
+    }
+
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        AffineIndex index;
+        llvm::Value * pointer = getAccessPointer(&*I);
+        if (pointer != NULL && getAffineIndex(pointer, index) && index.getCoefficient(gid) == 1 && !index.isUsedInSymbol(gid))
+            return true;
+    }
+    return false;
+}
+
+//One variant per factor, the OpenCL runtime defines HTROP_DEVICE_<device class> when it builds the program.
+//Coarsened GPU kernels get their own variant, their work-items stride over the global size to keep the accesses coalesced.
+//Empty if the emitter cannot generate a variant.
+std::string OpenCLCBackend::generateWorkItemVariants(llvm::Function * kernel, HTROP_PB::Message_RSRC::WorkItemFactor * workItemFactor, WorkItemFactorKind kind, int boundArg,
+                                                     const ReadOnlyArgs & readOnlyArgs, const std::set < unsigned int >&pitchedArgs) {
+    std::vector < std::pair < std::string, unsigned int > >deviceFactors;
+    deviceFactors.push_back(std::pair < std::string, unsigned int >("MCPU", workItemFactor->factor_mcpu()));
+    deviceFactors.push_back(std::pair < std::string, unsigned int >("GPU", workItemFactor->factor_gpu()));
+    deviceFactors.push_back(std::pair < std::string, unsigned int >("MIC", workItemFactor->factor_mic()));
+
+    std::map < std::pair < unsigned int, bool >, std::string > variants;
+    for (auto deviceFactor:deviceFactors) {
+        bool isStrided = kind == COARSENING && deviceFactor.first == "GPU";
+        std::string & condition = variants[std::pair < unsigned int, bool > (deviceFactor.second, isStrided)];
+        condition += (condition.empty()? "" : " || ") + std::string("defined(HTROP_DEVICE_") + deviceFactor.first + ")";
+    }
+
+    std::string kernelCode = "";
+    unsigned int variantIte = 0;
+    for (auto variant:variants) {
+        OpenCLCEmitter emitter(kernel);
+        emitter.setReadOnlyArgs(readOnlyArgs);
+        emitter.setSpecializedArgs(codeGenOptions.specializeArgs);
+        emitter.setPitchedArgs(pitchedArgs);
+        emitter.setNarrowIndices(narrowIndices);
+        if (kind == VECTOR_WIDTH)
+            emitter.setVectorWidth(variant.first.first, boundArg);
+        else if (kind == REGISTER_BLOCK)
+            emitter.setRegisterBlock(workItemFactor->dimension(), variant.first.first, boundArg);
+        else
+            emitter.setCoarsening(workItemFactor->dimension(), variant.first.first, boundArg, variant.first.second);
+        std::string variantCode;
+        if (!emitter.emit(variantCode)) {
+            std::cout << "\nSERVER INFO: No work-item variant of " << kernel->getName().str() << " (" << emitter.getError() << ")";
+            std::cout.flush();
+            return "";
+        }
+
+        //The last variant is also used by runtimes that do not define the device class
+        if (variantIte == 0 && variants.size() > 1)
+            kernelCode += "#if " + variant.second + "\n";
+        else if (variantIte + 1 < variants.size())
+            kernelCode += "#elif " + variant.second + "\n";
+        else if (variants.size() > 1)
+            kernelCode += "#else\n";
+        kernelCode += variantCode;
+        variantIte++;
+    }
+    if (variants.size() > 1)
+        kernelCode += "#endif\n";
+    return kernelCode;
+}
+
+bool OpenCLCBackend::getReduction(llvm::Function * kernel, std::vector < llvm::Loop * >&loopList, std::vector < unsigned int >&loopDimension,
+                                  const HTROP_PB::ReductionHint & reductionHint, Reduction & reduction) {
+    if (reductionHint.loop_depth() == 0 || reductionHint.loop_depth() > loopList.size() || reductionHint.arg_position() >= kernel->arg_size())
+        return false;
+
+    llvm::Function::arg_iterator arg_I = kernel->arg_begin();
+    for (unsigned int pos = 0; pos < reductionHint.arg_position(); pos++)
+        arg_I++;
+    if (!arg_I->getType()->isPointerTy())
+        return false;
+
+    reduction.accumulator = &*arg_I;
+    reduction.reductionOperator = (ReductionOperator) reductionHint.reduction_operator();
+    reduction.dimension = loopDimension[reductionHint.loop_depth() - 1];
+    reduction.groupSize = codeGenOptions.reductionGroupSize;
+
+#ifdef HTROP_DEBUG
+    std::cout << "\n Reduction into " << reduction.accumulator->getName().str() << " over dimension " << reduction.dimension;
+    std::cout.flush();
+#endif
+    return true;
+}
+
+//Stencils read the same elements from several work-items. An array gets a local-memory tile if it is
+//never written and all its loads are executed in every iteration, depend on the two parallelized
+//loops with the same strides and only differ by a constant displacement of at most maxHalo iterations.
+bool OpenCLCBackend::getLocalTiling(llvm::Function * kernel, std::vector < llvm::Loop * >&loopList, std::vector < unsigned int >&loopDimension, llvm::DominatorTree * DT, LocalTiling & tiling) {
+    const int64_t maxHalo = 8;
+    const unsigned int maxLocalMemory = 16384;  //Half of the minimum local memory of an OpenCL device
+
+    if (loopList.size() != 2)
+        return false;
+
+    llvm::Value * gid[2];
+    for (unsigned int loopIte = 0; loopIte < loopList.size(); loopIte++) {
+        gid[loopDimension[loopIte]] = &*loopList[loopIte]->getHeader()->begin();
+    }
+    llvm::BasicBlock * latch = loopList.back()->getLoopLatch();
+    if (latch == NULL)
+        return false;
+
+    std::set < llvm::Value * >writtenArrays;
+    std::set < llvm::Value * >untiledArrays;
+    std::map < llvm::Value *, std::vector < std::pair < llvm::LoadInst *, int64_t > > >arrayLoads;
+    std::map < llvm::Value *, std::pair < int64_t, int64_t > >arrayStrides;
+
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        llvm::Value * pointer = getAccessPointer(&*I);
+        if (pointer == NULL)
+            continue;
+
+        AffineIndex index;
+        bool isAffine = getAffineIndex(pointer, index);
+        llvm::LoadInst * loadInst = dyn_cast < LoadInst > (&*I);
+
+        //The tiles are not written back, every store has to name its array
+        if (loadInst == NULL) {
+            if (!isAffine)
+                return false;
+            writtenArrays.insert(index.base);
+            continue;
+        }
+        if (!isAffine || !isa < Argument > (index.base))
+            continue;
+
+        llvm::Type * elementType = index.base->getType()->getPointerElementType();
+        while (elementType->isArrayTy())
+            elementType = elementType->getArrayElementType();
 
-            //insert compare and jump
-            if (phi_offset > 0) {
-                branchInst->getParent()->getNextNode();
-                llvm::BasicBlock * tmpBlock = llvm::BasicBlock::Create(oclMod->getContext(), "branch_cmp", branchInst->getParent()->getParent(), branchInst->getParent()->getNextNode());
-                assert(constInt != NULL);
-                llvm::ICmpInst * icmpInst = new llvm::ICmpInst(*tmpBlock, llvm::ICmpInst::ICMP_SLT, callInst, constInt, "icmpInst");
-                llvm::BranchInst::Create(last_block, branchInst->getSuccessor(1), icmpInst, tmpBlock);
-                branchInst->setSuccessor(1, tmpBlock);
+        std::pair < int64_t, int64_t > strides(index.getCoefficient(gid[0]), index.getCoefficient(gid[1]));
+        bool isTileable = strides.first > 0 && strides.second > 0 && index.coefficients.size() == 2 && !index.isUsedInSymbol(gid[0]) && !index.isUsedInSymbol(gid[1])
+            && loadInst->getType() == elementType && DT->dominates(loadInst->getParent(), latch);
+
+        if (isTileable && arrayStrides.count(index.base) && arrayStrides[index.base] != strides)
+            isTileable = false;
+
+        if (!isTileable) {
+            untiledArrays.insert(index.base);
+            continue;
+        }
+        arrayStrides[index.base] = strides;
+        arrayLoads[index.base].push_back(std::pair < llvm::LoadInst *, int64_t > (loadInst, index.constant));
+    }
+
+    tiling.tileSize = codeGenOptions.localTileSize;
+    unsigned int localMemory = 0;
+
+    for (llvm::Function::arg_iterator arg_I = kernel->arg_begin(); arg_I != kernel->arg_end(); arg_I++) {
+        auto arrayLoad = arrayLoads.find(&*arg_I);
+        if (arrayLoad == arrayLoads.end() || writtenArrays.count(&*arg_I) || untiledArrays.count(&*arg_I))
+            continue;
+
+        LocalTile tile;
+        tile.array = &*arg_I;
+        tile.stride[0] = arrayStrides[&*arg_I].first;
+        tile.stride[1] = arrayStrides[&*arg_I].second;
+        tile.offset = arrayLoad->second[0].second;
+        tile.minOffset = tile.offset;
+        tile.maxOffset = tile.offset;
+
+        std::set < int64_t > offsets;
+        bool isDecomposed = true;
+
+        for (auto load:arrayLoad->second) {
+            //Smallest displacement (dx, dy) with dx * stride[0] + dy * stride[1] == delta
+            int64_t delta = load.second - tile.offset;
+            bool found = false;
+            int64_t dx = 0, dy = 0;
+            for (int64_t y = -maxHalo; y <= maxHalo; y++) {
+                int64_t rest = delta - y * tile.stride[1];
+                int64_t x = rest / tile.stride[0];
+                if (rest % tile.stride[0] != 0 || x < -maxHalo || x > maxHalo)
+                    continue;
+                if (!found || std::abs(x) + std::abs(y) < std::abs(dx) + std::abs(dy)) {
+                    dx = x;
+                    dy = y;
+                    found = true;
+                }
             }
+            if (!found) {
+                isDecomposed = false;
+                break;
+            }
+
+            tile.loads[load.first] = std::pair < int64_t, int64_t > (dx, dy);
+            tile.haloMin[0] = std::min(tile.haloMin[0], dx);
+            tile.haloMax[0] = std::max(tile.haloMax[0], dx);
+            tile.haloMin[1] = std::min(tile.haloMin[1], dy);
+            tile.haloMax[1] = std::max(tile.haloMax[1], dy);
+            tile.minOffset = std::min(tile.minOffset, load.second);
+            tile.maxOffset = std::max(tile.maxOffset, load.second);
+            offsets.insert(load.second);
+        }
+
+        //Without a neighbourhood there is no reuse between the work-items
+        if (!isDecomposed || offsets.size() < 2)
+            continue;
+
+        unsigned int elementSize = std::max(1u, (unsigned int)arrayLoad->second[0].first->getType()->getPrimitiveSizeInBits() / 8);
+        unsigned int tileBytes = tile.getWidth(tiling.tileSize) * tile.getHeight(tiling.tileSize) * elementSize;
+        if (localMemory + tileBytes > maxLocalMemory)
+            continue;
+        localMemory += tileBytes;
+
+#ifdef HTROP_DEBUG
+        std::cout << "\n Local tile for " << arg_I->getName().str() << ": " << tile.loads.size() << " loads, halo x [" << tile.haloMin[0] << ", " << tile.haloMax[0] << "]";
+        std::cout << " y [" << tile.haloMin[1] << ", " << tile.haloMax[1] << "]";
+        std::cout.flush();
+#endif
+        tiling.tiles.push_back(tile);
+    }
+
+    return tiling.isEnabled();
+}
 
-            //go to the latch and replace all the contents with a branch to the next block
-            bb = loop->getLoopLatch();
+//Small read-only arrays of a known size go to constant memory, at most the minimum constant buffer of an OpenCL device.
+//The other float and char arrays become images unless they are loaded through a local-memory tile.
+void OpenCLCBackend::getReadOnlyArgs(llvm::Function * kernel, const HTROP_PB::Message_RCRS::ScopInfo & scopInfo, LocalTiling & tiling, ReadOnlyArgs & readOnlyArgs) {
+    const uint64_t maxConstantSize = 65536;
+    const unsigned int maxConstantArgs = 8;
+
+    for (const auto & readOnlyArg:scopInfo.read_only_args()) {
+        if (readOnlyArg.arg_position() >= kernel->arg_size())
+            continue;
+        llvm::Argument * arg = getArgByPos(kernel, readOnlyArg.arg_position());
+        if (!arg->getType()->isPointerTy())
+            continue;
+        llvm::Type * elementType = arg->getType()->getPointerElementType();
+        while (elementType->isArrayTy())
+            elementType = elementType->getArrayElementType();
+
+        uint64_t size = readOnlyArg.num_elements() * oclMod->getDataLayout().getTypeAllocSize(elementType);
+        if (readOnlyArg.num_elements() > 0 && readOnlyArgs.constantArgs.size() < maxConstantArgs && readOnlyArgs.constantSize + size <= maxConstantSize) {
+            readOnlyArgs.constantArgs.insert(readOnlyArg.arg_position());
+            readOnlyArgs.constantSize += size;
+            continue;
+        }
 
-            //Find the corresponding increment instruction that uses the PHINode
-            BasicBlock::iterator tmp_I = bb->end();
-            llvm::Instruction * instIter = dyn_cast < Instruction > (--tmp_I);
+        bool isTiled = false;
+        for (auto & tile:tiling.tiles)
+            isTiled |= tile.array == arg;
+        if (!isTiled && (elementType->isFloatTy() || elementType->isIntegerTy(8)))
+            readOnlyArgs.imageArgs[readOnlyArg.arg_position()] = getRowWidthArg(kernel, arg);
+    }
 
-            while (!isa < AddOperator > (instIter)) {
-                llvm::Instruction * inst = instIter;
-                instIter = instIter->getPrevNode();
-                inst->dropAllReferences();
-                inst->eraseFromParent();
+#ifdef HTROP_DEBUG
+    std::cout << "\n Read-only arrays: " << readOnlyArgs.constantArgs.size() << " constant (" << readOnlyArgs.constantSize << " bytes), " << readOnlyArgs.imageArgs.size() << " images";
+    std::cout.flush();
+#endif
+}
+
+//The argument multiplying the row in all loads of the array (y * width + x), the image then keeps the rows of the array
+int OpenCLCBackend::getRowWidthArg(llvm::Function * kernel, llvm::Argument * array) {
+    int rowWidthArg = -1;
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        AffineIndex index;
+        if (!isa < LoadInst > (&*I) || !getAffineIndex(getAccessPointer(&*I), index) || index.base != array)
+            continue;
+
+        int loadWidthArg = -1;
+        for (auto coefficient:index.coefficients) {
+            auto mulInst = dyn_cast < BinaryOperator > (coefficient.first);
+            if (mulInst == NULL || mulInst->getOpcode() != Instruction::Mul)
+                continue;
+            for (unsigned int i = 0; i < 2; i++) {
+                llvm::Value * operand = mulInst->getOperand(i);
+                if (auto castInst = dyn_cast < CastInst > (operand))
+                    operand = castInst->getOperand(0);
+                if (isa < Argument > (operand) && operand->getType()->isIntegerTy())
+                    loadWidthArg = cast < Argument > (operand)->getArgNo();
             }
+        }
+        if (loadWidthArg < 0 || (rowWidthArg >= 0 && loadWidthArg != rowWidthArg))
+            return -1;
+        rowWidthArg = loadWidthArg;
+    }
+    return rowWidthArg;
+}
 
-            //Check if the instruction is the same as the Phi value
-            for (unsigned int phiValIter = 0; phiValIter < phi->getNumIncomingValues(); phiValIter++) {
-                if (phi->getIncomingValue(phiValIter) == instIter) {
-                    phi->removeIncomingValue(phiValIter);
-                    instIter->dropAllReferences();
-                    instIter->eraseFromParent();
-                    break;
+void OpenCLCBackend::getPitchedArgs(llvm::Function * kernel, const LocalTiling & tiling, const Reduction & reduction, const ReadOnlyArgs & readOnlyArgs,
+                                    std::set < unsigned int >&pitchedArgs) {
+    for (llvm::Function::arg_iterator arg_I = kernel->arg_begin(); arg_I != kernel->arg_end(); arg_I++) {
+        llvm::Argument * arg = &*arg_I;
+        unsigned int argPos = arg->getArgNo();
+        if (!arg->getType()->isPointerTy() || !arg->getType()->getPointerElementType()->isArrayTy())
+            continue;
+        llvm::Type * elementType = arg->getType()->getPointerElementType()->getArrayElementType();
+        if (!elementType->isIntegerTy() && !elementType->isFloatingPointTy())
+            continue;
+        if (reduction.accumulator == arg || readOnlyArgs.constantArgs.count(argPos) || readOnlyArgs.imageArgs.count(argPos))
+            continue;
+        bool isTiled = false;
+        for (auto & tile:tiling.tiles)
+            isTiled |= tile.array == arg;
+        if (isTiled)
+            continue;
+
+        //Every pointer derived from the array is a getelementptr that is loaded from or stored to
+        bool onlyElementAccesses = true;
+        std::vector < llvm::Value * >pointers(1, arg);
+        while (onlyElementAccesses && !pointers.empty()) {
+            llvm::Value * pointer = pointers.back();
+            pointers.pop_back();
+            for (auto user:pointer->users()) {
+                if (auto gepInst = dyn_cast < GetElementPtrInst > (user)) {
+                    onlyElementAccesses &= gepInst->getPointerOperand() == pointer;
+                    pointers.push_back(gepInst);
                 }
+                else if (auto storeInst = dyn_cast < StoreInst > (user))
+                    onlyElementAccesses &= storeInst->getPointerOperand() == pointer;
+                else
+                    onlyElementAccesses &= isa < LoadInst > (user);
             }
-            llvm::BranchInst::Create(bb->getNextNode(), bb);
+        }
+        if (onlyElementAccesses)
+            pitchedArgs.insert(argPos);
+    }
+
+#ifdef HTROP_DEBUG
+    std::cout << "\n Pitched arrays: " << pitchedArgs.size();
+    std::cout.flush();
+#endif
+}
+
+//Two side-effect free computations of the same value, e.g. the index of a store in the producer and of a load in the
+//consumer of a fused kernel. Loads and phis are only equal to themselves.
+static bool isSameValue(llvm::Value * a, llvm::Value * b) {
+    if (a == b)
+        return true;
+    llvm::Instruction * instA = dyn_cast < Instruction > (a);
+    llvm::Instruction * instB = dyn_cast < Instruction > (b);
+    if (instA == NULL || instB == NULL || isa < PHINode > (instA) || instA->mayReadOrWriteMemory() || !instA->isSameOperationAs(instB))
+        return false;
+    for (unsigned int i = 0; i < instA->getNumOperands(); i++) {
+        if (!isSameValue(instA->getOperand(i), instB->getOperand(i)))
+            return false;
+    }
+    return true;
+}
+
+static bool isSameIndex(const AffineIndex & a, const AffineIndex & b) {
+    if (a.base != b.base || a.constant != b.constant || a.coefficients.size() != b.coefficients.size())
+        return false;
+    for (auto coefficient:a.coefficients) {
+        bool found = false;
+        for (auto other:b.coefficients) {
+            if (other.second == coefficient.second && isSameValue(coefficient.first, other.first))
+                found = true;
+        }
+        if (!found)
+            return false;
+    }
+    return true;
+}
+
+//Arrays read and written by the scop of callInst, as argument positions of the caller. False if an access
+//cannot be attributed to an argument of the caller.
+static bool getCallAccesses(llvm::CallInst * callInst, std::set < unsigned int >&reads, std::set < unsigned int >&writes) {
+    llvm::Function * callee = callInst->getCalledFunction();
+    for (inst_iterator I = inst_begin(callee), E = inst_end(callee); I != E; ++I) {
+        llvm::Value * pointer = getAccessPointer(&*I);
+        if (pointer == NULL) {
+            if (I->mayReadOrWriteMemory())
+                return false;
+            continue;
+        }
+
+        //Private arrays of the work-item
+        AffineIndex index;
+        if (!getAffineIndex(pointer, index))
+            return false;
+        if (isa < AllocaInst > (index.base))
+            continue;
+        if (!isa < Argument > (index.base))
+            return false;
+
+        llvm::Argument * arg = dyn_cast < Argument > (callInst->getArgOperand(cast < Argument > (index.base)->getArgNo()));
+        if (arg == NULL)
+            return false;
+        if (isa < StoreInst > (&*I))
+            writes.insert(arg->getArgNo());
+        else
+            reads.insert(arg->getArgNo());
+    }
+    return true;
+}
 
-            //replace all instance of the phi with the call (NOTE: unsafe replace)
-            while (!phi->use_empty()) {
-                auto & U = *phi->use_begin();
-                //U.set(callInst);
-                U.set(expandednCallInst);
+//Branch conditions that lead from the entry block to block: (condition, successor taken). False if block is reached
+//on both edges of a branch or the path runs through a loop.
+static bool getPathConditions(llvm::BasicBlock * entry, llvm::BasicBlock * block, std::vector < std::pair < llvm::Value *, unsigned int > >&conditions) {
+    std::set < llvm::BasicBlock * >visited;
+    llvm::BasicBlock * current = entry;
+    while (current != block) {
+        llvm::BranchInst * branchInst = dyn_cast < BranchInst > (current->getTerminator());
+        if (branchInst == NULL || !visited.insert(current).second)
+            return false;
+        if (!branchInst->isConditional()) {
+            current = branchInst->getSuccessor(0);
+            continue;
+        }
+
+        bool reachable[2];
+        for (unsigned int succ = 0; succ < 2; succ++)
+            reachable[succ] = llvm::isPotentiallyReachable(branchInst->getSuccessor(succ), block);
+        if (reachable[0] == reachable[1])
+            return false;
+        unsigned int taken = reachable[0] ? 0 : 1;
+        conditions.push_back(std::pair < llvm::Value *, unsigned int >(branchInst->getCondition(), taken));
+        current = branchInst->getSuccessor(taken);
+    }
+    return true;
+}
+
+bool OpenCLCBackend::fuseKernels(llvm::Function * kernel, const HTROP_PB::Message_RCRS::ScopInfo & scopInfo, std::vector < std::pair < int, int > >&workgroupArgs,
+                                 std::vector < int >&workgroupLoops) {
+    //The fused scop of the client only calls the producer and then the consumer
+    std::vector < llvm::CallInst * >calls;
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        if (llvm::CallInst * callInst = dyn_cast < CallInst > (&*I))
+            calls.push_back(callInst);
+    }
+    if (calls.size() != 2)
+        return false;
+    for (int callIte = 0; callIte < 2; callIte++) {
+        if (calls[callIte]->getCalledFunction() == NULL || calls[callIte]->getCalledFunction()->getName() != scopInfo.fused_functions(callIte))
+            return false;
+    }
+
+    //Map both loop nests with the dimensions of the producer. The loops bounded by a trip count of the client are
+    //not mapped, the guards of the argument bounds tell whether a work-item of the consumer has a producer.
+    std::vector < unsigned int >loopDimension;
+    std::vector < std::vector < std::pair < int, int > > >callWorkgroupArgs(2);
+    for (int callIte = 0; callIte < 2; callIte++) {
+        llvm::Function * callee = calls[callIte]->getCalledFunction();
+        llvm::DominatorTree DT;
+        DT.recalculate(*callee);
+        llvm::LoopInfoBase < llvm::BasicBlock, llvm::Loop > KLoop;
+        KLoop.analyze(DT);
+
+        std::vector < Loop * >loopList;
+        std::vector < std::pair < int, int > >loopBounds;
+        if (!getParallelLoops(&KLoop, scopInfo.max_codegen_loop_depth(), 0, loopList, loopBounds))
+            return false;
+        if (callIte == 0)
+            loopDimension = getLoopDimensions(callee, loopList);
+        if (loopList.size() != loopDimension.size())
+            return false;
+
+        callWorkgroupArgs[callIte].resize(loopList.size());
+        workgroupLoops.resize(loopList.size());
+        for (unsigned int loopIte = 0; loopIte < loopList.size(); loopIte++) {
+            llvm::Argument * boundArg = dyn_cast < Argument > (calls[callIte]->getArgOperand(loopBounds[loopIte].first));
+            if (boundArg == NULL)
+                return false;
+            callWorkgroupArgs[callIte][loopDimension[loopIte]] = std::pair < int, int >(boundArg->getArgNo(), loopBounds[loopIte].second);
+            if (callIte == 0)
+                workgroupLoops[loopDimension[loopIte]] = loopIte;
+        }
+
+        if (!mapLoops(loopList, loopDimension, 0, &callee->back()))
+            return false;
+    }
+    if (callWorkgroupArgs[0] != callWorkgroupArgs[1])
+        return false;
+    workgroupArgs = callWorkgroupArgs[0];
+
+    //The work-items of the fused kernel must not depend on each other: the consumer may not write what the producer accesses,
+    //and it may only read the arrays written by the producer (intermediates) at the element of its own work-item
+    std::set < unsigned int >reads[2], writes[2];
+    for (int callIte = 0; callIte < 2; callIte++) {
+        if (!getCallAccesses(calls[callIte], reads[callIte], writes[callIte]))
+            return false;
+    }
+    std::set < unsigned int >intermediates;
+    for (unsigned int argPos:writes[1]) {
+        if (reads[0].count(argPos) || writes[0].count(argPos))
+            return false;
+    }
+    for (unsigned int argPos:writes[0]) {
+        if (!reads[1].count(argPos))
+            continue;
+        if (reads[0].count(argPos))
+            return false;
+        intermediates.insert(argPos);
+    }
+
+    //The producer returns into the block of the consumer call
+    llvm::BasicBlock * producerEntry = &kernel->getEntryBlock();
+    llvm::InlineFunctionInfo producerIFI;
+    if (!llvm::InlineFunction(calls[0], producerIFI))
+        return false;
+    llvm::BasicBlock * consumerEntry = calls[1]->getParent();
+    llvm::InlineFunctionInfo consumerIFI;
+    if (!llvm::InlineFunction(calls[1], consumerIFI))
+        return false;
+
+    //Per intermediate: the single store of the producer and the loads of the consumer
+    std::map < unsigned int, llvm::StoreInst * >producerStores;
+    std::map < unsigned int, std::vector < llvm::LoadInst * > >consumerLoads;
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        AffineIndex index;
+        llvm::Value * pointer = getAccessPointer(&*I);
+        if (pointer == NULL || !getAffineIndex(pointer, index) || !isa < Argument > (index.base) || !intermediates.count(cast < Argument > (index.base)->getArgNo()))
+            continue;
+        unsigned int argPos = cast < Argument > (index.base)->getArgNo();
+        if (llvm::StoreInst * storeInst = dyn_cast < StoreInst > (&*I)) {
+            if (producerStores.count(argPos))
+                return false;
+            producerStores[argPos] = storeInst;
+        }
+        else {
+            consumerLoads[argPos].push_back(cast < LoadInst > (&*I));
+        }
+    }
+
+    //A load of the consumer reads the element the store of its work-item wrote: same index, and the branch conditions that
+    //lead to the store (guards of the loop mapping, loop entry checks) also lead to the load
+    for (unsigned int argPos:intermediates) {
+        llvm::StoreInst * storeInst = producerStores[argPos];
+        AffineIndex storeIndex;
+        getAffineIndex(storeInst->getPointerOperand(), storeIndex);
+        std::vector < std::pair < llvm::Value *, unsigned int > >storeConditions;
+        if (!getPathConditions(producerEntry, storeInst->getParent(), storeConditions))
+            return false;
+
+        for (llvm::LoadInst * loadInst:consumerLoads[argPos]) {
+            AffineIndex loadIndex;
+            getAffineIndex(loadInst->getPointerOperand(), loadIndex);
+            if (loadInst->getType() != storeInst->getValueOperand()->getType() || !isSameIndex(storeIndex, loadIndex))
+                return false;
+
+            std::vector < std::pair < llvm::Value *, unsigned int > >loadConditions;
+            if (!getPathConditions(consumerEntry, loadInst->getParent(), loadConditions))
+                return false;
+            for (auto storeCondition:storeConditions) {
+                auto condition = std::find_if(loadConditions.begin(), loadConditions.end(), [&](std::pair < llvm::Value *, unsigned int >loadCondition) {
+                                              return loadCondition.second == storeCondition.second && isSameValue(loadCondition.first, storeCondition.first);
+                                              });
+                if (condition == loadConditions.end())
+                    return false;
             }
-            phi->dropAllReferences();
-            phi->eraseFromParent();
         }
+    }
 
-        std::string kernelCode = generateAxtorCodeForKernel(kernelFunction);
+    //The consumer reads the stored value, it is undefined on the paths of the work-items that skip the store
+    std::set < unsigned int >tmpArgs(scopInfo.fused_tmp_args().begin(), scopInfo.fused_tmp_args().end());
+    for (unsigned int argPos:intermediates) {
+        llvm::StoreInst * storeInst = producerStores[argPos];
+        llvm::Value * storedValue = storeInst->getValueOperand();
+
+        llvm::SSAUpdater forwarded;
+        forwarded.Initialize(storedValue->getType(), "fused");
+        if (storeInst->getParent() != producerEntry)
+            forwarded.AddAvailableValue(producerEntry, UndefValue::get(storedValue->getType()));
+        forwarded.AddAvailableValue(storeInst->getParent(), storedValue);
+
+        for (llvm::LoadInst * loadInst:consumerLoads[argPos]) {
+            loadInst->replaceAllUsesWith(forwarded.GetValueInMiddleOfBlock(loadInst->getParent()));
+            loadInst->eraseFromParent();
+        }
 
-        //CleanUp; remove all other functions
-        kernelCode = cleanKernel(kernelCode, kernelName);
+        //Only the fused kernel uses the array, the store is dead
+        if (tmpArgs.count(argPos))
+            storeInst->eraseFromParent();
 
-        //Add restrict keyword
-        kernelCode = addRestrict(kernelCode);
+#ifdef HTROP_DEBUG
+        std::cout << "\n Fused kernel " << kernel->getName().str() << " forwards argument " << argPos << " to " << consumerLoads[argPos].size() << " loads";
+        std::cout.flush();
+#endif
+    }
 
-        outStream << "\n\n" << kernelCode;
+    return true;
+}
+
+//Emit the kernel text with the selected emitter, the direct emitter falls back to Axtor for unsupported kernels.
+//Empty for unsupported kernels with scatter updates, they need the atomics of the direct emitter.
+//The tiling, the reduction, the read-only arrays, the pitched arrays and the work-item factor are cleared if the returned kernel does not use them.
+std::string OpenCLCBackend::generateKernelCode(llvm::Function * &kernel, std::string kernelName, std::ofstream & directOutStream, LocalTiling & tiling, Reduction & reduction,
+                                               ReadOnlyArgs & readOnlyArgs, std::set < unsigned int >&pitchedArgs, HTROP_PB::Message_RSRC::WorkItemFactor * workItemFactor,
+                                               WorkItemFactorKind workItemFactorKind, int factorBoundArg) {
+    std::string kernelCode;
+
+    if (codeGenOptions.oclEmitter != "axtor") {
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        //Devices without image support read the image arrays from buffers
+        ReadOnlyArgs bufferArgs = readOnlyArgs;
+        bufferArgs.imageArgs.clear();
+
+        OpenCLCEmitter emitter(kernel);
+        emitter.setSpecializedArgs(codeGenOptions.specializeArgs);
+        emitter.setLocalTiling(tiling);
+        emitter.setReduction(reduction);
+        emitter.setReadOnlyArgs(bufferArgs);
+        emitter.setPitchedArgs(pitchedArgs);
+        emitter.setNarrowIndices(narrowIndices);
+        emitter.setScatter(scatter);
+        bool emitted = emitter.emit(kernelCode);
+
+        if (emitted && workItemFactor->has_dimension()) {
+            std::string variantCode = generateWorkItemVariants(kernel, workItemFactor, workItemFactorKind, factorBoundArg, bufferArgs, pitchedArgs);
+            if (variantCode.empty())
+                workItemFactor->Clear();
+            else
+                kernelCode = variantCode;
+        }
+
+        //The runtime defines HTROP_IMAGE_SUPPORT for devices with images
+        if (emitted && !readOnlyArgs.imageArgs.empty()) {
+            OpenCLCEmitter imageEmitter(kernel);
+            imageEmitter.setSpecializedArgs(codeGenOptions.specializeArgs);
+            imageEmitter.setLocalTiling(tiling);
+            imageEmitter.setReduction(reduction);
+            imageEmitter.setReadOnlyArgs(readOnlyArgs);
+            imageEmitter.setPitchedArgs(pitchedArgs);
+            imageEmitter.setNarrowIndices(narrowIndices);
+            imageEmitter.setScatter(scatter);
+            std::string imageCode;
+            if (!imageEmitter.emit(imageCode)) {
+                std::cout << "\nSERVER INFO: No image variant of " << kernelName << " (" << imageEmitter.getError() << ")";
+                std::cout.flush();
+                imageCode = "";
+            }
+            else if (workItemFactor->has_dimension()) {
+                imageCode = generateWorkItemVariants(kernel, workItemFactor, workItemFactorKind, factorBoundArg, readOnlyArgs, pitchedArgs);
+            }
+
+            if (imageCode.empty())
+                readOnlyArgs.imageArgs.clear();
+            else
+                kernelCode = "#ifdef HTROP_IMAGE_SUPPORT\n" + imageCode + "#else\n" + kernelCode + "#endif\n";
+        }
+        long directTime = std::chrono::duration_cast < std::chrono::microseconds > (std::chrono::steady_clock::now() - startTime).count();
+
+        //Axtor would emit the updates without atomics, the client keeps the host code
+        if (!emitted && scatter.isEnabled()) {
+            std::cout << "\nSERVER INFO: Cannot emit the scatter updates of " << kernelName << " (" << emitter.getError() << "), no kernel";
+            std::cout.flush();
+            return "";
+        }
+
+        if (!emitted) {
+            std::cout << "\nSERVER INFO: Direct OpenCL emitter skipped " << kernelName << " (" << emitter.getError() << "), using Axtor";
+            std::cout.flush();
+            kernelCode = "";
+        }
+        else if (codeGenOptions.oclEmitter == "direct") {
+            return kernelCode;
+        }
+        else {
+            directOutStream << "\n\n" << kernelCode;
+
+            //The Axtor path modifies the kernel function, it runs after the direct emitter
+            startTime = std::chrono::steady_clock::now();
+            tiling.tiles.clear();
+            reduction = Reduction();
+            readOnlyArgs = ReadOnlyArgs();
+            pitchedArgs.clear();
+            workItemFactor->Clear();
+            std::string axtorCode = addRestrict(cleanKernel(generateAxtorCodeForKernel(kernel), kernelName));
+            long axtorTime = std::chrono::duration_cast < std::chrono::microseconds > (std::chrono::steady_clock::now() - startTime).count();
+
+            std::cout << "\nSERVER INFO: Kernel " << kernelName << " direct emitter " << directTime << " us, " << kernelCode.size() << " bytes; Axtor " << axtorTime << " us, " << axtorCode.size() << " bytes";
+            std::cout.flush();
+            return axtorCode;
+        }
     }
 
-    //Save the code to file 
-    outStream.close();
+    tiling.tiles.clear();
+    reduction = Reduction();
+    readOnlyArgs = ReadOnlyArgs();
+    pitchedArgs.clear();
+    workItemFactor->Clear();
+    kernelCode = generateAxtorCodeForKernel(kernel);
 
-    delete logOut;
+    //CleanUp; remove all other functions
+    kernelCode = cleanKernel(kernelCode, kernelName);
+
+    //Add restrict keyword
+    kernelCode = addRestrict(kernelCode);
+
+    return kernelCode;
 }
 
 //Generate AXTOR code
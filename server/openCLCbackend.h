@@ -24,15 +24,127 @@
 #define OPENCLCBACKEND_H
 
 #include "../common/hds.pb.h"
+#include "openCLCemitter.h"
 #include "llvm/IR/Module.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Dominators.h"
+#include "llvm/Analysis/LoopInfo.h"
 
 #include <string>
+#include <fstream>
+#include <vector>
+
+//Settings of the OpenCL code generation, they are part of the cache key
+struct CodeGenOptions {
+    //Kernel text generation: "axtor", "direct" (OpenCLCEmitter) or "compare" (Axtor kernels, the direct ones are written next to them)
+    std::string oclEmitter = "axtor";
+    //Work-group edge of the local-memory tiling of 2D stencils (direct emitter only), 0 disables the tiling
+    unsigned int localTileSize = 0;
+    //Register blocking factors of dense linear-algebra nests per device class (MCPU, GPU, MIC), empty disables the blocking
+     std::vector < unsigned int >registerBlock;
+    //Vector width (vloadN/vstoreN) of unit-stride accesses per device class (MCPU, GPU, MIC), empty disables the vectors
+     std::vector < unsigned int >vectorWidth;
+    //Iterations per work-item in the outermost dimension per device class (MCPU, GPU, MIC), empty disables the coarsening
+     std::vector < unsigned int >coarsening;
+    //Work-group size of parallel reductions found by the client (direct emitter only), 0 keeps them sequential per work-item
+    unsigned int reductionGroupSize = 0;
+    //Small IN arrays in __constant memory, float and char IN arrays as images on devices with image support (direct emitter only)
+    bool readOnlyMemory = false;
+    //Alternative kernels per scop (parallel depth, coarsening, tiling), the runtime times them and keeps the fastest per device
+    bool kernelVariants = false;
+    //Coarsening factors (MCPU, GPU, MIC) and tile edge of the variants of kernels without coarsening or tiles
+     std::vector < unsigned int >variantCoarsening = { 8, 2, 8 };
+    unsigned int variantTileSize = 16;
+    //Calls with fewer work-items run a version without work-item factors and tiles (direct emitter only), 0 disables the version
+    unsigned int smallSizeThreshold = 0;
+    //Integer arguments can be replaced by the values of a specialized program of the runtime (direct emitter only)
+    bool specializeArgs = false;
+    //Arrays of rows with a constant width in buffers whose rows start at the base address alignment of the device (direct emitter only)
+    bool pitchedBuffers = false;
+    //Version of the scop kernel with int instead of long index arithmetic for calls whose sizes fit (direct emitter only)
+    bool index32Versions = false;
+    //Wavefront kernel for 2D nests whose dependences the client found in both loops, the runtime launches the waves in order
+    bool wavefront = false;
+    //Sibling loops of imperfect nests in a sequence of kernels, one per loop chain
+    bool loopDistribution = false;
+    //Interior kernel without the tests of the work-item position against the bounds, the scop kernel runs the border work-items
+    bool indexSetSplitting = false;
+    //Scatter updates into a copy per work-group in local memory for arrays of up to scatterLocalBins elements, 0 for global atomics only
+    unsigned int scatterLocalBins = 0;
+
+    //Empty for the defaults, so that existing cache entries stay valid. Every option has to be added here.
+    std::string getFingerprint() const {
+        const CodeGenOptions defaults = CodeGenOptions();
+        std::string fingerprint = "";
+        addToFingerprint(fingerprint, "emitter", oclEmitter, defaults.oclEmitter);
+        addToFingerprint(fingerprint, "tile", localTileSize, defaults.localTileSize);
+        addToFingerprint(fingerprint, "block", registerBlock, defaults.registerBlock);
+        addToFingerprint(fingerprint, "vector", vectorWidth, defaults.vectorWidth);
+        addToFingerprint(fingerprint, "coarsen", coarsening, defaults.coarsening);
+        addToFingerprint(fingerprint, "reduce", reductionGroupSize, defaults.reductionGroupSize);
+        addToFingerprint(fingerprint, "readonly", readOnlyMemory, defaults.readOnlyMemory);
+        addToFingerprint(fingerprint, "variants", kernelVariants, defaults.kernelVariants);
+        addToFingerprint(fingerprint, "variant-coarsen", variantCoarsening, defaults.variantCoarsening);
+        addToFingerprint(fingerprint, "variant-tile", variantTileSize, defaults.variantTileSize);
+        addToFingerprint(fingerprint, "small", smallSizeThreshold, defaults.smallSizeThreshold);
+        addToFingerprint(fingerprint, "specialize", specializeArgs, defaults.specializeArgs);
+        addToFingerprint(fingerprint, "pitched", pitchedBuffers, defaults.pitchedBuffers);
+        addToFingerprint(fingerprint, "index32", index32Versions, defaults.index32Versions);
+        addToFingerprint(fingerprint, "wavefront", wavefront, defaults.wavefront);
+        addToFingerprint(fingerprint, "distribute", loopDistribution, defaults.loopDistribution);
+        addToFingerprint(fingerprint, "split", indexSetSplitting, defaults.indexSetSplitting);
+        addToFingerprint(fingerprint, "scatter-local", scatterLocalBins, defaults.scatterLocalBins);
+        return fingerprint;
+    }
+
+ private:
+    //name=value for an option that differs from its default, a switched on flag is only its name
+    template < typename T > static void addToFingerprint(std::string & fingerprint, const char *name, const T & value, const T & defaultValue) {
+        if (value == defaultValue)
+            return;
+        std::string valueString = toFingerprint(value);
+        fingerprint += (fingerprint.empty()? "" : ";") + std::string(name) + (valueString.empty()? "" : "=" + valueString);
+    }
+    static std::string toFingerprint(const std::string & value) {
+        return value;
+    }
+    static std::string toFingerprint(unsigned int value) {
+        return std::to_string(value);
+    }
+    static std::string toFingerprint(bool value) {
+        return value ? "" : "0";
+    }
+    static std::string toFingerprint(const std::vector < unsigned int >&values) {
+        std::string valueString = "";
+        for (unsigned int i = 0; i < values.size(); i++)
+            valueString += (i > 0 ? "," : "") + std::to_string(values[i]);
+        return valueString;
+    }
+};
+
+//A parallelized loop i = start; i pred bound; i += step that is replaced by get_global_id. Loops i < n with an argument n,
+//a constant start >= 0 and step 1 keep i = get_global_id and n as global size. Other affine loops use
+//i = start + get_global_id * step, the client evaluates the trip count from the loop bounds of its scop analysis.
+struct LoopMapping {
+    llvm::PHINode * phi = NULL;
+    llvm::BinaryOperator * increment = NULL;
+    llvm::ICmpInst * exitCmp = NULL;
+    llvm::BranchInst * latchBranch = NULL;
+    unsigned int incrementOperand = 0;  //Operand of exitCmp that is the increment (or a cast of it)
+    llvm::Value * start = NULL;
+    int64_t step = 1;
+    int boundArg = -1;          //Kernel argument holding the global size, -1 for the trip count of the scop analysis
+    llvm::CmpInst::Predicate guardPredicate = llvm::CmpInst::ICMP_SLT;  //Work-item iteration against the bound, true inside the iteration space
+};
+
+//How a work-item handles several iterations of a dimension (ScopFunctionOCLInfo register_block, vector_width, coarsening)
+enum WorkItemFactorKind { NO_WORK_ITEM_FACTOR, REGISTER_BLOCK, VECTOR_WIDTH, COARSENING };
 
 class OpenCLCBackend {
 
  public:
     //              OpenCLCBackend(llvm::Module *&oclMod);
-    OpenCLCBackend(llvm::Module * &oclModArg, HTROP_PB::Message_RCRS * codeGenMsgFromClient, HTROP_PB::Message_RSRC * codeGenMsgFromServer, std::string oclFileOnDisk);
+    OpenCLCBackend(llvm::Module * &oclModArg, HTROP_PB::Message_RCRS * codeGenMsgFromClient, HTROP_PB::Message_RSRC * codeGenMsgFromServer, std::string oclFileOnDisk, CodeGenOptions codeGenOptions);
 
     void generateOpenCLCode(unsigned int unrollFactorOuter, unsigned int unrollFactorInner);
     void generateOpenCLCode();
@@ -43,6 +155,102 @@ class OpenCLCBackend {
      std::string openCLCFile;
      std::string logFile;
      std::string generateAxtorCodeForKernel(llvm::Function * &kernel);
+     std::string generateKernelCode(llvm::Function * &kernel, std::string kernelName, std::ofstream & directOutStream, LocalTiling & tiling, Reduction & reduction,
+                                    ReadOnlyArgs & readOnlyArgs, std::set < unsigned int >&pitchedArgs, HTROP_PB::Message_RSRC::WorkItemFactor * workItemFactor,
+                                    WorkItemFactorKind workItemFactorKind, int factorBoundArg);
+     std::string generateWorkItemVariants(llvm::Function * kernel, HTROP_PB::Message_RSRC::WorkItemFactor * workItemFactor, WorkItemFactorKind kind, int boundArg,
+                                          const ReadOnlyArgs & readOnlyArgs, const std::set < unsigned int >&pitchedArgs);
+
+     CodeGenOptions codeGenOptions;
+
+    //The kernel of a scop with its loops parallelized up to maxDepth, named kernelName in the OpenCL code. Empty if the loops cannot be mapped.
+     std::string generateScopKernel(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelName, unsigned int max_codegen_loop_depth,
+                                    HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream);
+    //Alternative kernels of a scop for the autotuning of the runtime, they are added to the variants of scopFunctionInfo
+     std::string generateKernelVariants(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelCode,
+                                        HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream);
+    //Kernel versions for ranges of work-items, they are added to the size versions of scopFunctionInfo
+     std::string generateSizeVersions(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelCode,
+                                      HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream);
+    //Size version with 32-bit index arithmetic, the scop kernel stays the 64-bit fallback
+     std::string generateIndex32Version(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelCode,
+                                        HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream);
+    //Kernel of one wave t = skew * i + j of a 2D nest, empty if the loops cannot be mapped. Dimension 0 is the outer loop,
+    //the global id of dimension 1 is the wave.
+     std::string generateWavefrontKernel(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelName,
+                                         HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream);
+    //The inner loop mapped to dimension 1 runs iteration get_global_id(1) - skew * get_global_id(0)
+    void skewWavefront(llvm::Function * kernel, unsigned int skew, llvm::BasicBlock * lastBlock);
+    //Kernel per loop chain of an imperfect nest, the first one is the scop kernel and the others follow in its distributed_kernels.
+    //Empty if a chain has no kernel.
+     std::string generateDistributedKernels(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelName, unsigned int numLoopChains,
+                                            HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo, std::ofstream & directOutStream);
+    //The paths from a top-level loop to maxDepth or a loop without sub loops, sibling loops in program order. False if a
+    //sibling cannot be skipped (no preheader, several exits, phis in the exit) or memory is written between the siblings.
+    bool getLoopChains(llvm::Function * kernel, llvm::DominatorTree & DT, llvm::LoopInfoBase < llvm::BasicBlock, llvm::Loop > &KLoop, unsigned int maxDepth,
+                       std::vector < std::vector < llvm::Loop * > >&chains);
+    //Skip the loops of the other chains, returns the number of outer loops the chains share
+    unsigned int keepLoopChain(llvm::Function * kernel, unsigned int maxDepth, unsigned int chain);
+    //Loop chain generateScopKernel keeps, -1 for the whole nest
+    int distributedChain = -1;
+    //Interior and border kernel of the scop, both without work-item factors, tiles or special memory
+     std::string generateSplitKernels(const HTROP_PB::Message_RCRS::ScopInfo & clientKernelInfo, std::string kernelName, HTROP_PB::Message_RSRC::ScopFunctionOCLInfo * scopFunctionInfo,
+                                      std::ofstream & directOutStream);
+    //Replace the compares of the work-item position against the bounds of its dimension (boundArgs, -1 if not an argument) by their value
+    //in the interior. borderLow and borderHigh get the work-items of each dimension for which they differ, false if there is no compare.
+    bool foldBorderConditions(llvm::Function * kernel, const std::vector < int >&boundArgs, std::vector < unsigned int >&borderLow, std::vector < unsigned int >&borderHigh);
+    //generateScopKernel folds the border tests, it returns no code without them
+    bool splitInterior = false;
+    //The 64-bit integers of the kernel are only indices: no 64-bit loads, stores, calls, logical shifts or large constants
+    bool isIndex32Candidate(llvm::Function * kernel);
+    //Emit the 64-bit integers as int
+    bool narrowIndices = false;
+    //Scatter updates of the scop kernel, set by generateScopKernel for generateKernelCode
+    Scatter scatter;
+
+    //Induction variable, step and exit condition of a parallelized loop, false if it cannot be replaced by get_global_id.
+    //tripCountKnown allows the mapping of loops whose iteration count is not a kernel argument.
+    bool getLoopMapping(llvm::Loop * loop, bool tripCountKnown, LoopMapping & mapping);
+    //Replace the induction variable by get_global_id(dimension), work-items outside the iteration space jump to lastBlock
+    void mapLoopToDimension(LoopMapping & mapping, unsigned int dimension, llvm::BasicBlock * lastBlock);
+
+    //The loops of the nest that are parallelized, outermost first up to maxDepth and the first loop that cannot be mapped.
+    //Per loop: the argument holding the global size (-1 for the trip count of the client) and the constant start.
+    bool getParallelLoops(llvm::LoopInfoBase < llvm::BasicBlock, llvm::Loop > *KLoop, unsigned int maxDepth, unsigned int numLoopTripCounts,
+                          std::vector < llvm::Loop * >&loopList, std::vector < std::pair < int, int > >&loopBounds);
+    //False if a loop cannot be mapped, the kernel is then partially rewritten
+    bool mapLoops(std::vector < llvm::Loop * >&loopList, std::vector < unsigned int >&loopDimension, unsigned int numLoopTripCounts, llvm::BasicBlock * lastBlock);
+
+    //Map the producer and consumer scop called by a fused kernel and inline them. Both need the same bound arguments per dimension,
+    //every array of the producer that the consumer reads is forwarded from the store of the same work-item. Per dimension:
+    //the bound argument and start of the fused kernel and the loop of the producer.
+    bool fuseKernels(llvm::Function * kernel, const HTROP_PB::Message_RCRS::ScopInfo & scopInfo, std::vector < std::pair < int, int > >&workgroupArgs,
+                     std::vector < int >&workgroupLoops);
+
+    //NDRange dimension of each parallelized loop, the loop indexing contiguous memory gets dimension 0
+     std::vector < unsigned int >getLoopDimensions(llvm::Function * kernel, std::vector < llvm::Loop * >&loopList);
+
+    //Dense linear-algebra nests (gemm-like): the innermost parallelized loop contains a sequential loop with loads
+    //that do not depend on the parallelized loop of dimension 1, register blocking reuses them across iterations
+    bool isRegisterBlockCandidate(llvm::Function * kernel, std::vector < llvm::Loop * >&loopList, std::vector < unsigned int >&loopDimension);
+
+    //Kernels with unit-stride accesses in dimension 0, each work-item then handles a vector of consecutive iterations
+    bool isVectorCandidate(llvm::Function * kernel, std::vector < llvm::Loop * >&loopList, std::vector < unsigned int >&loopDimension);
+
+    //The reduction hint of the client if its loop is parallelized, the emitter checks the accesses of the accumulator
+    bool getReduction(llvm::Function * kernel, std::vector < llvm::Loop * >&loopList, std::vector < unsigned int >&loopDimension, const HTROP_PB::ReductionHint & reductionHint,
+                      Reduction & reduction);
+
+    //Read-only arrays of a 2D stencil that are loaded through a local-memory tile, false if the kernel does not qualify
+    bool getLocalTiling(llvm::Function * kernel, std::vector < llvm::Loop * >&loopList, std::vector < unsigned int >&loopDimension, llvm::DominatorTree * DT, LocalTiling & tiling);
+
+    //IN arrays of the client in constant memory (known size) or images (float and char)
+    void getReadOnlyArgs(llvm::Function * kernel, const HTROP_PB::Message_RCRS::ScopInfo & scopInfo, LocalTiling & tiling, ReadOnlyArgs & readOnlyArgs);
+    int getRowWidthArg(llvm::Function * kernel, llvm::Argument * array);
+
+    //Arrays of rows [width x scalar] that are only accessed through getelementptr, the emitter indexes their rows with the pitch.
+    //Tiles, images, constant arrays and the accumulator of a reduction keep the packed layout.
+    void getPitchedArgs(llvm::Function * kernel, const LocalTiling & tiling, const Reduction & reduction, const ReadOnlyArgs & readOnlyArgs, std::set < unsigned int >&pitchedArgs);
 
      llvm::Module * originalOclMod;
      std::unique_ptr < llvm::Module > oclModPtr;
@@ -53,6 +261,7 @@ class OpenCLCBackend {
      std::string oclFileOnDisk;
 
     void addOCLFunctions(llvm::Module * &oclModArg);
+    void cloneOriginalModule();
 
 };
 
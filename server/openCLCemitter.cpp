@@ -0,0 +1,1534 @@
+//    Copyright (c) 2019 University of Paderborn
+//                         (Gavin Vaz <gavin.vaz@uni-paderborn.de>,
+//                          Heinrich Riebler <heinrich.riebler@uni-paderborn.de>)
+
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+
+//    The above copyright notice and this permission notice shall be included in
+//    all copies or substantial portions of the Software.
+
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//    THE SOFTWARE.
+
+#include "openCLCemitter.h"
+#include "../common/indexAnalysis.h"
+
+#include <iomanip>
+#include <climits>
+#include <vector>
+
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/DerivedTypes.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/IR/Operator.h"
+
+#if LLVM_VERSION == 3 && LLVM_MINOR_VERSION < 5
+#include "llvm/Support/InstIterator.h"
+#else
+#include "llvm/IR/InstIterator.h"
+#endif
+
+using namespace llvm;
+
+//OpenCL built-in functions with the same semantics as the C library / LLVM intrinsic
+static const std::set < std::string > oclMathBuiltins = {
+    "sqrt", "rsqrt", "cbrt", "fabs", "exp", "exp2", "exp10", "expm1", "log", "log2", "log10", "log1p",
+    "pow", "sin", "cos", "tan", "asin", "acos", "atan", "atan2", "sinh", "cosh", "tanh",
+    "floor", "ceil", "round", "trunc", "rint", "fmin", "fmax", "fma", "fmod", "copysign", "hypot"
+};
+
+//Map a called function (sqrtf, llvm.sqrt.f32, ...) to the OpenCL built-in
+static bool getOpenCLBuiltin(std::string name, std::string & builtin) {
+    if (name.find("llvm.") == 0) {
+        name = name.substr(5);
+        name = name.substr(0, name.find('.'));
+        if (name == "fmuladd")
+            name = "fma";
+        else if (name == "minnum")
+            name = "fmin";
+        else if (name == "maxnum")
+            name = "fmax";
+    }
+
+    if (oclMathBuiltins.count(name)) {
+        builtin = name;
+        return true;
+    }
+    //float variants of the C library
+    if (name.size() > 1 && name.back() == 'f' && oclMathBuiltins.count(name.substr(0, name.size() - 1))) {
+        builtin = name.substr(0, name.size() - 1);
+        return true;
+    }
+    if (name == "abs" || name == "labs") {
+        builtin = "abs";
+        return true;
+    }
+    return false;
+}
+
+static bool isWorkItemFunction(std::string name) {
+    return name == "get_global_id" || name == "get_local_id" || name == "get_group_id" || name == "get_global_size" || name == "get_local_size" || name == "get_num_groups";
+}
+
+//Argument names of the scop function that are OpenCL C keywords or types
+static const std::set < std::string > oclReservedNames = {
+    "global", "local", "constant", "private", "kernel", "read_only", "write_only", "read_write",
+    "half", "uchar", "ushort", "uint", "ulong", "size_t", "image2d_t", "image3d_t", "sampler_t", "event_t"
+};
+
+static std::string sanitizeName(std::string name) {
+    for (auto & c:name) {
+        if (!isalnum(c))
+            c = '_';
+    }
+    if (oclReservedNames.count(name))
+        name += "_";
+    return name;
+}
+
+OpenCLCEmitter::OpenCLCEmitter(llvm::Function * kernel) {
+    OpenCLCEmitter::kernel = kernel;
+}
+
+void OpenCLCEmitter::setLocalTiling(const LocalTiling & tiling) {
+    OpenCLCEmitter::tiling = tiling;
+}
+
+void OpenCLCEmitter::setRegisterBlock(unsigned int dimension, unsigned int factor, unsigned int boundArg) {
+    blockDimension = dimension;
+    blockFactor = factor;
+    blockBoundArg = boundArg;
+}
+
+void OpenCLCEmitter::setVectorWidth(unsigned int width, unsigned int boundArg) {
+    setRegisterBlock(0, width, boundArg);
+    vectorize = width > 1;
+}
+
+void OpenCLCEmitter::setCoarsening(unsigned int dimension, unsigned int factor, int boundArg, bool strided) {
+    coarsenDimension = dimension;
+    coarsenFactor = factor;
+    coarsenBoundArg = boundArg;
+    coarsenStrided = strided;
+}
+
+void OpenCLCEmitter::setScatter(const Scatter & scatter) {
+    OpenCLCEmitter::scatter = scatter;
+}
+
+void OpenCLCEmitter::setReduction(const Reduction & reduction) {
+    OpenCLCEmitter::reduction = reduction;
+}
+
+void OpenCLCEmitter::setReadOnlyArgs(const ReadOnlyArgs & readOnlyArgs) {
+    unsigned int argPos = 0;
+    for (llvm::Function::arg_iterator arg_I = kernel->arg_begin(); arg_I != kernel->arg_end(); arg_I++, argPos++) {
+        if (readOnlyArgs.imageArgs.count(argPos))
+            imageArgs.insert(&*arg_I);
+        else if (readOnlyArgs.constantArgs.count(argPos))
+            constantArgs.insert(&*arg_I);
+    }
+    constantSize = readOnlyArgs.constantSize;
+}
+
+void OpenCLCEmitter::setSpecializedArgs(bool specializeArgs) {
+    this->specializeArgs = specializeArgs;
+}
+
+void OpenCLCEmitter::setNarrowIndices(bool narrowIndices) {
+    this->narrowIndices = narrowIndices;
+}
+
+void OpenCLCEmitter::setPitchedArgs(const std::set < unsigned int >&pitchedArgs) {
+    unsigned int argPos = 0;
+    for (llvm::Function::arg_iterator arg_I = kernel->arg_begin(); arg_I != kernel->arg_end(); arg_I++, argPos++) {
+        if (pitchedArgs.count(argPos))
+            this->pitchedArgs.insert(&*arg_I);
+    }
+}
+
+std::string OpenCLCEmitter::getError() {
+    return error;
+}
+
+bool OpenCLCEmitter::fail(std::string reason) {
+    if (error.empty())
+        error = reason;
+    return false;
+}
+
+bool OpenCLCEmitter::emit(std::string & kernelCode) {
+    if (!kernel->getReturnType()->isVoidTy())
+        return fail("kernel returns a value");
+
+    //Signature, the runtime sets the arguments by position
+    std::ostringstream signature;
+    signature << "__kernel ";
+    if (tiling.isEnabled())
+        signature << "__attribute__((reqd_work_group_size(" << tiling.tileSize << ", " << tiling.tileSize << ", 1))) ";
+    else if (reduction.isEnabled()) {
+        signature << "__attribute__((reqd_work_group_size(";
+        for (unsigned int dim = 0; dim < 3; dim++)
+            signature << (dim > 0 ? ", " : "") << (dim == reduction.dimension ? reduction.groupSize : 1);
+        signature << "))) ";
+    }
+    signature << "void " << kernel->getName().str() << "(";
+    unsigned int argPos = 0;
+    for (llvm::Function::arg_iterator arg_I = kernel->arg_begin(); arg_I != kernel->arg_end(); arg_I++, argPos++) {
+        std::string name = arg_I->hasName()? sanitizeName(arg_I->getName().str()) : "arg" + std::to_string(argPos);
+        valueNames[&*arg_I] = name;
+
+        if (argPos > 0)
+            signature << ", ";
+        if (imageArgs.count(&*arg_I)) {
+            signature << "read_only image2d_t " << name;
+        }
+        else if (arg_I->getType()->isPointerTy()) {
+            std::string elementType = getTypeName(getScalarElementType(arg_I->getType()), NULL);
+            if (elementType.empty())
+                return fail("unsupported type of argument " + name);
+            signature << getAddressSpace(&*arg_I) << elementType << " * restrict " << name;
+        }
+        else if (narrowIndices && arg_I->getType()->isIntegerTy(64)) {
+            //The runtime sets a long, the body uses its int copy
+            signature << "long htrop_" << name;
+            declarations << "    int " << name << " = (int)htrop_" << name << ";\n";
+        }
+        else {
+            std::string type = getTypeName(arg_I->getType(), NULL);
+            if (type.empty())
+                return fail("unsupported type of argument " + name);
+            signature << type << " " << name;
+        }
+    }
+    if (reduction.isEnabled()) {
+        std::string accumulatorType = getTypeName(getScalarElementType(reduction.accumulator->getType()), NULL);
+        signature << ", __global " << accumulatorType << " * restrict htrop_partial, __global long * restrict htrop_partial_index";
+    }
+    signature << ")";
+
+    if (!imageArgs.empty() && !checkImageAccesses())
+        return false;
+
+    if (blockFactor > 1 && !findBlockedValues())
+        return false;
+
+    if (reduction.isEnabled() && !findReductionAccesses())
+        return false;
+
+    if (scatter.isEnabled() && !findScatterAccesses())
+        return false;
+    if (scatter.localSize > 0 && (reduction.isEnabled() || coarsenFactor > 1 || blockFactor > 1))
+        return fail("local scatter copy with reduction or work-item factors");
+
+    if (!declareValues())
+        return false;
+
+    if (!pitchedArgs.empty())
+        declareRowPitches();
+
+    if (!imageArgs.empty())
+        declarations << "    const sampler_t htrop_sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_CLAMP_TO_EDGE | CLK_FILTER_NEAREST;\n";
+
+    //The compiler folds the values of a specialized program into the bounds and strides
+    if (specializeArgs) {
+        unsigned int specPos = 0;
+        for (llvm::Function::arg_iterator arg_I = kernel->arg_begin(); arg_I != kernel->arg_end(); arg_I++, specPos++) {
+            if (!arg_I->getType()->isIntegerTy())
+                continue;
+            std::string macro = "HTROP_SPEC_" + kernel->getName().str() + "_" + std::to_string(specPos);
+            body << "#ifdef " << macro << "\n    " << getValueName(&*arg_I) << " = " << macro << ";\n#endif\n";
+        }
+    }
+
+    if (tiling.isEnabled())
+        emitTileLoads();
+
+    if (vectorize) {
+        declarations << "    bool htrop_full;\n";
+        body << "    htrop_full = (long)get_global_id(0) * " << blockFactor << " + " << blockFactor << " <= (long)" << getArgName(blockBoundArg) << ";\n\n";
+    }
+
+    //The coarsened body is a loop over htrop_c, the global size is rounded up so the last iterations are skipped
+    if (coarsenFactor > 1) {
+        declarations << "    int htrop_c;\n";
+        body << "    htrop_c = 0;\n";
+        body << "htrop_coarsen:\n";
+        if (coarsenBoundArg >= 0) {
+            body << "    if ((long)" << getCoarsenedGlobalId() << " >= (long)" << getArgName(coarsenBoundArg) << ")\n";
+            body << "        return;\n";
+        }
+    }
+
+    if (reduction.isEnabled())
+        emitReductionStart();
+
+    if (scatter.localSize > 0)
+        emitScatterStart();
+
+    for (llvm::Function::iterator block = kernel->begin(); block != kernel->end(); block++) {
+        if (!emitBlock(&*block))
+            return false;
+    }
+
+    if (reduction.isEnabled())
+        emitReductionEnd();
+
+    if (scatter.localSize > 0)
+        emitScatterEnd();
+
+    if (coarsenFactor > 1) {
+        body << "htrop_next:\n";
+        body << "    htrop_c++;\n";
+        body << "    if (htrop_c < " << coarsenFactor << ") goto htrop_coarsen;\n";
+    }
+
+    kernelCode = signature.str() + "\n{\n" + declarations.str() + "\n" + body.str() + "}\n";
+
+    //The runtime defines the size of the constant buffer of the device
+    if (!constantArgs.empty()) {
+        std::string qualifier = getConstantQualifier();
+        kernelCode = "#if defined(HTROP_CONSTANT_SIZE) && HTROP_CONSTANT_SIZE >= " + std::to_string(constantSize) + "\n#define " + qualifier + " __constant\n#else\n#define " + qualifier +
+            " __global\n#endif\n" + kernelCode;
+    }
+    return true;
+}
+
+//BEGIN LOCAL TILING
+
+std::string OpenCLCEmitter::getArgName(unsigned int argPos) {
+    llvm::Function::arg_iterator arg_I = kernel->arg_begin();
+    for (unsigned int pos = 0; pos < argPos && arg_I != kernel->arg_end(); pos++)
+        arg_I++;
+    if (arg_I == kernel->arg_end()) {
+        fail("tiling bound is not a kernel argument");
+        return "0";
+    }
+    return getValueName(&*arg_I);
+}
+
+//The work-group loads its tile plus halo into local memory before any work-item starts.
+//Only elements between the first and the last element read by a valid work-item are loaded,
+//the halo of the border work-groups would otherwise read outside of the buffer.
+void OpenCLCEmitter::emitTileLoads() {
+    std::string tileSize = std::to_string(tiling.tileSize);
+    std::string bound[2];
+    for (int dim = 0; dim < 2; dim++) {
+        bound[dim] = "(long)" + getArgName(tiling.boundArg[dim]);
+    }
+
+    for (auto & tile:tiling.tiles) {
+        std::string name = getValueName(tile.array);
+        std::string type = getTypeName(getScalarElementType(tile.array->getType()), NULL);
+        std::string width = std::to_string(tile.getWidth(tiling.tileSize));
+        std::string height = std::to_string(tile.getHeight(tiling.tileSize));
+        std::string stride[2] = { std::to_string(tile.stride[0]) + "L", std::to_string(tile.stride[1]) + "L" };
+
+        declarations << "    __local " << type << " htrop_tile_" << name << "[" << width << " * " << height << "];\n";
+
+        body << "    for (int htrop_t = get_local_id(1) * " << tileSize << " + get_local_id(0); htrop_t < " << width << " * " << height << "; htrop_t += " << tileSize << " * " << tileSize << ") {\n";
+        body << "        long htrop_e = " << stride[0] << " * ((long)get_group_id(0) * " << tileSize << " + htrop_t % " << width << " + (" << tile.haloMin[0] << "))";
+        body << " + " << stride[1] << " * ((long)get_group_id(1) * " << tileSize << " + htrop_t / " << width << " + (" << tile.haloMin[1] << ")) + (" << tile.offset << ");\n";
+        body << "        if (htrop_e >= " << stride[0] << " * " << tiling.start[0] << " + " << stride[1] << " * " << tiling.start[1] << " + (" << tile.minOffset << ")";
+        body << " && htrop_e <= " << stride[0] << " * (" << bound[0] << " - 1) + " << stride[1] << " * (" << bound[1] << " - 1) + (" << tile.maxOffset << "))\n";
+        body << "            htrop_tile_" << name << "[htrop_t] = " << name << "[htrop_e];\n";
+        body << "    }\n";
+    }
+    body << "    barrier(CLK_LOCAL_MEM_FENCE);\n";
+
+    //The global size is rounded up to whole work-groups
+    body << "    if ((long)get_global_id(0) >= " << bound[0] << " || (long)get_global_id(1) >= " << bound[1] << ")\n";
+    body << "        return;\n\n";
+}
+
+bool OpenCLCEmitter::getTiledLoad(llvm::LoadInst * loadInst, std::string & expression) {
+    for (auto & tile:tiling.tiles) {
+        auto tiledLoad = tile.loads.find(loadInst);
+        if (tiledLoad == tile.loads.end())
+            continue;
+
+        int64_t column = tiledLoad->second.first - tile.haloMin[0];
+        int64_t row = tiledLoad->second.second - tile.haloMin[1];
+        expression = "htrop_tile_" + getValueName(tile.array) + "[(get_local_id(1) + " + std::to_string(row) + ") * " + std::to_string(tile.getWidth(tiling.tileSize)) + " + get_local_id(0) + " +
+            std::to_string(column) + "]";
+        return true;
+    }
+    return false;
+}
+
+//END LOCAL TILING
+
+//BEGIN REGISTER BLOCKING
+
+//The guard of the loop mapping that skips the work-items beyond an argument bound. In a register blocked kernel
+//it tests copy 0, the other copies check the bound themselves.
+bool OpenCLCEmitter::isBoundGuard(const llvm::BranchInst * branchInst) {
+    return branchInst->getMetadata("htrop.bound_guard") != NULL;
+}
+
+//The copies of a work-item run in lockstep, copy c computes iteration get_global_id(dimension) * factor + c.
+//Everything that depends on this id is replicated, the rest (e.g. the loads of B[k][j] in gemm) is shared.
+//The control flow must not depend on the id, the copies would have to branch differently otherwise.
+bool OpenCLCEmitter::findBlockedValues() {
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        Instruction *inst = &*I;
+        if (isa < AllocaInst > (inst))
+            return fail("private array in a register blocked kernel");
+
+        auto callInst = dyn_cast < CallInst > (inst);
+        if (callInst == NULL || callInst->getCalledFunction() == NULL || callInst->getCalledFunction()->getName() != "get_global_id")
+            continue;
+        auto dimension = dyn_cast < ConstantInt > (callInst->getArgOperand(0));
+        if (dimension == NULL || dimension->getZExtValue() != blockDimension)
+            continue;
+
+        if (blockedGlobalId != NULL)
+            return fail("several ids of the register blocked dimension");
+        blockedGlobalId = inst;
+        blockedValues.insert(inst);
+    }
+    if (blockedGlobalId == NULL)
+        return fail("no id of the register blocked dimension");
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+            if (I->getType()->isVoidTy() || blockedValues.count(&*I))
+                continue;
+            for (unsigned int i = 0; i < I->getNumOperands(); i++) {
+                if (blockedValues.count(I->getOperand(i))) {
+                    blockedValues.insert(&*I);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        auto branchInst = dyn_cast < BranchInst > (&*I);
+        if (branchInst && branchInst->isConditional() && blockedValues.count(branchInst->getCondition()) && !isBoundGuard(branchInst))
+            return fail("control flow depends on the register blocked dimension");
+        auto switchInst = dyn_cast < SwitchInst > (&*I);
+        if (switchInst && blockedValues.count(switchInst->getCondition()))
+            return fail("control flow depends on the register blocked dimension");
+
+        //Consecutive copies access consecutive elements
+        llvm::Value * pointer = getAccessPointer(&*I);
+        if (!vectorize || pointer == NULL || !blockedValues.count(pointer))
+            continue;
+        llvm::Type * type = isa < StoreInst > (&*I) ? cast < StoreInst > (&*I)->getValueOperand()->getType() : I->getType();
+        AffineIndex index;
+        if ((type->isIntegerTy() && !type->isIntegerTy(1)) || type->isFloatTy() || type->isDoubleTy()) {
+            if (getAffineIndex(pointer, index) && index.getCoefficient(blockedGlobalId) == 1 && !index.isUsedInSymbol(blockedGlobalId))
+                vectorAccesses.insert(&*I);
+        }
+    }
+    return true;
+}
+
+bool OpenCLCEmitter::isBlocked(const llvm::Instruction * inst) {
+    if (blockedValues.count(inst))
+        return true;
+    if (auto storeInst = dyn_cast < StoreInst > (inst))
+        return blockedValues.count(storeInst->getPointerOperand()) || blockedValues.count(storeInst->getValueOperand());
+    return false;
+}
+
+std::string OpenCLCEmitter::getCopySuffix(const llvm::Value * value) {
+    if (blockCopy == 0 || !blockedValues.count(value))
+        return "";
+    return "_r" + std::to_string(blockCopy);
+}
+
+//The last work-item may get fewer iterations than copies, the loads and stores of the others are skipped
+std::string OpenCLCEmitter::getCopyValid() {
+    return "((long)" + getValueName(blockedGlobalId) + getCopySuffix(blockedGlobalId) + " < (long)" + getArgName(blockBoundArg) + ")";
+}
+
+//Vector access in full work-items, scalar accesses of the valid copies in the last one
+bool OpenCLCEmitter::emitVectorAccess(llvm::Instruction * inst) {
+    static const char *components = "0123456789abcdef";
+    std::string width = std::to_string(blockFactor);
+
+    if (auto loadInst = dyn_cast < LoadInst > (inst)) {
+        std::string vector = "htrop_v" + std::to_string(nextVectorId++);
+        declarations << "    " << getTypeName(inst->getType(), NULL) << width << " " << vector << ";\n";
+
+        body << "    if (htrop_full) {\n";
+        body << "        " << vector << " = vload" << width << "(0, " << getOperand(loadInst->getPointerOperand()) << ");\n";
+        for (blockCopy = 0; blockCopy < blockFactor; blockCopy++) {
+            body << "        " << getValueName(inst) << getCopySuffix(inst) << " = " << vector << ".s" << components[blockCopy] << ";\n";
+        }
+        body << "    }\n    else {\n";
+        for (blockCopy = 0; blockCopy < blockFactor; blockCopy++) {
+            std::string load = "*" + getOperand(loadInst->getPointerOperand());
+            body << "        " << getValueName(inst) << getCopySuffix(inst) << " = " << (blockCopy > 0 ? "(" + getCopyValid() + " ? " + load + " : 0)" : load) << ";\n";
+        }
+        body << "    }\n";
+    }
+    else {
+        auto storeInst = cast < StoreInst > (inst);
+        std::string vectorValue = "(" + getTypeName(storeInst->getValueOperand()->getType(), NULL) + width + ")(";
+        for (blockCopy = 0; blockCopy < blockFactor; blockCopy++) {
+            vectorValue += (blockCopy > 0 ? ", " : "") + getOperand(storeInst->getValueOperand());
+        }
+        vectorValue += ")";
+        blockCopy = 0;
+
+        body << "    if (htrop_full) {\n";
+        body << "        vstore" << width << "(" << vectorValue << ", 0, " << getOperand(storeInst->getPointerOperand()) << ");\n";
+        body << "    }\n    else {\n";
+        for (blockCopy = 0; blockCopy < blockFactor; blockCopy++) {
+            body << "        " << (blockCopy > 0 ? "if " + getCopyValid() + " " : "") << "*" << getOperand(storeInst->getPointerOperand()) << " = " << getOperand(storeInst->getValueOperand()) << ";\n";
+        }
+        body << "    }\n";
+    }
+    blockCopy = 0;
+    return error.empty();
+}
+
+//END REGISTER BLOCKING
+
+//BEGIN READ-ONLY ARRAYS
+
+std::string OpenCLCEmitter::getConstantQualifier() {
+    return "HTROP_CONSTANT_" + sanitizeName(kernel->getName().str());
+}
+
+//Images are only read, with scalar loads of float or char
+bool OpenCLCEmitter::checkImageAccesses() {
+    if (vectorize)
+        return fail("image array in a vectorized kernel");
+    for (auto & tile:tiling.tiles) {
+        if (imageArgs.count(tile.array))
+            return fail("image array in a local-memory tile");
+    }
+
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        if (auto loadInst = dyn_cast < LoadInst > (&*I)) {
+            if (imageArgs.count(getPointerBase(loadInst->getPointerOperand())) && !loadInst->getType()->isFloatTy() && !loadInst->getType()->isIntegerTy(8))
+                return fail("unsupported element type of an image array");
+            continue;
+        }
+        for (unsigned int i = 0; i < I->getNumOperands(); i++) {
+            if (!I->getOperand(i)->getType()->isPointerTy() || !imageArgs.count(getPointerBase(I->getOperand(i))))
+                continue;
+            if (isa < StoreInst > (&*I))
+                return fail("store to an image array");
+            if (isa < CallInst > (&*I))
+                return fail("image array passed to a call");
+        }
+    }
+    return true;
+}
+
+//Element offset -> 2D coordinate of the image, the rows are get_image_width elements long
+std::string OpenCLCEmitter::getImageLoad(llvm::LoadInst * loadInst, const llvm::Value * image) {
+    std::string name = getValueName(image);
+    std::string offset = getOperand(loadInst->getPointerOperand());
+    std::string width = "get_image_width(" + name + ")";
+    std::string coord = "(int2)((int)(" + offset + " % " + width + "), (int)(" + offset + " / " + width + "))";
+
+    if (loadInst->getType()->isFloatTy())
+        return "read_imagef(" + name + ", htrop_sampler, " + coord + ").x";
+    return "((char)read_imageui(" + name + ", htrop_sampler, " + coord + ").x)";
+}
+
+//END READ-ONLY ARRAYS
+
+//BEGIN PITCHED ARRAYS
+
+//Same rounding as the runtime: the row of width elements padded to a multiple of HTROP_ROW_ALIGN bytes
+void OpenCLCEmitter::declareRowPitches() {
+    for (auto array:pitchedArgs) {
+        std::string type = getTypeName(getScalarElementType(array->getType()), NULL);
+        std::string rowBytes = std::to_string(array->getType()->getPointerElementType()->getArrayNumElements()) + "L * sizeof(" + type + ")";
+        declarations << "    const " << (narrowIndices ? "int" : "long") << " htrop_pitch_" << getValueName(array) << " = (" << rowBytes << " + HTROP_ROW_ALIGN - 1) / HTROP_ROW_ALIGN * HTROP_ROW_ALIGN / sizeof(" << type << ");\n";
+    }
+}
+
+//END PITCHED ARRAYS
+
+//BEGIN THREAD COARSENING
+
+std::string OpenCLCEmitter::getCoarsenedGlobalId() {
+    std::string dimension = std::to_string(coarsenDimension);
+    if (coarsenStrided)
+        return "(get_global_id(" + dimension + ") + htrop_c * get_global_size(" + dimension + "))";
+    return "(get_global_id(" + dimension + ") * " + std::to_string(coarsenFactor) + " + htrop_c)";
+}
+
+//END THREAD COARSENING
+
+//BEGIN REDUCTION
+
+static bool matchesReductionOperator(const llvm::BinaryOperator * binOp, ReductionOperator reductionOperator) {
+    switch (binOp->getOpcode()) {
+    case Instruction::Add:
+    case Instruction::FAdd:
+        return reductionOperator == RED_ADD;
+    case Instruction::Mul:
+    case Instruction::FMul:
+        return reductionOperator == RED_MUL;
+    case Instruction::And:
+        return reductionOperator == RED_AND;
+    case Instruction::Or:
+        return reductionOperator == RED_OR;
+    case Instruction::Xor:
+        return reductionOperator == RED_XOR;
+    default:
+        return false;
+    }
+}
+
+//Every store to the accumulator combines a load of the same address, the loads are not used otherwise
+bool OpenCLCEmitter::findReductionAccesses() {
+    llvm::Type * elementType = getScalarElementType(reduction.accumulator->getType());
+    std::vector < const llvm::Value * >pointers(1, reduction.accumulator);
+    for (unsigned int pointerIte = 0; pointerIte < pointers.size(); pointerIte++) {
+        for (auto user:pointers[pointerIte]->users()) {
+            if (isa < GetElementPtrInst > (user) || isa < BitCastInst > (user)) {
+                pointers.push_back(user);
+            }
+            else if (isa < LoadInst > (user)) {
+                reductionLoads.insert(cast < LoadInst > (user));
+            }
+            else if (auto storeInst = dyn_cast < StoreInst > (user)) {
+                if (storeInst->getPointerOperand() != pointers[pointerIte])
+                    return fail("accumulator address is stored");
+                reductionStores.insert(storeInst);
+            }
+            else {
+                return fail("unsupported use of the accumulator");
+            }
+        }
+    }
+    if (reductionStores.empty())
+        return fail("accumulator is never stored");
+
+    std::set < const llvm::Instruction * >combinedLoads;
+    for (auto store:reductionStores) {
+        const StoreInst *storeInst = cast < StoreInst > (store);
+        auto binOp = dyn_cast < BinaryOperator > (storeInst->getValueOperand());
+        if (binOp == NULL || !binOp->hasOneUse() || binOp->getType() != elementType || !matchesReductionOperator(binOp, reduction.reductionOperator))
+            return fail("accumulator store is not a reduction");
+
+        for (unsigned int i = 0; i < 2; i++) {
+            auto loadInst = dyn_cast < LoadInst > (binOp->getOperand(i));
+            if (loadInst && reductionLoads.count(loadInst) && loadInst->hasOneUse() && loadInst->getPointerOperand() == storeInst->getPointerOperand())
+                combinedLoads.insert(loadInst);
+        }
+        if (!isWorkItemInvariant(storeInst->getPointerOperand()))
+            return fail("accumulator address changes inside the work-item");
+    }
+    if (combinedLoads.size() != reductionLoads.size())
+        return fail("accumulator is read outside of the reduction");
+    return true;
+}
+
+//Depends only on arguments, constants and the global ids of the other dimensions
+bool OpenCLCEmitter::isWorkItemInvariant(const llvm::Value * value) {
+    if (isa < Argument > (value) || isa < Constant > (value))
+        return true;
+
+    if (auto callInst = dyn_cast < CallInst > (value)) {
+        auto dimension = dyn_cast < ConstantInt > (callInst->getArgOperand(0));
+        return callInst->getCalledFunction() != NULL && callInst->getCalledFunction()->getName() == "get_global_id" && dimension != NULL
+            && dimension->getZExtValue() != reduction.dimension;
+    }
+
+    auto inst = dyn_cast < Instruction > (value);
+    if (inst == NULL || isa < PHINode > (inst) || inst->mayReadFromMemory())
+        return false;
+
+    for (unsigned int i = 0; i < inst->getNumOperands(); i++) {
+        if (!isWorkItemInvariant(inst->getOperand(i)))
+            return false;
+    }
+    return true;
+}
+
+std::string OpenCLCEmitter::getReductionIdentity() {
+    std::string type = getTypeName(getScalarElementType(reduction.accumulator->getType()), NULL);
+    switch (reduction.reductionOperator) {
+    case RED_MUL:
+        return "((" + type + ")1)";
+    case RED_AND:
+        return "((" + type + ")~0)";
+    default:
+        return "((" + type + ")0)";
+    }
+}
+
+//The work-items outside of the iteration space take part in the combination with the identity
+void OpenCLCEmitter::emitReductionStart() {
+    std::string type = getTypeName(getScalarElementType(reduction.accumulator->getType()), NULL);
+
+    declarations << "    " << type << " htrop_acc;\n";
+    declarations << "    long htrop_acc_index;\n";
+    declarations << "    __local " << type << " htrop_red[" << reduction.groupSize << "];\n";
+    declarations << "    __local long htrop_red_index;\n";
+    declarations << "    int htrop_l;\n";
+
+    body << "    htrop_acc = " << getReductionIdentity() << ";\n";
+    body << "    htrop_acc_index = -1;\n";
+    if (reduction.boundArg >= 0) {
+        body << "    if ((long)get_global_id(" << reduction.dimension << ") >= (long)" << getArgName(reduction.boundArg) << ")\n";
+        body << "        goto htrop_reduce;\n";
+    }
+    body << "\n";
+}
+
+//Tree combination in local memory, the first work-item writes the partial result of the work-group
+void OpenCLCEmitter::emitReductionEnd() {
+    static const char *operators[] = { " + ", " * ", " & ", " | ", " ^ " };
+    std::string dimension = std::to_string(reduction.dimension);
+
+    body << "htrop_reduce:\n";
+    body << "    htrop_l = get_local_id(" << dimension << ");\n";
+    body << "    htrop_red[htrop_l] = htrop_acc;\n";
+    body << "    if (htrop_l == 0)\n";
+    body << "        htrop_red_index = -1;\n";
+    body << "    barrier(CLK_LOCAL_MEM_FENCE);\n";
+    body << "    if (htrop_acc_index >= 0)\n";
+    body << "        htrop_red_index = htrop_acc_index;\n";
+    body << "    barrier(CLK_LOCAL_MEM_FENCE);\n";
+    body << "    for (int htrop_s = " << reduction.groupSize / 2 << "; htrop_s > 0; htrop_s >>= 1) {\n";
+    body << "        if (htrop_l < htrop_s)\n";
+    body << "            htrop_red[htrop_l] = htrop_red[htrop_l]" << operators[reduction.reductionOperator] << "htrop_red[htrop_l + htrop_s];\n";
+    body << "        barrier(CLK_LOCAL_MEM_FENCE);\n";
+    body << "    }\n";
+    body << "    if (htrop_l == 0) {\n";
+    body << "        long htrop_g = get_group_id(0) + get_num_groups(0) * (get_group_id(1) + get_num_groups(1) * get_group_id(2));\n";
+    body << "        htrop_partial[htrop_g] = htrop_red[0];\n";
+    body << "        htrop_partial_index[htrop_g] = htrop_red_index;\n";
+    body << "    }\n";
+}
+
+//END REDUCTION
+
+//BEGIN SCATTER
+
+//old + value or a compare and select of old and value, returns value. The old value only feeds the update.
+static llvm::Value *getScatterValue(const llvm::Value * update, const llvm::LoadInst * oldValue, ReductionOperator scatterOperator,
+                                   std::vector < const llvm::Instruction * >&combination) {
+    if (auto binOp = dyn_cast < BinaryOperator > (update)) {
+        if (scatterOperator != RED_ADD || binOp->getOpcode() != Instruction::Add || !binOp->hasOneUse() || !oldValue->hasOneUse())
+            return NULL;
+        combination.push_back(binOp);
+        return binOp->getOperand(0) == oldValue ? binOp->getOperand(1) : binOp->getOperand(1) == oldValue ? binOp->getOperand(0) : NULL;
+    }
+
+    auto selectInst = dyn_cast < SelectInst > (update);
+    auto cmpInst = selectInst != NULL ? dyn_cast < ICmpInst > (selectInst->getCondition()) : NULL;
+    if (cmpInst == NULL || !selectInst->hasOneUse() || !cmpInst->hasOneUse() || !cmpInst->isSigned() || oldValue->getNumUses() != 2)
+        return NULL;
+
+    llvm::Value * a = cmpInst->getOperand(0);
+    llvm::Value * b = cmpInst->getOperand(1);
+    bool picksFirst = selectInst->getTrueValue() == a && selectInst->getFalseValue() == b;
+    if (!picksFirst && !(selectInst->getTrueValue() == b && selectInst->getFalseValue() == a))
+        return NULL;
+    bool isLess = cmpInst->getPredicate() == ICmpInst::ICMP_SLT || cmpInst->getPredicate() == ICmpInst::ICMP_SLE;
+    if ((isLess == picksFirst ? RED_MIN : RED_MAX) != scatterOperator)
+        return NULL;
+    combination.push_back(cmpInst);
+    combination.push_back(selectInst);
+    return a == oldValue ? b : b == oldValue ? a : NULL;
+}
+
+//Every store to the array updates the element a load of the same address read
+bool OpenCLCEmitter::findScatterAccesses() {
+    if (!getScalarElementType(scatter.array->getType())->isIntegerTy(32))
+        return fail("scatter array is not of 32-bit integers");
+
+    std::vector < const llvm::Value * >pointers(1, scatter.array);
+    std::vector < const llvm::StoreInst * >stores;
+    unsigned int numLoads = 0;
+    for (unsigned int pointerIte = 0; pointerIte < pointers.size(); pointerIte++) {
+        for (auto user:pointers[pointerIte]->users()) {
+            if (isa < GetElementPtrInst > (user) || isa < BitCastInst > (user))
+                pointers.push_back(user);
+            else if (isa < LoadInst > (user))
+                numLoads++;
+            else if (isa < StoreInst > (user) && cast < StoreInst > (user)->getPointerOperand() == pointers[pointerIte])
+                stores.push_back(cast < StoreInst > (user));
+            else
+                return fail("unsupported use of the scatter array");
+        }
+    }
+
+    for (auto storeInst:stores) {
+        auto update = dyn_cast < Instruction > (storeInst->getValueOperand());
+        const llvm::LoadInst * oldValue = NULL;
+        for (unsigned int i = 0; update != NULL && i < update->getNumOperands(); i++) {
+            auto operand = update->getOperand(i);
+            if (isa < SelectInst > (update) && i == 0) {
+                auto cmpInst = dyn_cast < ICmpInst > (operand);
+                if (cmpInst == NULL)
+                    continue;
+                operand = cmpInst->getOperand(0);
+            }
+            auto loadInst = dyn_cast < LoadInst > (operand);
+            if (loadInst != NULL && loadInst->getPointerOperand() == storeInst->getPointerOperand())
+                oldValue = loadInst;
+        }
+
+        std::vector < const llvm::Instruction * >combination;
+        llvm::Value * value = oldValue != NULL ? getScatterValue(update, oldValue, scatter.scatterOperator, combination) : NULL;
+        if (value == NULL)
+            return fail("scatter store is not an update");
+
+        scatterStores[storeInst] = value;
+        scatterUpdates.insert(oldValue);
+        scatterUpdates.insert(combination.begin(), combination.end());
+    }
+    if (stores.empty() || scatterStores.size() != numLoads)
+        return fail("scatter array is read outside of the updates");
+    return true;
+}
+
+std::string OpenCLCEmitter::getScatterIdentity() {
+    switch (scatter.scatterOperator) {
+    case RED_MIN:
+        return "INT_MAX";
+    case RED_MAX:
+        return "INT_MIN";
+    default:
+        return "0";
+    }
+}
+
+//The work-group starts with the identity in all elements of its copy
+void OpenCLCEmitter::emitScatterStart() {
+    declarations << "    __local int htrop_bins[" << scatter.localSize << "];\n";
+    declarations << "    int htrop_lid;\n";
+    declarations << "    int htrop_lsize;\n";
+
+    body << "    htrop_lid = get_local_id(0) + get_local_size(0) * (get_local_id(1) + get_local_size(1) * get_local_id(2));\n";
+    body << "    htrop_lsize = get_local_size(0) * get_local_size(1) * get_local_size(2);\n";
+    body << "    for (int htrop_b = htrop_lid; htrop_b < " << scatter.localSize << "; htrop_b += htrop_lsize)\n";
+    body << "        htrop_bins[htrop_b] = " << getScatterIdentity() << ";\n";
+    body << "    barrier(CLK_LOCAL_MEM_FENCE);\n\n";
+}
+
+//The elements the work-group changed are merged into the array
+void OpenCLCEmitter::emitScatterEnd() {
+    static const char *atomics[] = { "atomic_add", "", "", "", "", "atomic_min", "atomic_max" };
+
+    body << "htrop_scatter:\n";
+    body << "    barrier(CLK_LOCAL_MEM_FENCE);\n";
+    body << "    for (int htrop_b = htrop_lid; htrop_b < " << scatter.localSize << "; htrop_b += htrop_lsize) {\n";
+    body << "        if (htrop_bins[htrop_b] != " << getScatterIdentity() << ")\n";
+    body << "            " << atomics[scatter.scatterOperator] << "(" << getValueName(scatter.array) << " + htrop_b, htrop_bins[htrop_b]);\n";
+    body << "    }\n";
+}
+
+//END SCATTER
+
+//Leave the body of the work-item, the coarsening loop and the reduction continue after the blocks
+std::string OpenCLCEmitter::getReturn() {
+    if (coarsenFactor > 1)
+        return "goto htrop_next;";
+    if (reduction.isEnabled())
+        return "goto htrop_reduce;";
+    if (scatter.localSize > 0)
+        return "goto htrop_scatter;";
+    return "return;";
+}
+
+//BEGIN TYPES
+
+llvm::Type * OpenCLCEmitter::getScalarElementType(llvm::Type * type) {
+    if (type->isPointerTy())
+        type = type->getPointerElementType();
+    while (type->isArrayTy())
+        type = type->getArrayElementType();
+    return type;
+}
+
+bool OpenCLCEmitter::getNumScalarElements(llvm::Type * type, uint64_t & numElements) {
+    numElements = 1;
+    while (type->isArrayTy()) {
+        numElements *= type->getArrayNumElements();
+        type = type->getArrayElementType();
+    }
+    return type->isIntegerTy() || type->isFloatTy() || type->isDoubleTy();
+}
+
+std::string OpenCLCEmitter::getTypeName(llvm::Type * type, const llvm::Value * pointer) {
+    if (type->isVoidTy())
+        return "void";
+    if (type->isFloatTy())
+        return "float";
+    if (type->isDoubleTy())
+        return "double";
+    if (type->isIntegerTy()) {
+        switch (type->getIntegerBitWidth()) {
+        case 1:
+            return "bool";
+        case 8:
+            return "char";
+        case 16:
+            return "short";
+        case 32:
+            return "int";
+        case 64:
+            return narrowIndices ? "int" : "long";
+        }
+        return "";
+    }
+    if (type->isPointerTy()) {
+        //Pointers into an image are element offsets
+        if (pointer != NULL && imageArgs.count(getPointerBase(pointer)))
+            return "long";
+        std::string elementType = getTypeName(getScalarElementType(type), NULL);
+        if (elementType.empty() || elementType == "void")
+            return "";
+        return getAddressSpace(pointer) + elementType + "*";
+    }
+    return "";
+}
+
+std::string OpenCLCEmitter::getUnsignedTypeName(llvm::Type * type) {
+    std::string typeName = getTypeName(type, NULL);
+    if (typeName == "char" || typeName == "short" || typeName == "int" || typeName == "long")
+        return "u" + typeName;
+    return typeName;
+}
+
+//Kernel arguments are global (or constant), allocas private
+std::string OpenCLCEmitter::getAddressSpace(const llvm::Value * pointer) {
+    const llvm::Value *base = getPointerBase(pointer);
+    if (base != NULL && isa < AllocaInst > (base))
+        return "";
+    if (constantArgs.count(base))
+        return getConstantQualifier() + " ";
+    return "__global ";
+}
+
+const llvm::Value * OpenCLCEmitter::getPointerBase(const llvm::Value * pointer) {
+    std::set < const llvm::Value * >visited;
+    return getPointerBase(pointer, visited);
+}
+
+//Follow the pointer back to the kernel argument or alloca, NULL if unknown
+const llvm::Value * OpenCLCEmitter::getPointerBase(const llvm::Value * pointer, std::set < const llvm::Value * >&visited) {
+    if (pointer == NULL || isa < Argument > (pointer) || isa < AllocaInst > (pointer))
+        return pointer;
+    if (!visited.insert(pointer).second)
+        return NULL;
+
+    if (auto gepInst = dyn_cast < GetElementPtrInst > (pointer))
+        return getPointerBase(gepInst->getPointerOperand(), visited);
+    if (auto castInst = dyn_cast < CastInst > (pointer))
+        return getPointerBase(castInst->getOperand(0), visited);
+    if (auto selectInst = dyn_cast < SelectInst > (pointer))
+        return getPointerBase(selectInst->getTrueValue(), visited);
+    if (auto phi = dyn_cast < PHINode > (pointer)) {
+        for (unsigned int i = 0; i < phi->getNumIncomingValues(); i++) {
+            if (!visited.count(phi->getIncomingValue(i)))
+                return getPointerBase(phi->getIncomingValue(i), visited);
+        }
+    }
+    return NULL;
+}
+
+//END TYPES
+
+//BEGIN VALUES
+
+std::string OpenCLCEmitter::getValueName(const llvm::Value * value) {
+    auto valueName = valueNames.find(value);
+    if (valueName != valueNames.end())
+        return valueName->second;
+
+    std::string name = "v" + std::to_string(nextValueId++);
+    if (value->hasName())
+        name = sanitizeName(value->getName().str()) + "_" + name.substr(1);
+    valueNames[value] = name;
+    return name;
+}
+
+std::string OpenCLCEmitter::getBlockLabel(const llvm::BasicBlock * block) {
+    auto blockLabel = blockLabels.find(block);
+    if (blockLabel != blockLabels.end())
+        return blockLabel->second;
+
+    std::string label = "bb" + std::to_string(blockLabels.size());
+    if (block->hasName())
+        label = sanitizeName(block->getName().str()) + "_" + label.substr(2);
+    blockLabels[block] = label;
+    return label;
+}
+
+std::string OpenCLCEmitter::getOperand(llvm::Value * value) {
+    //The offsets into an image start at its first element
+    if (imageArgs.count(value))
+        return "0L";
+    if (auto constant = dyn_cast < Constant > (value))
+        return getConstant(constant);
+
+    auto valueName = valueNames.find(value);
+    if (valueName == valueNames.end()) {
+        fail("value used before its definition");
+        return "0";
+    }
+    return valueName->second + getCopySuffix(value);
+}
+
+std::string OpenCLCEmitter::getConstant(llvm::Constant * constant) {
+    if (auto constInt = dyn_cast < ConstantInt > (constant)) {
+        int64_t value = constInt->getSExtValue();
+        switch (constInt->getBitWidth()) {
+        case 1:
+            return constInt->isZero()? "false" : "true";
+        case 8:
+            return "((char)" + std::to_string(value) + ")";
+        case 16:
+            return "((short)" + std::to_string(value) + ")";
+        case 32:
+            if (value == INT_MIN)
+                return "(-2147483647 - 1)";
+            return std::to_string(value);
+        case 64:
+            if (narrowIndices) {
+                if (value <= INT_MIN || value > INT_MAX)
+                    fail("64-bit constant in a kernel with 32-bit indices");
+                return std::to_string(value);
+            }
+            if (value == LLONG_MIN)
+                return "(-9223372036854775807L - 1)";
+            return std::to_string(value) + "L";
+        }
+        fail("unsupported integer constant");
+        return "0";
+    }
+
+    if (auto constFP = dyn_cast < ConstantFP > (constant)) {
+        const APFloat & apFloat = constFP->getValueAPF();
+        bool isFloat = constFP->getType()->isFloatTy();
+        std::string cast = isFloat ? "" : "(double)";
+        if (apFloat.isNaN())
+            return cast + "NAN";
+        if (apFloat.isInfinity())
+            return apFloat.isNegative()? "(-" + cast + "INFINITY)" : cast + "INFINITY";
+
+        std::ostringstream literal;
+        literal << std::scientific;
+        if (isFloat)
+            literal << std::setprecision(9) << apFloat.convertToFloat() << "f";
+        else
+            literal << std::setprecision(17) << apFloat.convertToDouble();
+        return "(" + literal.str() + ")";
+    }
+
+    if (isa < ConstantPointerNull > (constant) || isa < UndefValue > (constant) || constant->isNullValue())
+        return "0";
+
+    fail("unsupported constant");
+    return "0";
+}
+
+//END VALUES
+
+//BEGIN INSTRUCTIONS
+
+//All variables are declared up front, the gotos would otherwise jump over their declarations
+bool OpenCLCEmitter::declareValues() {
+    for (inst_iterator I = inst_begin(kernel), E = inst_end(kernel); I != E; ++I) {
+        Instruction *inst = &*I;
+
+        if (auto allocaInst = dyn_cast < AllocaInst > (inst)) {
+            uint64_t numElements;
+            auto arraySize = dyn_cast < ConstantInt > (allocaInst->getArraySize());
+            if (!arraySize || !getNumScalarElements(allocaInst->getAllocatedType(), numElements))
+                return fail("unsupported alloca");
+            declarations << "    " << getTypeName(getScalarElementType(allocaInst->getAllocatedType()), NULL) << " " << getValueName(inst) << "[" << numElements * arraySize->getZExtValue() << "];\n";
+            continue;
+        }
+
+        if (inst->getType()->isVoidTy())
+            continue;
+
+        std::string type = getTypeName(inst->getType(), inst);
+        if (type.empty())
+            return fail(std::string("unsupported type of ") + inst->getOpcodeName() + " instruction");
+
+        unsigned int numCopies = blockedValues.count(inst) ? blockFactor : 1;
+        for (blockCopy = 0; blockCopy < numCopies; blockCopy++) {
+            declarations << "    " << type << " " << getValueName(inst) << getCopySuffix(inst) << ";\n";
+            if (isa < PHINode > (inst))
+                declarations << "    " << type << " " << getValueName(inst) << getCopySuffix(inst) << "_in;\n";
+        }
+        blockCopy = 0;
+    }
+    return true;
+}
+
+bool OpenCLCEmitter::emitBlock(llvm::BasicBlock * block) {
+    if (block != &kernel->getEntryBlock())
+        body << getBlockLabel(block) << ":\n";
+
+    for (BasicBlock::iterator I = block->begin(); I != block->end(); I++) {
+        if (auto phi = dyn_cast < PHINode > (&*I)) {
+            unsigned int numCopies = blockedValues.count(phi) ? blockFactor : 1;
+            for (blockCopy = 0; blockCopy < numCopies; blockCopy++) {
+                body << "    " << getValueName(phi) << getCopySuffix(phi) << " = " << getValueName(phi) << getCopySuffix(phi) << "_in;\n";
+            }
+            blockCopy = 0;
+            continue;
+        }
+        if (!emitInstruction(&*I))
+            return false;
+    }
+    return true;
+}
+
+bool OpenCLCEmitter::emitInstruction(llvm::Instruction * inst) {
+    if (vectorAccesses.count(inst))
+        return emitVectorAccess(inst);
+    if (!isBlocked(inst))
+        return emitInstructionCopy(inst);
+
+    for (blockCopy = 0; blockCopy < blockFactor && error.empty(); blockCopy++) {
+        emitInstructionCopy(inst);
+    }
+    blockCopy = 0;
+    return error.empty();
+}
+
+bool OpenCLCEmitter::emitInstructionCopy(llvm::Instruction * inst) {
+    std::string expression;
+
+    if (isa < AllocaInst > (inst))
+        return true;
+
+    if (auto terminator = dyn_cast < TerminatorInst > (inst))
+        return emitTerminator(terminator);
+
+    //The load and combination of a scatter update are part of its atomic
+    if (scatterUpdates.count(inst))
+        return true;
+
+    if (auto storeInst = dyn_cast < StoreInst > (inst)) {
+        if (scatterStores.count(storeInst)) {
+            static const char *atomics[] = { "atomic_add", "", "", "", "", "atomic_min", "atomic_max" };
+            std::string pointer = getOperand(storeInst->getPointerOperand());
+            if (scatter.localSize > 0)
+                pointer = "htrop_bins + (" + pointer + " - " + getValueName(scatter.array) + ")";
+            body << "    " << atomics[scatter.scatterOperator] << "(" << pointer << ", " << getOperand(scatterStores[storeInst]) << ");\n";
+            return error.empty();
+        }
+        if (reductionStores.count(storeInst)) {
+            body << "    htrop_acc = " << getOperand(storeInst->getValueOperand()) << ";\n";
+            body << "    htrop_acc_index = " << getOperand(storeInst->getPointerOperand()) << " - " << getValueName(reduction.accumulator) << ";\n";
+            return error.empty();
+        }
+        body << "    " << (blockCopy > 0 ? "if " + getCopyValid() + " " : "");
+        body << "*" << getOperand(storeInst->getPointerOperand()) << " = " << getOperand(storeInst->getValueOperand()) << ";\n";
+        return error.empty();
+    }
+
+    if (auto loadInst = dyn_cast < LoadInst > (inst)) {
+        if (reductionLoads.count(loadInst))
+            expression = "htrop_acc";
+        else if (imageArgs.count(getPointerBase(loadInst->getPointerOperand())))
+            expression = getImageLoad(loadInst, getPointerBase(loadInst->getPointerOperand()));
+        else if (!getTiledLoad(loadInst, expression))
+            expression = "*" + getOperand(loadInst->getPointerOperand());
+        if (blockCopy > 0)
+            expression = "(" + getCopyValid() + " ? " + expression + " : 0)";
+    }
+    else if (auto binOp = dyn_cast < BinaryOperator > (inst)) {
+        if (!emitBinaryOperator(binOp, expression))
+            return false;
+    }
+    else if (auto cmpInst = dyn_cast < CmpInst > (inst)) {
+        if (!emitCmp(cmpInst, expression))
+            return false;
+    }
+    else if (auto castInst = dyn_cast < CastInst > (inst)) {
+        if (!emitCast(castInst, expression))
+            return false;
+    }
+    else if (auto gepInst = dyn_cast < GetElementPtrInst > (inst)) {
+        if (!emitGetElementPtr(gepInst, expression))
+            return false;
+    }
+    else if (auto selectInst = dyn_cast < SelectInst > (inst)) {
+        if (selectInst->getCondition()->getType()->isVectorTy())
+            return fail("vector select");
+        expression = "(" + getOperand(selectInst->getCondition()) + " ? " + getOperand(selectInst->getTrueValue()) + " : " + getOperand(selectInst->getFalseValue()) + ")";
+    }
+    else if (auto callInst = dyn_cast < CallInst > (inst)) {
+        if (!emitCall(callInst, expression))
+            return false;
+        if (expression.empty())
+            return true;        //Dropped intrinsic
+        if (inst->getType()->isVoidTy()) {
+            body << "    " << expression << ";\n";
+            return error.empty();
+        }
+    }
+    else {
+        return fail(std::string("unsupported instruction ") + inst->getOpcodeName());
+    }
+
+    body << "    " << getValueName(inst) << getCopySuffix(inst) << " = " << expression << ";\n";
+    return error.empty();
+}
+
+bool OpenCLCEmitter::emitBinaryOperator(llvm::BinaryOperator * binOp, std::string & expression) {
+    if (binOp->getType()->isVectorTy())
+        return fail("vector operation");
+
+    std::string a = getOperand(binOp->getOperand(0));
+    std::string b = getOperand(binOp->getOperand(1));
+    std::string type = getTypeName(binOp->getType(), NULL);
+    std::string unsignedType = getUnsignedTypeName(binOp->getType());
+
+    switch (binOp->getOpcode()) {
+    case Instruction::Add:
+    case Instruction::FAdd:
+        expression = "(" + a + " + " + b + ")";
+        break;
+    case Instruction::Sub:
+    case Instruction::FSub:
+        expression = "(" + a + " - " + b + ")";
+        break;
+    case Instruction::Mul:
+    case Instruction::FMul:
+        expression = "(" + a + " * " + b + ")";
+        break;
+    case Instruction::SDiv:
+    case Instruction::FDiv:
+        expression = "(" + a + " / " + b + ")";
+        break;
+    case Instruction::SRem:
+        expression = "(" + a + " % " + b + ")";
+        break;
+    case Instruction::FRem:
+        expression = "fmod(" + a + ", " + b + ")";
+        break;
+    case Instruction::UDiv:
+        expression = "((" + type + ")((" + unsignedType + ")" + a + " / (" + unsignedType + ")" + b + "))";
+        break;
+    case Instruction::URem:
+        expression = "((" + type + ")((" + unsignedType + ")" + a + " % (" + unsignedType + ")" + b + "))";
+        break;
+    case Instruction::Shl:
+        expression = "(" + a + " << " + b + ")";
+        break;
+    case Instruction::AShr:
+        expression = "(" + a + " >> " + b + ")";
+        break;
+    case Instruction::LShr:
+        expression = "((" + type + ")((" + unsignedType + ")" + a + " >> " + b + "))";
+        break;
+    case Instruction::And:
+        expression = "(" + a + " & " + b + ")";
+        break;
+    case Instruction::Or:
+        expression = "(" + a + " | " + b + ")";
+        break;
+    case Instruction::Xor:
+        expression = "(" + a + " ^ " + b + ")";
+        break;
+    default:
+        return fail(std::string("unsupported binary operator ") + binOp->getOpcodeName());
+    }
+    return true;
+}
+
+bool OpenCLCEmitter::emitCmp(llvm::CmpInst * cmpInst, std::string & expression) {
+    if (cmpInst->getType()->isVectorTy())
+        return fail("vector compare");
+
+    std::string a = getOperand(cmpInst->getOperand(0));
+    std::string b = getOperand(cmpInst->getOperand(1));
+
+    if (cmpInst->isIntPredicate() && cmpInst->isUnsigned() && !cmpInst->getOperand(0)->getType()->isPointerTy()) {
+        std::string unsignedType = getUnsignedTypeName(cmpInst->getOperand(0)->getType());
+        a = "(" + unsignedType + ")" + a;
+        b = "(" + unsignedType + ")" + b;
+    }
+
+    switch (cmpInst->getPredicate()) {
+    case CmpInst::ICMP_EQ:
+    case CmpInst::FCMP_OEQ:
+        expression = "(" + a + " == " + b + ")";
+        break;
+    case CmpInst::ICMP_NE:
+    case CmpInst::FCMP_UNE:
+        expression = "(" + a + " != " + b + ")";
+        break;
+    case CmpInst::ICMP_SGT:
+    case CmpInst::ICMP_UGT:
+    case CmpInst::FCMP_OGT:
+        expression = "(" + a + " > " + b + ")";
+        break;
+    case CmpInst::ICMP_SGE:
+    case CmpInst::ICMP_UGE:
+    case CmpInst::FCMP_OGE:
+        expression = "(" + a + " >= " + b + ")";
+        break;
+    case CmpInst::ICMP_SLT:
+    case CmpInst::ICMP_ULT:
+    case CmpInst::FCMP_OLT:
+        expression = "(" + a + " < " + b + ")";
+        break;
+    case CmpInst::ICMP_SLE:
+    case CmpInst::ICMP_ULE:
+    case CmpInst::FCMP_OLE:
+        expression = "(" + a + " <= " + b + ")";
+        break;
+    case CmpInst::FCMP_ONE:
+        expression = "(" + a + " < " + b + " || " + a + " > " + b + ")";
+        break;
+    case CmpInst::FCMP_UEQ:
+        expression = "!(" + a + " < " + b + " || " + a + " > " + b + ")";
+        break;
+    case CmpInst::FCMP_UGT:
+        expression = "!(" + a + " <= " + b + ")";
+        break;
+    case CmpInst::FCMP_UGE:
+        expression = "!(" + a + " < " + b + ")";
+        break;
+    case CmpInst::FCMP_ULT:
+        expression = "!(" + a + " >= " + b + ")";
+        break;
+    case CmpInst::FCMP_ULE:
+        expression = "!(" + a + " > " + b + ")";
+        break;
+    case CmpInst::FCMP_ORD:
+        expression = "(!isnan(" + a + ") && !isnan(" + b + "))";
+        break;
+    case CmpInst::FCMP_UNO:
+        expression = "(isnan(" + a + ") || isnan(" + b + "))";
+        break;
+    case CmpInst::FCMP_TRUE:
+        expression = "true";
+        break;
+    case CmpInst::FCMP_FALSE:
+        expression = "false";
+        break;
+    default:
+        return fail("unsupported compare predicate");
+    }
+    return true;
+}
+
+bool OpenCLCEmitter::emitCast(llvm::CastInst * castInst, std::string & expression) {
+    llvm::Type * srcType = castInst->getSrcTy();
+    llvm::Type * dstType = castInst->getDestTy();
+    if (srcType->isVectorTy() || dstType->isVectorTy())
+        return fail("vector cast");
+
+    std::string a = getOperand(castInst->getOperand(0));
+    std::string type = getTypeName(dstType, castInst);
+
+    switch (castInst->getOpcode()) {
+    case Instruction::Trunc:
+        if (dstType->isIntegerTy(1))
+            expression = "((" + a + " & 1) != 0)";
+        else
+            expression = "((" + type + ")" + a + ")";
+        break;
+    case Instruction::ZExt:
+        if (srcType->isIntegerTy(1))
+            expression = "((" + type + ")" + a + ")";
+        else
+            expression = "((" + type + ")(" + getUnsignedTypeName(srcType) + ")" + a + ")";
+        break;
+    case Instruction::SExt:
+        if (srcType->isIntegerTy(1))
+            expression = "(" + a + " ? (" + type + ")-1 : (" + type + ")0)";
+        else
+            expression = "((" + type + ")" + a + ")";
+        break;
+    case Instruction::FPToSI:
+    case Instruction::SIToFP:
+    case Instruction::FPTrunc:
+    case Instruction::FPExt:
+        expression = "((" + type + ")" + a + ")";
+        break;
+    case Instruction::FPToUI:
+        expression = "((" + type + ")(" + getUnsignedTypeName(dstType) + ")" + a + ")";
+        break;
+    case Instruction::UIToFP:
+        expression = "((" + type + ")(" + getUnsignedTypeName(srcType) + ")" + a + ")";
+        break;
+    case Instruction::BitCast:
+        if (srcType->isPointerTy() && dstType->isPointerTy()) {
+            if (getScalarElementType(srcType) == getScalarElementType(dstType))
+                expression = a;
+            else
+                expression = "((" + type + ")" + a + ")";
+        }
+        else {
+            expression = "as_" + type + "(" + a + ")";
+        }
+        break;
+    default:
+        return fail(std::string("unsupported cast ") + castInst->getOpcodeName());
+    }
+    return true;
+}
+
+//Arrays are flattened, the offset is counted in scalar elements of the base pointer
+bool OpenCLCEmitter::emitGetElementPtr(llvm::GetElementPtrInst * gepInst, std::string & expression) {
+    if (gepInst->getType()->isVectorTy())
+        return fail("vector getelementptr");
+
+    llvm::Type * indexedType = gepInst->getPointerOperandType()->getPointerElementType();
+    std::vector < std::string > terms;
+    int64_t constOffset = 0;
+
+    for (unsigned int i = 1; i < gepInst->getNumOperands(); i++) {
+        if (i > 1) {
+            if (!indexedType->isArrayTy())
+                return fail("getelementptr into a non-array type");
+            indexedType = indexedType->getArrayElementType();
+        }
+
+        uint64_t numElements;
+        if (!getNumScalarElements(indexedType, numElements))
+            return fail("getelementptr into an unsupported type");
+
+        //The first index of a pitched array steps whole rows
+        Value *index = gepInst->getOperand(i);
+        const llvm::Value * base = i == 1 && indexedType->isArrayTy()? getPointerBase(gepInst->getPointerOperand()) : NULL;
+        if (base != NULL && pitchedArgs.count(base)) {
+            std::string pitch = "htrop_pitch_" + getValueName(base);
+            if (!isa < ConstantInt > (index))
+                terms.push_back(getOperand(index) + " * " + pitch);
+            else if (!cast < ConstantInt > (index)->isZero())
+                terms.push_back(std::to_string(cast < ConstantInt > (index)->getSExtValue()) + "L * " + pitch);
+            continue;
+        }
+
+        if (auto constIndex = dyn_cast < ConstantInt > (index)) {
+            constOffset += constIndex->getSExtValue() * (int64_t) numElements;
+        }
+        else if (numElements == 1) {
+            terms.push_back(getOperand(index));
+        }
+        else {
+            terms.push_back(getOperand(index) + " * " + std::to_string(numElements));
+        }
+    }
+    if (constOffset != 0)
+        terms.push_back(std::to_string(constOffset));
+
+    expression = getOperand(gepInst->getPointerOperand());
+    if (terms.empty())
+        return true;
+
+    expression = "(" + expression + " + ";
+    if (terms.size() > 1)
+        expression += "(";
+    for (unsigned int i = 0; i < terms.size(); i++) {
+        expression += (i > 0 ? " + " : "") + terms[i];
+    }
+    if (terms.size() > 1)
+        expression += ")";
+    expression += ")";
+    return true;
+}
+
+bool OpenCLCEmitter::emitCall(llvm::CallInst * callInst, std::string & expression) {
+    llvm::Function * callee = callInst->getCalledFunction();
+    if (callee == NULL)
+        return fail("indirect call");
+
+    std::string name = callee->getName().str();
+    if (isa < DbgInfoIntrinsic > (callInst) || name.find("llvm.lifetime.") == 0 || name.find("llvm.invariant.") == 0 || name == "llvm.assume") {
+        expression = "";
+        return true;
+    }
+
+    std::string builtin = name;
+    if (!isWorkItemFunction(name) && !getOpenCLBuiltin(name, builtin))
+        return fail("call to " + name);
+
+    if (callInst == blockedGlobalId) {
+        expression = "(get_global_id(" + std::to_string(blockDimension) + ") * " + std::to_string(blockFactor) + " + " + std::to_string(blockCopy) + ")";
+        return true;
+    }
+    if (coarsenFactor > 1 && name == "get_global_id") {
+        auto dimension = dyn_cast < ConstantInt > (callInst->getArgOperand(0));
+        if (dimension == NULL)
+            return fail("get_global_id of a variable dimension");
+        if (dimension->getZExtValue() == coarsenDimension) {
+            expression = getCoarsenedGlobalId();
+            return true;
+        }
+    }
+
+    expression = builtin + "(";
+    for (unsigned int i = 0; i < callInst->getNumArgOperands(); i++) {
+        expression += (i > 0 ? ", " : "") + getOperand(callInst->getArgOperand(i));
+    }
+    expression += ")";
+    return true;
+}
+
+//Assign the phis of the successor, then jump
+std::string OpenCLCEmitter::getJump(const llvm::BasicBlock * from, const llvm::BasicBlock * to) {
+    std::string jump = "";
+    for (BasicBlock::const_iterator I = to->begin(); I != to->end(); I++) {
+        const PHINode *phi = dyn_cast < PHINode > (&*I);
+        if (!phi)
+            break;
+        unsigned int numCopies = blockedValues.count(phi) ? blockFactor : 1;
+        for (blockCopy = 0; blockCopy < numCopies; blockCopy++) {
+            jump += getValueName(phi) + getCopySuffix(phi) + "_in = " + getOperand(phi->getIncomingValueForBlock(from)) + "; ";
+        }
+        blockCopy = 0;
+    }
+    return jump + "goto " + getBlockLabel(to) + ";";
+}
+
+bool OpenCLCEmitter::emitTerminator(llvm::TerminatorInst * terminator) {
+    llvm::BasicBlock * block = terminator->getParent();
+
+    if (isa < ReturnInst > (terminator) || isa < UnreachableInst > (terminator)) {
+        body << "    " << getReturn() << "\n";
+    }
+    else if (auto branchInst = dyn_cast < BranchInst > (terminator)) {
+        if (branchInst->isUnconditional()) {
+            body << "    " << getJump(block, branchInst->getSuccessor(0)) << "\n";
+        }
+        else {
+            body << "    if (" << getOperand(branchInst->getCondition()) << ") { " << getJump(block, branchInst->getSuccessor(0)) << " }\n";
+            body << "    else { " << getJump(block, branchInst->getSuccessor(1)) << " }\n";
+        }
+    }
+    else if (auto switchInst = dyn_cast < SwitchInst > (terminator)) {
+        body << "    switch (" << getOperand(switchInst->getCondition()) << ") {\n";
+        for (auto caseIt = switchInst->case_begin(); caseIt != switchInst->case_end(); ++caseIt) {
+            body << "    case " << getConstant(caseIt.getCaseValue()) << ": { " << getJump(block, caseIt.getCaseSuccessor()) << " }\n";
+        }
+        body << "    default: { " << getJump(block, switchInst->getDefaultDest()) << " }\n";
+        body << "    }\n";
+    }
+    else {
+        return fail(std::string("unsupported terminator ") + terminator->getOpcodeName());
+    }
+    return error.empty();
+}
+
+//END INSTRUCTIONS
@@ -0,0 +1,274 @@
+//    Copyright (c) 2019 University of Paderborn
+//                         (Gavin Vaz <gavin.vaz@uni-paderborn.de>,
+//                          Heinrich Riebler <heinrich.riebler@uni-paderborn.de>)
+
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+
+//    The above copyright notice and this permission notice shall be included in
+//    all copies or substantial portions of the Software.
+
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//    THE SOFTWARE.
+
+#ifndef OPENCLCEMITTER_H
+#define OPENCLCEMITTER_H
+
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Instructions.h"
+
+#include "../common/dataTransferType.h"
+
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//A read-only array of a 2D stencil loaded through a tile in local memory. The load at work-item
+//(x, y) with displacement (dx, dy) reads element stride[0] * (x + dx) + stride[1] * (y + dy) + offset.
+struct LocalTile {
+    llvm::Argument * array = NULL;
+    int64_t stride[2] = { 0, 0 };
+    int64_t offset = 0;
+    int64_t haloMin[2] = { 0, 0 };
+    int64_t haloMax[2] = { 0, 0 };
+    //Smallest and largest constant part of the loaded elements, they bound the elements read by the valid work-items
+    int64_t minOffset = 0;
+    int64_t maxOffset = 0;
+     std::map < const llvm::LoadInst *, std::pair < int64_t, int64_t > >loads;
+
+    unsigned int getWidth(unsigned int tileSize) const {
+        return tileSize + haloMax[0] - haloMin[0];
+    }
+    unsigned int getHeight(unsigned int tileSize) const {
+        return tileSize + haloMax[1] - haloMin[1];
+    }
+};
+
+//Local-memory tiling of a kernel with two parallelized dimensions, the work-group is tileSize x tileSize
+struct LocalTiling {
+    unsigned int tileSize = 0;
+    //Per dimension: first iteration and position of the kernel argument holding the iteration count
+    int64_t start[2] = { 0, 0 };
+    unsigned int boundArg[2] = { 0, 0 };
+     std::vector < LocalTile > tiles;
+
+    bool isEnabled() const {
+        return tileSize > 0 && !tiles.empty();
+    }
+};
+
+//Parallel reduction acc[x] = acc[x] op value over one NDRange dimension. Each work-item combines its iterations
+//in a private accumulator, the work-group combines them in local memory and writes one partial result.
+//The address x must be the same for all iterations of a work-item and may not depend on the reduction dimension.
+struct Reduction {
+    llvm::Argument * accumulator = NULL;
+    ReductionOperator reductionOperator = RED_ADD;
+    unsigned int dimension = 0;
+    unsigned int groupSize = 0; //Power of two, the work-group is groupSize in the reduction dimension and 1 in the others
+    int boundArg = -1;          //Kernel argument holding the iteration count of the reduction dimension, -1 if the loop guards it
+
+    bool isEnabled() const {
+        return accumulator != NULL && groupSize > 0;
+    }
+};
+
+//Commutative updates array[x] = array[x] op value of 32-bit integers with a data-dependent address x (histograms).
+//They become atomic_add, atomic_min or atomic_max. With localSize > 0 (the number of elements of the array) each
+//work-group updates a copy in local memory and merges it into the array at its end.
+struct Scatter {
+    llvm::Argument * array = NULL;
+    ReductionOperator scatterOperator = RED_ADD;
+    unsigned int localSize = 0;
+
+    bool isEnabled() const {
+        return array != NULL;
+    }
+};
+
+//Read-only (IN) arrays of the kernel. The constant arrays have a size known at compile time, they are __constant
+//on devices whose constant buffer holds constantSize bytes (HTROP_CONSTANT_SIZE of the runtime) and __global on the others.
+//The image arrays (float or char) are image2d_t, element i is read at (i % width, i / width) of the image.
+struct ReadOnlyArgs {
+     std::set < unsigned int >constantArgs;
+    uint64_t constantSize = 0;
+     std::map < unsigned int, int >imageArgs;  //Position -> argument holding the row width, -1 if unknown
+};
+
+//Emits OpenCL C for a kernel function after the get_global_id rewrite of the OpenCLCBackend.
+//Every basic block becomes a label, phis are assigned in the predecessors and all arrays
+//are flattened to pointers of their scalar element type. The pointer arguments are emitted
+//as __global restrict, the scop analysis already made sure that they do not alias.
+class OpenCLCEmitter {
+
+ public:
+    OpenCLCEmitter(llvm::Function * kernel);
+
+    //Load the arrays of the tiling from local memory, the kernel then requires a tileSize x tileSize work-group
+    void setLocalTiling(const LocalTiling & tiling);
+
+    //Register blocking (unroll-and-jam): each work-item computes factor consecutive iterations of dimension,
+    //the global size of the dimension has to be divided by factor (rounded up). boundArg holds the iteration count,
+    //the bound guard of the loop mapping tests the first copy.
+    void setRegisterBlock(unsigned int dimension, unsigned int factor, unsigned int boundArg);
+
+    //Each work-item handles width consecutive iterations of dimension 0 like a register block, the unit-stride
+    //accesses are combined to vloadN/vstoreN. The last work-item falls back to scalar accesses.
+    void setVectorWidth(unsigned int width, unsigned int boundArg);
+
+    //Thread coarsening: the body runs factor times per work-item, the global size of dimension has to be divided by
+    //factor (rounded up). Iteration c of a work-item is get_global_id(dimension) * factor + c, or with strided
+    //get_global_id(dimension) + c * get_global_size(dimension) so that neighbouring work-items stay adjacent.
+    //A boundArg of -1 leaves the iterations beyond the trip count to the guard of the loop mapping.
+    void setCoarsening(unsigned int dimension, unsigned int factor, int boundArg, bool strided);
+
+    //Combine the reduction per work-group, the kernel gets two more arguments for the partial results
+    //and the accumulator index of each work-group (-1 if the work-group did not store).
+    void setReduction(const Reduction & reduction);
+
+    //Make the scatter updates of the array atomic
+    void setScatter(const Scatter & scatter);
+
+    //Place the read-only arrays in constant or image memory, the pointers into an image become element offsets
+    void setReadOnlyArgs(const ReadOnlyArgs & readOnlyArgs);
+
+    //Integer arguments take the value of HTROP_SPEC_<kernel>_<position> if the runtime defines it for a specialized program
+    void setSpecializedArgs(bool specializeArgs);
+
+    //The rows of these arrays ([width x scalar] arguments) start every htrop_pitch_<name> elements, the width rounded up
+    //to HTROP_ROW_ALIGN bytes of the runtime. The arrays may only be accessed through getelementptr.
+    void setPitchedArgs(const std::set < unsigned int >&pitchedArgs);
+
+    //64-bit integers (indices, loop counters, long arguments) become int, the runtime only runs the kernel if all of them fit.
+    //The kernel may not load, store or call with 64-bit integers.
+    void setNarrowIndices(bool narrowIndices);
+
+    //Returns false if the kernel uses a construct the emitter does not support, see getError()
+    bool emit(std::string & kernelCode);
+     std::string getError();
+
+ private:
+     llvm::Function * kernel;
+     std::string error;
+    LocalTiling tiling;
+
+    unsigned int blockDimension = 0;
+    unsigned int blockFactor = 1;
+    unsigned int blockBoundArg = 0;
+     std::set < const llvm::Value * >blockedValues; //Values that differ between the copies of a work-item
+    llvm::Value * blockedGlobalId = NULL;
+    unsigned int blockCopy = 0; //Copy that is emitted, copy 0 keeps the plain names
+    bool vectorize = false;
+     std::set < const llvm::Instruction * >vectorAccesses;
+    unsigned int nextVectorId = 0;
+
+    unsigned int coarsenDimension = 0;
+    unsigned int coarsenFactor = 1;
+    int coarsenBoundArg = -1;
+    bool coarsenStrided = false;
+
+    Reduction reduction;
+     std::set < const llvm::Instruction * >reductionLoads;
+     std::set < const llvm::Instruction * >reductionStores;
+
+    Scatter scatter;
+     std::set < const llvm::Instruction * >scatterUpdates;      //Loads and combinations inside the atomics
+     std::map < const llvm::Instruction *, llvm::Value * >scatterStores;       //Store -> combined value
+
+     std::set < const llvm::Value * >constantArgs;
+    uint64_t constantSize = 0;
+     std::set < const llvm::Value * >imageArgs;
+
+    bool specializeArgs = false;
+
+     std::set < const llvm::Value * >pitchedArgs;
+
+    bool narrowIndices = false;
+
+     std::map < const llvm::Value *, std::string > valueNames;
+     std::map < const llvm::BasicBlock *, std::string > blockLabels;
+    unsigned int nextValueId = 0;
+
+     std::ostringstream declarations;
+     std::ostringstream body;
+
+    bool fail(std::string reason);
+
+    //Local-memory tiling
+     std::string getArgName(unsigned int argPos);
+    void emitTileLoads();
+    bool getTiledLoad(llvm::LoadInst * loadInst, std::string & expression);
+
+    //Register blocking
+    bool findBlockedValues();
+    bool isBlocked(const llvm::Instruction * inst);
+    bool isBoundGuard(const llvm::BranchInst * branchInst);
+     std::string getCopySuffix(const llvm::Value * value);
+     std::string getCopyValid();
+    bool emitVectorAccess(llvm::Instruction * inst);
+
+    //Thread coarsening
+     std::string getCoarsenedGlobalId();
+
+    //Reduction
+    bool findReductionAccesses();
+    bool isWorkItemInvariant(const llvm::Value * value);
+    void emitReductionStart();
+    void emitReductionEnd();
+     std::string getReductionIdentity();
+     std::string getReturn();
+
+    //Scatter updates
+    bool findScatterAccesses();
+     std::string getScatterIdentity();
+    void emitScatterStart();
+    void emitScatterEnd();
+
+    //Read-only arrays
+     std::string getConstantQualifier();
+    bool checkImageAccesses();
+     std::string getImageLoad(llvm::LoadInst * loadInst, const llvm::Value * image);
+
+    //Pitched arrays
+    void declareRowPitches();
+
+    //Types
+     llvm::Type * getScalarElementType(llvm::Type * type);
+    bool getNumScalarElements(llvm::Type * type, uint64_t & numElements);
+     std::string getTypeName(llvm::Type * type, const llvm::Value * pointer);
+     std::string getUnsignedTypeName(llvm::Type * type);
+     std::string getAddressSpace(const llvm::Value * pointer);
+     const llvm::Value * getPointerBase(const llvm::Value * pointer);
+     const llvm::Value * getPointerBase(const llvm::Value * pointer, std::set < const llvm::Value * >&visited);
+
+    //Values
+     std::string getValueName(const llvm::Value * value);
+     std::string getOperand(llvm::Value * value);
+     std::string getConstant(llvm::Constant * constant);
+     std::string getBlockLabel(const llvm::BasicBlock * block);
+
+    //Instructions
+    bool declareValues();
+    bool emitBlock(llvm::BasicBlock * block);
+    bool emitInstruction(llvm::Instruction * inst);
+    bool emitInstructionCopy(llvm::Instruction * inst);
+    bool emitBinaryOperator(llvm::BinaryOperator * binOp, std::string & expression);
+    bool emitCmp(llvm::CmpInst * cmpInst, std::string & expression);
+    bool emitCast(llvm::CastInst * castInst, std::string & expression);
+    bool emitGetElementPtr(llvm::GetElementPtrInst * gepInst, std::string & expression);
+    bool emitCall(llvm::CallInst * callInst, std::string & expression);
+    bool emitTerminator(llvm::TerminatorInst * terminator);
+     std::string getJump(const llvm::BasicBlock * from, const llvm::BasicBlock * to);
+};
+
+#endif                          // OPENCLCEMITTER_H
@@ -0,0 +1,82 @@
+//    Copyright (c) 2019 University of Paderborn 
+//                         (Gavin Vaz <gavin.vaz@uni-paderborn.de>,
+//                          Heinrich Riebler <heinrich.riebler@uni-paderborn.de>)
+
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+
+//    The above copyright notice and this permission notice shall be included in
+//    all copies or substantial portions of the Software.
+
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//    THE SOFTWARE.
+
+
+#include "../openCLCbackend.h"
+
+#include "gtest/gtest.h"
+
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+//The defaults keep the cache keys of servers without options
+TEST(CodeGenOptions, DefaultFingerprintIsEmpty) {
+    EXPECT_EQ(CodeGenOptions().getFingerprint(), "");
+}
+
+//An option missing in getFingerprint would let kernels of other options hit the cache
+TEST(CodeGenOptions, EveryOptionChangesFingerprint) {
+    std::vector < std::function < void (CodeGenOptions &) > >changes = {
+        [](CodeGenOptions & options) { options.oclEmitter = "direct"; },
+        [](CodeGenOptions & options) { options.localTileSize = 16; },
+        [](CodeGenOptions & options) { options.registerBlock = { 2, 4, 2 }; },
+        [](CodeGenOptions & options) { options.vectorWidth = { 16, 4, 16 }; },
+        [](CodeGenOptions & options) { options.coarsening = { 8, 2, 8 }; },
+        [](CodeGenOptions & options) { options.reductionGroupSize = 256; },
+        [](CodeGenOptions & options) { options.readOnlyMemory = true; },
+        [](CodeGenOptions & options) { options.kernelVariants = true; },
+        [](CodeGenOptions & options) { options.variantCoarsening = { 4, 4, 4 }; },
+        [](CodeGenOptions & options) { options.variantTileSize = 8; },
+        [](CodeGenOptions & options) { options.smallSizeThreshold = 4096; },
+        [](CodeGenOptions & options) { options.specializeArgs = true; },
+        [](CodeGenOptions & options) { options.pitchedBuffers = true; },
+        [](CodeGenOptions & options) { options.index32Versions = true; },
+        [](CodeGenOptions & options) { options.wavefront = true; },
+        [](CodeGenOptions & options) { options.loopDistribution = true; },
+        [](CodeGenOptions & options) { options.indexSetSplitting = true; },
+        [](CodeGenOptions & options) { options.scatterLocalBins = 256; },
+    };
+
+    std::set < std::string > fingerprints;
+    for (auto & change:changes) {
+        CodeGenOptions options;
+        change(options);
+        std::string fingerprint = options.getFingerprint();
+        EXPECT_NE(fingerprint, "");
+        EXPECT_TRUE(fingerprints.insert(fingerprint).second) << fingerprint;
+    }
+}
+
+//Two values of the same option get different cache entries
+TEST(CodeGenOptions, OptionValuesChangeFingerprint) {
+    CodeGenOptions small, large;
+    small.coarsening = { 2, 2, 2 };
+    large.coarsening = { 8, 2, 8 };
+    EXPECT_NE(small.getFingerprint(), large.getFingerprint());
+    EXPECT_EQ(large.getFingerprint(), "coarsen=8,2,8");
+
+    CodeGenOptions combined = large;
+    combined.readOnlyMemory = true;
+    EXPECT_EQ(combined.getFingerprint(), "coarsen=8,2,8;readonly");
+}
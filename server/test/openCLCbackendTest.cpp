@@ -0,0 +1,171 @@
+//    Copyright (c) 2019 University of Paderborn 
+//                         (Gavin Vaz <gavin.vaz@uni-paderborn.de>,
+//                          Heinrich Riebler <heinrich.riebler@uni-paderborn.de>)
+
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+
+//    The above copyright notice and this permission notice shall be included in
+//    all copies or substantial portions of the Software.
+
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//    THE SOFTWARE.
+
+
+#include "../openCLCbackend.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/AsmParser/Parser.h"
+#include "llvm/Support/SourceMgr.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <fstream>
+#include <sstream>
+
+//OpenCL code of the scops of irCode, each with loopDepth parallelized loops of which the outer tripCounts have a trip count of the client
+static std::string generateKernels(const std::string & irCode, const std::vector < std::string > &scops, unsigned int loopDepth, unsigned int tripCounts,
+                                   CodeGenOptions codeGenOptions, HTROP_PB::Message_RSRC & codeGenMsgFromServer) {
+    llvm::LLVMContext context;
+    llvm::SMDiagnostic error;
+    std::unique_ptr < llvm::Module > module = llvm::parseAssemblyString(irCode, error, context);
+    if (!module) {
+        error.print("openCLCbackendTest", llvm::errs());
+        return "";
+    }
+
+    HTROP_PB::Message_RCRS codeGenMsgFromClient;
+    for (auto & scop:scops) {
+        HTROP_PB::Message_RCRS::ScopInfo * scopInfo = codeGenMsgFromClient.add_scoplist();
+        scopInfo->set_scopfunctionname(scop);
+        scopInfo->set_max_codegen_loop_depth(loopDepth);
+        scopInfo->set_num_loop_trip_counts(tripCounts);
+    }
+
+    std::string oclFile = "openCLCbackendTest.cl";
+    llvm::Module * mod = module.get();
+    OpenCLCBackend backend(mod, &codeGenMsgFromClient, &codeGenMsgFromServer, oclFile, codeGenOptions);
+
+    std::ifstream oclStream(oclFile.c_str());
+    std::stringstream oclCode;
+    oclCode << oclStream.rdbuf();
+    return oclCode.str();
+}
+
+static CodeGenOptions directEmitter() {
+    CodeGenOptions codeGenOptions;
+    codeGenOptions.oclEmitter = "direct";
+    return codeGenOptions;
+}
+
+//for (i = 1; i + 1 != n - 1; i++), the exit compare of LFTR
+static const std::string neLatchedLoop = R"(
+define void @ne_loop(float* %a, i64 %n) {
+entry:
+  %bound = add i64 %n, -1
+  br label %loop
+loop:
+  %i = phi i64 [ 1, %entry ], [ %next, %loop ]
+  %p = getelementptr float, float* %a, i64 %i
+  %v = load float, float* %p
+  %w = fmul float %v, 2.0
+  store float %w, float* %p
+  %next = add nsw i64 %i, 1
+  %c = icmp ne i64 %next, %bound
+  br i1 %c, label %loop, label %exit
+exit:
+  ret void
+}
+
+define void @sgt_loop(float* %a, i64 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i64 [ 1, %entry ], [ %next, %loop ]
+  %p = getelementptr float, float* %a, i64 %i
+  store float 0.0, float* %p
+  %next = add nsw i64 %i, 1
+  %c = icmp sgt i64 %next, %n
+  br i1 %c, label %loop, label %exit
+exit:
+  ret void
+}
+)";
+
+//The work-items of the rounded up NDRange beyond n - 1 must not pass a guard iv != n - 1
+TEST(LoopMapping, NeLatchGetsOrderedGuard) {
+    HTROP_PB::Message_RSRC codeGenMsgFromServer;
+    std::string oclCode = generateKernels(neLatchedLoop, { "ne_loop" }, 1, 1, directEmitter(), codeGenMsgFromServer);
+
+    ASSERT_EQ(codeGenMsgFromServer.scopfunctions_size(), 1);
+    EXPECT_NE(oclCode.find("__kernel void ne_loop"), std::string::npos);
+    EXPECT_NE(oclCode.find(" < bound_"), std::string::npos);
+    EXPECT_EQ(oclCode.find("!="), std::string::npos);
+}
+
+//i > n with a positive step has no ordered bound, the client keeps the loop
+TEST(LoopMapping, UnorderedExitIsNotMapped) {
+    HTROP_PB::Message_RSRC codeGenMsgFromServer;
+    std::string oclCode = generateKernels(neLatchedLoop, { "sgt_loop" }, 1, 1, directEmitter(), codeGenMsgFromServer);
+
+    EXPECT_EQ(codeGenMsgFromServer.scopfunctions_size(), 0);
+    EXPECT_EQ(oclCode.find("__kernel void sgt_loop"), std::string::npos);
+}
+
+//A rotated stencil, the border tests share the loop header with the mapped induction variable
+static const std::string rotatedStencil = R"(
+define void @stencil(float* %a, float* %b, i64 %n) {
+entry:
+  %last = add nsw i64 %n, -1
+  br label %loop
+loop:
+  %i = phi i64 [ 0, %entry ], [ %next, %latch ]
+  %lo = icmp sgt i64 %i, 0
+  %hi = icmp slt i64 %i, %last
+  %inside = and i1 %lo, %hi
+  br i1 %inside, label %interior, label %latch
+interior:
+  %im1 = add nsw i64 %i, -1
+  %ip1 = add nsw i64 %i, 1
+  %pl = getelementptr float, float* %a, i64 %im1
+  %pr = getelementptr float, float* %a, i64 %ip1
+  %l = load float, float* %pl
+  %r = load float, float* %pr
+  %s = fadd float %l, %r
+  %pb = getelementptr float, float* %b, i64 %i
+  store float %s, float* %pb
+  br label %latch
+latch:
+  %next = add nsw i64 %i, 1
+  %c = icmp slt i64 %next, %n
+  br i1 %c, label %loop, label %exit
+exit:
+  ret void
+}
+)";
+
+//Only the guard of the loop mapping is kept, the border tests fold in the interior kernel
+TEST(IndexSetSplitting, RotatedStencilIsSplit) {
+    CodeGenOptions codeGenOptions = directEmitter();
+    codeGenOptions.indexSetSplitting = true;
+    HTROP_PB::Message_RSRC codeGenMsgFromServer;
+    std::string oclCode = generateKernels(rotatedStencil, { "stencil" }, 1, 1, codeGenOptions, codeGenMsgFromServer);
+
+    ASSERT_EQ(codeGenMsgFromServer.scopfunctions_size(), 1);
+    ASSERT_TRUE(codeGenMsgFromServer.scopfunctions(0).has_interior_kernel());
+    const HTROP_PB::Message_RSRC::ScopFunctionOCLInfo & interiorInfo = codeGenMsgFromServer.scopfunctions(0).interior_kernel();
+    ASSERT_EQ(interiorInfo.border_low_size(), 1);
+    EXPECT_EQ(interiorInfo.border_low(0), 1u);
+    EXPECT_EQ(interiorInfo.border_high(0), 1u);
+    EXPECT_NE(oclCode.find("__kernel void stencil"), std::string::npos);
+    EXPECT_NE(oclCode.find("__kernel void stencil_interior"), std::string::npos);
+}